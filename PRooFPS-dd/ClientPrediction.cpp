@@ -0,0 +1,135 @@
+/*
+    ###################################################################################
+    ClientPrediction.cpp
+    Client-side prediction of own player movement for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include "ClientPrediction.h"
+
+
+// ############################### PUBLIC ################################
+
+
+/**
+* Drops all recorded steps, e.g. when player is respawned or teleported and the previous predictions are not relevant anymore.
+*/
+void proofps_dd::ClientPrediction::reset()
+{
+    m_steps.clear();
+    m_runToggleCmdSeqs.clear();
+}
+
+/**
+* Records a locally simulated physics iteration.
+*
+* @param nCmdSeq Sequence number of the last MsgUserCmdFromClient sent before this step, 0 if none was sent yet.
+* @param fDeltaX Horizontal position change applied locally in this step.
+* @param fDeltaY Vertical position change applied locally in this step.
+*/
+void proofps_dd::ClientPrediction::addStep(const std::uint32_t& nCmdSeq, const float& fDeltaX, const float& fDeltaY)
+{
+    const std::uint32_t nIterationSinceCmd =
+        (!m_steps.empty() && (m_steps.back().m_nCmdSeq == nCmdSeq)) ?
+        (m_steps.back().m_nIterationSinceCmd + 1) :
+        0;
+    m_steps.push_back(Step{ nCmdSeq, nIterationSinceCmd, fDeltaX, fDeltaY });
+    if (m_steps.size() > nMaxUnackedSteps)
+    {
+        m_steps.pop_front();
+    }
+}
+
+/**
+* Records that the given sent cmd also carried a run mode toggle, which we have already applied locally.
+*
+* @param nCmdSeq Sequence number of the MsgUserCmdFromClient carrying the toggle.
+*/
+void proofps_dd::ClientPrediction::addRunToggle(const std::uint32_t& nCmdSeq)
+{
+    m_runToggleCmdSeqs.push_back(nCmdSeq);
+    if (m_runToggleCmdSeqs.size() > nMaxUnackedSteps)
+    {
+        m_runToggleCmdSeqs.pop_front();
+    }
+}
+
+/**
+* Drops the steps already included in the authoritative position, and the run toggles already included in the authoritative running state.
+*
+* @param nAckedCmdSeq             Last cmd sequence number processed by server, as received in MsgUserUpdateFromServer.
+* @param nIterationsSinceAckedCmd Number of physics iterations simulated by server after processing nAckedCmdSeq.
+* The position changes of the remaining steps are to be added to the authoritative position, see getUnackedDeltaX() and getUnackedDeltaY().
+*/
+void proofps_dd::ClientPrediction::reconcile(const std::uint32_t& nAckedCmdSeq, const std::uint32_t& nIterationsSinceAckedCmd)
+{
+    while (!m_steps.empty() &&
+        (isCmdSeqOlder(m_steps.front().m_nCmdSeq, nAckedCmdSeq) ||
+            ((m_steps.front().m_nCmdSeq == nAckedCmdSeq) && (m_steps.front().m_nIterationSinceCmd < nIterationsSinceAckedCmd))))
+    {
+        m_steps.pop_front();
+    }
+    while (!m_runToggleCmdSeqs.empty() && !isCmdSeqOlder(nAckedCmdSeq, m_runToggleCmdSeqs.front()))
+    {
+        m_runToggleCmdSeqs.pop_front();
+    }
+}
+
+float proofps_dd::ClientPrediction::getUnackedDeltaX() const
+{
+    float fDeltaX = 0.f;
+    for (const auto& step : m_steps)
+    {
+        fDeltaX += step.m_fDeltaX;
+    }
+    return fDeltaX;
+}
+
+float proofps_dd::ClientPrediction::getUnackedDeltaY() const
+{
+    float fDeltaY = 0.f;
+    for (const auto& step : m_steps)
+    {
+        fDeltaY += step.m_fDeltaY;
+    }
+    return fDeltaY;
+}
+
+size_t proofps_dd::ClientPrediction::getUnackedStepCount() const
+{
+    return m_steps.size();
+}
+
+size_t proofps_dd::ClientPrediction::getUnackedRunToggleCount() const
+{
+    return m_runToggleCmdSeqs.size();
+}
+
+/**
+* @param bAckedRunning Authoritative running state as received in MsgUserUpdateFromServer, reconcile() shall be invoked before this.
+*
+* @return The running state we should have locally: the authoritative one with our not yet acknowledged run toggles applied.
+*/
+bool proofps_dd::ClientPrediction::getPredictedRunning(const bool& bAckedRunning) const
+{
+    return bAckedRunning != ((m_runToggleCmdSeqs.size() % 2) == 1);
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
+
+
+/**
+* Wraparound-aware comparison.
+*/
+bool proofps_dd::ClientPrediction::isCmdSeqOlder(const std::uint32_t& nCmdSeq, const std::uint32_t& nCmdSeqOther)
+{
+    return static_cast<std::int32_t>(nCmdSeq - nCmdSeqOther) < 0;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+/*
+    ###################################################################################
+    ClientPrediction.h
+    Client-side prediction of own player movement for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace proofps_dd
+{
+
+    /**
+    * Bookkeeping of the movement steps a client has predicted locally for its own player, so they can be replayed
+    * on top of the authoritative position received from the server.
+    *
+    * Each physics iteration simulated by the client is recorded as a step with its horizontal and vertical position change, tagged with the sequence number of the last
+    * MsgUserCmdFromClient sent before the step, and with the index of the step since that cmd.
+    * The server acknowledges the last processed cmd and the number of physics iterations it simulated since then in
+    * MsgUserUpdateFromServer: the steps covered by this acknowledgement are already included in the authoritative position,
+    * the remaining ones are not, so the predicted position is the authoritative position plus the remaining steps.
+    *
+    * Since commands are event-based (sent only when input changes), a single cmd might cover many steps.
+    *
+    * Run mode toggles sent in cmds are also recorded, since server might reject a toggle (e.g. it arrived too early): the predicted
+    * running state is the authoritative running state received in MsgUserUpdateFromServer with the not yet acknowledged toggles applied.
+    */
+    class ClientPrediction
+    {
+    public:
+
+        /** Prediction never gets ahead of the last authoritative position by more steps than this, e.g. when server stops sending
+            updates because our player is blocked by a wall the client doesn't know about. */
+        static constexpr size_t nMaxUnackedSteps = 128;
+
+        // ---------------------------------------------------------------------------
+
+        ClientPrediction() = default;
+
+        ClientPrediction(const ClientPrediction&) = delete;
+        ClientPrediction& operator=(const ClientPrediction&) = delete;
+        ClientPrediction(ClientPrediction&&) = delete;
+        ClientPrediction&& operator=(ClientPrediction&&) = delete;
+
+        void reset();
+
+        void addStep(const std::uint32_t& nCmdSeq, const float& fDeltaX, const float& fDeltaY);
+        void addRunToggle(const std::uint32_t& nCmdSeq);
+        void reconcile(const std::uint32_t& nAckedCmdSeq, const std::uint32_t& nIterationsSinceAckedCmd);
+
+        float getUnackedDeltaX() const;
+        float getUnackedDeltaY() const;
+        size_t getUnackedStepCount() const;
+        size_t getUnackedRunToggleCount() const;
+        bool getPredictedRunning(const bool& bAckedRunning) const;
+
+    protected:
+
+    private:
+
+        struct Step
+        {
+            std::uint32_t m_nCmdSeq;
+            std::uint32_t m_nIterationSinceCmd;  /**< 0 for the 1st step after sending cmd m_nCmdSeq. */
+            float m_fDeltaX;
+            float m_fDeltaY;
+        };
+
+        static bool isCmdSeqOlder(const std::uint32_t& nCmdSeq, const std::uint32_t& nCmdSeqOther);
+
+        // ---------------------------------------------------------------------------
+
+        std::deque<Step> m_steps;  /**< Oldest first. */
+        std::deque<std::uint32_t> m_runToggleCmdSeqs;  /**< Sequence numbers of sent cmds carrying a run toggle, oldest first. */
+
+    }; // class ClientPrediction
+
+} // namespace proofps_dd
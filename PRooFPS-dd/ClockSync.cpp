@@ -0,0 +1,225 @@
+/*
+    ###################################################################################
+    ClockSync.cpp
+    Server-side estimation of a client's clock and connection timing for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <algorithm>
+#include <cmath>
+
+#include "ClockSync.h"
+
+
+// ############################### PUBLIC ################################
+
+
+/**
+* Converts the given time to the timestamp format used in messages: milliseconds since the epoch of the steady clock,
+* truncated to 32 bits.
+*/
+std::uint32_t proofps_dd::ClockSync::toMillisecs32(const TimePoint& time)
+{
+    return static_cast<std::uint32_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count());
+}
+
+/**
+* Forgets everything, e.g. when the client reconnects.
+*/
+void proofps_dd::ClockSync::reset()
+{
+    *this = ClockSync();
+}
+
+/**
+* Updates clock offset, drift and jitter estimates with a new message received from the client.
+*
+* @param nClientTimeMillisecs The client's timestamp carried by the message, 0 means unknown, in such case it is ignored.
+* @param timeArrival          When server received the message.
+*/
+void proofps_dd::ClockSync::addClientTimestamp(const std::uint32_t& nClientTimeMillisecs, const TimePoint& timeArrival)
+{
+    if (nClientTimeMillisecs == 0)
+    {
+        return;
+    }
+
+    if (!m_bSynced)
+    {
+        m_bSynced = true;
+        m_timeFirst = timeArrival;
+        m_nClientTimeFirst = nClientTimeMillisecs;
+        m_timeWindowStart = timeArrival;
+        // all offset members are already 0, relative to the first message
+        return;
+    }
+
+    const float fOffsetMillisecs =
+        std::chrono::duration<float, std::milli>(timeArrival - m_timeFirst).count() -
+        static_cast<float>(static_cast<std::int32_t>(nClientTimeMillisecs - m_nClientTimeFirst));
+
+    m_fJitterMillisecs += (std::abs(fOffsetMillisecs - m_fPrevOffsetMillisecs) - m_fJitterMillisecs) * fJitterGain;
+    m_fPrevOffsetMillisecs = fOffsetMillisecs;
+
+    if (timeArrival - m_timeWindowStart < std::chrono::milliseconds(nOffsetWindowMillisecs))
+    {
+        m_fWindowOffsetMinMillisecs = std::min(m_fWindowOffsetMinMillisecs, fOffsetMillisecs);
+        return;
+    }
+
+    // window is over, the change of the minimum offset compared to the previous window is the drift
+    if (m_bHasPrevWindow)
+    {
+        const float fDriftPpm =
+            (m_fWindowOffsetMinMillisecs - m_fPrevWindowOffsetMinMillisecs) /
+            std::chrono::duration<float, std::milli>(m_timeWindowStart - m_timePrevWindowStart).count() * 1000000.f;
+        m_fDriftPpm = m_bHasDrift ? (m_fDriftPpm + (fDriftPpm - m_fDriftPpm) * fDriftGain) : fDriftPpm;
+        m_bHasDrift = true;
+    }
+    m_bHasPrevWindow = true;
+    m_fPrevWindowOffsetMinMillisecs = m_fWindowOffsetMinMillisecs;
+    m_timePrevWindowStart = m_timeWindowStart;
+    m_fWindowOffsetMinMillisecs = fOffsetMillisecs;
+    m_timeWindowStart = timeArrival;
+}
+
+/**
+* Updates round-trip time estimate.
+*
+* @param nEchoedServerTimeMillisecs Server timestamp echoed back by the client, already increased by the client with the
+*                                   time elapsed between receiving and echoing it. 0 means unknown.
+* @param timeArrival                When server received the echo.
+*
+* @return False if the sample is invalid and thus ignored, true otherwise.
+*/
+bool proofps_dd::ClockSync::addRttSample(const std::uint32_t& nEchoedServerTimeMillisecs, const TimePoint& timeArrival)
+{
+    if (nEchoedServerTimeMillisecs == 0)
+    {
+        return false;
+    }
+
+    const std::int32_t nRttMillisecs = static_cast<std::int32_t>(toMillisecs32(timeArrival) - nEchoedServerTimeMillisecs);
+    if ((nRttMillisecs < 0) || (static_cast<std::uint32_t>(nRttMillisecs) > nRttSampleMaxMillisecs))
+    {
+        return false;
+    }
+
+    m_fRttMillisecs = m_bHasRtt ? (m_fRttMillisecs + (nRttMillisecs - m_fRttMillisecs) * fRttGain) : static_cast<float>(nRttMillisecs);
+    m_bHasRtt = true;
+    return true;
+}
+
+/**
+* @return True if at least 1 client timestamp has been received, so client timestamps can be converted to server time.
+*/
+bool proofps_dd::ClockSync::isSynced() const
+{
+    return m_bSynced;
+}
+
+/**
+* @return Server clock minus client clock, including the minimal one-way delay, in timestamp format milliseconds.
+*/
+double proofps_dd::ClockSync::getClockOffsetMillisecs() const
+{
+    return static_cast<double>(static_cast<std::int32_t>(toMillisecs32(m_timeFirst) - m_nClientTimeFirst)) + getOffsetMinMillisecs();
+}
+
+/**
+* @return How many microseconds the client clock is slower per second than the server clock, negative if faster.
+*         0 until 2 offset windows have elapsed.
+*/
+float proofps_dd::ClockSync::getClockDriftPpm() const
+{
+    return m_fDriftPpm;
+}
+
+float proofps_dd::ClockSync::getJitterMillisecs() const
+{
+    return m_fJitterMillisecs;
+}
+
+bool proofps_dd::ClockSync::hasRtt() const
+{
+    return m_bHasRtt;
+}
+
+/**
+* @return Smoothed round-trip time, 0 if there is no valid sample yet.
+*/
+float proofps_dd::ClockSync::getRttMillisecs() const
+{
+    return m_fRttMillisecs;
+}
+
+/**
+* Converts a client timestamp to server time, i.e. when a message sent at that client time would have arrived with
+* minimal delay. The difference of 2 converted timestamps is the difference measured by the client, free of network jitter.
+*
+* @return The converted time, or the epoch of the steady clock if not synced yet.
+*/
+proofps_dd::ClockSync::TimePoint proofps_dd::ClockSync::toServerTime(const std::uint32_t& nClientTimeMillisecs) const
+{
+    if (!m_bSynced)
+    {
+        return TimePoint{};
+    }
+
+    return m_timeFirst + std::chrono::duration_cast<TimePoint::duration>(
+        std::chrono::duration<double, std::milli>(
+            static_cast<double>(static_cast<std::int32_t>(nClientTimeMillisecs - m_nClientTimeFirst)) + getOffsetMinMillisecs()));
+}
+
+/**
+* Tells the time elapsed between sending 2 messages as measured by the client, free of network jitter.
+* Client timestamps are not trusted blindly: the result is capped to the time elapsed between the arrivals of the messages,
+* converted to the client's clock rate using the estimated drift, plus the given deviation. So by faking timestamps a client
+* can gain at most that much deviation compared to the arrival times.
+*
+* @return Milliseconds elapsed between sending the 2 messages, negative if the client clock stepped back.
+*         If client timestamps cannot be used (not synced, unknown timestamp, drift estimate out of sane range), it is the
+*         milliseconds elapsed between their arrivals.
+*/
+std::int64_t proofps_dd::ClockSync::getClientIntervalMillisecs(
+    const MsgTime& msgTimeFrom,
+    const MsgTime& msgTimeTo,
+    const std::uint32_t& nDeviationMaxMillisecs) const
+{
+    const std::int64_t nArrivalIntervalMillisecs =
+        std::chrono::duration_cast<std::chrono::milliseconds>(msgTimeTo.m_timeArrival - msgTimeFrom.m_timeArrival).count();
+    if (!m_bSynced || (msgTimeFrom.m_timeArrival == TimePoint{}) ||
+        (msgTimeFrom.m_nClientTimeMillisecs == 0) || (msgTimeTo.m_nClientTimeMillisecs == 0) ||
+        (std::abs(m_fDriftPpm) > fDriftPpmSaneMax))
+    {
+        return nArrivalIntervalMillisecs;
+    }
+
+    const std::int64_t nClientIntervalMillisecs =
+        static_cast<std::int32_t>(msgTimeTo.m_nClientTimeMillisecs - msgTimeFrom.m_nClientTimeMillisecs);
+    // positive drift means slower client clock, so it measures less time during the same arrival interval
+    const std::int64_t nClientIntervalMaxMillisecs =
+        static_cast<std::int64_t>(std::ceil(nArrivalIntervalMillisecs * (1.0 - m_fDriftPpm / 1000000.0))) + nDeviationMaxMillisecs;
+    return std::min(nClientIntervalMillisecs, nClientIntervalMaxMillisecs);
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
+
+
+/**
+* @return Minimum offset relative to the first message, in the current and previous window, so it is never based on
+*         just a few messages at the beginning of a window.
+*/
+float proofps_dd::ClockSync::getOffsetMinMillisecs() const
+{
+    return m_bHasPrevWindow ? std::min(m_fWindowOffsetMinMillisecs, m_fPrevWindowOffsetMinMillisecs) : m_fWindowOffsetMinMillisecs;
+}
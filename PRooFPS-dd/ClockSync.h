@@ -0,0 +1,100 @@
+#pragma once
+
+/*
+    ###################################################################################
+    ClockSync.h
+    Server-side estimation of a client's clock and connection timing for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <chrono>
+#include <cstdint>
+
+namespace proofps_dd
+{
+
+    /**
+    * Estimates the relation of a client's clock to the server's clock, based on the client timestamps carried by the
+    * messages received from the client, and the connection timing (round-trip time, jitter).
+    *
+    * The offset is the difference between server arrival time and client send time, so it includes the one-way delay too.
+    * Its minimum within a time window belongs to the least delayed message, that is the best estimate of clock offset
+    * plus minimal one-way delay. Comparing the minimums of consecutive windows tells the drift between the 2 clocks.
+    * Jitter is the smoothed variation of the offset between consecutive messages, as in RFC 3550.
+    * Round-trip time is measured by the client echoing back the server timestamp it has received, adjusted by the time
+    * it held it, smoothed as in RFC 6298.
+    *
+    * Timestamps are milliseconds of a steady clock truncated to 32 bits, so they wrap around in ~49 days.
+    */
+    class ClockSync
+    {
+    public:
+
+        using TimePoint = std::chrono::steady_clock::time_point;
+
+        static constexpr unsigned int nOffsetWindowMillisecs = 5000;
+        static constexpr float fJitterGain = 1.f / 16.f;
+        static constexpr float fRttGain = 1.f / 8.f;
+        static constexpr float fDriftGain = 1.f / 4.f;
+        static constexpr std::uint32_t nRttSampleMaxMillisecs = 10000;  /**< Bigger RTT samples are treated invalid. */
+        static constexpr float fDriftPpmSaneMax = 1000.f;                /**< Bigger drift estimate means client timestamps are not trusted. */
+
+        /** Send time and arrival time of a message received from the client. */
+        struct MsgTime
+        {
+            std::uint32_t m_nClientTimeMillisecs = 0;   /**< 0 means unknown. */
+            TimePoint m_timeArrival{};                  /**< Epoch of the steady clock means there is no such message yet. */
+        };
+
+        static std::uint32_t toMillisecs32(const TimePoint& time);
+
+        // ---------------------------------------------------------------------------
+
+        ClockSync() = default;
+
+        void reset();
+
+        void addClientTimestamp(const std::uint32_t& nClientTimeMillisecs, const TimePoint& timeArrival);
+        bool addRttSample(const std::uint32_t& nEchoedServerTimeMillisecs, const TimePoint& timeArrival);
+
+        bool isSynced() const;
+        double getClockOffsetMillisecs() const;
+        float getClockDriftPpm() const;
+        float getJitterMillisecs() const;
+        bool hasRtt() const;
+        float getRttMillisecs() const;
+
+        TimePoint toServerTime(const std::uint32_t& nClientTimeMillisecs) const;
+        std::int64_t getClientIntervalMillisecs(
+            const MsgTime& msgTimeFrom,
+            const MsgTime& msgTimeTo,
+            const std::uint32_t& nDeviationMaxMillisecs) const;
+
+    protected:
+
+    private:
+
+        float getOffsetMinMillisecs() const;
+
+        // ---------------------------------------------------------------------------
+
+        bool m_bSynced = false;
+        TimePoint m_timeFirst{};                /**< Arrival time of the first client timestamp, offsets are relative to this. */
+        std::uint32_t m_nClientTimeFirst = 0;   /**< The first client timestamp. */
+        float m_fPrevOffsetMillisecs = 0.f;     /**< Offset of the previous message, relative to the first one. */
+        float m_fWindowOffsetMinMillisecs = 0.f;
+        TimePoint m_timeWindowStart{};
+        bool m_bHasPrevWindow = false;
+        float m_fPrevWindowOffsetMinMillisecs = 0.f;
+        TimePoint m_timePrevWindowStart{};
+        bool m_bHasDrift = false;
+        float m_fDriftPpm = 0.f;
+        float m_fJitterMillisecs = 0.f;
+        bool m_bHasRtt = false;
+        float m_fRttMillisecs = 0.f;
+
+    }; // class ClockSync
+
+} // namespace proofps_dd
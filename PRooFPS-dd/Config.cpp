@@ -12,7 +12,11 @@
 
 #include <cassert>
 
+#include "InterestManagement.h"
+#include "MsgTrafficStats.h"
 #include "Player.h"
+#include "SendScheduler.h"
+#include "SnapshotInterpolation.h"
 
 static constexpr char* CVAR_SV_RECONNECT_DELAY = "sv_reconnect_delay";
 static constexpr char* CVAR_CL_RECONNECT_DELAY = "cl_reconnect_delay";
@@ -379,6 +383,124 @@ void proofps_dd::Config::validate()
 
     m_bFriendlyFire = m_pge.getConfigProfiles().getVars()[TeamDeathMatchMode::szCvarSvTdmFriendlyFire].getAsBool();
 
+    if (!m_pge.getConfigProfiles().getVars()[InterestManagement::szCVarSvInterestManagement].getAsString().empty())
+    {
+        m_bInterestManagement = m_pge.getConfigProfiles().getVars()[InterestManagement::szCVarSvInterestManagement].getAsBool();
+        getConsole().OLn("Interest Management from config: %s", (m_bInterestManagement ? "yes" : "no"));
+    }
+    else
+    {
+        m_pge.getConfigProfiles().getVars()[InterestManagement::szCVarSvInterestManagement].Set(InterestManagement::bSvInterestManagementDef);
+        m_bInterestManagement = InterestManagement::bSvInterestManagementDef;
+        getConsole().OLn("Missing Interest Management in config, forcing default: %s", (m_bInterestManagement ? "yes" : "no"));
+    }
+
+    auto& cvarSvNetClientBudget = m_pge.getConfigProfiles().getVars()[SendScheduler::szCVarSvNetClientBudgetBytesPerTick];
+    if (!cvarSvNetClientBudget.getAsString().empty())
+    {
+        if (cvarSvNetClientBudget.getAsInt() >= 0)
+        {
+            m_nClientBudgetBytesPerTick = cvarSvNetClientBudget.getAsUInt();
+            getConsole().OLn("Client Budget Bytes Per Tick from config: %u", m_nClientBudgetBytesPerTick);
+        }
+        else
+        {
+            m_nClientBudgetBytesPerTick = SendScheduler::nClientBudgetBytesPerTickDef;
+            getConsole().EOLn("ERROR: Invalid Client Budget Bytes Per Tick in config: %s, forcing default: %u",
+                cvarSvNetClientBudget.getAsString().c_str(), m_nClientBudgetBytesPerTick);
+            cvarSvNetClientBudget.Set(SendScheduler::nClientBudgetBytesPerTickDef);
+        }
+    }
+    else
+    {
+        cvarSvNetClientBudget.Set(SendScheduler::nClientBudgetBytesPerTickDef);
+        m_nClientBudgetBytesPerTick = SendScheduler::nClientBudgetBytesPerTickDef;
+        getConsole().OLn("Missing Client Budget Bytes Per Tick in config, forcing default: %u", m_nClientBudgetBytesPerTick);
+    }
+
+    auto& cvarClInterpDelay = m_pge.getConfigProfiles().getVars()[SnapshotInterpolation::szCVarClInterpDelayMillisecs];
+    if (!cvarClInterpDelay.getAsString().empty())
+    {
+        if ((cvarClInterpDelay.getAsInt() >= 0) &&
+            (cvarClInterpDelay.getAsInt() <= static_cast<int>(SnapshotInterpolation::nInterpDelayMillisecsMax)))
+        {
+            m_nClientInterpDelayMillisecs = cvarClInterpDelay.getAsUInt();
+            getConsole().OLn("Client Interp Delay from config: %u millisecs", m_nClientInterpDelayMillisecs);
+        }
+        else
+        {
+            m_nClientInterpDelayMillisecs = SnapshotInterpolation::nInterpDelayMillisecsDef;
+            getConsole().EOLn("ERROR: Invalid Client Interp Delay in config: %s, forcing default: %u",
+                cvarClInterpDelay.getAsString().c_str(), m_nClientInterpDelayMillisecs);
+            cvarClInterpDelay.Set(SnapshotInterpolation::nInterpDelayMillisecsDef);
+        }
+    }
+    else
+    {
+        cvarClInterpDelay.Set(SnapshotInterpolation::nInterpDelayMillisecsDef);
+        m_nClientInterpDelayMillisecs = SnapshotInterpolation::nInterpDelayMillisecsDef;
+        getConsole().OLn("Missing Client Interp Delay in config, forcing default: %u", m_nClientInterpDelayMillisecs);
+    }
+
+    m_bNetEmu = m_pge.getConfigProfiles().getVars()[NetworkConditionEmulator::szCVarNetEmu].getAsBool();
+    m_netEmuConditions = NetworkConditionEmulator::Conditions();
+    if (m_bNetEmu)
+    {
+        auto& cvarNetEmuLatency = m_pge.getConfigProfiles().getVars()[NetworkConditionEmulator::szCVarNetEmuLatencyMillisecs];
+        if ((cvarNetEmuLatency.getAsInt() >= 0) && (cvarNetEmuLatency.getAsUInt() <= NetworkConditionEmulator::nMillisecsMax))
+        {
+            m_netEmuConditions.m_nLatencyMillisecs = cvarNetEmuLatency.getAsUInt();
+        }
+        else
+        {
+            getConsole().EOLn("ERROR: Invalid %s in config: %s, forcing: 0",
+                NetworkConditionEmulator::szCVarNetEmuLatencyMillisecs, cvarNetEmuLatency.getAsString().c_str());
+            cvarNetEmuLatency.Set(0);
+        }
+
+        auto& cvarNetEmuJitter = m_pge.getConfigProfiles().getVars()[NetworkConditionEmulator::szCVarNetEmuJitterMillisecs];
+        if ((cvarNetEmuJitter.getAsInt() >= 0) && (cvarNetEmuJitter.getAsUInt() <= NetworkConditionEmulator::nMillisecsMax))
+        {
+            m_netEmuConditions.m_nJitterMillisecs = cvarNetEmuJitter.getAsUInt();
+        }
+        else
+        {
+            getConsole().EOLn("ERROR: Invalid %s in config: %s, forcing: 0",
+                NetworkConditionEmulator::szCVarNetEmuJitterMillisecs, cvarNetEmuJitter.getAsString().c_str());
+            cvarNetEmuJitter.Set(0);
+        }
+
+        auto& cvarNetEmuLossRate = m_pge.getConfigProfiles().getVars()[NetworkConditionEmulator::szCVarNetEmuLossRate];
+        if ((cvarNetEmuLossRate.getAsFloat() >= 0.f) && (cvarNetEmuLossRate.getAsFloat() <= 1.f))
+        {
+            m_netEmuConditions.m_fLossRate = cvarNetEmuLossRate.getAsFloat();
+        }
+        else
+        {
+            getConsole().EOLn("ERROR: Invalid %s in config: %s, forcing: 0",
+                NetworkConditionEmulator::szCVarNetEmuLossRate, cvarNetEmuLossRate.getAsString().c_str());
+            cvarNetEmuLossRate.Set(0.f);
+        }
+
+        auto& cvarNetEmuReorderRate = m_pge.getConfigProfiles().getVars()[NetworkConditionEmulator::szCVarNetEmuReorderRate];
+        if ((cvarNetEmuReorderRate.getAsFloat() >= 0.f) && (cvarNetEmuReorderRate.getAsFloat() <= 1.f))
+        {
+            m_netEmuConditions.m_fReorderRate = cvarNetEmuReorderRate.getAsFloat();
+        }
+        else
+        {
+            getConsole().EOLn("ERROR: Invalid %s in config: %s, forcing: 0",
+                NetworkConditionEmulator::szCVarNetEmuReorderRate, cvarNetEmuReorderRate.getAsString().c_str());
+            cvarNetEmuReorderRate.Set(0.f);
+        }
+
+        m_nNetEmuSeed = m_pge.getConfigProfiles().getVars()[NetworkConditionEmulator::szCVarNetEmuSeed].getAsUInt();
+
+        getConsole().OLn("Network Condition Emulation from config: latency: %u ms, jitter: %u ms, loss rate: %f, reorder rate: %f, seed: %u",
+            m_netEmuConditions.m_nLatencyMillisecs, m_netEmuConditions.m_nJitterMillisecs,
+            m_netEmuConditions.m_fLossRate, m_netEmuConditions.m_fReorderRate, m_nNetEmuSeed);
+    }
+
     auto& cvarGfxSmokeAmount = m_pge.getConfigProfiles().getVars()[Smoke::szCVarGfxSmokeAmount];
     if (!cvarGfxSmokeAmount.getAsString().empty())
     {
@@ -509,6 +631,42 @@ const bool& proofps_dd::Config::getFriendlyFire() const
     return m_bFriendlyFire;
 }
 
+const bool& proofps_dd::Config::getInterestManagement() const
+{
+    return m_bInterestManagement;
+}
+
+const unsigned int& proofps_dd::Config::getClientBudgetBytesPerTick() const
+{
+    return m_nClientBudgetBytesPerTick;
+}
+
+/**
+* @return Client-only: remote players are rendered this many millisecs behind the newest received update, 0 means interpolation is disabled.
+*/
+const unsigned int& proofps_dd::Config::getClientInterpDelayMillisecs() const
+{
+    return m_nClientInterpDelayMillisecs;
+}
+
+/**
+* @return True if received packets shall go through NetworkConditionEmulator before being handled.
+*/
+const bool& proofps_dd::Config::getNetworkConditionEmulation() const
+{
+    return m_bNetEmu;
+}
+
+const proofps_dd::NetworkConditionEmulator::Conditions& proofps_dd::Config::getNetworkConditionEmulatorConditions() const
+{
+    return m_netEmuConditions;
+}
+
+const unsigned int& proofps_dd::Config::getNetworkConditionEmulatorSeed() const
+{
+    return m_nNetEmuSeed;
+}
+
 const proofps_dd::Smoke::SmokeConfigAmount& proofps_dd::Config::getSmokeConfigAmount() const
 {
     return m_eSmokeAmount;
@@ -633,6 +791,8 @@ bool proofps_dd::Config::clientHandleServerInfoFromServer(
     {
         getConsole().OLn("bFriendlyFire         : %s", (m_serverInfo.m_bFriendlyFire ? "yes" : "no"));
     }
+    getConsole().OLn("bAllowStrafeMidAir    : %s", (m_serverInfo.m_bAllowStrafeMidAir ? "yes" : "no"));
+    getConsole().OLn("bAllowStrafeMidAirFull: %s", (m_serverInfo.m_bAllowStrafeMidAirFull ? "yes" : "no"));
     getConsole().OLnOO("");
 
     getConsole().SetLoggingState(getLoggerModuleName(), bPrevLoggingState);
@@ -694,14 +854,16 @@ bool proofps_dd::Config::serverSendServerInfo(pge_network::PgeNetworkConnectionH
         getPlayerRespawnInvulnerabilityDelaySeconds(),
         getFriendlyFire(),
         nRoundTimeLimitSecs,
-        nRoundPrepareTimeSecs))
+        nRoundPrepareTimeSecs,
+        m_pge.getConfigProfiles().getVars()[CVAR_SV_ALLOW_STRAFE_MID_AIR].getAsBool(),
+        m_pge.getConfigProfiles().getVars()[CVAR_SV_ALLOW_STRAFE_MID_AIR_FULL].getAsBool()))
     {
         getConsole().EOLn("Config::%s(): initPkt() FAILED at line %d!", __func__, __LINE__);
         assert(false);
         return false;
     }
 
-    m_pge.getNetwork().getServer().send(newPktServerInfo, connHandleServerSide);
+    MsgTrafficStats::serverSend(m_pge.getNetwork(), newPktServerInfo, connHandleServerSide);
     return true;
 }
 
@@ -718,7 +880,9 @@ void proofps_dd::Config::serverSaveServerInfo(
     const unsigned int& nRespawnInvulnerabilityTimeSecs,
     const bool& bFriendlyFire,
     const unsigned int& nSecondaryTimeLimitSecs,
-    const unsigned int& nTertiaryTimeLimitSecs)
+    const unsigned int& nTertiaryTimeLimitSecs,
+    const bool& bAllowStrafeMidAir,
+    const bool& bAllowStrafeMidAirFull)
 {
     assert(m_pge.getNetwork().isServer());
 
@@ -741,6 +905,9 @@ void proofps_dd::Config::serverSaveServerInfo(
     m_serverInfo.m_nSecondaryTimeLimitSecs = nSecondaryTimeLimitSecs;
     m_serverInfo.m_nTertiaryTimeLimitSecs = nTertiaryTimeLimitSecs;
 
+    m_serverInfo.m_bAllowStrafeMidAir = bAllowStrafeMidAir;
+    m_serverInfo.m_bAllowStrafeMidAirFull = bAllowStrafeMidAirFull;
+
     const bool bPrevLoggingState = getConsole().getLoggingState(getLoggerModuleName());
     getConsole().SetLoggingState(getLoggerModuleName(), true);
 
@@ -768,6 +935,8 @@ void proofps_dd::Config::serverSaveServerInfo(
     {
         getConsole().OLn("bFriendlyFire         : %s", (m_serverInfo.m_bFriendlyFire ? "yes" : "no"));
     }
+    getConsole().OLn("bAllowStrafeMidAir    : %s", (m_serverInfo.m_bAllowStrafeMidAir ? "yes" : "no"));
+    getConsole().OLn("bAllowStrafeMidAirFull: %s", (m_serverInfo.m_bAllowStrafeMidAirFull ? "yes" : "no"));
     getConsole().OLnOO("");
 
     getConsole().SetLoggingState(getLoggerModuleName(), bPrevLoggingState);
@@ -20,6 +20,7 @@
 #include "Consts.h"
 #include "GameMode.h"
 #include "Maps.h"
+#include "NetworkConditionEmulator.h"
 #include "PRooFPS-dd-packet.h"
 #include "Smoke.h"
 
@@ -111,6 +112,14 @@ namespace proofps_dd
 
         const bool& getFriendlyFire() const;
 
+        const bool& getInterestManagement() const;
+        const unsigned int& getClientBudgetBytesPerTick() const;
+        const unsigned int& getClientInterpDelayMillisecs() const;
+
+        const bool& getNetworkConditionEmulation() const;
+        const NetworkConditionEmulator::Conditions& getNetworkConditionEmulatorConditions() const;
+        const unsigned int& getNetworkConditionEmulatorSeed() const;
+
         const Smoke::SmokeConfigAmount& getSmokeConfigAmount() const;
 
         const float& getAttackDamageMultiplier() const;
@@ -138,7 +147,9 @@ namespace proofps_dd
             const unsigned int& nRespawnInvulnerabilityTimeSec,
             const bool& bFriendlyFire,
             const unsigned int& nSecondaryTimeLimitSecs,
-            const unsigned int& nTertiaryTimeLimitSecs);
+            const unsigned int& nTertiaryTimeLimitSecs,
+            const bool& bAllowStrafeMidAir,
+            const bool& bAllowStrafeMidAirFull);
 
         const MsgServerInfoFromServer& getServerInfo() const;
         bool isServerInfoReceived() const;
@@ -172,6 +183,14 @@ namespace proofps_dd
 
         bool m_bFriendlyFire = true;
 
+        bool m_bInterestManagement = true;
+        unsigned int m_nClientBudgetBytesPerTick = 0;  /**< 0 means unlimited, see SendScheduler. */
+        unsigned int m_nClientInterpDelayMillisecs = 0;  /**< 0 means interpolation is disabled, see SnapshotInterpolation. */
+
+        bool m_bNetEmu = false;
+        NetworkConditionEmulator::Conditions m_netEmuConditions;
+        unsigned int m_nNetEmuSeed = 0;
+
         Smoke::SmokeConfigAmount m_eSmokeAmount = Smoke::SmokeConfigAmount::Normal;
 
         unsigned int m_nPlayerRespawnDelaySecs{};  // cannot include Player.h in this file thus not defaulting this properly
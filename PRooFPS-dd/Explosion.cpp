@@ -85,246 +85,98 @@ void proofps_dd::Explosion::destroyReferenceExplosions()
     m_explosionRefObjects.clear();
 }
 
-/**
-    Ctor to be used by PGE server instance: explosion id will be assigned within the ctor.
-*/
 proofps_dd::Explosion::Explosion(
-    PGE& pge,
-    const pge_network::PgeNetworkConnectionHandle& connHandle,
-    const ExplosionObjRefId& refId,
-    const PureVector& pos,
-    const TPureFloat& fDamageAreaSize) :
-    m_id(m_globalExplosionId++),
+    PgeObjectPoolBase& parentPool,
+    PGE& pge) :
+    PgePooledObject(parentPool),
+    m_id(0),
     m_pge(pge),
-    m_connHandle(connHandle),
-    m_refId(refId),
-    m_fDamageAreaSize(fDamageAreaSize),
+    m_connHandle(0),
+    m_refId(0),
+    m_refIdCloned(0),
+    m_fDamageAreaSize(0.f),
     m_objPrimary(nullptr),
     m_objSecondary(nullptr),
+    m_fScalingPrimary(1.f),
+    m_fScalingSecondary(1.f),
+    m_bPrimaryFinished(true),
+    m_bSecondaryFinished(true),
     m_bCreateSentToClients(false)
 {
-    const auto itRef = m_explosionRefObjects.find(refId);
-    if (itRef == m_explosionRefObjects.end())
-    {
-        getConsole().EOLn("Explosion ctor (server): no ref explosion found with id: %u", static_cast<uint32_t>(refId));
-        throw std::runtime_error("Explosion ctor (server): no ref explosion found with id: " + std::to_string(refId));
-    }
-
-    const auto explRefData = itRef->second;
-    assert(explRefData.m_pRefObj);
-
-    m_fScalingPrimary = explRefData.m_pRefObj->getScaling().getX();
-    m_fScalingSecondary = explRefData.m_pRefObj->getScaling().getX();
-
-    m_objPrimary = m_pge.getPure().getObject3DManager().createCloned(*explRefData.m_pRefObj);
-    m_objSecondary = m_pge.getPure().getObject3DManager().createCloned(*explRefData.m_pRefObj);
-
-    if (!m_objPrimary || !m_objSecondary)
-    {
-        CConsole::getConsoleInstance("Explosion").EOLn("Explosion ctor (server): Failed to create a cloned object!");
-        throw std::runtime_error("Explosion ctor (server): Failed to create a cloned object!");
-    }
-
-    m_objPrimary->Show();
-    m_objPrimary->getPosVec() = pos;
+    // cloned objects are created by init() because the reference object is not known before
+}
 
-    m_objSecondary->Hide();
-    m_objSecondary->getPosVec() = pos;
+proofps_dd::Explosion::~Explosion()
+{
+    destroyClonedObjects();
+    
+    // no need to stop instance, keep playing! The Wav resource itself is in the ExplosionRef anyway.
+    //m_pge.getAudio().stopSoundInstance(m_sndHandle);
+}
 
-    // NOT playing sound here but in the copy ctor! Reason: copy ctor is invoked anyway when we store the explosion in the container!
-    //m_sndHandle = m_pge.getAudio().play3dSound(*explRefData.m_pSndExplosion, pos);
-    //m_pge.getAudio().getAudioEngineCore().set3dSourceMinMaxDistance(m_sndHandle, SndExplosionDistMin, SndExplosionDistMax);
-    //m_pge.getAudio().getAudioEngineCore().set3dSourceAttenuation(m_sndHandle, SoLoud::AudioSource::ATTENUATION_MODELS::LINEAR_DISTANCE, 1.f);
+/**
+    To be used by PGE server instance: explosion id will be assigned here.
+*/
+void proofps_dd::Explosion::init(
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const ExplosionObjRefId& refId,
+    const PureVector& pos,
+    const TPureFloat& fDamageAreaSize)
+{
+    initShared(m_globalExplosionId++, connHandle, refId, pos, fDamageAreaSize);
+    m_bCreateSentToClients = false;
 }
 
 /**
-    Ctor to be used by PGE client instance: explosion id as received from server.
+    To be used by PGE client instance: explosion id as received from server.
 */
-proofps_dd::Explosion::Explosion(
-    PGE& pge,
+void proofps_dd::Explosion::init(
     const Explosion::ExplosionId& id,
     const pge_network::PgeNetworkConnectionHandle& connHandle,
     const ExplosionObjRefId& refId,
     const PureVector& pos,
-    const TPureFloat& fDamageAreaSize) :
-    m_id(id),
-    m_pge(pge),
-    m_connHandle(connHandle),
-    m_refId(refId),
-    m_fDamageAreaSize(fDamageAreaSize),
-    m_objPrimary(nullptr),
-    m_objSecondary(nullptr),
-    m_bCreateSentToClients(true) /* irrelevant for this client-side ctor but we are client so yes it is sent :) */
+    const TPureFloat& fDamageAreaSize)
 {
-    const auto itRef = m_explosionRefObjects.find(refId);
-    if (itRef == m_explosionRefObjects.end())
-    {
-        getConsole().EOLn("Explosion ctor (client): no ref explosion found with id: %u", static_cast<uint32_t>(refId));
-        throw std::runtime_error("Explosion ctor (client): no ref explosion found with id: " + std::to_string(refId));
-    }
-
-    const auto explRefData = itRef->second;
-    assert(explRefData.m_pRefObj);
-
-    m_fScalingPrimary = explRefData.m_pRefObj->getScaling().getX();
-    m_fScalingSecondary = explRefData.m_pRefObj->getScaling().getX();
-
-    m_objPrimary = m_pge.getPure().getObject3DManager().createCloned(*explRefData.m_pRefObj);
-    m_objSecondary = m_pge.getPure().getObject3DManager().createCloned(*explRefData.m_pRefObj);
-    if (!m_objPrimary || !m_objSecondary)
-    {
-        CConsole::getConsoleInstance("Explosion").EOLn("Explosion ctor (client): Failed to create a cloned object!");
-        throw std::runtime_error("Explosion ctor (client): Failed to create a cloned object!");
-    }
-
-    m_objPrimary->Show();
-    m_objPrimary->getPosVec() = pos;
-    
-    m_objSecondary->Hide();
-    m_objSecondary->getPosVec() = pos;
-
-    // NOT playing sound here but in the copy ctor! Reason: copy ctor is invoked anyway when we store the explosion in the container!
-    //m_sndHandle = m_pge.getAudio().play3dSound(*explRefData.m_pSndExplosion, pos);
-    //m_pge.getAudio().getAudioEngineCore().set3dSourceMinMaxDistance(m_sndHandle, SndExplosionDistMin, SndExplosionDistMax);
-    //m_pge.getAudio().getAudioEngineCore().set3dSourceAttenuation(m_sndHandle, SoLoud::AudioSource::ATTENUATION_MODELS::LINEAR_DISTANCE, 1.f);
+    initShared(id, connHandle, refId, pos, fDamageAreaSize);
+    m_bCreateSentToClients = true; /* irrelevant for client-side but we are client so yes it is sent :) */
 }
 
-proofps_dd::Explosion::Explosion(const proofps_dd::Explosion& other) :
-    m_id(other.m_id),
-    m_pge(other.m_pge),
-    m_connHandle(other.m_connHandle),
-    m_refId(other.m_refId),
-    m_fDamageAreaSize(other.m_fDamageAreaSize),
-    m_fScalingPrimary(other.m_fScalingPrimary),
-    m_fScalingSecondary(other.m_fScalingSecondary),
-    m_bCreateSentToClients(other.m_bCreateSentToClients)
+void proofps_dd::Explosion::onSetUsed()
 {
-    const auto itRef = m_explosionRefObjects.find(m_refId);
-    if (itRef == m_explosionRefObjects.end())
-    {
-        getConsole().EOLn("Explosion copy ctor: no ref explosion found with id: %u", static_cast<uint32_t>(m_refId));
-        throw std::runtime_error("Explosion copy ctor: no ref explosion found with id: " + std::to_string(m_refId));
-    }
-
-    const auto explRefData = itRef->second;
-    assert(explRefData.m_pRefObj);
-
-    PureVector pos;
-
-    if (other.m_objPrimary)
+    // init() shows the primary object, here we just make sure nothing is visible from a free explosion
+    if (used())
     {
-        m_objPrimary = m_pge.getPure().getObject3DManager().createCloned(*explRefData.m_pRefObj);
-        m_objPrimary->SetRenderingAllowed(other.m_objPrimary->isRenderingAllowed());
-        m_objPrimary->getPosVec() = other.m_objPrimary->getPosVec();
-        m_objPrimary->SetScaling(other.m_objPrimary->getScaling());
-        pos = m_objPrimary->getPosVec();
-        
-        if (!m_objPrimary)
-        {
-            CConsole::getConsoleInstance("Explosion").EOLn("Explosion copy ctor: Failed to create a cloned object!");
-            throw std::runtime_error("Explosion copy ctor: Failed to create a cloned object!");
-        }
-    }
-    else
-    {
-        m_objPrimary = nullptr;
+        return;
     }
 
-    if (other.m_objSecondary)
+    if (m_objPrimary)
     {
-        m_objSecondary = m_pge.getPure().getObject3DManager().createCloned(*explRefData.m_pRefObj);
-        m_objSecondary->SetRenderingAllowed(other.m_objSecondary->isRenderingAllowed());
-        m_objSecondary->getPosVec() = other.m_objSecondary->getPosVec();
-        m_objSecondary->SetScaling(other.m_objSecondary->getScaling());
-        pos = m_objSecondary->getPosVec();
-
-        if (!m_objSecondary)
-        {
-            CConsole::getConsoleInstance("Explosion").EOLn("Explosion copy ctor: Failed to create a cloned object!");
-            throw std::runtime_error("Explosion copy ctor: Failed to create a cloned object!");
-        }
+        m_objPrimary->Hide();
     }
-    else
+    if (m_objSecondary)
     {
-        m_objSecondary = nullptr;
+        m_objSecondary->Hide();
     }
-
-    m_sndHandle = m_pge.getAudio().play3dSound(*explRefData.m_pSndExplosion, pos);
-    m_pge.getAudio().getAudioEngineCore().set3dSourceMinMaxDistance(m_sndHandle, SndExplosionDistMin, SndExplosionDistMax);
-    m_pge.getAudio().getAudioEngineCore().set3dSourceAttenuation(m_sndHandle, SoLoud::AudioSource::ATTENUATION_MODELS::LINEAR_DISTANCE, 1.f);
 }
 
-//proofps_dd::Explosion& proofps_dd::Explosion::operator=(const proofps_dd::Explosion& other)
-//{
-//    m_id = other.m_id;
-//    m_pge = other.m_pge;
-//    m_connHandle = other.m_connHandle;
-//    m_refId = other.m_refId;
-//    m_fDamageAreaSize = other.m_fDamageAreaSize;
-//    m_fScalingPrimary = other.m_fScalingPrimary;
-//    m_fScalingSecondary = other.m_fScalingSecondary;
-//    m_bCreateSentToClients = other.m_bCreateSentToClients;
-//
-//    const auto itRef = m_explosionRefObjects.find(m_refId);
-//    if (itRef == m_explosionRefObjects.end())
-//    {
-//        getConsole().EOLn("Explosion copy assignment: no ref explosion found with id: %u", static_cast<uint32_t>(m_refId));
-//        throw std::runtime_error("Explosion copy assignment: no ref explosion found with id: " + std::to_string(m_refId));
-//    }
-//
-//    const auto explRefData = itRef->second;
-//    assert(explRefData.m_pRefObj);
-//
-//    if (other.m_objPrimary)
-//    {
-//        m_objPrimary = m_gfx.getObject3DManager().createCloned(*explRefData.m_pRefObj);
-//        m_objPrimary->SetRenderingAllowed(other.m_objPrimary->isRenderingAllowed());
-//        m_objPrimary->getPosVec() = other.m_objPrimary->getPosVec();
-//        m_objPrimary->SetScaling(other.m_objPrimary->getScaling());
-//        if (!m_objPrimary)
-//        {
-//            CConsole::getConsoleInstance("Explosion").EOLn("Explosion copy ctor: Failed to create a cloned object!");
-//            throw std::runtime_error("Explosion copy ctor: Failed to create a cloned object!");
-//        }
-//    }
-//    else
-//    {
-//        m_objPrimary = nullptr;
-//    }
-//
-//    if (other.m_objSecondary)
-//    {
-//        m_objSecondary = m_gfx.getObject3DManager().createCloned(*explRefData.m_pRefObj);
-//        m_objSecondary->SetRenderingAllowed(other.m_objSecondary->isRenderingAllowed());
-//        m_objSecondary->getPosVec() = other.m_objSecondary->getPosVec();
-//        m_objSecondary->SetScaling(other.m_objSecondary->getScaling());
-//        if (!m_objSecondary)
-//        {
-//            CConsole::getConsoleInstance("Explosion").EOLn("Explosion copy ctor: Failed to create a cloned object!");
-//            throw std::runtime_error("Explosion copy ctor: Failed to create a cloned object!");
-//        }
-//    }
-//    else
-//    {
-//        m_objSecondary = nullptr;
-//    }
-//
-//    return *this;
-//}
-
-proofps_dd::Explosion::~Explosion()
+/**
+    The cloned objects must be destroyed before their reference object, i.e. before destroyReferenceExplosions().
+    Next init() will create them again.
+*/
+void proofps_dd::Explosion::destroyClonedObjects()
 {
     if (m_objPrimary)
     {
         m_pge.getPure().getObject3DManager().DeleteAttachedInstance(*m_objPrimary);
+        m_objPrimary = nullptr;
     }
     if (m_objSecondary)
     {
         m_pge.getPure().getObject3DManager().DeleteAttachedInstance(*m_objSecondary);
+        m_objSecondary = nullptr;
     }
-    
-    // no need to stop instance, keep playing! The Wav resource itself is in the ExplosionRef anyway.
-    //m_pge.getAudio().stopSoundInstance(m_sndHandle);
+    m_bPrimaryFinished = true;
+    m_bSecondaryFinished = true;
 }
 
 CConsole& proofps_dd::Explosion::getConsole() const
@@ -349,7 +201,7 @@ bool& proofps_dd::Explosion::isCreateSentToClients()
 
 void proofps_dd::Explosion::update(const unsigned int& nFactor)
 {
-    if (m_objPrimary)
+    if (!m_bPrimaryFinished)
     {
         m_fScalingPrimary += 1.5f / static_cast<TPureFloat>(nFactor);
         // either we are scaling in all dimensions or just in XY directions, not sure which looks better!
@@ -363,13 +215,13 @@ void proofps_dd::Explosion::update(const unsigned int& nFactor)
 
         if (fCurrentDiameter > fTargetDiameter)
         {
-            delete m_objPrimary;
-            m_objPrimary = nullptr;
+            m_objPrimary->Hide();
+            m_bPrimaryFinished = true;
         }
         else
         {
             const float fAnimationProgress = fCurrentDiameter / fTargetDiameter;
-            if (m_objSecondary && !m_objSecondary->isRenderingAllowed())
+            if (!m_bSecondaryFinished && !m_objSecondary->isRenderingAllowed())
             {
                 if (fAnimationProgress >= 0.4f)
                 {
@@ -382,7 +234,7 @@ void proofps_dd::Explosion::update(const unsigned int& nFactor)
     }
 
     // copy-paste code, not nice ...
-    if (m_objSecondary && m_objSecondary->isRenderingAllowed())
+    if (!m_bSecondaryFinished && m_objSecondary->isRenderingAllowed())
     {
         m_fScalingSecondary += 1.5f / static_cast<TPureFloat>(nFactor);
         // either we are scaling in all dimensions or just in XY directions, not sure which looks better!
@@ -396,8 +248,8 @@ void proofps_dd::Explosion::update(const unsigned int& nFactor)
 
         if (fCurrentDiameter > fTargetDiameter)
         {
-            delete m_objSecondary;
-            m_objSecondary = nullptr;
+            m_objSecondary->Hide();
+            m_bSecondaryFinished = true;
         }
         else
         {
@@ -452,7 +304,7 @@ float proofps_dd::Explosion::getDamageAtDistance(
 
 bool proofps_dd::Explosion::shouldBeDeleted() const
 {
-    return !m_objPrimary && !m_objSecondary;
+    return m_bPrimaryFinished && m_bSecondaryFinished;
 }
 
 
@@ -464,3 +316,65 @@ bool proofps_dd::Explosion::shouldBeDeleted() const
 
 proofps_dd::Explosion::ExplosionId proofps_dd::Explosion::m_globalExplosionId = 0;
 std::map<proofps_dd::ExplosionObjRefId, proofps_dd::Explosion::ExplosionRefData> proofps_dd::Explosion::m_explosionRefObjects;
+
+void proofps_dd::Explosion::initShared(
+    const ExplosionId& id,
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const ExplosionObjRefId& refId,
+    const PureVector& pos,
+    const TPureFloat& fDamageAreaSize)
+{
+    const auto itRef = m_explosionRefObjects.find(refId);
+    if (itRef == m_explosionRefObjects.end())
+    {
+        getConsole().EOLn("Explosion::%s(): no ref explosion found with id: %u", __func__, static_cast<uint32_t>(refId));
+        throw std::runtime_error("Explosion::init(): no ref explosion found with id: " + std::to_string(refId));
+    }
+
+    const auto explRefData = itRef->second;
+    assert(explRefData.m_pRefObj);
+
+    if (m_refIdCloned != refId)
+    {
+        // this pool element was used with a different reference object before
+        destroyClonedObjects();
+    }
+
+    if (!m_objPrimary || !m_objSecondary)
+    {
+        destroyClonedObjects();
+        m_objPrimary = m_pge.getPure().getObject3DManager().createCloned(*explRefData.m_pRefObj);
+        m_objSecondary = m_pge.getPure().getObject3DManager().createCloned(*explRefData.m_pRefObj);
+        if (!m_objPrimary || !m_objSecondary)
+        {
+            getConsole().EOLn("Explosion::%s(): Failed to create a cloned object!", __func__);
+            throw std::runtime_error("Explosion::init(): Failed to create a cloned object!");
+        }
+        m_refIdCloned = refId;
+    }
+
+    m_id = id;
+    m_connHandle = connHandle;
+    m_refId = refId;
+    m_fDamageAreaSize = fDamageAreaSize;
+
+    // a reused object still has the scaling and transparency where its previous animation ended
+    m_fScalingPrimary = explRefData.m_pRefObj->getScaling().getX();
+    m_fScalingSecondary = explRefData.m_pRefObj->getScaling().getX();
+    m_objPrimary->SetScaling(explRefData.m_pRefObj->getScaling());
+    m_objSecondary->SetScaling(explRefData.m_pRefObj->getScaling());
+    m_objPrimary->getMaterial(false).getTextureEnvColor().SetAsFloats(1.f, 1.f, 1.f, 1.f);
+    m_objSecondary->getMaterial(false).getTextureEnvColor().SetAsFloats(1.f, 1.f, 1.f, 1.f);
+
+    m_objPrimary->Show();
+    m_objPrimary->getPosVec() = pos;
+    m_bPrimaryFinished = false;
+
+    m_objSecondary->Hide();
+    m_objSecondary->getPosVec() = pos;
+    m_bSecondaryFinished = false;
+
+    m_sndHandle = m_pge.getAudio().play3dSound(*explRefData.m_pSndExplosion, pos);
+    m_pge.getAudio().getAudioEngineCore().set3dSourceMinMaxDistance(m_sndHandle, SndExplosionDistMin, SndExplosionDistMax);
+    m_pge.getAudio().getAudioEngineCore().set3dSourceAttenuation(m_sndHandle, SoLoud::AudioSource::ATTENUATION_MODELS::LINEAR_DISTANCE, 1.f);
+}
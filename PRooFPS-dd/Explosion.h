@@ -18,7 +18,11 @@ namespace proofps_dd
 
     typedef PFL::StringHash ExplosionObjRefId;
 
-    class Explosion
+    /**
+    * Explosions are pooled: the cloned 3D objects stay with the pool element while it is free, so creating an explosion
+    * with the same reference object as before does not need any allocation.
+    */
+    class Explosion : public PgePooledObject
     {
 
     public:
@@ -41,28 +45,35 @@ namespace proofps_dd
 
         // ---------------------------------------------------------------------------
 
-        /** Ctor to be used by PGE server instance: explosion id will be assigned within the ctor. */
         Explosion(
-            PGE& pge,
+            PgeObjectPoolBase& parentPool,
+            PGE& pge);
+
+        virtual ~Explosion();
+
+        Explosion(const Explosion&) = delete;
+        Explosion& operator=(const Explosion&) = delete;
+        Explosion(Explosion&&) = delete;
+        Explosion& operator=(Explosion&&) = delete;
+
+        /** To be used by PGE server instance: explosion id will be assigned here. */
+        void init(
             const pge_network::PgeNetworkConnectionHandle& connHandle,
             const ExplosionObjRefId& refId,
             const PureVector& pos,
             const TPureFloat& fDamageAreaSize);
 
-        /** Ctor to be used by PGE client instance: explosion id as received from server. */
-        Explosion(
-            PGE& pge,
+        /** To be used by PGE client instance: explosion id as received from server. */
+        void init(
             const ExplosionId& id,
             const pge_network::PgeNetworkConnectionHandle& connHandle,
             const ExplosionObjRefId& refId,
             const PureVector& pos,
             const TPureFloat& fDamageAreaSize);
 
-        Explosion(const Explosion& other);            // TODO check if we really cannot live with just compiler generated copy ctor?
-
-        Explosion& operator=(const Explosion& other) = delete; // if needed, uncomment and update in cpp as well
+        virtual void onSetUsed() override;
 
-        virtual ~Explosion();
+        void destroyClonedObjects();
 
         CConsole& getConsole() const;                    /**< Returns access to console preset with logger module name as this class. */
 
@@ -99,17 +110,27 @@ namespace proofps_dd
         PGE& m_pge;
         pge_network::PgeNetworkConnectionHandle m_connHandle;  /**< Owner (caused by) of this explosion. Used by PGE server instance only. */
         ExplosionObjRefId m_refId;                             /**< Explosion object reference id, used to search in m_explosionRefObjects. Used by PGE server and client instances. */
+        ExplosionObjRefId m_refIdCloned;                       /**< Reference id of the currently cloned objects, they are reused by init() if it is the same as the requested one. */
         TPureFloat m_fDamageAreaSize;                          /**< Originating bullet's fDamageAreaSize. Used by PGE server and client instances. */
 
         PureObject3D* m_objPrimary;                            /**< Associated Primary Pure object to be rendered. Used by PGE server and client instances. TODO: shared ptr. */
         PureObject3D* m_objSecondary;                          /**< Associated Secondary Pure object to be rendered. Used by PGE server and client instances. TODO: shared ptr. */
         TPureFloat m_fScalingPrimary;                          /**< To be increased during animation. */
         TPureFloat m_fScalingSecondary;                        /**< To be increased during animation. */
+        bool m_bPrimaryFinished;                               /**< Animation of m_objPrimary is finished, it is hidden but kept for reuse. */
+        bool m_bSecondaryFinished;                             /**< Animation of m_objSecondary is finished, it is hidden but kept for reuse. */
         bool m_bCreateSentToClients;                           /**< Server should send update to clients about creation of new explosions. By default false. */
         SoLoud::handle m_sndHandle{};
 
         // ---------------------------------------------------------------------------
 
+        void initShared(
+            const ExplosionId& id,
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const ExplosionObjRefId& refId,
+            const PureVector& pos,
+            const TPureFloat& fDamageAreaSize);
+
     }; // class Explosion
 
 } // namespace proofps_dd
@@ -15,8 +15,10 @@
 
 #include "Consts.h"
 #include "Maps.h"
+#include "MsgTrafficStats.h"
 #include "Player.h"
 #include "PRooFPS-dd-packet.h"
+#include "StringTable.h"
 #include "WeaponHandling.h"
 
 
@@ -658,6 +660,7 @@ ImVec4 proofps_dd::GUI::m_colorExtraText_CountdownTimerForRespawnOrForcedSpectat
 bool proofps_dd::GUI::m_bShowHealthAndArmor = false;
 
 proofps_dd::GUI::InGameMenuState proofps_dd::GUI::m_currentMenuInInGameMenu = proofps_dd::GUI::InGameMenuState::None;
+bool proofps_dd::GUI::m_bShowMsgTrafficStatsInServerAdminMenu = false;
 
 proofps_dd::XHair* proofps_dd::GUI::m_pXHair = nullptr;
 proofps_dd::Minimap* proofps_dd::GUI::m_pMinimap = nullptr;
@@ -2624,14 +2627,14 @@ void proofps_dd::GUI::drawInGameWelcomeTeamSelectSpectatorMenu(
                             // Instead of using sendToServer() of getClient() or inject() of getServer() instances, we use the send() of
                             // their common interface which always points to the initialized instance, which is either client or server.
                             // Btw send() in case of server instance and server as target is implemented as an inject() as of May 2023 (and Jan 2025 :)).
-                            m_pPge->getNetwork().getServerClientInstance()->send(pktUserInGameMenuCmd);
+                            MsgTrafficStats::send(m_pPge->getNetwork(), pktUserInGameMenuCmd);
                         }
                     }
                     else /* bToggleSpectatorMode is true */
                     {
                         // exiting spectator mode can be done with team selection only in team-based games, and anytime in non-team-based games.
                         proofps_dd::MsgUserInGameMenuCmd::toggleSpectatorMode(pktUserInGameMenuCmd);
-                        m_pPge->getNetwork().getServerClientInstance()->send(pktUserInGameMenuCmd);
+                        MsgTrafficStats::send(m_pPge->getNetwork(), pktUserInGameMenuCmd);
                     }
                 }
                 hideGameObjectives();
@@ -2666,6 +2669,56 @@ void proofps_dd::GUI::drawInGameWelcomeTeamSelectSpectatorMenu(
     style.Colors[ImGuiCol_PopupBg] = prevPopupBgColor;
 } // drawInGameWelcomeTeamSelectSpectatorMenu()
 
+/**
+* Draws the network traffic of server with all clients and the handling cost, per message kind, as counted by MsgTrafficStats.
+* Injected messages are not network traffic so they are not shown here, but they are in the dump file.
+*/
+void proofps_dd::GUI::drawMsgTrafficStatsTable(const float& fTableWidthPixels)
+{
+    const MsgTrafficStats& msgTrafficStats = MsgTrafficStats::getInstance();
+    const float fSecs = std::max(
+        0.001f,
+        std::chrono::duration_cast<std::chrono::milliseconds>(msgTrafficStats.getDurationSinceClear()).count() / 1000.f);
+
+    static constexpr char* const szHeaderLabels[] = { "Msg", "Tx", "Tx B/s", "Rx", "Rx B/s", "Avg us", "Max us" };
+    constexpr int nCols = static_cast<int>(sizeof(szHeaderLabels) / sizeof(szHeaderLabels[0]));
+    constexpr ImGuiTableFlags tblFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_SizingStretchProp;
+    if (!ImGui::BeginTable("tbl_msgtrafficstats", nCols, tblFlags, ImVec2(fTableWidthPixels, 0.f)))
+    {
+        return;
+    }
+
+    for (int iCol = 0; iCol < nCols; iCol++)
+    {
+        ImGui::TableSetupColumn(szHeaderLabels[iCol], ImGuiTableColumnFlags_WidthStretch, iCol == 0 ? 4.f : 1.f);
+    }
+    ImGui::TableHeadersRow();
+
+    for (const auto& msgId2ZStringPair : MapMsgAppId2String)
+    {
+        const MsgTrafficStats::Counters counters = msgTrafficStats.getClientsTotalCounters(msgId2ZStringPair.msgId);
+        const MsgTrafficStats::HandlerStats& handlerStats = msgTrafficStats.getHandlerStats(msgId2ZStringPair.msgId);
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted(msgId2ZStringPair.zstring);
+        ImGui::TableSetColumnIndex(1);
+        ImGui::Text("%zu", counters.m_nTxMsgs);
+        ImGui::TableSetColumnIndex(2);
+        ImGui::Text("%.0f", counters.m_nTxBytes / fSecs);
+        ImGui::TableSetColumnIndex(3);
+        ImGui::Text("%zu", counters.m_nRxMsgs);
+        ImGui::TableSetColumnIndex(4);
+        ImGui::Text("%.0f", counters.m_nRxBytes / fSecs);
+        ImGui::TableSetColumnIndex(5);
+        ImGui::Text("%.1f", (handlerStats.m_nCalls == 0) ? 0.f : (handlerStats.m_nTotalUSecs / static_cast<float>(handlerStats.m_nCalls)));
+        ImGui::TableSetColumnIndex(6);
+        ImGui::Text("%lld", static_cast<long long>(handlerStats.m_nMaxUSecs));
+    }
+
+    ImGui::EndTable();
+}
+
 void proofps_dd::GUI::drawInGameServerAdminMenu()
 {
     assert(m_pPge);
@@ -2675,27 +2728,34 @@ void proofps_dd::GUI::drawInGameServerAdminMenu()
 
     constexpr char* const szWindowTitle = "Server Admin";
 
-    constexpr float fWindowWidthDesired = 300.f;
+    const float fWindowWidthDesired = m_bShowMsgTrafficStatsInServerAdminMenu ? 700.f : 300.f;
     // would be good to have this value saved in the class, but for now I'm just copy-pasting it from GUI::initialize():
     const float fScalingFactor = m_pPge->getPure().getWindow().getClientHeight() / 768.f;
     const float fWindowWidthMinPixels = ImGui::CalcTextSize(szWindowTitle).x + 2 * ImGui::GetStyle().WindowPadding.x;
     const float fWindowWidth = std::max(fWindowWidthDesired * fScalingFactor, fWindowWidthMinPixels);
 
-    const float fButtonWidthMinPixels = ImGui::CalcTextSize("SOFT (R)ESTART").x + 2 * ImGui::GetStyle().FramePadding.x;
+    // longest button text
+    const float fButtonWidthMinPixels = ImGui::CalcTextSize("HIDE MSG (S)TATS").x + 2 * ImGui::GetStyle().FramePadding.x;
     const float fButtonHeightMinPixels = m_fFontSizePxHudGeneralScaled + 2 * ImGui::GetStyle().FramePadding.y;
     const float fBtnWidth = fButtonWidthMinPixels + 30.f;
     const float fBtnHeight = fButtonHeightMinPixels + 10.f;
 
     constexpr int nTextRows = 4; /* 2 x (window title on top + notice text at bottom) */
-    constexpr int nButtonRows = 3;
+    constexpr int nButtonRows = 5;
+    // header row + 1 row per message kind, each row is 1 line of text plus cell padding and border
+    const int nTableRows = m_bShowMsgTrafficStatsInServerAdminMenu ? (static_cast<int>(MsgTrafficStats::nMsgIdCount) + 1) : 0;
+    const float fTableHeight =
+        nTableRows * (ImGui::GetTextLineHeight() + 2 * ImGui::GetStyle().CellPadding.y + 1.f);
     const float fContentHeight =
         m_fFontSizePxHudGeneralScaled * nTextRows +
         nButtonRows * fBtnHeight +
-        (nTextRows + nButtonRows - 1) * ImGui::GetStyle().ItemSpacing.y;
+        fTableHeight +
+        (nTextRows + nButtonRows + (nTableRows > 0 ? 1 : 0) - 1) * ImGui::GetStyle().ItemSpacing.y;
     const float fWindowHeight = fContentHeight + 2 * ImGui::GetStyle().WindowPadding.y;
 
-    ImGui::SetNextWindowPos(ImGui::GetMainViewport()->GetCenter(), ImGuiCond_Appearing, ImVec2(0.5f, 0.5f));
-    ImGui::SetNextWindowSize(ImVec2(fWindowWidth, fWindowHeight), ImGuiCond_Appearing);
+    // size might change while open due to showing/hiding the stats table, and position needs to follow it to stay centered
+    ImGui::SetNextWindowPos(ImGui::GetMainViewport()->GetCenter(), ImGuiCond_Always, ImVec2(0.5f, 0.5f));
+    ImGui::SetNextWindowSize(ImVec2(fWindowWidth, fWindowHeight), ImGuiCond_Always);
 
     // for now we decide in-game menu transparency based on minimap transparency setting
     const float fPopupBgAlpha =
@@ -2748,15 +2808,37 @@ void proofps_dd::GUI::drawInGameServerAdminMenu()
             {
                 m_pMaps->getMapcycle().mapcycleNext();
                 pge_network::PgePacket newPktMapChange;
-                if (!proofps_dd::MsgMapChangeFromServer::initPkt(newPktMapChange, m_pMaps->getMapcycle().mapcycleGetCurrent()))
+                if (!proofps_dd::MsgMapChangeFromServer::initPkt(
+                    newPktMapChange,
+                    StringTable::serverIntern(m_pPge->getNetwork(), m_pMaps->getMapcycle().mapcycleGetCurrent())))
                 {
                     getConsole().EOLn("GUI::%s(): initPkt() FAILED at line %d!", __func__, __LINE__);
                     assert(false);
                 }
-                m_pPge->getNetwork().getServer().sendToAll(newPktMapChange);
+                MsgTrafficStats::serverSendToAll(m_pPge->getNetwork(), newPktMapChange);
             }
         }
 
+        ImGui::SetCursorPos(ImVec2(fWindowWidth / 2 - fBtnWidth / 2, ImGui::GetCursorPosY()));
+        // In case of buttons, remove size argument (ImVec2) to auto-resize.
+        if (ImGui::Button(m_bShowMsgTrafficStatsInServerAdminMenu ? "HIDE MSG (S)TATS" : "MSG (S)TATS", ImVec2(fBtnWidth, fBtnHeight)) ||
+            ImGui::IsKeyPressed(ImGuiKey_S))
+        {
+            m_bShowMsgTrafficStatsInServerAdminMenu = !m_bShowMsgTrafficStatsInServerAdminMenu;
+        }
+
+        ImGui::SetCursorPos(ImVec2(fWindowWidth / 2 - fBtnWidth / 2, ImGui::GetCursorPosY()));
+        // In case of buttons, remove size argument (ImVec2) to auto-resize.
+        if (ImGui::Button("(D)UMP MSG STATS", ImVec2(fBtnWidth, fBtnHeight)) || ImGui::IsKeyPressed(ImGuiKey_D))
+        {
+            MsgTrafficStats::getInstance().dumpToFile(MsgTrafficStats::szDumpFilename);
+        }
+
+        if (m_bShowMsgTrafficStatsInServerAdminMenu)
+        {
+            drawMsgTrafficStatsTable(fWindowWidth - 2 * ImGui::GetStyle().WindowPadding.x);
+        }
+
         static const std::string sNotice =
             std::string("Key '") + GAME_INPUT_KEY_MENU_SERVERADMIN + "' toggles this window.";
         drawText(
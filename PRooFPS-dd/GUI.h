@@ -200,6 +200,7 @@ namespace proofps_dd
         static ServerRestartGameCallback m_cbServerSoftRestartGame;
         static ServerRestartGameCallback m_cbServerHardRestartGame;
         static InGameMenuState m_currentMenuInInGameMenu;
+        static bool m_bShowMsgTrafficStatsInServerAdminMenu;
 
         /* Misc */
 
@@ -373,6 +374,7 @@ namespace proofps_dd
 
         static void drawInGameWelcomeTeamSelectSpectatorMenu(
             const std::map<pge_network::PgeNetworkConnectionHandle, proofps_dd::Player>::iterator& itCurrentPlayer);
+        static void drawMsgTrafficStatsTable(const float& fTableWidthPixels);
         static void drawInGameServerAdminMenu();
         static void drawInGameMenu(
             const std::map<pge_network::PgeNetworkConnectionHandle, proofps_dd::Player>::iterator& itCurrentPlayer);
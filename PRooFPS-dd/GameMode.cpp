@@ -9,6 +9,7 @@
 
 #include "stdafx.h"  // PCH
 #include "GameMode.h"
+#include "MsgTrafficStats.h"
 #include "Player.h"
 #include "PRooFPS-dd-packet.h"
 
@@ -467,7 +468,7 @@ bool proofps_dd::GameMode::serverSendGameSessionStateToClient(pge_network::PgeIN
         assert(false);
         return false;
     }
-    network.getServer().send(pktGameSessionState, connHandle);
+    MsgTrafficStats::serverSend(network, pktGameSessionState, connHandle);
 
     return true;
 }
@@ -485,7 +486,7 @@ bool proofps_dd::GameMode::serverSendGameSessionStateToClients(pge_network::PgeI
         assert(false);
         return false;
     }
-    network.getServer().sendToAllClientsExcept(pktGameSessionState);
+    MsgTrafficStats::serverSendToAllClientsExcept(network, pktGameSessionState);
 
     return true;
 }
@@ -1538,7 +1539,7 @@ bool proofps_dd::TeamRoundGameMode::serverSendRoundStateToClient(pge_network::Pg
         assert(false);
         return false;
     }
-    network.getServer().send(pktRoundState, connHandle);
+    MsgTrafficStats::serverSend(network, pktRoundState, connHandle);
 
     return true;
 }
@@ -1558,7 +1559,7 @@ bool proofps_dd::TeamRoundGameMode::serverSendRoundStateToClients(pge_network::P
         assert(false);
         return false;
     }
-    network.getServer().sendToAllClientsExcept(pktRoundState);
+    MsgTrafficStats::serverSendToAllClientsExcept(network, pktRoundState);
 
     return true;
 }
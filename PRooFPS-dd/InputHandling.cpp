@@ -14,6 +14,8 @@
 //#include <unistd.h>   // for getpid()
 #include <process.h>  // for getpid()
 
+#include "MsgTrafficStats.h"
+#include "StringTable.h"
 #include "SharedWithTest.h"
 
 #include "Test.h"
@@ -53,7 +55,13 @@ proofps_dd::InputHandling::InputHandling(
     m_bPrevJump(false),
     m_bJump(false),
     m_fLastPlayerAngleYSent(-1.f),
-    m_fLastWeaponAngleZSent(0.f)
+    m_fLastWeaponAngleZSent(0.f),
+    m_nLastUserCmdSeqSent(0),
+    m_inputSampler({
+        VK_LEFT, VK_RIGHT, (unsigned char)VkKeyScan('a'), (unsigned char)VkKeyScan('d'),
+        (unsigned char)VkKeyScan('s'), (unsigned char)VkKeyScan('w'), VK_SPACE, VK_CONTROL,
+        VK_LBUTTON }),
+    m_bFireButtonHeldSampled(false)
 {
     // note that the following should not be touched here as they are not fully constructed when we are here:
     // pge, durations, gui, mapPlayers, maps, sounds
@@ -86,8 +94,13 @@ proofps_dd::InputHandling::PlayerAppActionRequest proofps_dd::InputHandling::cli
     const unsigned int nTickrate,
     const unsigned int nClUpdateRate,
     const unsigned int nPhysicsRateMin,
+    const std::uint32_t& nViewServerTick,
+    const std::uint32_t& nEchoServerTimeMillisecs,
+    proofps_dd::ClientPrediction& clientPrediction,
     proofps_dd::WeaponHandling& wpnHandling /* this design is really bad this way as it is explained in serverHandleUserCmdMoveFromClient() */)
 {
+    m_bFireButtonHeldSampled = m_inputSampler.isKeyHeld(VK_LBUTTON);
+
     pge_network::PgePacket pkt;
     /* we always init the pkt with the current strafe state so it is correctly sent to server even if we are not setting it
        in the keyboard function, this is needed if only clientMouseWhenConnectedToServer() generates reason to send the pkt */
@@ -98,7 +111,7 @@ proofps_dd::InputHandling::PlayerAppActionRequest proofps_dd::InputHandling::cli
     if (playerAppActionReq == proofps_dd::InputHandling::PlayerAppActionRequest::None)
     {
         clientMouseWhenConnectedToServer(gameMode, pkt, player, xhair.getObject3D());
-        clientUpdatePlayerAsPerInputAndSendUserCmdMoveToServer(pkt, player, xhair.getObject3D(), gameMode);
+        clientUpdatePlayerAsPerInputAndSendUserCmdMoveToServer(pkt, player, xhair.getObject3D(), gameMode, nViewServerTick, nEchoServerTimeMillisecs, clientPrediction);
     }
     return playerAppActionReq;
 }
@@ -108,6 +121,44 @@ proofps_dd::InputHandling::PlayerAppActionRequest proofps_dd::InputHandling::cli
     return clientKeyboardWhenDisconnectedFromServer();
 }
 
+const std::uint32_t& proofps_dd::InputHandling::getLastUserCmdSeqSent() const
+{
+    return m_nLastUserCmdSeqSent;
+}
+
+/**
+* Starts sampling movement keys and fire button on a separate thread, see InputSampler.
+*/
+bool proofps_dd::InputHandling::startInputSampling()
+{
+    return m_inputSampler.start();
+}
+
+void proofps_dd::InputHandling::stopInputSampling()
+{
+    m_inputSampler.stop();
+    m_inputSampler.clear();
+}
+
+/**
+* Expected to be invoked in every frame right before input handling with the current time, so the key states evaluated by the input
+* handling reflect all key presses and releases that happened until then, even the ones shorter than a frame.
+* The effect of a key press is applied for the whole frame though, since the user cmd is built once per frame.
+* Keys pressed while our window is not active are ignored, also pending key presses are forgotten so they won't have any effect later
+* when the window becomes active again.
+*/
+void proofps_dd::InputHandling::consumeInputEventsUntil(
+    const std::chrono::time_point<std::chrono::steady_clock>& timeUntil,
+    bool bWindowActive)
+{
+    m_inputSampler.setEnabled(bWindowActive);
+    m_inputSampler.consumeEventsUntil(timeUntil);
+    if (!bWindowActive)
+    {
+        m_inputSampler.clear();
+    }
+}
+
 bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
     pge_network::PgeNetworkConnectionHandle connHandleServerSide,
     const proofps_dd::MsgUserCmdFromClient& pktUserCmdMove,
@@ -125,12 +176,6 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
         return false;
     }
 
-    if (gameMode.isGameWon())
-    {
-        // no input shall be accepted from any client when game is already finished
-        return true;
-    }
-
     const auto it = m_mapPlayers.find(connHandleServerSide);
     if (m_mapPlayers.end() == it)
     {
@@ -139,8 +184,24 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
         return true;    // in release mode, we dont terminate the server, just silently ignore: same reason as in PlayerHandling::serverHandleUserInGameMenuCmd()
     }
 
+    const auto timeArrival = std::chrono::steady_clock::now();
+    it->second.getClockSync().addClientTimestamp(pktUserCmdMove.m_nClientTimeMillisecs, timeArrival);
+    it->second.getClockSync().addRttSample(pktUserCmdMove.m_nEchoServerTimeMillisecs, timeArrival);
+
+    if (gameMode.isGameWon())
+    {
+        // no input shall be accepted from any client when game is already finished
+        return true;
+    }
+
     const std::string& sClientUserName = it->second.getName();
 
+    // acknowledged back in MsgUserUpdateFromServer, even if this cmd is ignored below, the client needs to know it has been processed
+    if (pktUserCmdMove.m_nCmdSeq != 0)
+    {
+        it->second.setLastCmdSeqProcessed(pktUserCmdMove.m_nCmdSeq);
+    }
+
     if ((!pktUserCmdMove.m_bJumpAction) && (!pktUserCmdMove.m_bCrouch) && (!pktUserCmdMove.m_bDescent) && (!pktUserCmdMove.m_bSendSwitchToRunning) &&
         (pktUserCmdMove.m_fPlayerAngleY == -1.f) && (!pktUserCmdMove.m_bRequestReload) && (!pktUserCmdMove.m_bShouldSend))
     {
@@ -185,11 +246,12 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
     }
 
     const std::chrono::time_point<std::chrono::steady_clock> timeStart = std::chrono::steady_clock::now();
+    const ClockSync::MsgTime cmdTime{ pktUserCmdMove.m_nClientTimeMillisecs, timeArrival };
 
     if (pktUserCmdMove.m_bSendSwitchToRunning)
     {
         const auto nMillisecsSinceLastToggleRunning =
-            std::chrono::duration_cast<std::chrono::milliseconds>(timeStart - player.getTimeLastToggleRun()).count();
+            serverGetMillisecsSinceLastRateLimitedCmd(playerConst, Player::RateLimitedCmd::ToggleRun, cmdTime);
         if (nMillisecsSinceLastToggleRunning < m_nKeyPressOnceWpnHandlingMinumumWaitMilliseconds)
         {
             // should NOT had received this from client this early
@@ -200,6 +262,7 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
         }
         else
         {
+            player.getLastRateLimitedCmdTime(Player::RateLimitedCmd::ToggleRun) = cmdTime;
             player.setRun(!player.isRunning());
         }
     }
@@ -222,7 +285,7 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
     if (pktUserCmdMove.m_bToggleUseItem && gameMode.isPlayerMovementAllowed())
     {
         const auto nMillisecsSinceLastToggle =
-            std::chrono::duration_cast<std::chrono::milliseconds>(timeStart - player.getTimeLastToggleUseItem()).count();
+            serverGetMillisecsSinceLastRateLimitedCmd(playerConst, Player::RateLimitedCmd::ToggleUseItem, cmdTime);
         if (nMillisecsSinceLastToggle < m_nKeyPressOnceToggleUseItemMinumumWaitMilliseconds)
         {
             // should NOT had received this from client this early
@@ -233,6 +296,7 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
         }
         else
         {
+            player.getLastRateLimitedCmdTime(Player::RateLimitedCmd::ToggleUseItem) = cmdTime;
             player.handleToggleInventoryItem(MapItemType::ITEM_JETLAX, false);
         }
     }
@@ -327,22 +391,22 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
             else
             {
                 //getConsole().EOLn("not jumping");
-                if (nMillisecsSinceLastJump < m_nKeyPressOnceJumpMinumumWaitMilliseconds)
+                const auto nMillisecsSinceLastJumpCmd =
+                    serverGetMillisecsSinceLastRateLimitedCmd(playerConst, Player::RateLimitedCmd::Jump, cmdTime);
+                if (nMillisecsSinceLastJumpCmd < m_nKeyPressOnceJumpMinumumWaitMilliseconds)
                 {
                     // should NOT had received this from client this early (actually could, see explanation below)
                     getConsole().EOLn("InputHandling::%s(): player %s sent jump request too early, ignoring (actual: %d, req: %d)!",
-                        __func__, sClientUserName.c_str(), nMillisecsSinceLastJump, m_nKeyPressOnceJumpMinumumWaitMilliseconds);
+                        __func__, sClientUserName.c_str(), nMillisecsSinceLastJumpCmd, m_nKeyPressOnceJumpMinumumWaitMilliseconds);
                     // For now, dont terminate. Reason: since client does the rate limit on its side, it can happen that the required time elapsed
                     // at client-side but did not elapse at server-side. Imagine client sends a packet to server, the ping is a bit high. Client
                     // already starts to wait the required delay before sending next packet. Server receives the packet 30 ms later and starts
                     // measuring time. In the meantime client sends next packet, ping is lower, delay is much less, so server receives the packet
                     // a few msecs earlier than the required delay elapsed on server-side.
-                    // So we should not terminate but log these occurrences to understand how many such occasions are there on LAN party.
-                    // A way to solve this issue in reliable way is that client must always send its timestamp as well to the server, so
-                    // server can check if required time elapsed based on client's sent timestamp compared to the previously sent timestamp.
-                    // To avoid cheating, server must also decide if client timestamp is valid: server must save the initial client timestamp
-                    // upon client connect, and it can check if game session time duration is actually matching the real elapsed time with
-                    // client's elapsed time.
+                    // Client sends its timestamp in every cmd, so server measures the time between cmds by these timestamps instead of arrival
+                    // times, see serverGetMillisecsSinceLastRateLimitedCmd(). Timestamps are checked against arrival times and the estimated
+                    // clock drift, so a client cannot gain much by faking them.
+                    // So we should not terminate but log the remaining occurrences to understand how many such occasions are there on LAN party.
                     //assert(false);  // in debug mode, terminate the game
                 }
                 else
@@ -350,6 +414,7 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
                     // Since we are doing the actual strafe movement in the Physics class, the forces we would like to record at the moment
                     // of jumping up are available there, not here. So here we are just recording that we will do the jump: delaying it to the
                     // Physics class, so inside there at the correct place jump() will be invoked and correct forces will be saved.
+                    player.getLastRateLimitedCmdTime(Player::RateLimitedCmd::Jump) = cmdTime;
                     player.setWillJumpInNextTick(1.f, 0.f);
                 }
             }
@@ -369,9 +434,8 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
 
     if (pktUserCmdMove.m_bRequestReload)
     {
-        static std::chrono::time_point<std::chrono::steady_clock> timeLastWpnReload;
         const auto nMillisecsSinceLastWpnReload =
-            std::chrono::duration_cast<std::chrono::milliseconds>(timeStart - timeLastWpnReload).count();
+            serverGetMillisecsSinceLastRateLimitedCmd(playerConst, Player::RateLimitedCmd::WpnReload, cmdTime);
         if (nMillisecsSinceLastWpnReload < m_nKeyPressOnceWpnHandlingMinumumWaitMilliseconds)
         {
             // should NOT had received this from client this early
@@ -382,7 +446,7 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
         }
         else
         {
-            timeLastWpnReload = std::chrono::steady_clock::now();
+            player.getLastRateLimitedCmdTime(Player::RateLimitedCmd::WpnReload) = cmdTime;
             if (wpn->reload())
             {
 
@@ -400,9 +464,7 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
     if (!pktUserCmdMove.m_bRequestReload && (wpn->getState() == Weapon::State::WPN_READY) && (pktUserCmdMove.m_cWeaponSwitch != '\0'))
     {
         const auto nMillisecsSinceLastWpnSwitch =
-            std::chrono::duration_cast<std::chrono::milliseconds>(
-                timeStart - player.getWeaponManager().getTimeLastWeaponSwitch()
-            ).count();
+            serverGetMillisecsSinceLastRateLimitedCmd(playerConst, Player::RateLimitedCmd::WpnSwitch, cmdTime);
         if (nMillisecsSinceLastWpnSwitch < m_nKeyPressOnceWpnHandlingMinumumWaitMilliseconds)
         {
             // should NOT had received this from client this early
@@ -413,6 +475,7 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
         }
         else
         {
+            player.getLastRateLimitedCmdTime(Player::RateLimitedCmd::WpnSwitch) = cmdTime;
             const auto itTargetWpn = WeaponManager::getKeypressToWeaponMap().find(pktUserCmdMove.m_cWeaponSwitch);
             if (itTargetWpn == WeaponManager::getKeypressToWeaponMap().end())
             {
@@ -488,9 +551,9 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
                 proofps_dd::MsgCurrentWpnUpdateFromServer::initPkt(
                     pktWpnUpdateCurrent,
                     connHandleServerSide,
-                    pTargetWpn->getFilename(),
+                    StringTable::serverIntern(m_pge.getNetwork(), pTargetWpn->getFilename()),
                     pTargetWpn->getState().getNew());
-                m_pge.getNetwork().getServer().sendToAllClientsExcept(pktWpnUpdateCurrent);
+                MsgTrafficStats::serverSendToAllClientsExcept(m_pge.getNetwork(), pktWpnUpdateCurrent);
             }
             //else
             //{
@@ -553,6 +616,21 @@ bool proofps_dd::InputHandling::serverHandleUserCmdMoveFromClient(
 // ############################### PRIVATE ###############################
 
 
+/**
+* Server-side rate limits measure the time between the client timestamps of cmds, so network jitter cannot make a cmd look too early
+* if client respected the rate limit. See ClockSync::getClientIntervalMillisecs() about how client timestamps are checked.
+*
+* @return Milliseconds elapsed between the last cmd in which the given action was accepted and the given cmd.
+*/
+std::chrono::milliseconds::rep proofps_dd::InputHandling::serverGetMillisecsSinceLastRateLimitedCmd(
+    const proofps_dd::Player& player,
+    const proofps_dd::Player::RateLimitedCmd& cmd,
+    const proofps_dd::ClockSync::MsgTime& cmdTime) const
+{
+    return player.getClockSync().getClientIntervalMillisecs(
+        player.getLastRateLimitedCmdTime(cmd), cmdTime, m_nRateLimitClientTimeDeviationMaxMilliseconds);
+}
+
 void proofps_dd::InputHandling::clientKeyboardWhenConnectedToServer_Spectating(
     proofps_dd::GameMode& gameMode,
     const proofps_dd::Player& player)
@@ -788,14 +866,23 @@ proofps_dd::InputHandling::PlayerAppActionRequest proofps_dd::InputHandling::cli
         ScopeBenchmarkerDataStore::clear(); // since ScopeBenchmarker works with static data, make sure we dont leave anything there
     }
 
+    // Continuous movement keys are read from the input sampler instead of the engine: a key pressed even for a shorter time than a frame
+    // is seen as held now. All keys are read here unconditionally, since reading also clears their pressed-since-last-read latch.
+    const bool bStrafeLeftHeld = m_inputSampler.isKeyHeld(VK_LEFT) | m_inputSampler.isKeyHeld((unsigned char)VkKeyScan('a'));
+    const bool bStrafeRightHeld = m_inputSampler.isKeyHeld(VK_RIGHT) | m_inputSampler.isKeyHeld((unsigned char)VkKeyScan('d'));
+    const bool bCrouchHeld = m_inputSampler.isKeyHeld(VK_CONTROL);
+    const bool bDescentHeld = m_inputSampler.isKeyHeld((unsigned char)VkKeyScan('s'));
+    const bool bJumpHeld = m_inputSampler.isKeyHeld(VK_SPACE) | m_inputSampler.isKeyHeld((unsigned char)VkKeyScan('w'));
+    const bool bJumpPressedOnce =
+        m_inputSampler.isKeyPressedOnce(VK_SPACE, std::chrono::milliseconds(m_nKeyPressOnceJumpMinumumWaitMilliseconds)) |
+        m_inputSampler.isKeyPressedOnce((unsigned char)VkKeyScan('w'), std::chrono::milliseconds(m_nKeyPressOnceJumpMinumumWaitMilliseconds));
+
     // For now we dont need rate limit for strafe, but in future if FPS limit can be disable we probably will want to limit this!
-    if (gameMode.isPlayerMovementAllowed() &&
-        (m_pge.getInput().getKeyboard().isKeyPressed(VK_LEFT) || m_pge.getInput().getKeyboard().isKeyPressed((unsigned char)VkKeyScan('a'))))
+    if (gameMode.isPlayerMovementAllowed() && bStrafeLeftHeld)
     {
         m_strafe = proofps_dd::Strafe::LEFT;
     }
-    else if (gameMode.isPlayerMovementAllowed() &&
-        (m_pge.getInput().getKeyboard().isKeyPressed(VK_RIGHT) || m_pge.getInput().getKeyboard().isKeyPressed((unsigned char)VkKeyScan('d'))))
+    else if (gameMode.isPlayerMovementAllowed() && bStrafeRightHeld)
     {
         m_strafe = proofps_dd::Strafe::RIGHT;
     }
@@ -806,20 +893,18 @@ proofps_dd::InputHandling::PlayerAppActionRequest proofps_dd::InputHandling::cli
 
     // isKeyPressed() detects left SHIFT or CONTROL keys only, detecting the right-side stuff requires engine update.
     // For now we dont need rate limit for this, but in future if FPS limit can be disabled we probably will want to limit this!
-    m_bCrouch = m_pge.getInput().getKeyboard().isKeyPressed(VK_CONTROL);
+    m_bCrouch = bCrouchHeld;
 
     // in v0.6 crouch also controlled jetlax descent, but v0.7 separated descent from crouch, both now can be done separately or together.
-    m_bDescent = gameMode.isPlayerMovementAllowed() && m_pge.getInput().getKeyboard().isKeyPressed((unsigned char)VkKeyScan('s'));
+    m_bDescent = gameMode.isPlayerMovementAllowed() && bDescentHeld;
 
     if (player.hasAntiGravityActive())
     {
-        m_bJump = gameMode.isPlayerMovementAllowed() &&
-            m_pge.getInput().getKeyboard().areKeysPressed(VK_SPACE, (unsigned char)VkKeyScan('w'));
+        m_bJump = gameMode.isPlayerMovementAllowed() && bJumpHeld;
     }
     else
     {
-        m_bJump = gameMode.isPlayerMovementAllowed() &&
-            m_pge.getInput().getKeyboard().areKeysPressedOnce(VK_SPACE, (unsigned char)VkKeyScan('w'), m_nKeyPressOnceJumpMinumumWaitMilliseconds);
+        m_bJump = gameMode.isPlayerMovementAllowed() && bJumpPressedOnce;
     }
 
     bool bToggleRunWalk = false;
@@ -838,7 +923,7 @@ proofps_dd::InputHandling::PlayerAppActionRequest proofps_dd::InputHandling::cli
         }
     }
 
-    const bool bFireButtonPressed = gameMode.isPlayerMovementAllowed() && m_pge.getInput().getMouse().isButtonPressed(PGEInputMouse::MouseButton::MBTN_LEFT);
+    const bool bFireButtonPressed = gameMode.isPlayerMovementAllowed() && m_bFireButtonHeldSampled;
     if (bFireButtonPressed)
     {
         // neither of the firing-induced auto-reload or auto-switch behaviors can be executed if user is still pressing fire button, however
@@ -1224,7 +1309,7 @@ bool proofps_dd::InputHandling::clientMouseWhenConnectedToServer(
     if (gameMode.isPlayerMovementAllowed())
     {
         const bool bFireButtonPressed =
-            m_pge.getInput().getMouse().isButtonPressed(PGEInputMouse::MouseButton::MBTN_LEFT) &&
+            m_bFireButtonHeldSampled &&
             ((std::as_const(player).getHealth() > 0) ||
              ((std::as_const(player).getHealth() == 0) && gameMode.isRespawnAllowedAfterDie()));
 
@@ -1303,7 +1388,10 @@ void proofps_dd::InputHandling::clientUpdatePlayerAsPerInputAndSendUserCmdMoveTo
     pge_network::PgePacket& pkt,
     proofps_dd::Player& player,
     PureObject3D& objXHair,
-    proofps_dd::GameMode& gameMode)
+    proofps_dd::GameMode& gameMode,
+    const std::uint32_t& nViewServerTick,
+    const std::uint32_t& nEchoServerTimeMillisecs,
+    proofps_dd::ClientPrediction& clientPrediction)
 {
     if (!gameMode.isPlayerAllowedForGameplay(player))
     {
@@ -1380,7 +1468,43 @@ void proofps_dd::InputHandling::clientUpdatePlayerAsPerInputAndSendUserCmdMoveTo
         // Instead of using sendToServer() of getClient() or inject() of getServer() instances, we use the send() of
         // their common interface which always points to the initialized instance, which is either client or server.
         // Btw send() in case of server instance and server as target is implemented as an inject() as of May 2023.
-        m_pge.getNetwork().getServerClientInstance()->send(pkt);
+        ++m_nLastUserCmdSeqSent;
+        if (m_nLastUserCmdSeqSent == 0)
+        {
+            // 0 is reserved for "none", skip it on wraparound
+            ++m_nLastUserCmdSeqSent;
+        }
+        proofps_dd::MsgUserCmdFromClient::setCmdSeq(pkt, m_nLastUserCmdSeqSent);
+        // server-side lag compensation: bullets we fire are hit-tested against players as we see them now
+        proofps_dd::MsgUserCmdFromClient::setViewServerTick(pkt, nViewServerTick);
+        // server estimates our clock and connection timing from these, see ClockSync
+        proofps_dd::MsgUserCmdFromClient::setTimestamps(pkt, ClockSync::toMillisecs32(std::chrono::steady_clock::now()), nEchoServerTimeMillisecs);
+
+        if (!m_pge.getNetwork().isServer())
+        {
+            // Client-side prediction: continuous movement inputs are applied to our own player immediately, the same way as server will apply them
+            // when this cmd arrives, see Physics::clientPredictLocalPlayerMovement().
+            // Server player doesnt need this since it injects the cmd to itself and processes it right away.
+            const proofps_dd::MsgUserCmdFromClient& msgUserCmdMove = pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgUserCmdFromClient>(pkt);
+            if (msgUserCmdMove.m_strafe != player.getStrafe())
+            {
+                player.setStrafe(msgUserCmdMove.m_strafe);
+            }
+            if (msgUserCmdMove.m_bJumpAction && !player.hasAntiGravityActive() && !player.isJumping())
+            {
+                // same as server's handling of jump input, setWillJumpInNextTick() does nothing if prediction does not allow jumping now,
+                // and if server rejects this jump (e.g. arrived too early), reconciliation corrects our position
+                player.setWillJumpInNextTick(1.f, 0.f);
+            }
+            if (msgUserCmdMove.m_bSendSwitchToRunning)
+            {
+                // server might reject the toggle, the authoritative running state is reconciled in PlayerHandling::handleUserUpdateFromServer()
+                player.setRun(!player.isRunning());
+                clientPrediction.addRunToggle(m_nLastUserCmdSeqSent);
+            }
+        }
+
+        MsgTrafficStats::send(m_pge.getNetwork(), pkt);
         timeLastMsgUserCmdFromClientSent = std::chrono::steady_clock::now();
     }
 }
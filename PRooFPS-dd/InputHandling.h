@@ -15,9 +15,11 @@
 #include "PGE.h"
 
 #include "CameraHandling.h"
+#include "ClientPrediction.h"
 #include "Durations.h"
 #include "GameMode.h"
 #include "GUI.h"
+#include "InputSampler.h"
 #include "Maps.h"
 #include "Player.h"
 #include "PRooFPS-dd-packet.h"
@@ -45,6 +47,7 @@ namespace proofps_dd
         static constexpr std::chrono::milliseconds::rep m_nPlayerAngleYSendIntervalMilliseconds = 100;
         static constexpr std::chrono::milliseconds::rep m_nWeaponAngleZBigChangeSendIntervalMilliseconds = 100;
         static constexpr std::chrono::milliseconds::rep m_nWeaponAngleZSmallChangeSendIntervalMilliseconds = 200;
+        static constexpr std::uint32_t m_nRateLimitClientTimeDeviationMaxMilliseconds = 30;  /**< Server-side rate limits accept client time ahead of arrival time at most this much. */
         static constexpr float m_fWeaponAngleZBigChangeThreshold = 30.f;
 
         static const char* getLoggerModuleName();
@@ -76,6 +79,9 @@ namespace proofps_dd
             const unsigned int nTickrate,
             const unsigned int nClUpdateRate,
             const unsigned int nPhysicsRateMin,
+            const std::uint32_t& nViewServerTick,
+            const std::uint32_t& nEchoServerTimeMillisecs,
+            proofps_dd::ClientPrediction& clientPrediction,
             proofps_dd::WeaponHandling& wpnHandling);
 
         PlayerAppActionRequest clientHandleInputWhenDisconnectedFromServer();
@@ -86,6 +92,14 @@ namespace proofps_dd
             proofps_dd::GameMode& gameMode,
             proofps_dd::WeaponHandling& wpnHandling /* this design is really bad this way */);
 
+        const std::uint32_t& getLastUserCmdSeqSent() const;
+
+        bool startInputSampling();
+        void stopInputSampling();
+        void consumeInputEventsUntil(
+            const std::chrono::time_point<std::chrono::steady_clock>& timeUntil,
+            bool bWindowActive);
+
     private:
 
         static const char* getMsgAppIdName(const proofps_dd::PRooFPSappMsgId& id);
@@ -112,8 +126,16 @@ namespace proofps_dd
         bool m_bJump;
         TPureFloat m_fLastPlayerAngleYSent;
         TPureFloat m_fLastWeaponAngleZSent;
+        std::uint32_t m_nLastUserCmdSeqSent;  /**< Sequence number of the last sent MsgUserCmdFromClient, 0 if none yet. */
+        InputSampler m_inputSampler;  /**< Movement keys and fire button, so short presses between 2 frames are not lost. */
+        bool m_bFireButtonHeldSampled;  /**< Fire button state fetched from m_inputSampler once per frame, since its latch is cleared by reading. */
 
         
+        std::chrono::milliseconds::rep serverGetMillisecsSinceLastRateLimitedCmd(
+            const proofps_dd::Player& player,
+            const proofps_dd::Player::RateLimitedCmd& cmd,
+            const proofps_dd::ClockSync::MsgTime& cmdTime) const;
+
         void clientKeyboardWhenConnectedToServer_Spectating(
             proofps_dd::GameMode& gameMode,
             const proofps_dd::Player& player);
@@ -142,7 +164,10 @@ namespace proofps_dd
             pge_network::PgePacket& pkt,
             proofps_dd::Player& player,
             PureObject3D& objXHair,
-            proofps_dd::GameMode& gameMode);
+            proofps_dd::GameMode& gameMode,
+            const std::uint32_t& nViewServerTick,
+            const std::uint32_t& nEchoServerTimeMillisecs,
+            proofps_dd::ClientPrediction& clientPrediction);
 
         void clientMouseWheel(
             const short int& nMouseWheelChange,
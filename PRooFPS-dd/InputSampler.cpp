@@ -0,0 +1,332 @@
+/*
+    ###################################################################################
+    InputSampler.cpp
+    High-frequency sampling of keyboard and mouse buttons for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include "InputSampler.h"
+
+// available since Windows 10 1803, older SDKs might not define it
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+
+// ############################### PUBLIC ################################
+
+
+const char* proofps_dd::InputSampler::getLoggerModuleName()
+{
+    return "InputSampler";
+}
+
+/**
+* Default key state function: physical state of the given key or mouse button at the moment of invocation, independent of the
+* message queue of any window, so it can be invoked by any thread.
+*/
+bool proofps_dd::InputSampler::isKeyDownAsync(TKey nKey)
+{
+    // GetAsyncKeyState() maps mouse buttons to physical buttons, not logical ones
+    if (((nKey == VK_LBUTTON) || (nKey == VK_RBUTTON)) && GetSystemMetrics(SM_SWAPBUTTON))
+    {
+        nKey = (nKey == VK_LBUTTON) ? VK_RBUTTON : VK_LBUTTON;
+    }
+    return (GetAsyncKeyState(nKey) & 0x8000) != 0;
+}
+
+CConsole& proofps_dd::InputSampler::getConsole() const
+{
+    return CConsole::getConsoleInstance(getLoggerModuleName());
+}
+
+/**
+* @param vecKeys         The keys and mouse buttons to be sampled, all other keys are ignored.
+* @param funcIsKeyDown   Tells the current state of a key, invoked by the sampler thread.
+* @param nSamplingPeriod Time between 2 samples by the sampler thread.
+* @param nQueueCapacity  Maximum number of events not yet consumed.
+*/
+proofps_dd::InputSampler::InputSampler(
+    const std::vector<TKey>& vecKeys,
+    const TKeyStateFunc& funcIsKeyDown,
+    const std::chrono::microseconds& nSamplingPeriod,
+    const size_t& nQueueCapacity) :
+    m_vecKeys(vecKeys),
+    m_funcIsKeyDown(funcIsKeyDown),
+    m_nSamplingPeriod(nSamplingPeriod),
+    m_vecKeysDownSampled(vecKeys.size(), false),
+    m_queueEvents(nQueueCapacity)
+{
+    for (const auto& nKey : m_vecKeys)
+    {
+        m_mapKeyStates[nKey] = KeyState();
+    }
+}
+
+proofps_dd::InputSampler::~InputSampler()
+{
+    stop();
+}
+
+/**
+* Starts the sampler thread. From now on, sample() must not be invoked by anyone else.
+*
+* @return False if the thread is already running or could not be started, true otherwise.
+*/
+bool proofps_dd::InputSampler::start()
+{
+    if (isRunning())
+    {
+        getConsole().EOLn("InputSampler::%s(): already running!", __func__);
+        return false;
+    }
+
+    m_bRunning = true;
+    try
+    {
+        m_thread = std::thread(&InputSampler::threadFunc, this);
+    }
+    catch (const std::exception& e)
+    {
+        getConsole().EOLn("InputSampler::%s(): failed to start thread: %s!", __func__, e.what());
+        m_bRunning = false;
+        return false;
+    }
+    return true;
+}
+
+/**
+* Stops the sampler thread and waits for it to finish. Events already queued can still be consumed.
+*/
+void proofps_dd::InputSampler::stop()
+{
+    m_bRunning = false;
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+bool proofps_dd::InputSampler::isRunning() const
+{
+    return m_bRunning;
+}
+
+/**
+* While disabled, all keys are sampled as released, e.g. we don't want to react to keys pressed while our window is not active.
+* Can be invoked by any thread.
+*/
+void proofps_dd::InputSampler::setEnabled(bool bEnabled)
+{
+    m_bEnabled = bEnabled;
+}
+
+bool proofps_dd::InputSampler::isEnabled() const
+{
+    return m_bEnabled;
+}
+
+/**
+* Producer only.
+* Samples all keys and queues an event for each key that changed its state since the previous sample.
+* Invoked periodically by the sampler thread, can be invoked directly only if the thread is not running.
+* If the queue is full, the event is dropped and the key will be sampled again next time.
+*/
+void proofps_dd::InputSampler::sample(const std::chrono::time_point<std::chrono::steady_clock>& timeSample)
+{
+    const bool bEnabled = m_bEnabled;
+    for (size_t i = 0; i < m_vecKeys.size(); i++)
+    {
+        const bool bDown = bEnabled && m_funcIsKeyDown(m_vecKeys[i]);
+        if (bDown == m_vecKeysDownSampled[i])
+        {
+            continue;
+        }
+
+        if (m_queueEvents.push(KeyEvent{ m_vecKeys[i], bDown, timeSample }))
+        {
+            m_vecKeysDownSampled[i] = bDown;
+        }
+        else
+        {
+            m_nDroppedEventsCount++;
+        }
+    }
+}
+
+/**
+* Consumer only.
+* Applies all events having timestamp not later than the given time to the key states, in the order of their occurrence.
+* Since every key down event is latched until the next isKeyHeld() query, a key pressed and released within the consumed
+* period is not lost.
+*/
+void proofps_dd::InputSampler::consumeEventsUntil(const std::chrono::time_point<std::chrono::steady_clock>& timeUntil)
+{
+    if (m_bEventPending)
+    {
+        if (m_eventPending.m_time > timeUntil)
+        {
+            return;
+        }
+        applyEvent(m_eventPending);
+        m_bEventPending = false;
+    }
+
+    KeyEvent event;
+    while (m_queueEvents.pop(event))
+    {
+        if (event.m_time > timeUntil)
+        {
+            m_eventPending = event;
+            m_bEventPending = true;
+            break;
+        }
+        applyEvent(event);
+    }
+
+    if (timeUntil > m_timeLastConsumed)
+    {
+        m_timeLastConsumed = timeUntil;
+    }
+}
+
+/**
+* Consumer only.
+* @return State of the given key as of the last consumed event.
+*/
+bool proofps_dd::InputSampler::isKeyDown(TKey nKey) const
+{
+    const auto it = m_mapKeyStates.find(nKey);
+    return (it != m_mapKeyStates.end()) && it->second.m_bDown;
+}
+
+/**
+* Consumer only.
+* @return True if the given key is down as of the last consumed event, or it has been pressed since the previous invocation
+*         of this function for the same key, false otherwise.
+*/
+bool proofps_dd::InputSampler::isKeyHeld(TKey nKey)
+{
+    const auto it = m_mapKeyStates.find(nKey);
+    if (it == m_mapKeyStates.end())
+    {
+        return false;
+    }
+
+    const bool bHeld = it->second.m_bDown || it->second.m_bPressedSinceLastQuery;
+    it->second.m_bPressedSinceLastQuery = false;
+    return bHeld;
+}
+
+/**
+* Consumer only.
+* Same as isKeyHeld() but for actions to be triggered once per key press, like PGEInputKeyboard::isKeyPressedOnce(): a key down event
+* since the previous invocation always triggers, a continuously held key triggers again only when at least nMinWait has elapsed since
+* the last trigger. Elapsed time is measured in the consumed time, so it does not depend on the time of the invocation.
+*
+* @return True if the action bound to the given key shall be triggered now, false otherwise.
+*/
+bool proofps_dd::InputSampler::isKeyPressedOnce(TKey nKey, const std::chrono::milliseconds& nMinWait)
+{
+    const auto it = m_mapKeyStates.find(nKey);
+    if (it == m_mapKeyStates.end())
+    {
+        return false;
+    }
+
+    KeyState& keyState = it->second;
+    const bool bPressedOnce =
+        keyState.m_bPressedSinceLastOnceQuery ||
+        (keyState.m_bDown && ((m_timeLastConsumed - keyState.m_timeLastPressedOnce) >= nMinWait));
+    keyState.m_bPressedSinceLastOnceQuery = false;
+    if (bPressedOnce)
+    {
+        keyState.m_timeLastPressedOnce = m_timeLastConsumed;
+    }
+    return bPressedOnce;
+}
+
+/**
+* Consumer only.
+* @return The latest time passed to consumeEventsUntil().
+*/
+const std::chrono::time_point<std::chrono::steady_clock>& proofps_dd::InputSampler::getTimeLastConsumed() const
+{
+    return m_timeLastConsumed;
+}
+
+size_t proofps_dd::InputSampler::getDroppedEventsCount() const
+{
+    return m_nDroppedEventsCount;
+}
+
+/**
+* Consumer only.
+* Drops all events not yet consumed and sets all keys released.
+* Note that the sampler thread still remembers the last sampled states, so a key being held now will not generate a new key down event.
+*/
+void proofps_dd::InputSampler::clear()
+{
+    m_queueEvents.clear();
+    m_bEventPending = false;
+    for (auto& keyStatePair : m_mapKeyStates)
+    {
+        keyStatePair.second = KeyState();
+    }
+    m_timeLastConsumed = {};
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
+
+
+void proofps_dd::InputSampler::threadFunc()
+{
+    // Sleep() and std::this_thread::sleep_for() have the resolution of the system timer which is usually 15.6 ms, that is too coarse
+    // for us, so we try using a high resolution waitable timer, and fall back to sleep_for() only if it is not available.
+    const HANDLE hTimer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    if (!hTimer)
+    {
+        getConsole().EOLn("InputSampler::%s(): high resolution timer is not available, sampling period will be longer than requested!", __func__);
+    }
+
+    while (m_bRunning)
+    {
+        sample(std::chrono::steady_clock::now());
+
+        if (hTimer)
+        {
+            LARGE_INTEGER dueTime;
+            dueTime.QuadPart = -static_cast<LONGLONG>(m_nSamplingPeriod.count()) * 10;  // relative, in 100 ns units
+            if (SetWaitableTimer(hTimer, &dueTime, 0, NULL, NULL, FALSE))
+            {
+                WaitForSingleObject(hTimer, INFINITE);
+                continue;
+            }
+        }
+        std::this_thread::sleep_for(m_nSamplingPeriod);
+    }
+
+    if (hTimer)
+    {
+        CloseHandle(hTimer);
+    }
+}
+
+void proofps_dd::InputSampler::applyEvent(const KeyEvent& event)
+{
+    KeyState& keyState = m_mapKeyStates[event.m_nKey];
+    keyState.m_bDown = event.m_bDown;
+    if (event.m_bDown)
+    {
+        keyState.m_bPressedSinceLastQuery = true;
+        keyState.m_bPressedSinceLastOnceQuery = true;
+    }
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+/*
+    ###################################################################################
+    InputSampler.h
+    High-frequency sampling of keyboard and mouse buttons for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "CConsole.h"
+
+#include "SpscQueue.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Samples the state of a fixed set of keys and mouse buttons on its own thread, with much higher frequency than the framerate,
+    * and records every state change as a timestamped event.
+    *
+    * Engine updates its keyboard and mouse state only once per frame, so a short key press between 2 frames is lost.
+    * The sampler thread (producer) pushes the events into a lock-free queue, and the main thread (consumer) consumes the events
+    * up to a given point in time. Since every key down event is latched until queried, a key pressed and released between 2
+    * consumptions is still seen as pressed once.
+    *
+    * Note that the game consumes the events once per frame, right before building the user cmd, so the timing of a key press is
+    * still quantized to frames: a frame spike stretches a short key press to the length of that frame. The timestamps of the events
+    * are not sent to the server.
+    */
+    class InputSampler
+    {
+    public:
+
+        using TKey = unsigned char;  /**< Virtual key code, same as used with PGEInputKeyboard, also mouse buttons like VK_LBUTTON. */
+        using TKeyStateFunc = std::function<bool(TKey)>;
+
+        struct KeyEvent
+        {
+            TKey m_nKey;
+            bool m_bDown;
+            std::chrono::time_point<std::chrono::steady_clock> m_time;
+        };
+
+        static constexpr std::chrono::microseconds nSamplingPeriodDef{ 1000 };
+        static constexpr size_t nQueueCapacityDef = 256;
+
+        static const char* getLoggerModuleName();
+
+        static bool isKeyDownAsync(TKey nKey);
+
+        // ---------------------------------------------------------------------------
+
+        CConsole& getConsole() const;
+
+        InputSampler(
+            const std::vector<TKey>& vecKeys,
+            const TKeyStateFunc& funcIsKeyDown = isKeyDownAsync,
+            const std::chrono::microseconds& nSamplingPeriod = nSamplingPeriodDef,
+            const size_t& nQueueCapacity = nQueueCapacityDef);
+        ~InputSampler();
+
+        InputSampler(const InputSampler&) = delete;
+        InputSampler& operator=(const InputSampler&) = delete;
+        InputSampler(InputSampler&&) = delete;
+        InputSampler&& operator=(InputSampler&&) = delete;
+
+        bool start();
+        void stop();
+        bool isRunning() const;
+
+        void setEnabled(bool bEnabled);
+        bool isEnabled() const;
+
+        void sample(const std::chrono::time_point<std::chrono::steady_clock>& timeSample);
+
+        void consumeEventsUntil(const std::chrono::time_point<std::chrono::steady_clock>& timeUntil);
+        bool isKeyDown(TKey nKey) const;
+        bool isKeyHeld(TKey nKey);
+        bool isKeyPressedOnce(TKey nKey, const std::chrono::milliseconds& nMinWait);
+        const std::chrono::time_point<std::chrono::steady_clock>& getTimeLastConsumed() const;
+        size_t getDroppedEventsCount() const;
+        void clear();
+
+    protected:
+
+    private:
+
+        struct KeyState
+        {
+            bool m_bDown = false;
+            bool m_bPressedSinceLastQuery = false;  /**< Latched by key down event, cleared by isKeyHeld(). */
+            bool m_bPressedSinceLastOnceQuery = false;  /**< Latched by key down event, cleared by isKeyPressedOnce(). */
+            std::chrono::time_point<std::chrono::steady_clock> m_timeLastPressedOnce{};  /**< When isKeyPressedOnce() last returned true. */
+        };
+
+        const std::vector<TKey> m_vecKeys;
+        const TKeyStateFunc m_funcIsKeyDown;
+        const std::chrono::microseconds m_nSamplingPeriod;
+
+        std::vector<bool> m_vecKeysDownSampled;  /**< Producer-only, last sampled state of m_vecKeys. */
+        SpscQueue<KeyEvent> m_queueEvents;
+        std::atomic<size_t> m_nDroppedEventsCount{ 0 };
+        std::atomic<bool> m_bEnabled{ true };
+
+        KeyEvent m_eventPending{};        /**< Consumer-only, already popped but its time is later than the last consume time. */
+        bool m_bEventPending = false;     /**< Consumer-only. */
+        std::map<TKey, KeyState> m_mapKeyStates;  /**< Consumer-only. */
+        std::chrono::time_point<std::chrono::steady_clock> m_timeLastConsumed;  /**< Consumer-only. */
+
+        std::thread m_thread;
+        std::atomic<bool> m_bRunning{ false };
+
+        void threadFunc();
+        void applyEvent(const KeyEvent& event);
+
+    }; // class InputSampler
+
+} // namespace proofps_dd
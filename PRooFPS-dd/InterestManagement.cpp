@@ -0,0 +1,166 @@
+/*
+    ###################################################################################
+    InterestManagement.cpp
+    Server-side per-client relevance filtering for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <algorithm>
+
+#include "InterestManagement.h"
+
+
+// ############################### PUBLIC ################################
+
+
+const char* proofps_dd::InterestManagement::getLoggerModuleName()
+{
+    return "InterestManagement";
+}
+
+CConsole& proofps_dd::InterestManagement::getConsole() const
+{
+    return CConsole::getConsoleInstance(getLoggerModuleName());
+}
+
+proofps_dd::InterestManagement::InterestManagement()
+{
+}
+
+const bool& proofps_dd::InterestManagement::isEnabled() const
+{
+    return m_bEnabled;
+}
+
+void proofps_dd::InterestManagement::setEnabled(const bool& bEnabled)
+{
+    if (m_bEnabled != bEnabled)
+    {
+        getConsole().OLn("InterestManagement::%s(): %b", __func__, bEnabled);
+    }
+    m_bEnabled = bEnabled;
+}
+
+/**
+* Forgets all client views and all bullet records.
+* Shall be invoked when all bullets are deleted at once, e.g. map change or game restart, otherwise the recycled bullet ids
+* would be treated as already known by clients.
+*/
+void proofps_dd::InterestManagement::clear()
+{
+    m_clientViews.clear();
+    m_bulletKnownByClients.clear();
+}
+
+void proofps_dd::InterestManagement::updateClientView(
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const float& fViewPosX)
+{
+    ClientView& view = m_clientViews[connHandle];
+    view.m_fViewPosX = fViewPosX;
+    view.m_bKnown = true;
+}
+
+void proofps_dd::InterestManagement::setClientViewUnknown(
+    const pge_network::PgeNetworkConnectionHandle& connHandle)
+{
+    m_clientViews[connHandle].m_bKnown = false;
+}
+
+void proofps_dd::InterestManagement::removeClient(
+    const pge_network::PgeNetworkConnectionHandle& connHandle)
+{
+    m_clientViews.erase(connHandle);
+    for (auto& bulletPair : m_bulletKnownByClients)
+    {
+        auto& vecClients = bulletPair.second;
+        vecClients.erase(std::remove(vecClients.begin(), vecClients.end(), connHandle), vecClients.end());
+    }
+}
+
+size_t proofps_dd::InterestManagement::getClientViewCount() const
+{
+    return m_clientViews.size();
+}
+
+/**
+* Tells if the given horizontal range overlaps the relevance window of the given client.
+* Always true when interest management is disabled or we don't know where the client is looking at.
+*
+* @param connHandle The client.
+* @param fMinX      Left edge of the horizontal range to be checked.
+* @param fMaxX      Right edge of the horizontal range to be checked.
+*
+* @return True if anything happening within the given range might be seen or heard by the client, false otherwise.
+*/
+bool proofps_dd::InterestManagement::isRelevantForClient(
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const float& fMinX,
+    const float& fMaxX) const
+{
+    if (!m_bEnabled)
+    {
+        return true;
+    }
+
+    const auto it = m_clientViews.find(connHandle);
+    if ((it == m_clientViews.end()) || !it->second.m_bKnown)
+    {
+        return true;
+    }
+
+    return (fMaxX >= (it->second.m_fViewPosX - fRelevanceHalfWidthX)) &&
+        (fMinX <= (it->second.m_fViewPosX + fRelevanceHalfWidthX));
+}
+
+bool proofps_dd::InterestManagement::isRelevantForClient(
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const float& fPosX) const
+{
+    return isRelevantForClient(connHandle, fPosX, fPosX);
+}
+
+bool proofps_dd::InterestManagement::isBulletKnownByClient(
+    const Bullet::BulletId& bulletId,
+    const pge_network::PgeNetworkConnectionHandle& connHandle) const
+{
+    const auto it = m_bulletKnownByClients.find(bulletId);
+    if (it == m_bulletKnownByClients.end())
+    {
+        return false;
+    }
+
+    return std::find(it->second.begin(), it->second.end(), connHandle) != it->second.end();
+}
+
+void proofps_dd::InterestManagement::setBulletKnownByClient(
+    const Bullet::BulletId& bulletId,
+    const pge_network::PgeNetworkConnectionHandle& connHandle)
+{
+    auto& vecClients = m_bulletKnownByClients[bulletId];
+    if (std::find(vecClients.begin(), vecClients.end(), connHandle) == vecClients.end())
+    {
+        vecClients.push_back(connHandle);
+    }
+}
+
+void proofps_dd::InterestManagement::forgetBullet(
+    const Bullet::BulletId& bulletId)
+{
+    m_bulletKnownByClients.erase(bulletId);
+}
+
+size_t proofps_dd::InterestManagement::getKnownBulletCount() const
+{
+    return m_bulletKnownByClients.size();
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
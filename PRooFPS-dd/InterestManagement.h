@@ -0,0 +1,113 @@
+#pragma once
+
+/*
+    ###################################################################################
+    InterestManagement.h
+    Server-side per-client relevance filtering for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <map>
+#include <vector>
+
+#include "CConsole.h"
+
+#include "PGE.h"
+
+#include "Maps.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Server-side relevance sets for clients.
+    *
+    * Clients render only a narrow horizontal window around their camera (see Maps::updateVisibilitiesForRenderer()), so sending them
+    * cosmetic-only traffic (bullet creates, plain bullet deletes, bounce and melee hit sounds, indirectly smoke trails) about things
+    * happening far away from them is just a waste of upload bandwidth.
+    * This class keeps track of the horizontal view window of each client, and of the set of clients already informed about each
+    * bullet, so WeaponHandling can decide per client if a bullet-related message is relevant.
+    *
+    * Gameplay-critical traffic (user updates, deaths, item updates, player events, etc.) is NOT filtered by this class, those are still
+    * sent to everyone.
+    */
+    class InterestManagement
+    {
+    public:
+
+        static constexpr char* szCVarSvInterestManagement = "sv_interest_management";
+        static constexpr bool bSvInterestManagementDef = true;
+
+        /** Extra distance added to both sides of the renderer's view window. Camera might follow the xhair and might be still
+            moving towards the player, also the bullet might appear in view before the next server tick, so we are generous here. */
+        static constexpr float fRelevanceMarginX = 6.f;
+        static constexpr float fRelevanceHalfWidthX = Maps::fRenderVisibilityHalfWidthX + fRelevanceMarginX;
+
+        static const char* getLoggerModuleName();
+
+        // ---------------------------------------------------------------------------
+
+        CConsole& getConsole() const;
+
+        InterestManagement();
+
+        InterestManagement(const InterestManagement&) = delete;
+        InterestManagement& operator=(const InterestManagement&) = delete;
+        InterestManagement(InterestManagement&&) = delete;
+        InterestManagement&& operator=(InterestManagement&&) = delete;
+
+        const bool& isEnabled() const;
+        void setEnabled(const bool& bEnabled);
+
+        void clear();
+
+        void updateClientView(
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const float& fViewPosX);
+        void setClientViewUnknown(
+            const pge_network::PgeNetworkConnectionHandle& connHandle);
+        void removeClient(
+            const pge_network::PgeNetworkConnectionHandle& connHandle);
+        size_t getClientViewCount() const;
+
+        bool isRelevantForClient(
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const float& fMinX,
+            const float& fMaxX) const;
+        bool isRelevantForClient(
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const float& fPosX) const;
+
+        bool isBulletKnownByClient(
+            const Bullet::BulletId& bulletId,
+            const pge_network::PgeNetworkConnectionHandle& connHandle) const;
+        void setBulletKnownByClient(
+            const Bullet::BulletId& bulletId,
+            const pge_network::PgeNetworkConnectionHandle& connHandle);
+        void forgetBullet(
+            const Bullet::BulletId& bulletId);
+        size_t getKnownBulletCount() const;
+
+    protected:
+
+    private:
+
+        struct ClientView
+        {
+            float m_fViewPosX = 0.f;
+            bool m_bKnown = false;   /**< False if we cannot tell where the client is looking at, e.g. spectating or dead, then everything is relevant. */
+        };
+
+        bool m_bEnabled = true;
+
+        std::map<pge_network::PgeNetworkConnectionHandle, ClientView> m_clientViews;
+
+        /** Per bullet, the clients already informed about the bullet being created.
+            Usually there are only a few clients so a small vector per bullet is cheaper than a set. */
+        std::map<Bullet::BulletId, std::vector<pge_network::PgeNetworkConnectionHandle>> m_bulletKnownByClients;
+
+    }; // class InterestManagement
+
+} // namespace proofps_dd
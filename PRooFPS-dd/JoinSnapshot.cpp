@@ -0,0 +1,248 @@
+/*
+    ###################################################################################
+    JoinSnapshot.cpp
+    Serialized world state streamed to a connecting client for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#include "JoinSnapshot.h"
+#include "MsgTrafficStats.h"
+#include "PRooFPS-dd-packet.h"
+
+
+// ############################### PUBLIC ################################
+
+
+const char* proofps_dd::JoinSnapshot::getLoggerModuleName()
+{
+    return "JoinSnapshot";
+}
+
+CConsole& proofps_dd::JoinSnapshot::getConsole() const
+{
+    return CConsole::getConsoleInstance(getLoggerModuleName());
+}
+
+void proofps_dd::JoinSnapshot::clear()
+{
+    m_vecData.clear();
+    m_nRecordCount = 0;
+    m_nExpectedLength = 0;
+}
+
+size_t proofps_dd::JoinSnapshot::getLength() const
+{
+    return m_vecData.size();
+}
+
+/**
+* Server-only.
+* @return Number of records added since the last clear().
+*/
+size_t proofps_dd::JoinSnapshot::getRecordCount() const
+{
+    return m_nRecordCount;
+}
+
+/**
+* Server-only.
+* Appends the given app message as a record.
+*
+* @return False if the record is invalid or the snapshot would grow too big, true otherwise.
+*/
+bool proofps_dd::JoinSnapshot::addRecord(
+    const pge_network::MsgApp::TMsgId& msgId,
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const pge_network::TByte* pData,
+    const size_t& nLength)
+{
+    if (!pData || (nLength == 0) || (nLength > std::numeric_limits<std::uint16_t>::max()))
+    {
+        getConsole().EOLn("JoinSnapshot::%s(): invalid record: msgId: %u, length: %u!", __func__, msgId, nLength);
+        return false;
+    }
+
+    if (m_vecData.size() + sizeof(RecordHeader) + nLength > nSnapshotMaxLength)
+    {
+        getConsole().EOLn("JoinSnapshot::%s(): snapshot would be too big, cannot add msgId: %u!", __func__, msgId);
+        return false;
+    }
+
+    RecordHeader header;
+    header.m_msgId = msgId;
+    header.m_connHandle = connHandle;
+    header.m_nLength = static_cast<std::uint16_t>(nLength);
+
+    const size_t nOffset = m_vecData.size();
+    m_vecData.resize(nOffset + sizeof(RecordHeader) + nLength);
+    std::memcpy(&m_vecData[nOffset], &header, sizeof(RecordHeader));
+    std::memcpy(&m_vecData[nOffset + sizeof(RecordHeader)], pData, nLength);
+    m_nRecordCount++;
+    return true;
+}
+
+/**
+* Server-only.
+* @return Number of MsgJoinSnapshotChunkFromServer messages needed to send the snapshot.
+*/
+size_t proofps_dd::JoinSnapshot::getChunkCount() const
+{
+    return (m_vecData.size() + MsgJoinSnapshotChunkFromServer::nDataMaxLength - 1) / MsgJoinSnapshotChunkFromServer::nDataMaxLength;
+}
+
+/**
+* Server-only.
+* Initializes the given packet with the chunk having the given index.
+*
+* @return False if the index is out of range, true otherwise.
+*/
+bool proofps_dd::JoinSnapshot::getChunkAsPkt(const size_t& iChunk, pge_network::PgePacket& pkt) const
+{
+    if (iChunk >= getChunkCount())
+    {
+        return false;
+    }
+
+    const size_t nOffset = iChunk * MsgJoinSnapshotChunkFromServer::nDataMaxLength;
+    const size_t nLength = std::min(MsgJoinSnapshotChunkFromServer::nDataMaxLength, m_vecData.size() - nOffset);
+    return proofps_dd::MsgJoinSnapshotChunkFromServer::initPkt(
+        pkt,
+        static_cast<std::uint32_t>(m_vecData.size()),
+        static_cast<std::uint32_t>(nOffset),
+        &m_vecData[nOffset],
+        static_cast<std::uint32_t>(nLength));
+}
+
+/**
+* Server-only.
+* Sends the whole snapshot to the given client. Since chunks are sent as reliable messages, they arrive in order.
+*/
+bool proofps_dd::JoinSnapshot::serverSend(
+    pge_network::PgeINetwork& network,
+    const pge_network::PgeNetworkConnectionHandle& connHandle) const
+{
+    for (size_t iChunk = 0; iChunk < getChunkCount(); iChunk++)
+    {
+        pge_network::PgePacket pkt;
+        if (!getChunkAsPkt(iChunk, pkt))
+        {
+            getConsole().EOLn("JoinSnapshot::%s(): getChunkAsPkt() FAILED at line %d!", __func__, __LINE__);
+            assert(false);
+            return false;
+        }
+        MsgTrafficStats::serverSend(network, pkt, connHandle);
+    }
+    return true;
+}
+
+/**
+* Client-only.
+* Appends the received chunk to the snapshot. The first chunk starts a new snapshot.
+*
+* @return False if the chunk is invalid or not the expected next chunk, true otherwise.
+*/
+bool proofps_dd::JoinSnapshot::clientHandleJoinSnapshotChunkFromServer(const MsgJoinSnapshotChunkFromServer& msg)
+{
+    if (msg.m_nOffset == 0)
+    {
+        clear();
+        if ((msg.m_nSnapshotLength == 0) || (msg.m_nSnapshotLength > nSnapshotMaxLength))
+        {
+            getConsole().EOLn("JoinSnapshot::%s(): invalid snapshot length: %u!", __func__, msg.m_nSnapshotLength);
+            return false;
+        }
+        m_nExpectedLength = msg.m_nSnapshotLength;
+        m_vecData.reserve(m_nExpectedLength);
+    }
+
+    if ((msg.m_nSnapshotLength != m_nExpectedLength) ||
+        (msg.m_nOffset != m_vecData.size()) ||
+        (msg.m_nLength == 0) ||
+        (msg.m_nLength > sizeof(msg.m_data)) ||
+        (m_vecData.size() + msg.m_nLength > m_nExpectedLength))
+    {
+        getConsole().EOLn("JoinSnapshot::%s(): unexpected chunk: snapshot length: %u, offset: %u, length: %u, received so far: %u of %u!",
+            __func__, msg.m_nSnapshotLength, msg.m_nOffset, msg.m_nLength, m_vecData.size(), m_nExpectedLength);
+        clear();
+        return false;
+    }
+
+    m_vecData.insert(m_vecData.end(), msg.m_data, msg.m_data + msg.m_nLength);
+    return true;
+}
+
+/**
+* Client-only.
+* @return True if all chunks of the snapshot have been received, false otherwise.
+*/
+bool proofps_dd::JoinSnapshot::isComplete() const
+{
+    return (m_nExpectedLength != 0) && (m_vecData.size() == m_nExpectedLength);
+}
+
+/**
+* Client-only.
+* Reconstructs the packets from the records of the complete snapshot, in the same order as they were added by server.
+*
+* @return False if the snapshot is not complete or malformed, true otherwise.
+*/
+bool proofps_dd::JoinSnapshot::getRecordsAsPkts(std::vector<pge_network::PgePacket>& vecPkts) const
+{
+    vecPkts.clear();
+    if (!isComplete())
+    {
+        getConsole().EOLn("JoinSnapshot::%s(): snapshot is not complete!", __func__);
+        return false;
+    }
+
+    size_t nOffset = 0;
+    while (nOffset < m_vecData.size())
+    {
+        RecordHeader header;
+        if (nOffset + sizeof(RecordHeader) > m_vecData.size())
+        {
+            getConsole().EOLn("JoinSnapshot::%s(): truncated record header at offset: %u!", __func__, nOffset);
+            vecPkts.clear();
+            return false;
+        }
+        std::memcpy(&header, &m_vecData[nOffset], sizeof(RecordHeader));
+        nOffset += sizeof(RecordHeader);
+
+        if ((header.m_nLength == 0) || (nOffset + header.m_nLength > m_vecData.size()))
+        {
+            getConsole().EOLn("JoinSnapshot::%s(): invalid record length: %u at offset: %u!", __func__, header.m_nLength, nOffset);
+            vecPkts.clear();
+            return false;
+        }
+
+        vecPkts.emplace_back();
+        pge_network::PgePacket& pkt = vecPkts.back();
+        pge_network::PgePacket::initPktMsgApp(pkt, header.m_connHandle);
+        pge_network::TByte* const pMsgAppData = pge_network::PgePacket::preparePktMsgAppFill(pkt, header.m_msgId, header.m_nLength);
+        if (!pMsgAppData)
+        {
+            getConsole().EOLn("JoinSnapshot::%s(): preparePktMsgAppFill() FAILED for msgId: %u, length: %u!", __func__, header.m_msgId, header.m_nLength);
+            vecPkts.clear();
+            return false;
+        }
+        std::memcpy(pMsgAppData, &m_vecData[nOffset], header.m_nLength);
+        nOffset += header.m_nLength;
+    }
+
+    return true;
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
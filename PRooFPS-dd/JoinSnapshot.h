@@ -0,0 +1,107 @@
+#pragma once
+
+/*
+    ###################################################################################
+    JoinSnapshot.h
+    Serialized world state streamed to a connecting client for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <cstdint>
+#include <vector>
+
+#include "CConsole.h"
+
+#include "PGE.h"
+
+namespace proofps_dd
+{
+
+    struct MsgJoinSnapshotChunkFromServer;
+
+    /**
+    * Everything a connecting client needs to know about the already existing world (other players with their names, teams, inventory,
+    * position, scores and current weapon, and the state of map items), serialized into a single byte stream.
+    *
+    * Server builds it once per connecting client, then streams it in as few MsgJoinSnapshotChunkFromServer messages as possible,
+    * instead of sending a separate message for every piece of state of every player and item.
+    * Client reassembles the chunks, and when the snapshot is complete, it processes the records as if they were received one by one,
+    * so the same message handlers are used as for regular updates.
+    *
+    * A record is a header (app message id, connection handle of the packet, message length) followed by the app message itself.
+    * Layout is the same as in the individual messages, so server and client must be the same build, as with all other messages.
+    */
+    class JoinSnapshot
+    {
+    public:
+
+        static constexpr size_t nSnapshotMaxLength = 1024 * 1024;  /**< Client rejects a bigger snapshot, e.g. sent by a malicious server. */
+
+        static const char* getLoggerModuleName();
+
+        // ---------------------------------------------------------------------------
+
+        CConsole& getConsole() const;
+
+        JoinSnapshot() = default;
+
+        JoinSnapshot(const JoinSnapshot&) = delete;
+        JoinSnapshot& operator=(const JoinSnapshot&) = delete;
+        JoinSnapshot(JoinSnapshot&&) = delete;
+        JoinSnapshot&& operator=(JoinSnapshot&&) = delete;
+
+        void clear();
+        size_t getLength() const;
+        size_t getRecordCount() const;
+
+        /**
+        * Server-only.
+        * Appends the app message in the given packet as a record.
+        * @return False if the snapshot would grow too big, true otherwise.
+        */
+        template <typename TMsg>
+        bool add(const pge_network::PgePacket& pkt)
+        {
+            return addRecord(
+                static_cast<pge_network::MsgApp::TMsgId>(TMsg::id),
+                pge_network::PgePacket::getServerSideConnectionHandle(pkt),
+                reinterpret_cast<const pge_network::TByte*>(&pge_network::PgePacket::getMsgAppDataFromPkt<const TMsg>(pkt)),
+                sizeof(TMsg));
+        }
+
+        bool addRecord(
+            const pge_network::MsgApp::TMsgId& msgId,
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const pge_network::TByte* pData,
+            const size_t& nLength);
+
+        size_t getChunkCount() const;
+        bool getChunkAsPkt(const size_t& iChunk, pge_network::PgePacket& pkt) const;
+        bool serverSend(
+            pge_network::PgeINetwork& network,
+            const pge_network::PgeNetworkConnectionHandle& connHandle) const;
+
+        bool clientHandleJoinSnapshotChunkFromServer(const MsgJoinSnapshotChunkFromServer& msg);
+        bool isComplete() const;
+        bool getRecordsAsPkts(std::vector<pge_network::PgePacket>& vecPkts) const;
+
+    protected:
+
+    private:
+
+        struct RecordHeader
+        {
+            pge_network::MsgApp::TMsgId m_msgId;
+            pge_network::PgeNetworkConnectionHandle m_connHandle;
+            std::uint16_t m_nLength;  /**< Length of the app message following the header. */
+        };
+
+        std::vector<pge_network::TByte> m_vecData;
+        size_t m_nRecordCount = 0;     /**< Server-only. */
+        size_t m_nExpectedLength = 0;  /**< Client-only, total length announced by the first chunk. */
+
+    }; // class JoinSnapshot
+
+} // namespace proofps_dd
@@ -45,7 +45,7 @@ bool proofps_dd::Mapcycle::isValidMapFilename(const std::string& sFilename)
     // we assume the given string is valid filename, so we are not checking for general filename validity,
     // such as illegal characters like '?', we just check for validity from Maps perspective.
 
-    if (sFilename.length() >= proofps_dd::MsgMapChangeFromServer::nMapFilenameMaxLength)
+    if (sFilename.length() >= proofps_dd::StringTable::nStringBufferLength)
     {
         return false;
     }
@@ -463,13 +463,13 @@ void proofps_dd::Maps::updateVisibilitiesForRenderer()
         PureObject3D* const obj = m_blocks[i];
         if ( obj != PGENULL )
         {
-            if ( (obj->getPosVec().getX() + obj->getSizeVec().getX()/2.0f) <= campos.getX() - 13.f )
+            if ( (obj->getPosVec().getX() + obj->getSizeVec().getX()/2.0f) <= campos.getX() - fRenderVisibilityHalfWidthX )
             {
                 obj->SetRenderingAllowed(false);
             }
             else
             {
-                if ( (obj->getPosVec().getX() - obj->getSizeVec().getX()/2.0f) >= campos.getX() + 13.f )
+                if ( (obj->getPosVec().getX() - obj->getSizeVec().getX()/2.0f) >= campos.getX() + fRenderVisibilityHalfWidthX )
                 {
                     obj->SetRenderingAllowed(false);
                 }
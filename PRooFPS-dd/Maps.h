@@ -45,6 +45,10 @@ namespace proofps_dd
 
         static constexpr float GAME_PLAYERS_POS_Z = -1.2f;
 
+        /** Map blocks farther than this horizontal distance from the camera are not rendered, see updateVisibilitiesForRenderer().
+            Server also uses this to tell what is relevant to a client, see InterestManagement. */
+        static constexpr float fRenderVisibilityHalfWidthX = 13.f;
+
         static const char* getLoggerModuleName();
 
         // ---------------------------------------------------------------------------
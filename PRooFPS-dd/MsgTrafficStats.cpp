@@ -0,0 +1,387 @@
+/*
+    ###################################################################################
+    MsgTrafficStats.cpp
+    Per-message-type traffic and handling cost counters for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#include "MsgTrafficStats.h"
+
+
+// ############################### PUBLIC ################################
+
+
+const char* proofps_dd::MsgTrafficStats::getLoggerModuleName()
+{
+    return "MsgTrafficStats";
+}
+
+/**
+* The instance used by the game, so any code having access to the network can send messages through the send functions here.
+*/
+proofps_dd::MsgTrafficStats& proofps_dd::MsgTrafficStats::getInstance()
+{
+    static MsgTrafficStats instance;
+    return instance;
+}
+
+/**
+* Counts and sends the given packet by server to the given connection, or injects it to server itself if connHandle is
+* pge_network::ServerConnHandle.
+*/
+void proofps_dd::MsgTrafficStats::serverSend(
+    pge_network::PgeINetwork& network,
+    const pge_network::PgePacket& pkt,
+    const pge_network::PgeNetworkConnectionHandle& connHandle)
+{
+    getInstance().addTx(connHandle, pkt);
+    network.getServer().send(pkt, connHandle);
+}
+
+/**
+* Counts and sends the given packet by server to all clients, and also injects it to server itself.
+*/
+void proofps_dd::MsgTrafficStats::serverSendToAll(
+    pge_network::PgeINetwork& network,
+    const pge_network::PgePacket& pkt)
+{
+    getInstance().addTxToAllClients(pkt, true, pge_network::ServerConnHandle);
+    network.getServer().sendToAll(pkt);
+}
+
+/**
+* Counts and sends the given packet by server to all clients except the given one. Not injected to server itself.
+*/
+void proofps_dd::MsgTrafficStats::serverSendToAllClientsExcept(
+    pge_network::PgeINetwork& network,
+    const pge_network::PgePacket& pkt,
+    const pge_network::PgeNetworkConnectionHandle& exceptConnHandle)
+{
+    getInstance().addTxToAllClients(pkt, false, exceptConnHandle);
+    network.getServer().sendToAllClientsExcept(pkt, exceptConnHandle);
+}
+
+/**
+* Counts and sends the given packet by client to server.
+*/
+void proofps_dd::MsgTrafficStats::clientSend(
+    pge_network::PgeINetwork& network,
+    const pge_network::PgePacket& pkt)
+{
+    getInstance().addTx(pge_network::ServerConnHandle, pkt);
+    network.getClient().send(pkt);
+}
+
+/**
+* Counts and sends the given packet by the initialized instance: client sends it to server, server injects it to itself.
+*/
+void proofps_dd::MsgTrafficStats::send(
+    pge_network::PgeINetwork& network,
+    const pge_network::PgePacket& pkt)
+{
+    getInstance().addTx(pge_network::ServerConnHandle, pkt);
+    network.getServerClientInstance()->send(pkt);
+}
+
+CConsole& proofps_dd::MsgTrafficStats::getConsole() const
+{
+    return CConsole::getConsoleInstance(getLoggerModuleName());
+}
+
+proofps_dd::MsgTrafficStats::MsgTrafficStats() :
+    m_timeCleared(std::chrono::steady_clock::now())
+{
+}
+
+/**
+* Forgets everything including the connections, e.g. when networking is reinitialized.
+*/
+void proofps_dd::MsgTrafficStats::reset()
+{
+    m_connStats.clear();
+    clear();
+}
+
+/**
+* Zeroes all counters and forgets disconnected connections, but keeps the connected ones as broadcast targets.
+*/
+void proofps_dd::MsgTrafficStats::clear()
+{
+    for (auto it = m_connStats.begin(); it != m_connStats.end(); )
+    {
+        if (it->second.m_bConnected)
+        {
+            it->second.m_counters = PerMsgCounters{};
+            ++it;
+        }
+        else
+        {
+            it = m_connStats.erase(it);
+        }
+    }
+    m_handlerStats = std::array<HandlerStats, nMsgIdCount>{};
+    m_timeCleared = std::chrono::steady_clock::now();
+}
+
+/**
+* Server-only.
+* The given client connection becomes target of broadcast messages.
+*/
+void proofps_dd::MsgTrafficStats::addConnection(const pge_network::PgeNetworkConnectionHandle& connHandle)
+{
+    if (connHandle == pge_network::ServerConnHandle)
+    {
+        // server is never a client connection, injects are counted separately
+        return;
+    }
+    m_connStats[connHandle].m_bConnected = true;
+}
+
+/**
+* Server-only.
+* Counters of the given client connection are kept until the next clear(), but it is not a target of broadcasts anymore.
+*/
+void proofps_dd::MsgTrafficStats::removeConnection(const pge_network::PgeNetworkConnectionHandle& connHandle)
+{
+    const auto it = m_connStats.find(connHandle);
+    if (it != m_connStats.end())
+    {
+        it->second.m_bConnected = false;
+    }
+}
+
+void proofps_dd::MsgTrafficStats::addTx(
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const pge_network::PgePacket& pkt)
+{
+    size_t iMsgId;
+    size_t nBytes;
+    if (!getAppMsgInfo(pkt, iMsgId, nBytes))
+    {
+        return;
+    }
+
+    Counters& counters = m_connStats[connHandle].m_counters[iMsgId];
+    ++counters.m_nTxMsgs;
+    counters.m_nTxBytes += nBytes;
+}
+
+/**
+* Server-only.
+* Counts the given packet as sent to each connected client except the given one.
+*
+* @param bIncludeServer True if the packet is also injected to server itself.
+*/
+void proofps_dd::MsgTrafficStats::addTxToAllClients(
+    const pge_network::PgePacket& pkt,
+    const bool& bIncludeServer,
+    const pge_network::PgeNetworkConnectionHandle& exceptConnHandle)
+{
+    size_t iMsgId;
+    size_t nBytes;
+    if (!getAppMsgInfo(pkt, iMsgId, nBytes))
+    {
+        return;
+    }
+
+    for (auto& connStatsPair : m_connStats)
+    {
+        if (connStatsPair.second.m_bConnected && (connStatsPair.first != exceptConnHandle))
+        {
+            Counters& counters = connStatsPair.second.m_counters[iMsgId];
+            ++counters.m_nTxMsgs;
+            counters.m_nTxBytes += nBytes;
+        }
+    }
+
+    if (bIncludeServer)
+    {
+        Counters& counters = m_connStats[pge_network::ServerConnHandle].m_counters[iMsgId];
+        ++counters.m_nTxMsgs;
+        counters.m_nTxBytes += nBytes;
+    }
+}
+
+void proofps_dd::MsgTrafficStats::addRx(
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const pge_network::PgePacket& pkt)
+{
+    size_t iMsgId;
+    size_t nBytes;
+    if (!getAppMsgInfo(pkt, iMsgId, nBytes))
+    {
+        return;
+    }
+
+    Counters& counters = m_connStats[connHandle].m_counters[iMsgId];
+    ++counters.m_nRxMsgs;
+    counters.m_nRxBytes += nBytes;
+}
+
+void proofps_dd::MsgTrafficStats::addHandlerDuration(
+    const PRooFPSappMsgId& msgId,
+    const std::chrono::microseconds::rep& nUSecs)
+{
+    if (static_cast<size_t>(msgId) >= nMsgIdCount)
+    {
+        return;
+    }
+
+    HandlerStats& handlerStats = m_handlerStats[static_cast<size_t>(msgId)];
+    ++handlerStats.m_nCalls;
+    handlerStats.m_nTotalUSecs += nUSecs;
+    handlerStats.m_nMaxUSecs = std::max(handlerStats.m_nMaxUSecs, nUSecs);
+}
+
+/**
+* @return Counters of the given message kind for the given connection, all zero if nothing has been counted for them.
+*/
+const proofps_dd::MsgTrafficStats::Counters& proofps_dd::MsgTrafficStats::getCounters(
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const PRooFPSappMsgId& msgId) const
+{
+    static const Counters countersEmpty;
+    const auto it = m_connStats.find(connHandle);
+    return ((it == m_connStats.end()) || (static_cast<size_t>(msgId) >= nMsgIdCount)) ?
+        countersEmpty :
+        it->second.m_counters[static_cast<size_t>(msgId)];
+}
+
+/**
+* @return Sum of counters of the given message kind for all client connections, i.e. the actual network traffic of server.
+*/
+proofps_dd::MsgTrafficStats::Counters proofps_dd::MsgTrafficStats::getClientsTotalCounters(const PRooFPSappMsgId& msgId) const
+{
+    Counters total;
+    if (static_cast<size_t>(msgId) >= nMsgIdCount)
+    {
+        return total;
+    }
+
+    for (const auto& connStatsPair : m_connStats)
+    {
+        if (connStatsPair.first == pge_network::ServerConnHandle)
+        {
+            continue;
+        }
+        const Counters& counters = connStatsPair.second.m_counters[static_cast<size_t>(msgId)];
+        total.m_nTxMsgs += counters.m_nTxMsgs;
+        total.m_nTxBytes += counters.m_nTxBytes;
+        total.m_nRxMsgs += counters.m_nRxMsgs;
+        total.m_nRxBytes += counters.m_nRxBytes;
+    }
+    return total;
+}
+
+const proofps_dd::MsgTrafficStats::HandlerStats& proofps_dd::MsgTrafficStats::getHandlerStats(const PRooFPSappMsgId& msgId) const
+{
+    static const HandlerStats handlerStatsEmpty;
+    return (static_cast<size_t>(msgId) >= nMsgIdCount) ? handlerStatsEmpty : m_handlerStats[static_cast<size_t>(msgId)];
+}
+
+std::chrono::steady_clock::duration proofps_dd::MsgTrafficStats::getDurationSinceClear() const
+{
+    return std::chrono::steady_clock::now() - m_timeCleared;
+}
+
+/**
+* Writes all counters to the given file: handler costs, then traffic per connection, per message kind.
+*
+* @return True on success, false if the file could not be written.
+*/
+bool proofps_dd::MsgTrafficStats::dumpToFile(const std::string& sFilename) const
+{
+    std::ofstream f(sFilename);
+    if (f.fail())
+    {
+        getConsole().EOLn("MsgTrafficStats::%s(): ERROR: couldn't create file: %s", __func__, sFilename.c_str());
+        return false;
+    }
+
+    const float fSecs = std::max(0.001f, std::chrono::duration_cast<std::chrono::milliseconds>(getDurationSinceClear()).count() / 1000.f);
+    f << "Measured duration: " << std::fixed << std::setprecision(3) << fSecs << " secs" << std::endl;
+
+    size_t nLongestMsgNameLength = 0;
+    for (const auto& msgId2ZStringPair : MapMsgAppId2String)
+    {
+        nLongestMsgNameLength = std::max(nLongestMsgNameLength, std::char_traits<char>::length(msgId2ZStringPair.zstring));
+    }
+
+    f << std::endl;
+    f << "Handler cost per AppMsgId: [Calls, Total (us), Avg (us), Max (us)]" << std::endl;
+    for (size_t i = 0; i < nMsgIdCount; i++)
+    {
+        const HandlerStats& handlerStats = m_handlerStats[i];
+        f << "  " << std::left << std::setw(nLongestMsgNameLength + 1) << MapMsgAppId2String[i].zstring << std::right
+            << std::setw(10) << handlerStats.m_nCalls
+            << std::setw(12) << handlerStats.m_nTotalUSecs
+            << std::setw(10) << std::setprecision(1)
+            << ((handlerStats.m_nCalls == 0) ? 0.f : (handlerStats.m_nTotalUSecs / static_cast<float>(handlerStats.m_nCalls)))
+            << std::setw(10) << handlerStats.m_nMaxUSecs << std::endl;
+    }
+
+    for (const auto& connStatsPair : m_connStats)
+    {
+        f << std::endl;
+        f << "Connection " << connStatsPair.first
+            << ((connStatsPair.first == pge_network::ServerConnHandle) ? " (server)" : "")
+            << (connStatsPair.second.m_bConnected ? "" : " (disconnected)")
+            << ": [Tx Msgs, Tx Bytes, Tx Bps, Rx Msgs, Rx Bytes, Rx Bps]" << std::endl;
+        for (size_t i = 0; i < nMsgIdCount; i++)
+        {
+            const Counters& counters = connStatsPair.second.m_counters[i];
+            if ((counters.m_nTxMsgs == 0) && (counters.m_nRxMsgs == 0))
+            {
+                continue;
+            }
+            f << "  " << std::left << std::setw(nLongestMsgNameLength + 1) << MapMsgAppId2String[i].zstring << std::right
+                << std::setw(10) << counters.m_nTxMsgs
+                << std::setw(12) << counters.m_nTxBytes
+                << std::setw(10) << std::setprecision(1) << (counters.m_nTxBytes / fSecs)
+                << std::setw(10) << counters.m_nRxMsgs
+                << std::setw(12) << counters.m_nRxBytes
+                << std::setw(10) << (counters.m_nRxBytes / fSecs) << std::endl;
+        }
+    }
+
+    getConsole().OLn("MsgTrafficStats::%s(): dumped to file: %s", __func__, sFilename.c_str());
+    return true;
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
+
+
+/**
+* @return False if the given packet does not carry an app message we know, in such case it is not counted.
+*/
+bool proofps_dd::MsgTrafficStats::getAppMsgInfo(
+    const pge_network::PgePacket& pkt,
+    size_t& iMsgId,
+    size_t& nBytes)
+{
+    if (pge_network::PgePacket::getPacketId(pkt) != pge_network::MsgApp::id)
+    {
+        return false;
+    }
+
+    iMsgId = static_cast<size_t>(pge_network::PgePacket::getMsgAppIdFromPkt(pkt));
+    if (iMsgId >= nMsgIdCount)
+    {
+        return false;
+    }
+
+    nBytes = static_cast<size_t>(pge_network::PgePacket::getMessageAppsTotalActualLengthBytes(pkt));
+    return true;
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+/*
+    ###################################################################################
+    MsgTrafficStats.h
+    Per-message-type traffic and handling cost counters for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <string>
+
+#include "CConsole.h"
+
+#include "PGE.h"
+
+#include "PRooFPS-dd-packet.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Counts app messages and bytes sent and received, per connection and per PRooFPSappMsgId, and the time spent handling
+    * received messages per PRooFPSappMsgId, so we know which message kinds dominate bandwidth and CPU.
+    *
+    * Connection handles are the server-side ones:
+    *  - on server, a client's connection handle means traffic over network with that client, and pge_network::ServerConnHandle
+    *    means messages injected by server to itself, i.e. no network traffic;
+    *  - on client, everything is counted for pge_network::ServerConnHandle, since the server is the only peer.
+    *
+    * Outgoing messages are counted by the send functions here, so all app code shall send messages through them.
+    * PGE also counts messages per PRooFPSappMsgId, but only as a total, without bytes and per-connection breakdown.
+    *
+    * Not thread-safe: all functions shall be invoked from the main thread.
+    */
+    class MsgTrafficStats
+    {
+    public:
+
+        static constexpr size_t nMsgIdCount = static_cast<size_t>(PRooFPSappMsgId::LastMsgId);
+        static constexpr char* szDumpFilename = "msgtrafficstats.txt";
+
+        struct Counters
+        {
+            size_t m_nTxMsgs = 0;
+            size_t m_nTxBytes = 0;
+            size_t m_nRxMsgs = 0;
+            size_t m_nRxBytes = 0;
+        };
+
+        struct HandlerStats
+        {
+            size_t m_nCalls = 0;
+            std::chrono::microseconds::rep m_nTotalUSecs = 0;
+            std::chrono::microseconds::rep m_nMaxUSecs = 0;
+        };
+
+        using PerMsgCounters = std::array<Counters, nMsgIdCount>;
+
+        static const char* getLoggerModuleName();
+        static MsgTrafficStats& getInstance();
+
+        static void serverSend(
+            pge_network::PgeINetwork& network,
+            const pge_network::PgePacket& pkt,
+            const pge_network::PgeNetworkConnectionHandle& connHandle = pge_network::ServerConnHandle);
+        static void serverSendToAll(
+            pge_network::PgeINetwork& network,
+            const pge_network::PgePacket& pkt);
+        static void serverSendToAllClientsExcept(
+            pge_network::PgeINetwork& network,
+            const pge_network::PgePacket& pkt,
+            const pge_network::PgeNetworkConnectionHandle& exceptConnHandle = pge_network::ServerConnHandle);
+        static void clientSend(
+            pge_network::PgeINetwork& network,
+            const pge_network::PgePacket& pkt);
+        static void send(
+            pge_network::PgeINetwork& network,
+            const pge_network::PgePacket& pkt);
+
+        // ---------------------------------------------------------------------------
+
+        CConsole& getConsole() const;
+
+        MsgTrafficStats();
+
+        MsgTrafficStats(const MsgTrafficStats&) = delete;
+        MsgTrafficStats& operator=(const MsgTrafficStats&) = delete;
+        MsgTrafficStats(MsgTrafficStats&&) = delete;
+        MsgTrafficStats&& operator=(MsgTrafficStats&&) = delete;
+
+        void reset();
+        void clear();
+
+        void addConnection(const pge_network::PgeNetworkConnectionHandle& connHandle);
+        void removeConnection(const pge_network::PgeNetworkConnectionHandle& connHandle);
+
+        void addTx(
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const pge_network::PgePacket& pkt);
+        void addTxToAllClients(
+            const pge_network::PgePacket& pkt,
+            const bool& bIncludeServer,
+            const pge_network::PgeNetworkConnectionHandle& exceptConnHandle);
+        void addRx(
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const pge_network::PgePacket& pkt);
+        void addHandlerDuration(
+            const PRooFPSappMsgId& msgId,
+            const std::chrono::microseconds::rep& nUSecs);
+
+        const Counters& getCounters(
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const PRooFPSappMsgId& msgId) const;
+        Counters getClientsTotalCounters(const PRooFPSappMsgId& msgId) const;
+        const HandlerStats& getHandlerStats(const PRooFPSappMsgId& msgId) const;
+        std::chrono::steady_clock::duration getDurationSinceClear() const;
+
+        bool dumpToFile(const std::string& sFilename) const;
+
+    protected:
+
+    private:
+
+        struct ConnStats
+        {
+            bool m_bConnected = false;  /**< Disconnected ones are kept for the dump, but are not targets of broadcasts anymore. */
+            PerMsgCounters m_counters{};
+        };
+
+        static bool getAppMsgInfo(
+            const pge_network::PgePacket& pkt,
+            size_t& iMsgId,
+            size_t& nBytes);
+
+        // ---------------------------------------------------------------------------
+
+        std::map<pge_network::PgeNetworkConnectionHandle, ConnStats> m_connStats;
+        std::array<HandlerStats, nMsgIdCount> m_handlerStats{};
+        std::chrono::time_point<std::chrono::steady_clock> m_timeCleared;
+
+    }; // class MsgTrafficStats
+
+} // namespace proofps_dd
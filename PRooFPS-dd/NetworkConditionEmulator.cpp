@@ -0,0 +1,256 @@
+/*
+    ###################################################################################
+    NetworkConditionEmulator.cpp
+    Network condition emulator (latency, jitter, loss, reordering) for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <algorithm>
+
+#include "NetworkConditionEmulator.h"
+#include "PRooFPS-dd-packet.h"
+
+
+// ############################### PUBLIC ################################
+
+
+const char* proofps_dd::NetworkConditionEmulator::getLoggerModuleName()
+{
+    return "NetworkConditionEmulator";
+}
+
+CConsole& proofps_dd::NetworkConditionEmulator::getConsole() const
+{
+    return CConsole::getConsoleInstance(getLoggerModuleName());
+}
+
+proofps_dd::NetworkConditionEmulator::NetworkConditionEmulator(const unsigned int& nSeed) :
+    m_rng(nSeed)
+{
+}
+
+void proofps_dd::NetworkConditionEmulator::setDefaultConditions(
+    const Direction& dir,
+    const Conditions& conditions)
+{
+    m_defaultConditions[static_cast<size_t>(dir)] = conditions;
+}
+
+/**
+* Overrides the default conditions of the given direction for the given connection.
+*/
+void proofps_dd::NetworkConditionEmulator::setConditions(
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const Direction& dir,
+    const Conditions& conditions)
+{
+    m_conditions[ConnDirKey(connHandle, dir)] = conditions;
+}
+
+const proofps_dd::NetworkConditionEmulator::Conditions& proofps_dd::NetworkConditionEmulator::getConditions(
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const Direction& dir) const
+{
+    const auto it = m_conditions.find(ConnDirKey(connHandle, dir));
+    return (it == m_conditions.end()) ? m_defaultConditions[static_cast<size_t>(dir)] : it->second;
+}
+
+/**
+* Puts the packet in flight, according to the conditions of the given connection and direction.
+*
+* @param connHandle Connection handle of the client, regardless of direction.
+* @param dir        Direction of the packet.
+* @param pkt        The packet being sent.
+* @param timeNow    Time of sending.
+*/
+void proofps_dd::NetworkConditionEmulator::submit(
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const Direction& dir,
+    const pge_network::PgePacket& pkt,
+    const TimePoint& timeNow)
+{
+    const bool bAppMsg = (pge_network::PgePacket::getPacketId(pkt) == pge_network::MsgApp::id);
+    const pge_network::MsgApp::TMsgId msgId = bAppMsg ? pge_network::PgePacket::getMsgAppIdFromPkt(pkt) : nNonAppMsgId;
+    const bool bReliable = !bAppMsg ||
+        (static_cast<size_t>(msgId) >= static_cast<size_t>(PRooFPSappMsgId::LastMsgId)) ||
+        (getMsgAppDelivery(static_cast<PRooFPSappMsgId>(msgId)) == PRooFPSappMsgDelivery::Reliable);
+
+    MsgStats& stats = m_stats[msgId];
+    ++stats.m_nSent;
+
+    const Conditions& conditions = getConditions(connHandle, dir);
+    TimePoint timeDelivery = timeNow +
+        std::chrono::milliseconds(conditions.m_nLatencyMillisecs + randomMillisecs(conditions.m_nJitterMillisecs));
+
+    if (randomUnit() < conditions.m_fLossRate)
+    {
+        if (!bReliable)
+        {
+            ++stats.m_nLost;
+            return;
+        }
+        // reliable: the sender notices the loss after a round trip and resends
+        ++stats.m_nResent;
+        timeDelivery += std::chrono::milliseconds(2 * conditions.m_nLatencyMillisecs + randomMillisecs(conditions.m_nJitterMillisecs));
+    }
+
+    if (bReliable)
+    {
+        // reliable packets are delivered in order, so they wait for the earlier ones
+        TimePoint& timeLastReliable = m_lastReliableDelivery[ConnDirKey(connHandle, dir)];
+        timeDelivery = std::max(timeDelivery, timeLastReliable);
+        timeLastReliable = timeDelivery;
+    }
+    else if (randomUnit() < conditions.m_fReorderRate)
+    {
+        // hold back so later packets overtake it
+        timeDelivery += std::chrono::milliseconds(1 + randomMillisecs(std::max(10u, conditions.m_nLatencyMillisecs)));
+    }
+
+    m_inFlight.push(InFlightPkt{
+        timeDelivery,
+        timeNow,
+        m_nNextOrder++,
+        connHandle,
+        dir,
+        msgId,
+        bAppMsg ? static_cast<size_t>(pge_network::PgePacket::getMessageAppsTotalActualLengthBytes(pkt)) : sizeof(pkt),
+        pkt });
+}
+
+/**
+* Fetches the next packet due to be received by the given time.
+* Stale packets are also fetched, the receiver shall drop them as told by isLastPolledStale().
+*
+* @return True if a packet was fetched, false if no packet is due yet.
+*/
+bool proofps_dd::NetworkConditionEmulator::poll(
+    const TimePoint& timeNow,
+    pge_network::PgePacket& pkt,
+    pge_network::PgeNetworkConnectionHandle& connHandle,
+    Direction& dir)
+{
+    if (m_inFlight.empty() || (m_inFlight.top().m_timeDelivery > timeNow))
+    {
+        return false;
+    }
+
+    const InFlightPkt& inFlightPkt = m_inFlight.top();
+    pkt = inFlightPkt.m_pkt;
+    connHandle = inFlightPkt.m_connHandle;
+    dir = inFlightPkt.m_dir;
+
+    MsgStats& stats = m_stats[inFlightPkt.m_msgId];
+    ++stats.m_nDelivered;
+    stats.m_nBytesDelivered += inFlightPkt.m_nBytes;
+    stats.m_durQueueDelayTotal += std::chrono::duration_cast<std::chrono::microseconds>(timeNow - inFlightPkt.m_timeSubmit);
+
+    m_bLastPolledStale = false;
+    const auto itLastOrder = m_lastDeliveredOrder.find(ConnDirMsgKey(
+        connHandle, dir, inFlightPkt.m_msgId, pge_network::PgePacket::getServerSideConnectionHandle(pkt)));
+    if (itLastOrder == m_lastDeliveredOrder.end())
+    {
+        m_lastDeliveredOrder.emplace(
+            ConnDirMsgKey(connHandle, dir, inFlightPkt.m_msgId, pge_network::PgePacket::getServerSideConnectionHandle(pkt)),
+            inFlightPkt.m_nOrder);
+    }
+    else if (inFlightPkt.m_nOrder < itLastOrder->second)
+    {
+        ++stats.m_nStale;
+        m_bLastPolledStale = true;
+    }
+    else
+    {
+        itLastOrder->second = inFlightPkt.m_nOrder;
+    }
+
+    m_inFlight.pop();
+    return true;
+}
+
+/**
+* @return True if the packet fetched by the last successful poll() was delivered after a later message of the same kind about the same player.
+*/
+bool proofps_dd::NetworkConditionEmulator::isLastPolledStale() const
+{
+    return m_bLastPolledStale;
+}
+
+size_t proofps_dd::NetworkConditionEmulator::getInFlightCount() const
+{
+    return m_inFlight.size();
+}
+
+/**
+* Drops all packets in flight and all statistics, and reseeds the random generator.
+* Configured conditions are kept.
+*/
+void proofps_dd::NetworkConditionEmulator::reset(const unsigned int& nSeed)
+{
+    m_rng.seed(nSeed);
+    m_inFlight = decltype(m_inFlight)();
+    m_nNextOrder = 0;
+    m_lastReliableDelivery.clear();
+    m_lastDeliveredOrder.clear();
+    m_stats.clear();
+    m_bLastPolledStale = false;
+}
+
+const proofps_dd::NetworkConditionEmulator::MsgStats& proofps_dd::NetworkConditionEmulator::getMsgStats(
+    const pge_network::MsgApp::TMsgId& msgId) const
+{
+    static const MsgStats statsEmpty;
+    const auto it = m_stats.find(msgId);
+    return (it == m_stats.end()) ? statsEmpty : it->second;
+}
+
+/**
+* Logs effective throughput, average queueing delay and stale-update rate per message id.
+*
+* @param durMeasured Duration of the measurement, used for calculating throughput.
+*/
+void proofps_dd::NetworkConditionEmulator::printReport(const std::chrono::steady_clock::duration& durMeasured) const
+{
+    const float fSecs = std::max(0.001f, std::chrono::duration_cast<std::chrono::milliseconds>(durMeasured).count() / 1000.f);
+    getConsole().OLn("NetworkConditionEmulator::%s(): measured duration: %f secs", __func__, fSecs);
+    for (const auto& statsPair : m_stats)
+    {
+        const MsgStats& stats = statsPair.second;
+        const char* const szMsgName =
+            (static_cast<size_t>(statsPair.first) < MapMsgAppId2String.size()) ?
+            MapMsgAppId2String[statsPair.first].zstring :
+            "(non-app packet)";
+        const float fAvgQueueDelayMillisecs = (stats.m_nDelivered == 0) ?
+            0.f :
+            (stats.m_durQueueDelayTotal.count() / 1000.f / stats.m_nDelivered);
+        const float fStaleRate = (stats.m_nDelivered == 0) ?
+            0.f :
+            (static_cast<float>(stats.m_nStale) / stats.m_nDelivered);
+
+        getConsole().OLn(
+            "  %s: sent: %u, lost: %u, resent: %u, delivered: %u, throughput: %f B/s, avg queue delay: %f ms, stale rate: %f",
+            szMsgName, stats.m_nSent, stats.m_nLost, stats.m_nResent, stats.m_nDelivered,
+            stats.m_nBytesDelivered / fSecs, fAvgQueueDelayMillisecs, fStaleRate);
+    }
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
+
+
+float proofps_dd::NetworkConditionEmulator::randomUnit()
+{
+    return std::uniform_real_distribution<float>(0.f, 1.f)(m_rng);
+}
+
+unsigned int proofps_dd::NetworkConditionEmulator::randomMillisecs(const unsigned int& nMax)
+{
+    return (nMax == 0) ? 0 : std::uniform_int_distribution<unsigned int>(0, nMax)(m_rng);
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+/*
+    ###################################################################################
+    NetworkConditionEmulator.h
+    Network condition emulator (latency, jitter, loss, reordering) for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <chrono>
+#include <limits>
+#include <map>
+#include <queue>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "CConsole.h"
+
+#include "PGE.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Emulates bad network conditions between sending and receiving PgePackets: latency, jitter, loss and reordering,
+    * configurable per direction and per connection. Randomness is seeded so a run can be reproduced exactly.
+    *
+    * Packets are submit()-ted when sent and poll()-ed when they are due to be received, so this can be put between the sender
+    * and the receiver side of any transport.
+    * The game puts it in front of its received packet handling if enabled by config (see szCVarNetEmu), so every instance emulates
+    * the conditions of its own incoming direction.
+    * Delivery class of the message is taken into account (see PRooFPSappMsgDelivery):
+    *  - reliable messages are never lost but resent after a round trip, and they are delivered in order, so a lost reliable
+    *    message delays all later reliable messages of the same connection and direction (head-of-line blocking);
+    *  - unreliable-sequenced messages are lost and reordered, and a message delivered after a later message of the same kind is
+    *    counted as stale, since the receiver drops it.
+    *
+    * Not thread-safe: all functions shall be invoked from the same thread.
+    */
+    class NetworkConditionEmulator
+    {
+    public:
+
+        using TimePoint = std::chrono::steady_clock::time_point;
+
+        static constexpr char* szCVarNetEmu = "net_emu";
+        static constexpr char* szCVarNetEmuLatencyMillisecs = "net_emu_latency_ms";
+        static constexpr char* szCVarNetEmuJitterMillisecs = "net_emu_jitter_ms";
+        static constexpr char* szCVarNetEmuLossRate = "net_emu_loss_rate";
+        static constexpr char* szCVarNetEmuReorderRate = "net_emu_reorder_rate";
+        static constexpr char* szCVarNetEmuSeed = "net_emu_seed";
+        static constexpr unsigned int nMillisecsMax = 1000;  /**< Max latency and max jitter accepted from config. */
+
+        /** Used in statistics for packets not carrying app message, e.g. connect and disconnect. */
+        static constexpr pge_network::MsgApp::TMsgId nNonAppMsgId = std::numeric_limits<pge_network::MsgApp::TMsgId>::max();
+
+        enum class Direction
+        {
+            ServerToClient,
+            ClientToServer
+        };
+
+        struct Conditions
+        {
+            unsigned int m_nLatencyMillisecs = 0;  /**< One-way latency. */
+            unsigned int m_nJitterMillisecs = 0;   /**< Latency of each packet is randomly increased by at most this much. */
+            float m_fLossRate = 0.f;               /**< [0..1] */
+            float m_fReorderRate = 0.f;            /**< [0..1] Chance of holding back a packet so later packets overtake it. */
+        };
+
+        struct MsgStats
+        {
+            size_t m_nSent = 0;
+            size_t m_nLost = 0;            /**< Unreliable messages lost. */
+            size_t m_nResent = 0;          /**< Reliable messages lost once and resent. */
+            size_t m_nDelivered = 0;
+            size_t m_nStale = 0;           /**< Unreliable-sequenced messages delivered after a later message of the same kind about the same player. */
+            size_t m_nBytesDelivered = 0;
+            std::chrono::microseconds m_durQueueDelayTotal{ 0 };  /**< Sum of time between submit and actual poll. */
+        };
+
+        static const char* getLoggerModuleName();
+
+        // ---------------------------------------------------------------------------
+
+        CConsole& getConsole() const;
+
+        explicit NetworkConditionEmulator(const unsigned int& nSeed);
+
+        NetworkConditionEmulator(const NetworkConditionEmulator&) = delete;
+        NetworkConditionEmulator& operator=(const NetworkConditionEmulator&) = delete;
+        NetworkConditionEmulator(NetworkConditionEmulator&&) = delete;
+        NetworkConditionEmulator&& operator=(NetworkConditionEmulator&&) = delete;
+
+        void setDefaultConditions(
+            const Direction& dir,
+            const Conditions& conditions);
+        void setConditions(
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const Direction& dir,
+            const Conditions& conditions);
+        const Conditions& getConditions(
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const Direction& dir) const;
+
+        void submit(
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const Direction& dir,
+            const pge_network::PgePacket& pkt,
+            const TimePoint& timeNow);
+        bool poll(
+            const TimePoint& timeNow,
+            pge_network::PgePacket& pkt,
+            pge_network::PgeNetworkConnectionHandle& connHandle,
+            Direction& dir);
+        bool isLastPolledStale() const;
+        size_t getInFlightCount() const;
+
+        void reset(const unsigned int& nSeed);
+
+        const MsgStats& getMsgStats(const pge_network::MsgApp::TMsgId& msgId) const;
+        void printReport(const std::chrono::steady_clock::duration& durMeasured) const;
+
+    protected:
+
+    private:
+
+        using ConnDirKey = std::tuple<pge_network::PgeNetworkConnectionHandle, Direction>;
+        /** The last element is the connection handle inside the packet, i.e. the player the message is about, since e.g. user updates of
+            different players are not superseding each other. */
+        using ConnDirMsgKey = std::tuple<pge_network::PgeNetworkConnectionHandle, Direction, pge_network::MsgApp::TMsgId, pge_network::PgeNetworkConnectionHandle>;
+
+        struct InFlightPkt
+        {
+            TimePoint m_timeDelivery;
+            TimePoint m_timeSubmit;
+            size_t m_nOrder;  /**< Submit order, also keeps packets with same delivery time in FIFO order. */
+            pge_network::PgeNetworkConnectionHandle m_connHandle;
+            Direction m_dir;
+            pge_network::MsgApp::TMsgId m_msgId;
+            size_t m_nBytes;
+            pge_network::PgePacket m_pkt;
+        };
+
+        struct InFlightPktLater
+        {
+            bool operator()(const InFlightPkt& a, const InFlightPkt& b) const
+            {
+                return (a.m_timeDelivery > b.m_timeDelivery) ||
+                    ((a.m_timeDelivery == b.m_timeDelivery) && (a.m_nOrder > b.m_nOrder));
+            }
+        };
+
+        std::mt19937 m_rng;
+        Conditions m_defaultConditions[2];
+        std::map<ConnDirKey, Conditions> m_conditions;
+        std::priority_queue<InFlightPkt, std::vector<InFlightPkt>, InFlightPktLater> m_inFlight;
+        size_t m_nNextOrder = 0;
+        std::map<ConnDirKey, TimePoint> m_lastReliableDelivery;  /**< Reliable packets cannot overtake each other within a connection and direction. */
+        std::map<ConnDirMsgKey, size_t> m_lastDeliveredOrder;    /**< For detecting stale deliveries. */
+        std::map<pge_network::MsgApp::TMsgId, MsgStats> m_stats;
+        bool m_bLastPolledStale = false;
+
+        float randomUnit();
+        unsigned int randomMillisecs(const unsigned int& nMax);
+
+    }; // class NetworkConditionEmulator
+
+} // namespace proofps_dd
@@ -13,6 +13,8 @@
 #include <chrono>
 
 #include "Networking.h"
+#include "MsgTrafficStats.h"
+#include "StringTable.h"
 #include "PRooFPS-dd-packet.h"
 
 
@@ -75,6 +77,10 @@ bool proofps_dd::Networking::reinitializeNetworking()
 
         // however allowlisting needs to be invoked always since different messages are allowed for server and clients
         allowListAppMessages();
+
+        // connection handles and string ids are not valid anymore
+        MsgTrafficStats::getInstance().reset();
+        StringTable::getInstance().clear();
     }
     return bRet;
 }
@@ -138,6 +144,8 @@ void proofps_dd::Networking::allowListAppMessages()
         m_pge.getNetwork().getClient().getAllowListedAppMessages().insert(static_cast<pge_network::MsgApp::TMsgId>(proofps_dd::MsgWpnUpdateFromServer::id));
         m_pge.getNetwork().getClient().getAllowListedAppMessages().insert(static_cast<pge_network::MsgApp::TMsgId>(proofps_dd::MsgCurrentWpnUpdateFromServer::id));
         m_pge.getNetwork().getClient().getAllowListedAppMessages().insert(static_cast<pge_network::MsgApp::TMsgId>(proofps_dd::MsgDeathNotificationFromServer::id));
+        m_pge.getNetwork().getClient().getAllowListedAppMessages().insert(static_cast<pge_network::MsgApp::TMsgId>(proofps_dd::MsgStringTableEntryFromServer::id));
+        m_pge.getNetwork().getClient().getAllowListedAppMessages().insert(static_cast<pge_network::MsgApp::TMsgId>(proofps_dd::MsgJoinSnapshotChunkFromServer::id));
     }
 }
 
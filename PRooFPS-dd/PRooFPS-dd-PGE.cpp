@@ -22,6 +22,11 @@
 #include "Pure/include/external/PureCamera.h"
 #include "../../Console/CConsole/src/CConsole.h"
 
+#include "JoinSnapshot.h"
+#include "MsgTrafficStats.h"
+#include "PacketReceiveQueues.h"
+#include "StringTable.h"
+
 using namespace std::chrono_literals;
 
 static constexpr unsigned int GAME_FPS_MEASURE_INTERVAL = 500;
@@ -98,6 +103,8 @@ proofps_dd::PRooFPSddPGE::PRooFPSddPGE(const char* gameTitle) :
     m_config(Config::getConfigInstance(*this, m_maps)),
     m_gui(GUI::getGuiInstance(*this, *this, m_config, m_maps, *this, m_mapPlayers, this->getSmokePool(), m_sounds)),
     m_maps(getAudio(), getConfigProfiles(), getPure()),
+    m_bPacketHandlingFailed(false),
+    m_netEmu(0),
     m_fps(GAME_MAXFPS_DEF),
     m_fps_counter(0),
     m_fps_lastmeasure(0),
@@ -135,6 +142,7 @@ bool proofps_dd::PRooFPSddPGE::onGameInitializing()
     getConsole().SetLoggingState(getNetwork().getLoggerModuleName(), true);
     getConsole().SetLoggingState(getNetwork().getServer().getLoggerModuleName(), true);
     getConsole().SetLoggingState(getNetwork().getClient().getLoggerModuleName(), true);
+    getConsole().SetLoggingState(NetworkConditionEmulator::getLoggerModuleName(), true);
 
     // Misc engine logs
     getConsole().SetLoggingState("PureWindow", true);
@@ -267,6 +275,13 @@ bool proofps_dd::PRooFPSddPGE::onGameInitialized()
     m_sounds.m_sndPlayerBruh.set3dMinMaxDistance(SndPlayerDieDistMin, SndPlayerDieDistMax);
     m_sounds.m_sndPlayerBruh.set3dAttenuation(SoLoud::AudioSource::ATTENUATION_MODELS::LINEAR_DISTANCE, 1.f);
 
+    if (!startInputSampling())
+    {
+        getConsole().EOLn("PRooFPSddPGE::%s(): startInputSampling() FAILED!", __func__);
+        getConsole().OOOLn("PRooFPSddPGE::onGameInitialized() FAILED!");
+        return false;
+    }
+
     getConsole().OOOLn("PRooFPSddPGE::onGameInitialized() done!");
 
     getInput().getMouse().SetCursorPos(
@@ -325,6 +340,25 @@ void proofps_dd::PRooFPSddPGE::onGameRunning()
 
     m_durations.m_nFramesElapsedSinceLastDurationsReset++;
 
+    // Received packets are handled at the beginning of every frame, even in main menu, since connection state changes are also among them,
+    // and at the beginning of each tick. All of them in the order of receiving, since handlers depend on that order.
+    if (!handleReceivedPackets())
+    {
+        // Engine used to terminate the application when packets were handled in onPacketReceived() and handling failed.
+        // Now that handling is deferred, we leave the game session instead, the rest of the queued packets are useless anyway.
+        getConsole().EOLn("PRooFPSddPGE::%s(): packet handling failed, leaving game session!", __func__);
+        m_bPacketHandlingFailed = false;
+        m_packetReceiveQueues.clear();
+        disconnect(true, "Failed to handle received packet");
+    }
+
+    // Input events are consumed by every frame before input handling, but if there is no input handling, we just drop them, so nothing pressed in the menu or
+    // while waiting for connection will have effect later.
+    if ((m_gui.getMainMenuState() != proofps_dd::GUI::MainMenuState::None) || !hasValidConnection())
+    {
+        consumeInputEventsUntil(timeOnGameRunningStart, false);
+    }
+
     // onGameRunning() is invoked by PGE in every frame no matter if we are in main menu or a game session.
     // PURE calls drawDearImGuiCb() in every frame.
     // If we are in main menu, then basically GUI::drawWindowForMainMenu() is operating, since drawDearImGuiCb() is calling it back in every frame.
@@ -350,11 +384,17 @@ void proofps_dd::PRooFPSddPGE::onGameRunning()
                 // leading to GameMode.cpp unable to compile.
                 // 1 way of fixing this would be to implement the prevMenuState stuff explained a few lines above, so that
                 // the main loop itself would be able to detect exiting from the menu and invoke stuff only once!
-                serverSetAllowStrafeMidAir(getConfigProfiles().getVars()[CVAR_SV_ALLOW_STRAFE_MID_AIR].getAsBool());
-                serverSetAllowStrafeMidAirFull(getConfigProfiles().getVars()[CVAR_SV_ALLOW_STRAFE_MID_AIR_FULL].getAsBool());
+                setAllowStrafeMidAir(getConfigProfiles().getVars()[CVAR_SV_ALLOW_STRAFE_MID_AIR].getAsBool());
+                setAllowStrafeMidAirFull(getConfigProfiles().getVars()[CVAR_SV_ALLOW_STRAFE_MID_AIR_FULL].getAsBool());
                 serverSetFallDamageMultiplier(m_config.getFallDamageMultiplier());
                 serverUpdateWeapons(*GameMode::getGameMode());
             }
+            else if (m_config.isServerInfoReceived())
+            {
+                // client-side prediction of our own player's movement needs the same rules as server
+                setAllowStrafeMidAir(m_config.getServerInfo().m_bAllowStrafeMidAir);
+                setAllowStrafeMidAirFull(m_config.getServerInfo().m_bAllowStrafeMidAirFull);
+            }
 
             // 1 TICK START
             const auto DurationSimulationStepMicrosecsPerTick = std::chrono::microseconds((1000 * 1000) / m_config.getTickRate());
@@ -367,6 +407,11 @@ void proofps_dd::PRooFPSddPGE::onGameRunning()
             {
                 // @TICKRATE
                 m_timeSimulation += DurationSimulationStepMicrosecsPerTick;
+                if (!handleReceivedPackets())
+                {
+                    // game session is left at the beginning of next frame
+                    break;
+                }
                 if (getNetwork().isServer())
                 {
                     mainLoopConnectedServerOnlyOneTick(DurationSimulationStepMicrosecsPerTick.count());
@@ -378,6 +423,8 @@ void proofps_dd::PRooFPSddPGE::onGameRunning()
             }
             // 1 TICK END
 
+            // user cmds are built once per frame, so input events are consumed right before that, up to now
+            consumeInputEventsUntil(std::chrono::steady_clock::now(), window.isActive());
             mainLoopConnectedShared(window);
         } // endif validConnection
         else
@@ -434,10 +481,50 @@ void proofps_dd::PRooFPSddPGE::onGameRunning()
 
 /**
     Called when a new network packet is received.
+    The packet is not handled here, only validated and queued, it will be handled by handlePacket() at a defined point of the main loop,
+    see handleReceivedPackets(). PGE invokes this from its frame loop on the main thread, the same thread that handles the packets.
 
-    @return True on successful packet handling, false on serious error that should result in terminating the application.
+    @return True on successful packet queueing, false on invalid packet that should result in terminating the application.
 */
 bool proofps_dd::PRooFPSddPGE::onPacketReceived(const pge_network::PgePacket& pkt)
+{
+    // packets injected by server to itself are not travelling over network so they are not subject to network condition emulation
+    if (m_config.getNetworkConditionEmulation() &&
+        !(getNetwork().isServer() && (pge_network::PgePacket::getServerSideConnectionHandle(pkt) == pge_network::ServerConnHandle)))
+    {
+        if (!PacketReceiveQueues::isValid(pkt))
+        {
+            getConsole().EOLn("PRooFPSddPGE::%s(): invalid pkt, pktId: %u!", __func__, pge_network::PgePacket::getPacketId(pkt));
+            return false;
+        }
+        if (getNetwork().isServer())
+        {
+            m_netEmu.submit(
+                pge_network::PgePacket::getServerSideConnectionHandle(pkt),
+                NetworkConditionEmulator::Direction::ClientToServer,
+                pkt,
+                std::chrono::steady_clock::now());
+        }
+        else
+        {
+            m_netEmu.submit(
+                pge_network::ServerConnHandle,
+                NetworkConditionEmulator::Direction::ServerToClient,
+                pkt,
+                std::chrono::steady_clock::now());
+        }
+        return true;
+    }
+
+    return m_packetReceiveQueues.push(pkt);
+}
+
+/**
+    Handles a received packet, invoked only by the main thread.
+
+    @return True on successful packet handling, false on serious error that should result in terminating the application.
+*/
+bool proofps_dd::PRooFPSddPGE::handlePacket(const pge_network::PgePacket& pkt)
 {
     assert(GameMode::getGameMode());
 
@@ -448,6 +535,10 @@ bool proofps_dd::PRooFPSddPGE::onPacketReceived(const pge_network::PgePacket& pk
     switch (pgePktId)
     {
     case pge_network::MsgUserConnectedServerSelf::id:
+        if (getNetwork().isServer() && (pge_network::PgePacket::getServerSideConnectionHandle(pkt) != pge_network::ServerConnHandle))
+        {
+            MsgTrafficStats::getInstance().addConnection(pge_network::PgePacket::getServerSideConnectionHandle(pkt));
+        }
         bRet = handleUserConnected(
             pge_network::PgePacket::getServerSideConnectionHandle(pkt),
             pge_network::PgePacket::getMessageAsUserConnected(pkt),
@@ -456,6 +547,11 @@ bool proofps_dd::PRooFPSddPGE::onPacketReceived(const pge_network::PgePacket& pk
             m_cbDisplayMapLoadingProgressUpdate);
         break;
     case pge_network::MsgUserDisconnectedFromServer::id:
+        if (getNetwork().isServer())
+        {
+            serverRemoveClientFromInterestManagement(pge_network::PgePacket::getServerSideConnectionHandle(pkt));
+            MsgTrafficStats::getInstance().removeConnection(pge_network::PgePacket::getServerSideConnectionHandle(pkt));
+        }
         bRet = handleUserDisconnected(
             pge_network::PgePacket::getServerSideConnectionHandle(pkt),
             pge_network::PgePacket::getMessageAsUserDisconnected(pkt),
@@ -545,6 +641,10 @@ bool proofps_dd::PRooFPSddPGE::onPacketReceived(const pge_network::PgePacket& pk
                 pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgUserCmdFromClient>(pkt),
                 *GameMode::getGameMode(),
                 *this);
+            serverUpdateLagCompensationTicks(
+                pge_network::PgePacket::getServerSideConnectionHandle(pkt),
+                pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgUserCmdFromClient>(pkt).m_nViewServerTick,
+                m_config.getTickRate());
             break;
         case proofps_dd::MsgUserUpdateFromServer::id:
             assert(m_gui.getXHair());
@@ -608,10 +708,44 @@ bool proofps_dd::PRooFPSddPGE::onPacketReceived(const pge_network::PgePacket& pk
                 getConfigProfiles(),
                 getSmokePool());
             break;
+        case proofps_dd::MsgStringTableEntryFromServer::id:
+            if (getNetwork().isServer())
+            {
+                getConsole().EOLn("PRooFPSddPGE::%s(): server received MsgStringTableEntryFromServer, CANNOT HAPPEN!", __func__);
+                assert(false);
+                return false;
+            }
+            bRet = StringTable::getInstance().clientHandleStringTableEntryFromServer(
+                pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgStringTableEntryFromServer>(pkt));
+            break;
+        case proofps_dd::MsgJoinSnapshotChunkFromServer::id:
+            if (getNetwork().isServer())
+            {
+                getConsole().EOLn("PRooFPSddPGE::%s(): server received MsgJoinSnapshotChunkFromServer, CANNOT HAPPEN!", __func__);
+                assert(false);
+                return false;
+            }
+            // Records of a complete snapshot are processed by recursively invoking this function, so they are counted in stats by their own
+            // msg ids. Not counting the chunk itself, otherwise the same bytes and handling time would be counted twice.
+            return clientHandleJoinSnapshotChunkFromServer(
+                pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgJoinSnapshotChunkFromServer>(pkt));
         default:
             bRet = false;
             getConsole().EOLn("CustomPGE::%s(): unknown msgId %u in MsgApp!", __func__, proofpsAppMsgId);
         }
+
+        // On client, everything is received from server. On server, the connection handle in a packet is its sender only
+        // if the message is allowed to be sent by clients, otherwise server injected it to itself.
+        MsgTrafficStats::getInstance().addRx(
+            (!getNetwork().isServer() ||
+             (getNetwork().getServer().getAllowListedAppMessages().find(static_cast<pge_network::MsgApp::TMsgId>(proofpsAppMsgId)) ==
+              getNetwork().getServer().getAllowListedAppMessages().end())) ?
+                pge_network::ServerConnHandle :
+                pge_network::PgePacket::getServerSideConnectionHandle(pkt),
+            pkt);
+        MsgTrafficStats::getInstance().addHandlerDuration(
+            proofpsAppMsgId,
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - timeStart).count());
         break;
     }
     default:
@@ -634,6 +768,8 @@ void proofps_dd::PRooFPSddPGE::onGameDestroying()
     m_gui.textForNextFrame("Exiting game ...", 200, getPure().getWindow().getClientHeight() / 2);
     getPure().getRenderer()->RenderScene();
 
+    stopInputSampling();
+
     //getConsole().SetLoggingState("4LLM0DUL3S", true);
     //getPure().WriteList();
     //getConsole().SetLoggingState("4LLM0DUL3S", false);
@@ -654,6 +790,50 @@ void proofps_dd::PRooFPSddPGE::onGameDestroying()
 // ############################### PRIVATE ###############################
 
 
+/**
+    Handles all packets received since the last invocation, in the order of receiving.
+    If handling a packet fails, the rest of the packets are not handled since they might depend on the failed one, and
+    m_bPacketHandlingFailed stays set until the caller clears it.
+
+    @return False if handling a packet failed in this or an earlier invocation, true otherwise.
+*/
+bool proofps_dd::PRooFPSddPGE::handleReceivedPackets()
+{
+    if (m_bPacketHandlingFailed)
+    {
+        return false;
+    }
+
+    pge_network::PgePacket pkt;
+    if (m_config.getNetworkConditionEmulation())
+    {
+        // packets become received when they are due as per the emulated conditions
+        const auto timeNow = std::chrono::steady_clock::now();
+        pge_network::PgeNetworkConnectionHandle connHandle;
+        NetworkConditionEmulator::Direction dir;
+        while (m_netEmu.poll(timeNow, pkt, connHandle, dir))
+        {
+            // the receiver of an unreliable lane would drop the ones overtaken by a later update of the same kind
+            if (!m_netEmu.isLastPolledStale())
+            {
+                m_packetReceiveQueues.push(pkt);
+            }
+        }
+    }
+
+    while (m_packetReceiveQueues.pop(pkt))
+    {
+        if (!handlePacket(pkt))
+        {
+            getConsole().EOLn("PRooFPSddPGE::%s(): handlePacket() FAILED for pktId: %u!", __func__, pge_network::PgePacket::getPacketId(pkt));
+            m_bPacketHandlingFailed = true;
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void proofps_dd::PRooFPSddPGE::showLoadingScreen(int nProgress)
 {
     m_gui.showLoadingScreen(nProgress, m_maps.getNextMapToBeLoaded());
@@ -687,6 +867,16 @@ bool proofps_dd::PRooFPSddPGE::connect()
         return false;
     }
 
+    if (m_config.getNetworkConditionEmulation())
+    {
+        // only the incoming direction is emulated by an instance, so for emulating both directions, both server and clients shall enable it
+        m_netEmu.reset(m_config.getNetworkConditionEmulatorSeed());
+        m_netEmu.setDefaultConditions(
+            getNetwork().isServer() ? NetworkConditionEmulator::Direction::ClientToServer : NetworkConditionEmulator::Direction::ServerToClient,
+            m_config.getNetworkConditionEmulatorConditions());
+        m_timeNetEmuStart = std::chrono::steady_clock::now();
+    }
+
     bool bRet;
     const std::string sAppVersion = std::string(GAME_NAME) + " " + std::string(GAME_VERSION);
     if (getNetwork().isServer())
@@ -732,10 +922,21 @@ void proofps_dd::PRooFPSddPGE::disconnect(bool bExitFromGameSession, const std::
     m_gui.hideCountdownTimerForRespawnOrForcedSpectating();
     getPure().getRenderer()->RenderScene();
 
+    if (m_config.getNetworkConditionEmulation())
+    {
+        m_netEmu.printReport(std::chrono::steady_clock::now() - m_timeNetEmuStart);
+    }
+
     getConsole().SetLoggingState("4LLM0DUL3S", true);
     getNetwork().disconnect(sExtraDebugText);
     m_nServerSideConnectionHandle = pge_network::ServerConnHandle; // default it back
     getConsole().SetLoggingState("4LLM0DUL3S", false);
+    if (!getNetwork().isServer())
+    {
+        // server will send all entries again when we reconnect, server keeps them since ids do not change within a session
+        StringTable::getInstance().clear();
+        m_joinSnapshot.clear();
+    }
     
     // As server, dont need to remove players because we already disconnected above, this will cause all connection states to transition to
     // disconnected while handling state changes in engine main loop (getNetwork.Update()), invoking our handleUserDisconnected() as well.
@@ -768,8 +969,13 @@ void proofps_dd::PRooFPSddPGE::disconnect(bool bExitFromGameSession, const std::
     }
 
     m_config.setServerInfoNotReceived();
+    // all clients are being disconnected anyway, accumulated priorities are not valid on the next map
+    m_sendScheduler.clear();
     deleteWeaponHandlingAll(
         false /* no need for bulletpool dealloc, it is unnecessary and slow anyway, and if we are changing map, alloc again will be slow too*/);
+    // timers refer to entities of the game session being left
+    serverClearTimers();
+    m_mapItemRespawnTimers.clear();
     m_maps.unload();
 
     if (bExitFromGameSession)
@@ -804,6 +1010,7 @@ void proofps_dd::PRooFPSddPGE::mainLoopConnectedServerOnlyOneTick(
     assert(GameMode::getGameMode());
     assert(m_gui.getXHair());
     const bool bWin = GameMode::getGameMode()->serverCheckAndUpdateWinningConditions(getNetwork());
+    serverHandleDueTimers();
     for (unsigned int iPhyIter = 1; iPhyIter <= nPhysicsIterationsPerTick; iPhyIter++)
     {
         // @PHYSICS-RATE START
@@ -824,7 +1031,6 @@ void proofps_dd::PRooFPSddPGE::mainLoopConnectedServerOnlyOneTick(
 
         // @PHYSICS-RATE END
     }  // for iPhyIter
-    serverUpdateRespawnTimers(m_config, getConfigProfiles(), *GameMode::getGameMode(), m_durations, getSmokePool());
     serverSendUserUpdates(getConfigProfiles(), m_config, m_durations, *GameMode::getGameMode());
 
     // @TICK-RATE END
@@ -843,9 +1049,11 @@ void proofps_dd::PRooFPSddPGE::mainLoopConnectedClientOnlyOneTick(
     GameMode* const gm = GameMode::getGameMode();
     assert(gm);
 
+    Player& player = m_mapPlayers.at(m_nServerSideConnectionHandle); // cannot throw, because of bValidConnection
     const unsigned int nPhysicsIterationsPerTick = std::max(1u, m_config.getPhysicsRate() / m_config.getTickRate());
     for (unsigned int iPhyIter = 1; iPhyIter <= nPhysicsIterationsPerTick; iPhyIter++)
     {
+        clientPredictLocalPlayerMovement(player, getLastUserCmdSeqSent(), m_config.getPhysicsRate(), *gm);
         clientUpdateBullets(m_config.getPhysicsRate());
         clientUpdateExplosions(*gm, m_config.getPhysicsRate());
         updateSmokes(*gm, m_config.getPhysicsRate());
@@ -867,7 +1075,8 @@ void proofps_dd::PRooFPSddPGE::mainLoopConnectedShared(PureWindow& window)
     if (window.isActive())
     {
         if (clientHandleInputWhenConnectedAndSendUserCmdMoveToServer(
-            *GameMode::getGameMode(), player, *m_gui.getXHair(), m_config.getTickRate(), m_config.getClientUpdateRate(), m_config.getPhysicsRate(), *this
+            *GameMode::getGameMode(), player, *m_gui.getXHair(), m_config.getTickRate(), m_config.getClientUpdateRate(), m_config.getPhysicsRate(),
+            clientGetViewServerTick(m_config), clientGetEchoServerTimeMillisecs(), getClientPrediction(), *this
         ) == proofps_dd::InputHandling::PlayerAppActionRequest::Exit)
         {
             disconnect(true);
@@ -1277,8 +1486,99 @@ void proofps_dd::PRooFPSddPGE::updateAudioVisualsForGameModeShared()
     m_durations.m_nUpdateGameModeDurationUSecs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - timeStart).count();
 }
 
+/**
+    Only server executes this, once per tick.
+    Advances the server timers to the tick being simulated and handles the expired timers, so entities waiting for something
+    to happen at a given time are not polled every tick.
+*/
+void proofps_dd::PRooFPSddPGE::serverHandleDueTimers()
+{
+    const std::chrono::time_point<std::chrono::steady_clock> timeStart = std::chrono::steady_clock::now();
+
+    // server tick counter is incremented at the end of the tick by serverSendUserUpdates(), so we are simulating the next one
+    std::uint32_t nCurrentServerTick = getServerTick() + 1;
+    if (nCurrentServerTick == 0)
+    {
+        ++nCurrentServerTick;
+    }
+
+    getServerTimers().advance(nCurrentServerTick, m_vecServerTimersExpired);
+    for (const auto& expiry : m_vecServerTimersExpired)
+    {
+        switch (static_cast<ServerTimerKind>(expiry.m_nKind))
+        {
+        case ServerTimerKind::MapItemRespawn:
+            serverRespawnItem(expiry.m_nId);
+            break;
+        case ServerTimerKind::PlayerRespawn:
+            assert(GameMode::getGameMode());
+            serverRespawnPlayerByTimer(
+                static_cast<pge_network::PgeNetworkConnectionHandle>(expiry.m_nId), m_config, getConfigProfiles(), *GameMode::getGameMode(), getSmokePool());
+            break;
+        case ServerTimerKind::PlayerInvulnerabilityEnd:
+            serverEndPlayerInvulnerabilityByTimer(static_cast<pge_network::PgeNetworkConnectionHandle>(expiry.m_nId));
+            break;
+        default:
+            getConsole().EOLn("PRooFPSddPGE::%s(): unhandled timer kind %u!", __func__, expiry.m_nKind);
+            assert(false);
+        }
+    }
+
+    m_durations.m_nUpdateRespawnTimersDurationUSecs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - timeStart).count();
+}
+
+void proofps_dd::PRooFPSddPGE::serverCancelItemRespawnTimers()
+{
+    for (const auto& itemTimerPair : m_mapItemRespawnTimers)
+    {
+        getServerTimers().cancel(itemTimerPair.second);
+    }
+    m_mapItemRespawnTimers.clear();
+}
+
+/**
+    Invoked when the respawn timer of the given taken map item expires.
+*/
+void proofps_dd::PRooFPSddPGE::serverRespawnItem(const MapItem::MapItemId& mapItemId)
+{
+    m_mapItemRespawnTimers.erase(mapItemId);
+
+    assert(GameMode::getGameMode());
+    if (GameMode::getGameMode()->isGameWon())
+    {
+        // all items are respawned anyway by the restart after winning
+        return;
+    }
+
+    const auto itItem = m_maps.getItems().find(mapItemId);
+    if ((itItem == m_maps.getItems().end()) || !itItem->second || !itItem->second->isTaken())
+    {
+        return;
+    }
+
+    MapItem& mapItem = *(itItem->second);
+    mapItem.unTake();
+
+    pge_network::PgePacket newPktMapItemUpdate;
+    if (proofps_dd::MsgMapItemUpdateFromServer::initPkt(
+        newPktMapItemUpdate,
+        pge_network::ServerConnHandle,
+        mapItem.getId(),
+        mapItem.isTaken()))
+    {
+        MsgTrafficStats::serverSendToAllClientsExcept(getNetwork(), newPktMapItemUpdate);
+    }
+    else
+    {
+        getConsole().EOLn("PRooFPSddPGE::%s(): initPkt() FAILED at line %d!", __func__, __LINE__);
+        assert(false);
+    }
+}
+
 void proofps_dd::PRooFPSddPGE::serverRespawnItems()
 {
+    serverCancelItemRespawnTimers();
+
     // respawn all map items
     pge_network::PgePacket newPktMapItemUpdate;
     for (auto& itemPair : m_maps.getItems())
@@ -1303,7 +1603,7 @@ void proofps_dd::PRooFPSddPGE::serverRespawnItems()
             mapItem.getId(),
             mapItem.isTaken()))
         {
-            getNetwork().getServer().sendToAllClientsExcept(newPktMapItemUpdate);
+            MsgTrafficStats::serverSendToAllClientsExcept(getNetwork(), newPktMapItemUpdate);
         }
         else
         {
@@ -1338,14 +1638,8 @@ void proofps_dd::PRooFPSddPGE::serverPickupAndRespawnItems()
 
         if (mapItem.isTaken())
         {
-            const auto nSecsSinceTake = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - mapItem.getTimeTaken()).count();
-            if (nSecsSinceTake < static_cast<std::chrono::seconds::rep>(MapItem::getItemRespawnTimeSecs(mapItem)))
-            {
-                continue;
-            }
-
-            mapItem.unTake();
-            bSendItemUpdate = true;
+            // respawned by its timer scheduled upon taking, in serverHandleDueTimers()
+            continue;
         }
         else
         {
@@ -1376,13 +1670,19 @@ void proofps_dd::PRooFPSddPGE::serverPickupAndRespawnItems()
                         bool bHasJustBecomeAvailable = false;
                         player.takeItem(mapItem, newPktWpnUpdate, bHasJustBecomeAvailable);  // this also invokes mapItem.Take()
                         bSendItemUpdate = true;
+                        auto& itemRespawnTimerId = m_mapItemRespawnTimers[mapItem.getId()];
+                        getServerTimers().cancel(itemRespawnTimerId);  // normally an untaken item has no timer
+                        itemRespawnTimerId = getServerTimers().schedule(
+                            MapItem::getItemRespawnTimeSecs(mapItem) * m_config.getTickRate(),
+                            static_cast<std::uint32_t>(ServerTimerKind::MapItemRespawn),
+                            mapItem.getId());
                         // although item update is always sent, wpn update is sent only if takeItem() flipped the availability of the wpn,
                         // since it can happen the item is not weapon-related at all, or something else, anyway let takeItem() make the decision!
                         if (proofps_dd::MsgWpnUpdateFromServer::getAvailable(newPktWpnUpdate))
                         {
                             if (playerPair.second.getServerSideConnectionHandle() != pge_network::ServerConnHandle) // server doesnt send this to itself
                             {
-                                getNetwork().getServer().send(newPktWpnUpdate, playerPair.second.getServerSideConnectionHandle());
+                                MsgTrafficStats::serverSend(getNetwork(), newPktWpnUpdate, playerPair.second.getServerSideConnectionHandle());
                             }
                             else
                             {
@@ -1413,7 +1713,7 @@ void proofps_dd::PRooFPSddPGE::serverPickupAndRespawnItems()
                 mapItem.getId(),
                 mapItem.isTaken()))
             {
-                getNetwork().getServer().sendToAllClientsExcept(newPktMapItemUpdate);
+                MsgTrafficStats::serverSendToAllClientsExcept(getNetwork(), newPktMapItemUpdate);
             }
             else
             {
@@ -1477,6 +1777,52 @@ bool proofps_dd::PRooFPSddPGE::clientHandleGameSessionStateFromServer(const proo
     return true;
 }
 
+bool proofps_dd::PRooFPSddPGE::clientHandleJoinSnapshotChunkFromServer(const proofps_dd::MsgJoinSnapshotChunkFromServer& msg)
+{
+    if (!m_joinSnapshot.clientHandleJoinSnapshotChunkFromServer(msg))
+    {
+        getConsole().EOLn("PRooFPSddPGE::%s(): invalid chunk received!", __func__);
+        assert(false);
+        return false;
+    }
+
+    if (!m_joinSnapshot.isComplete())
+    {
+        return true;
+    }
+
+    std::vector<pge_network::PgePacket> vecPkts;
+    const bool bRecordsValid = m_joinSnapshot.getRecordsAsPkts(vecPkts);
+    m_joinSnapshot.clear();
+    if (!bRecordsValid)
+    {
+        getConsole().EOLn("PRooFPSddPGE::%s(): getRecordsAsPkts() FAILED!", __func__);
+        assert(false);
+        return false;
+    }
+
+    getConsole().OLn("PRooFPSddPGE::%s(): processing join snapshot with %u records", __func__, vecPkts.size());
+    for (const auto& pkt : vecPkts)
+    {
+        // a record can be anything that server is allowed to send to us, except another snapshot chunk
+        const pge_network::MsgApp::TMsgId msgId = pge_network::PgePacket::getMsgAppIdFromPkt(pkt);
+        if ((msgId == static_cast<pge_network::MsgApp::TMsgId>(proofps_dd::MsgJoinSnapshotChunkFromServer::id)) ||
+            (getNetwork().getClient().getAllowListedAppMessages().find(msgId) == getNetwork().getClient().getAllowListedAppMessages().end()))
+        {
+            getConsole().EOLn("PRooFPSddPGE::%s(): not allowed msgId %u in join snapshot!", __func__, msgId);
+            assert(false);
+            return false;
+        }
+
+        if (!handlePacket(pkt))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetworkConnectionHandle connHandleServerSide, const proofps_dd::MsgUserSetupFromServer& msg)
 {
     // TODO: make sure received user name is properly null-terminated! someone else could had sent that, e.g. malicious server
@@ -1502,8 +1848,9 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
 
     if (msg.m_bCurrentClient)
     {
+        const std::string& sMapFilename = StringTable::getInstance().getString(msg.m_nMapFilenameId);
         getConsole().OLn("PRooFPSddPGE::%s(): this is me, connHandleServerSide: %u, my IP: %s, map: %s",
-            __func__, connHandleServerSide, msg.m_szIpAddress, msg.m_szMapFilename);
+            __func__, connHandleServerSide, msg.m_szIpAddress, sMapFilename.c_str());
         m_nServerSideConnectionHandle = connHandleServerSide;
 
         if (getNetwork().isServer())
@@ -1529,16 +1876,16 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
                 assert(false);
                 return false;
             }
-            getNetwork().getServer().send(newPktUserNameChange);
+            MsgTrafficStats::serverSend(getNetwork(), newPktUserNameChange);
 
             // Server receives map name also in MsgUserSetupFromServer.
             // However, the server MUST have the correct map loaded already at this point:
             //  - if this is a bootup, it loaded already in handleUserConnected();
             //  - if this is a map change, it loaded already in handleMapChangeFromServer().
             // So if file name is mismatching then there must be a huge logic error somewhere and we should terminate now.
-            if (m_maps.getFilename() != msg.m_szMapFilename)
+            if (m_maps.getFilename() != sMapFilename)
             {
-                getConsole().EOLn("PRooFPSddPGE::%s(): unexpected map name received by self: %s, loaded map: %s!", __func__, msg.m_szMapFilename, m_maps.getFilename().c_str());
+                getConsole().EOLn("PRooFPSddPGE::%s(): unexpected map name received by self: %s, loaded map: %s!", __func__, sMapFilename.c_str(), m_maps.getFilename().c_str());
                 assert(false);
                 return false;
             }
@@ -1548,19 +1895,19 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
             // Client receives map name also in MsgUserSetupFromServer.
             // If this is a bootup, then we need to load map here, only if it is different than what we have already loaded (map change case).
             // Because we also get here in case of reconnecting after a map change, we should load the map only if it is different than server just asked for.
-            if (m_maps.getFilename() != msg.m_szMapFilename)
+            if (m_maps.getFilename() != sMapFilename)
             {
                 // if we fall here with non-empty m_maps.getFilename(), it is an error, and m_maps.load() will fail as expected.
-                if (!m_maps.load(msg.m_szMapFilename, m_cbDisplayMapLoadingProgressUpdate))
+                if (!m_maps.load(sMapFilename.c_str(), m_cbDisplayMapLoadingProgressUpdate))
                 {
-                    getConsole().EOLn("PRooFPSddPGE::%s(): m_maps.load() failed: %s!", __func__, msg.m_szMapFilename);
+                    getConsole().EOLn("PRooFPSddPGE::%s(): m_maps.load() failed: %s!", __func__, sMapFilename.c_str());
                     assert(false);
                     return false;
                 }
             }
             else
             {
-                getConsole().OLn("PRooFPSddPGE::%s(): map %s already loaded", __func__, msg.m_szMapFilename);
+                getConsole().OLn("PRooFPSddPGE::%s(): map %s already loaded", __func__, sMapFilename.c_str());
             }
 
             // Now we should ask the server to set our wanted name,
@@ -1580,7 +1927,7 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
                 assert(false);
                 return false;
             }
-            getNetwork().getClient().send(newPktUserNameChange);
+            MsgTrafficStats::clientSend(getNetwork(), newPktUserNameChange);
         }
 
         // at this point we can be sure we have the proper map loaded, camera must start from the center of the map
@@ -1601,11 +1948,14 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
 
         if (getNetwork().isServer())
         {
-            // we send as many MsgUserSetupFromServer pkts to the client as the number of already connected players,
+            // we put as many MsgUserSetupFromServer msgs into the join snapshot as the number of already connected players,
             // otherwise client won't know about them, so this way the client will detect them as newly connected users;
-            // we also send MsgUserUpdateFromServer about each player so new client will immediately have their positions and other data updated,
+            // we also put MsgUserUpdateFromServer about each player so new client will immediately have their positions and other data updated,
             // and MsgCurrentWpnUpdateFromServer so their current weapon is also correctly display instead of the default wpn.
-            
+            // The snapshot is built once and then streamed to the client in a few chunks, instead of sending all these msgs one by one.
+            JoinSnapshot joinSnapshot;
+            bool bJoinSnapshotBuilt = true;
+
             for (const auto& it : m_mapPlayers)
             {
                 pge_network::PgePacket newPktSetup;
@@ -1614,13 +1964,13 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
                     it.second.getServerSideConnectionHandle(),
                     false,
                     it.second.getIpAddress(),
-                    "" /* here mapFilename is irrelevant */))
+                    StringTable::serverIntern(getNetwork(), m_maps.getFilename()) /* here mapFilename is irrelevant, but must be a valid id */))
                 {
                     getConsole().EOLn("PRooFPSddPGE::%s(): initPkt() FAILED at line %d!", __func__, __LINE__);
                     assert(false);
                     continue;
                 }
-                getNetwork().getServer().send(newPktSetup, connHandleServerSide);
+                bJoinSnapshotBuilt &= joinSnapshot.add<proofps_dd::MsgUserSetupFromServer>(newPktSetup);
 
                 if (!it.second.getName().empty())
                 {
@@ -1637,7 +1987,7 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
                         assert(false);
                         return false;
                     }
-                    getNetwork().getServer().send(newPktUserNameChange, connHandleServerSide);
+                    bJoinSnapshotBuilt &= joinSnapshot.add<proofps_dd::MsgUserNameChangeAndBootupDone>(newPktUserNameChange);
                 }
 
                 bool bSentImplicitExitSpectatorMode = false;
@@ -1652,7 +2002,7 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
                         it.second.getServerSideConnectionHandle(),
                         PlayerEventId::TeamIdChanged,
                         static_cast<int>(it.second.getTeamId()));
-                    getNetwork().getServer().send(pktPlayerEventTeamSelect, connHandleServerSide);
+                    bJoinSnapshotBuilt &= joinSnapshot.add<proofps_dd::MsgPlayerEventFromServer>(pktPlayerEventTeamSelect);
                 }
 
                 // send item availability BEFORE MsgUserUpdateFromServer because latter has the up-to-date getCurrentInventoryItemPower()
@@ -1669,7 +2019,7 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
                         assert(false);
                         continue;
                     }
-                    getNetwork().getServer().send(pktPlayerInventoryItemAvailable, connHandleServerSide);
+                    bJoinSnapshotBuilt &= joinSnapshot.add<proofps_dd::MsgPlayerEventFromServer>(pktPlayerInventoryItemAvailable);
                 }
 
                 if (it.second.hasAntiGravityActive())
@@ -1686,7 +2036,7 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
                         assert(false);
                         continue;
                     }
-                    getNetwork().getServer().send(pktPlayerInventoryItemActive, connHandleServerSide);
+                    bJoinSnapshotBuilt &= joinSnapshot.add<proofps_dd::MsgPlayerEventFromServer>(pktPlayerInventoryItemActive);
                 }
 
                 pge_network::PgePacket newPktUserUpdate;
@@ -1701,6 +2051,7 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
                     it.second.getWeaponManager().getCurrentWeapon()->getObject3D().getAngleVec().getZ(),
                     it.second.getWeaponManager().getCurrentWeapon()->getMomentaryAccuracy(it.second.isMoving(), it.second.isRunning(), it.second.getCrouchStateCurrent()),
                     it.second.getActuallyRunningOnGround(),
+                    it.second.isRunning(),
                     false /* TODO: why are we not sending out the current crouch state??? */,
                     it.second.getSomersaultAngle(),
                     it.second.getArmor(),
@@ -1718,20 +2069,20 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
                     assert(false);
                     continue;
                 }
-                getNetwork().getServer().send(newPktUserUpdate, connHandleServerSide);
+                bJoinSnapshotBuilt &= joinSnapshot.add<proofps_dd::MsgUserUpdateFromServer>(newPktUserUpdate);
 
                 pge_network::PgePacket pktWpnUpdateCurrent;
                 if (!proofps_dd::MsgCurrentWpnUpdateFromServer::initPkt(
                     pktWpnUpdateCurrent,
                     it.second.getServerSideConnectionHandle(),
-                    it.second.getWeaponManager().getCurrentWeapon()->getFilename(),
+                    StringTable::serverIntern(getNetwork(), it.second.getWeaponManager().getCurrentWeapon()->getFilename()),
                     it.second.getWeaponManager().getCurrentWeapon()->getState().getNew()))
                 {
                     getConsole().EOLn("PRooFPSddPGE::%s(): initPkt() FAILED at line %d!", __func__, __LINE__);
                     assert(false);
                     continue;
                 }
-                getNetwork().getServer().send(pktWpnUpdateCurrent, connHandleServerSide);
+                bJoinSnapshotBuilt &= joinSnapshot.add<proofps_dd::MsgCurrentWpnUpdateFromServer>(pktWpnUpdateCurrent);
 
                 // by default spectator mode is enabled for players, send packet to toggle it
                 // if a player is not spectating
@@ -1743,11 +2094,11 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
                         pktPlayerEventToggleSpectator,
                         it.second.getServerSideConnectionHandle(),
                         PlayerEventId::ToggledSpectatorMode);
-                    getNetwork().getServer().send(pktPlayerEventToggleSpectator, connHandleServerSide);
+                    bJoinSnapshotBuilt &= joinSnapshot.add<proofps_dd::MsgPlayerEventFromServer>(pktPlayerEventToggleSpectator);
                 }
             }
 
-            // we also send the state of all map items
+            // we also put the state of all map items
             pge_network::PgePacket newPktMapItemUpdate;
             for (auto& itemPair : m_maps.getItems())
             {
@@ -1762,7 +2113,7 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
                     itemPair.first,
                     itemPair.second->isTaken()))
                 {
-                    getNetwork().getServer().send(newPktMapItemUpdate, connHandleServerSide);
+                    bJoinSnapshotBuilt &= joinSnapshot.add<proofps_dd::MsgMapItemUpdateFromServer>(newPktMapItemUpdate);
                 }
                 else
                 {
@@ -1770,6 +2121,22 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
                     assert(false);
                 }
             }
+
+            if (!bJoinSnapshotBuilt)
+            {
+                getConsole().EOLn("PRooFPSddPGE::%s(): failed to build join snapshot for connHandleServerSide: %u!", __func__, connHandleServerSide);
+                assert(false);
+                return false;
+            }
+
+            getConsole().OLn("PRooFPSddPGE::%s(): sending join snapshot to connHandleServerSide: %u: %u records, %u bytes, %u chunks",
+                __func__, connHandleServerSide, joinSnapshot.getRecordCount(), joinSnapshot.getLength(), joinSnapshot.getChunkCount());
+            if (!joinSnapshot.serverSend(getNetwork(), connHandleServerSide))
+            {
+                getConsole().EOLn("PRooFPSddPGE::%s(): serverSend() FAILED at line %d!", __func__, __LINE__);
+                assert(false);
+                return false;
+            }
         } // end server processing birth of another user
     }
 
@@ -1795,20 +2162,14 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
     // We dont hide player here:
     // updatePlayersVisuals() is responsible for player visibility updates, thus also for hiding player not allowed for gameplay!
 
-    if (getNetwork().isServer() && msg.m_bCurrentClient)
-    {
-        // server player is obviously not expecting after bootup delayed update from server
-        insertedPlayer.setExpectingAfterBootUpDelayedUpdate(false);
-    }
-
     float fMaxBulletRatePerSec = 0.f;
     for (const auto& entry : std::filesystem::directory_iterator(proofps_dd::GAME_WEAPONS_DIR))
     {
         //getConsole().OLn("PRooFPSddPGE::%s(): %s!", __func__, entry.path().filename().string().c_str());
-        if (entry.path().filename().string().length() >= proofps_dd::MsgWpnUpdateFromServer::nWpnNameNameMaxLength)
+        if (entry.path().filename().string().length() >= proofps_dd::StringTable::nStringBufferLength)
         {
             getConsole().EOLn("PRooFPSddPGE::%s(): skip wpn due to long filename: %s!", __func__, entry.path().string().c_str());
-            continue; // otherwise multiple weapons with same first nWpnNameNameMaxLength-1 chars would be mixed up in pkts
+            continue; // otherwise it could not be added to StringTable, so it could not be referred to in pkts
         }
 
         if (entry.path().extension().string() == ".txt")
@@ -1855,6 +2216,14 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
         }
     }
 
+    // weapon ids are assigned by WeaponManager, they are the same for all players so binding by the 1st player is enough
+    if ((m_mapPlayers.size() == 1) && !bindWeaponDefinitions(insertedPlayer.getWeaponManager()))
+    {
+        getConsole().EOLn("PRooFPSddPGE::%s(): failed to bind weapon definitions!", __func__);
+        assert(false);
+        return false;
+    }
+
     if (getBullets().capacity() == 0)
     {
         // considering a bullet lifetime up to 10 secs, a player can have up to 10 * fMaxBulletRatePerSec active bullets on the map, and
@@ -1915,9 +2284,15 @@ bool proofps_dd::PRooFPSddPGE::handleUserSetupFromServer(pge_network::PgeNetwork
 
 bool proofps_dd::PRooFPSddPGE::handleMapChangeFromServer(pge_network::PgeNetworkConnectionHandle /*connHandleServerSide*/, const proofps_dd::MsgMapChangeFromServer& msg)
 {
-    getConsole().OLn("PRooFPSddPGE::%s(): map: %s", __func__, msg.m_szMapFilename);
-
-    // TODO: make sure received map name is properly null-terminated! someone else could had sent that, e.g. malicious server
+    // copy, since client clears StringTable upon disconnect below
+    const std::string sMapFilename = StringTable::getInstance().getString(msg.m_nMapFilenameId);
+    getConsole().OLn("PRooFPSddPGE::%s(): map: %s", __func__, sMapFilename.c_str());
+    if (sMapFilename.empty())
+    {
+        getConsole().EOLn("PRooFPSddPGE::%s(): unknown map filename id: %u!", __func__, msg.m_nMapFilenameId);
+        assert(false);
+        return false;
+    }
 
     getAudio().stopSoundInstance(m_sounds.m_sndEndgameMusicHandle);
     getAudio().stopSoundInstance(m_sounds.m_sndRoundWinHandle);
@@ -1927,7 +2302,7 @@ bool proofps_dd::PRooFPSddPGE::handleMapChangeFromServer(pge_network::PgeNetwork
     }
 
     // map change request may come anytime, so first we disconnect and clean up
-    disconnect(false, "Map change: " + m_maps.getFilename() + " -> " + msg.m_szMapFilename);
+    disconnect(false, "Map change: " + m_maps.getFilename() + " -> " + sMapFilename);
     // reason for disconnecting from the server (in case of client) or clients (in case of server) is the following:
     // - in case of server we stop listening because we are busy anyway with map loading, cannot process messages on the main thread,
     //   so even if we could turn off GNS heartbeat supervisioning we still could not receive client messages;
@@ -1950,9 +2325,9 @@ bool proofps_dd::PRooFPSddPGE::handleMapChangeFromServer(pge_network::PgeNetwork
     // But programmatically client's disconnect injects a MsgUserDisconnected pkt with server's connection handle, so the client will
     // get informed about server's disconnect anyway in handleUserDisconnected() where it should delete all players.
 
-    if (!m_maps.load(msg.m_szMapFilename, m_cbDisplayMapLoadingProgressUpdate))
+    if (!m_maps.load(sMapFilename.c_str(), m_cbDisplayMapLoadingProgressUpdate))
     {
-        getConsole().EOLn("PRooFPSddPGE::%s(): m_maps.load() failed: %s!", __func__, msg.m_szMapFilename);
+        getConsole().EOLn("PRooFPSddPGE::%s(): m_maps.load() failed: %s!", __func__, sMapFilename.c_str());
         assert(false);
         return false;
     }
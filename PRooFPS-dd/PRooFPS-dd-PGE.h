@@ -21,13 +21,17 @@
 #include "GameMode.h"
 #include "GUI.h"
 #include "InputHandling.h"
+#include "JoinSnapshot.h"
 #include "Maps.h"
+#include "NetworkConditionEmulator.h"
 #include "Networking.h"
+#include "PacketReceiveQueues.h"
 #include "Physics.h"
 #include "Player.h"
 #include "PlayerHandling.h"
 #include "PRooFPS-dd-packet.h"
 #include "Sounds.h"
+#include "TickTimerWheel.h"
 #include "WeaponHandling.h"
 
 namespace proofps_dd
@@ -101,8 +105,20 @@ namespace proofps_dd
         proofps_dd::Durations m_durations;
         proofps_dd::Sounds m_sounds;
 
+        proofps_dd::JoinSnapshot m_joinSnapshot;  /**< Client-only, the snapshot being received from server while connecting. */
+        proofps_dd::PacketReceiveQueues m_packetReceiveQueues;  /**< Filled by onPacketReceived(), drained by handleReceivedPackets(). */
+        bool m_bPacketHandlingFailed;  /**< Set by handleReceivedPackets(), game session is left at the beginning of next frame. */
+        proofps_dd::NetworkConditionEmulator m_netEmu;  /**< Used only if enabled by config, delays received packets before they are queued. */
+        std::chrono::time_point<std::chrono::steady_clock> m_timeNetEmuStart;  /**< For the report of m_netEmu. */
+
+        std::vector<proofps_dd::TickTimerWheel::Expiry> m_vecServerTimersExpired;  /**< Server-only, reused by serverHandleDueTimers(). */
+        std::map<MapItem::MapItemId, proofps_dd::TickTimerWheel::TimerId> m_mapItemRespawnTimers;  /**< Server-only, timers of taken map items. */
+
         // ---------------------------------------------------------------------------
 
+        bool handleReceivedPackets();
+        bool handlePacket(const pge_network::PgePacket& pkt);
+
         void showLoadingScreen(int nProgress);
         void hideLoadingScreen();
 
@@ -126,11 +142,16 @@ namespace proofps_dd
         void updateVisualsForGameModeShared(const GameMode* gm);
         void updateAudioVisualsForGameModeShared();
 
+        void serverHandleDueTimers();
+        void serverCancelItemRespawnTimers();
+        void serverRespawnItem(const MapItem::MapItemId& mapItemId);
         void serverRespawnItems();
         void serverPickupAndRespawnItems();
 
         bool clientHandleGameSessionStateFromServer(
             const proofps_dd::MsgGameSessionStateFromServer& msg);
+        bool clientHandleJoinSnapshotChunkFromServer(
+            const proofps_dd::MsgJoinSnapshotChunkFromServer& msg);
 
         bool handleUserSetupFromServer(
             pge_network::PgeNetworkConnectionHandle connHandleServerSide,
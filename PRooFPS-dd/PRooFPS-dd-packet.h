@@ -10,6 +10,8 @@
 */
 
 #include <array>
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <unordered_map>
 
@@ -19,6 +21,7 @@
 #include "GameMode.h"
 #include "MapItem.h"
 #include "Strafe.h"
+#include "StringTable.h"
 
 namespace proofps_dd
 {
@@ -40,6 +43,8 @@ namespace proofps_dd
         DeathNotificationFromServer,
         PlayerEventFromServer,
         UserInGameMenuCmd,
+        StringTableEntryFromServer,
+        JoinSnapshotChunkFromServer,
         LastMsgId
     };
 
@@ -65,12 +70,78 @@ namespace proofps_dd
         PRooFPSappMsgId2ZStringPair{ PRooFPSappMsgId::CurrentWpnUpdateFromServer,  "MsgCurrentWpnUpdateFromServer" },
         PRooFPSappMsgId2ZStringPair{ PRooFPSappMsgId::DeathNotificationFromServer, "MsgDeathNotificationFromServer" },
         PRooFPSappMsgId2ZStringPair{ PRooFPSappMsgId::PlayerEventFromServer,       "MsgPlayerEventFromServer" },
-        PRooFPSappMsgId2ZStringPair{ PRooFPSappMsgId::UserInGameMenuCmd,           "MsgUserInGameMenuCmd" }
+        PRooFPSappMsgId2ZStringPair{ PRooFPSappMsgId::UserInGameMenuCmd,           "MsgUserInGameMenuCmd" },
+        PRooFPSappMsgId2ZStringPair{ PRooFPSappMsgId::StringTableEntryFromServer,  "MsgStringTableEntryFromServer" },
+        PRooFPSappMsgId2ZStringPair{ PRooFPSappMsgId::JoinSnapshotChunkFromServer, "MsgJoinSnapshotChunkFromServer" }
     );
 
     // this way nobody will forget updating both the enum and the array
     static_assert(static_cast<size_t>(PRooFPSappMsgId::LastMsgId) == MapMsgAppId2String.size());
 
+    /**
+    * How a message is expected to be delivered.
+    * These are labels only for now: the PGE send functions used by MsgTrafficStats have no per-message reliability parameter,
+    * so every message is actually sent reliably and in order.
+    * The labels are honored by NetworkConditionEmulator, and this table is where MsgTrafficStats shall select the transport
+    * lane from once PGE can send unreliably.
+    * Reliable: every message is delivered, in order. Used for events (deaths, item pickups, map change, etc.).
+    * UnreliableSequenced: only state updates superseded by the next tick anyway. A lost one is not resent. Once such messages are
+    *                      really sent unreliably, the receiver will also need to drop the ones arriving out-of-order.
+    */
+    enum class PRooFPSappMsgDelivery
+    {
+        Reliable,
+        UnreliableSequenced
+    };
+
+    struct PRooFPSappMsgId2DeliveryPair
+    {
+        PRooFPSappMsgId msgId;
+        PRooFPSappMsgDelivery delivery;
+    };
+
+    // elements must be in the same order as in the enum, so we can index by msgId
+    constexpr auto MapMsgAppId2Delivery = PFL::std_array_of<PRooFPSappMsgId2DeliveryPair>
+    (
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::ServerInfoFromServer,        PRooFPSappMsgDelivery::Reliable },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::GameSessionStateFromServer,  PRooFPSappMsgDelivery::Reliable },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::GameRoundStateFromServer,    PRooFPSappMsgDelivery::Reliable },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::MapChangeFromServer,         PRooFPSappMsgDelivery::Reliable },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::UserSetupFromServer,         PRooFPSappMsgDelivery::Reliable },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::UserNameChangeAndBootupDone, PRooFPSappMsgDelivery::Reliable },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::UserCmdFromClient,           PRooFPSappMsgDelivery::Reliable },  /* carries one-shot inputs e.g. weapon switch */
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::UserUpdateFromServer,        PRooFPSappMsgDelivery::UnreliableSequenced },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::BulletUpdateFromServer,      PRooFPSappMsgDelivery::Reliable },  /* only create and delete, bullets are simulated by clients */
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::MapItemUpdateFromServer,     PRooFPSappMsgDelivery::Reliable },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::WpnUpdateFromServer,         PRooFPSappMsgDelivery::Reliable },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::CurrentWpnUpdateFromServer,  PRooFPSappMsgDelivery::Reliable },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::DeathNotificationFromServer, PRooFPSappMsgDelivery::Reliable },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::PlayerEventFromServer,       PRooFPSappMsgDelivery::Reliable },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::UserInGameMenuCmd,           PRooFPSappMsgDelivery::Reliable },
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::StringTableEntryFromServer,  PRooFPSappMsgDelivery::Reliable },  /* must be reliable, ids are referred to by other reliable msgs */
+        PRooFPSappMsgId2DeliveryPair{ PRooFPSappMsgId::JoinSnapshotChunkFromServer, PRooFPSappMsgDelivery::Reliable }   /* must be reliable, chunks are reassembled in order */
+    );
+
+    static_assert(static_cast<size_t>(PRooFPSappMsgId::LastMsgId) == MapMsgAppId2Delivery.size());
+
+    constexpr bool isMapMsgAppId2DeliveryInEnumOrder()
+    {
+        for (size_t i = 0; i < MapMsgAppId2Delivery.size(); i++)
+        {
+            if (static_cast<size_t>(MapMsgAppId2Delivery[i].msgId) != i)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    static_assert(isMapMsgAppId2DeliveryInEnumOrder());
+
+    constexpr PRooFPSappMsgDelivery getMsgAppDelivery(const PRooFPSappMsgId& msgId)
+    {
+        return MapMsgAppId2Delivery[static_cast<size_t>(msgId)].delivery;
+    }
+
     // server -> clients
     // sent to any connecting client, or in the future even before connecting e.g. when listing servers.
     // Client initialization/player bringup SHALL NOT depend on this, this is just for informational purpose so that
@@ -111,7 +182,9 @@ namespace proofps_dd
             const unsigned int& nRespawnInvulnerabilityTimeSecs,
             const bool& bFriendlyFire,
             const unsigned int& nSecondaryTimeLimitSecs,
-            const unsigned int& nTertiaryTimeLimitSecs)
+            const unsigned int& nTertiaryTimeLimitSecs,
+            const bool& bAllowStrafeMidAir,
+            const bool& bAllowStrafeMidAirFull)
         {
             // although preparePktMsgAppFill() does runtime check, we should fail already at compile-time if msg is too big!
             static_assert(sizeof(MsgServerInfoFromServer) <= pge_network::MsgApp::nMaxMessageLengthBytes, "msg size");
@@ -147,6 +220,9 @@ namespace proofps_dd
             msgServerInfo.m_nSecondaryTimeLimitSecs = nSecondaryTimeLimitSecs;
             msgServerInfo.m_nTertiaryTimeLimitSecs = nTertiaryTimeLimitSecs;
 
+            msgServerInfo.m_bAllowStrafeMidAir = bAllowStrafeMidAir;
+            msgServerInfo.m_bAllowStrafeMidAirFull = bAllowStrafeMidAirFull;
+
             return true;
         }
 
@@ -170,6 +246,9 @@ namespace proofps_dd
         unsigned int m_nSecondaryTimeLimitSecs;            /**< Used in Round-games only. Round time limit. */
         unsigned int m_nTertiaryTimeLimitSecs;             /**< Used in Round-games only. Round prepare time. */
 
+        bool m_bAllowStrafeMidAir;      /**< Clients need this and the next one for predicting own player movement the same way as server. */
+        bool m_bAllowStrafeMidAirFull;
+
     };  // struct MsgServerInfoFromServer
     static_assert(std::is_trivial_v<MsgServerInfoFromServer>);
     static_assert(std::is_trivially_copyable_v<MsgServerInfoFromServer>);
@@ -270,12 +349,16 @@ namespace proofps_dd
     struct MsgMapChangeFromServer
     {
         static const PRooFPSappMsgId id = PRooFPSappMsgId::MapChangeFromServer;
-        static const uint8_t nMapFilenameMaxLength = 64;
 
         static bool initPkt(
             pge_network::PgePacket& pkt,
-            const std::string& sMapFilename)
+            const StringTable::StringId& nMapFilenameId)
         {
+            if (nMapFilenameId == StringTable::InvalidStringId)
+            {
+                return false;
+            }
+
             // although preparePktMsgAppFill() does runtime check, we should fail already at compile-time if msg is too big!
             static_assert(sizeof(MsgMapChangeFromServer) <= pge_network::MsgApp::nMaxMessageLengthBytes, "msg size");
 
@@ -289,13 +372,13 @@ namespace proofps_dd
                 return false;
             }
 
-            proofps_dd::MsgMapChangeFromServer& msgUserSetup = reinterpret_cast<proofps_dd::MsgMapChangeFromServer&>(*pMsgAppData);
-            strncpy_s(msgUserSetup.m_szMapFilename, sizeof(msgUserSetup.m_szMapFilename), sMapFilename.c_str(), sMapFilename.length());
+            proofps_dd::MsgMapChangeFromServer& msgMapChange = reinterpret_cast<proofps_dd::MsgMapChangeFromServer&>(*pMsgAppData);
+            msgMapChange.m_nMapFilenameId = nMapFilenameId;
 
             return true;
         }
 
-        char m_szMapFilename[nMapFilenameMaxLength];
+        StringTable::StringId m_nMapFilenameId;
     };  // struct MsgMapChangeFromServer
     static_assert(std::is_trivial_v<MsgMapChangeFromServer>);
     static_assert(std::is_trivially_copyable_v<MsgMapChangeFromServer>);
@@ -462,8 +545,13 @@ namespace proofps_dd
             const pge_network::PgeNetworkConnectionHandle& connHandleServerSide,
             bool bCurrentClient,
             const std::string& sIpAddress,
-            const std::string& sMapFilename)
+            const StringTable::StringId& nMapFilenameId)
         {
+            if (nMapFilenameId == StringTable::InvalidStringId)
+            {
+                return false;
+            }
+
             // although preparePktMsgAppFill() does runtime check, we should fail already at compile-time if msg is too big!
             static_assert(sizeof(MsgUserSetupFromServer) <= pge_network::MsgApp::nMaxMessageLengthBytes, "msg size");
 
@@ -480,14 +568,14 @@ namespace proofps_dd
             proofps_dd::MsgUserSetupFromServer& msgUserSetup = reinterpret_cast<proofps_dd::MsgUserSetupFromServer&>(*pMsgAppData);
             msgUserSetup.m_bCurrentClient = bCurrentClient;
             strncpy_s(msgUserSetup.m_szIpAddress, sizeof(msgUserSetup.m_szIpAddress), sIpAddress.c_str(), sIpAddress.length());
-            strncpy_s(msgUserSetup.m_szMapFilename, sizeof(msgUserSetup.m_szMapFilename), sMapFilename.c_str(), sMapFilename.length());
+            msgUserSetup.m_nMapFilenameId = nMapFilenameId;
 
             return true;
         }
 
         bool m_bCurrentClient;
         char m_szIpAddress[pge_network::MsgUserConnectedServerSelf::nIpAddressMaxLength];
-        char m_szMapFilename[MsgMapChangeFromServer::nMapFilenameMaxLength];
+        StringTable::StringId m_nMapFilenameId;
     };  // struct MsgUserSetupFromServer
     static_assert(std::is_trivial_v<MsgUserSetupFromServer>);
     static_assert(std::is_trivially_copyable_v<MsgUserSetupFromServer>);
@@ -578,6 +666,10 @@ namespace proofps_dd
             msgUserCmdMove.m_bJumpAction = bJump;
             msgUserCmdMove.m_fPlayerAngleY = fPlayerAngleY;
             msgUserCmdMove.m_fWpnAngleZ = fWeaponAngleZ;
+            msgUserCmdMove.m_nCmdSeq = 0;
+            msgUserCmdMove.m_nViewServerTick = 0;
+            msgUserCmdMove.m_nClientTimeMillisecs = 0;
+            msgUserCmdMove.m_nEchoServerTimeMillisecs = 0;
 
             return true;
         }
@@ -666,6 +758,35 @@ namespace proofps_dd
             return msgUserCmdMove.m_bShouldSend;
         }
 
+        static void setCmdSeq(
+            pge_network::PgePacket& pkt,
+            std::uint32_t nCmdSeq)
+        {
+            // TODO: later we should offset pMsgApp because other messages might be already inside this pkt!
+            proofps_dd::MsgUserCmdFromClient& msgUserCmdMove = pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgUserCmdFromClient>(pkt);
+            msgUserCmdMove.m_nCmdSeq = nCmdSeq;
+        }
+
+        static void setViewServerTick(
+            pge_network::PgePacket& pkt,
+            std::uint32_t nViewServerTick)
+        {
+            // TODO: later we should offset pMsgApp because other messages might be already inside this pkt!
+            proofps_dd::MsgUserCmdFromClient& msgUserCmdMove = pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgUserCmdFromClient>(pkt);
+            msgUserCmdMove.m_nViewServerTick = nViewServerTick;
+        }
+
+        static void setTimestamps(
+            pge_network::PgePacket& pkt,
+            std::uint32_t nClientTimeMillisecs,
+            std::uint32_t nEchoServerTimeMillisecs)
+        {
+            // TODO: later we should offset pMsgApp because other messages might be already inside this pkt!
+            proofps_dd::MsgUserCmdFromClient& msgUserCmdMove = pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgUserCmdFromClient>(pkt);
+            msgUserCmdMove.m_nClientTimeMillisecs = nClientTimeMillisecs;
+            msgUserCmdMove.m_nEchoServerTimeMillisecs = nEchoServerTimeMillisecs;
+        }
+
         bool m_bShouldSend;
         Strafe m_strafe;                 // continuous op
         bool m_bJumpAction;              // continuous op
@@ -678,13 +799,20 @@ namespace proofps_dd
         TPureFloat m_fPlayerAngleY;
         TPureFloat m_fWpnAngleZ;
         bool m_bToggleUseItem;
+        std::uint32_t m_nCmdSeq;         // client's sequence number of this cmd, acknowledged back in MsgUserUpdateFromServer for client-side prediction
+        std::uint32_t m_nViewServerTick; // server tick the client was rendering remote players at, for server-side lag compensation, 0 if unknown
+        std::uint32_t m_nClientTimeMillisecs;      // client's send time, see ClockSync
+        std::uint32_t m_nEchoServerTimeMillisecs;  // newest received MsgUserUpdateFromServer::m_nServerTimeMillisecs plus the time client held it, for RTT, 0 if unknown
     };  // struct MsgUserCmdFromClient
     static_assert(std::is_trivial_v<MsgUserCmdFromClient>);
     static_assert(std::is_trivially_copyable_v<MsgUserCmdFromClient>);
     static_assert(std::is_standard_layout_v<MsgUserCmdFromClient>);
 
     // server -> self (inject) and clients
-    // sent regularly to all clients
+    // sent regularly to all clients.
+    // This is a state update superseded by the next one, so it is labeled PRooFPSappMsgDelivery::UnreliableSequenced, except the ones with m_bRespawn
+    // set or sent during player bringup: those must be delivered.
+    // Note that PGE currently sends it reliably anyway, see PRooFPSappMsgDelivery.
     struct MsgUserUpdateFromServer
     {
         static const PRooFPSappMsgId id = PRooFPSappMsgId::UserUpdateFromServer;
@@ -700,6 +828,7 @@ namespace proofps_dd
             TPureFloat fWpnAngleZ,
             float fWpnMomentaryAccuracy,
             bool bActuallyRunningOnGround,
+            bool bRunning,
             bool bCrouch,
             float fSomersaultAngle,
             int nArmor,
@@ -711,7 +840,11 @@ namespace proofps_dd
             float fFiringAccuracy,
             unsigned int nShotsFired,
             bool bInvulnerability,
-            float fCurrentInventoryItemPower)
+            float fCurrentInventoryItemPower,
+            std::uint32_t nServerTick = 0 /* 0 means unknown, e.g. during player bringup */,
+            std::uint32_t nLastCmdSeqProcessed = 0,
+            std::uint32_t nPhysicsIterationsSinceLastCmd = 0,
+            std::uint32_t nServerTimeMillisecs = 0)
         {
             // although preparePktMsgAppFill() does runtime check, we should fail already at compile-time if msg is too big!
             static_assert(sizeof(MsgUserUpdateFromServer) <= pge_network::MsgApp::nMaxMessageLengthBytes, "msg size");
@@ -735,6 +868,7 @@ namespace proofps_dd
             msgUserCmdUpdate.m_fWpnAngleZ = fWpnAngleZ;
             msgUserCmdUpdate.m_fWpnMomentaryAccuracy = fWpnMomentaryAccuracy;
             msgUserCmdUpdate.m_bActuallyRunningOnGround = bActuallyRunningOnGround;
+            msgUserCmdUpdate.m_bRunning = bRunning;
             msgUserCmdUpdate.m_bCrouch = bCrouch;
             // currently this is redundant: this is the same angle as fPlayerAngleZ, however in the future they might not be always the same,
             // this is why I'm sending both now: on client-side, client must set player's angle Z to fPlayerAngleZ, and set somersault angle
@@ -750,6 +884,10 @@ namespace proofps_dd
             msgUserCmdUpdate.m_nShotsFired = nShotsFired;
             msgUserCmdUpdate.m_bInvulnerability = bInvulnerability;
             msgUserCmdUpdate.m_fCurrentInventoryItemPower = fCurrentInventoryItemPower;
+            msgUserCmdUpdate.m_nServerTick = nServerTick;
+            msgUserCmdUpdate.m_nLastCmdSeqProcessed = nLastCmdSeqProcessed;
+            msgUserCmdUpdate.m_nPhysicsIterationsSinceLastCmd = nPhysicsIterationsSinceLastCmd;
+            msgUserCmdUpdate.m_nServerTimeMillisecs = nServerTimeMillisecs;
 
             return true;
         }
@@ -762,6 +900,7 @@ namespace proofps_dd
         TPureFloat m_fWpnAngleZ;
         float m_fWpnMomentaryAccuracy;
         bool m_bActuallyRunningOnGround;
+        bool m_bRunning;  // run mode toggled by the player, not necessarily moving; client reconciles its predicted run toggles with this
         bool m_bCrouch;
         float m_fSomersaultAngle;
         int m_nArmor;
@@ -774,6 +913,10 @@ namespace proofps_dd
         unsigned int m_nShotsFired;
         bool m_bInvulnerability;
         float m_fCurrentInventoryItemPower;  // e.g. jetlax. Makes sense to include it here since usually it changes with player's position.
+        std::uint32_t m_nServerTick;  // server tick of this state, clients derive the tick they view other players at from it, 0 if unknown
+        std::uint32_t m_nLastCmdSeqProcessed;            // last MsgUserCmdFromClient::m_nCmdSeq processed by server for this player, 0 if none
+        std::uint32_t m_nPhysicsIterationsSinceLastCmd;  // physics iterations simulated by server since processing m_nLastCmdSeqProcessed
+        std::uint32_t m_nServerTimeMillisecs;            // server's send time, echoed back by client for RTT measurement, 0 if unknown
     };  // struct MsgUserUpdateFromServer
     static_assert(std::is_trivial_v<MsgUserUpdateFromServer>);
     static_assert(std::is_trivially_copyable_v<MsgUserUpdateFromServer>);
@@ -808,7 +951,8 @@ namespace proofps_dd
             const int& nDamageHp,
             const TPureFloat& damageAreaSize,
             const Bullet::DamageAreaEffect& damageAreaEffect,
-            const TPureFloat& damageAreaPulse)
+            const TPureFloat& damageAreaPulse,
+            const bool& bNewborn)
         {
             // although preparePktMsgAppFill() does runtime check, we should fail already at compile-time if msg is too big!
             static_assert(sizeof(MsgBulletUpdateFromServer) <= pge_network::MsgApp::nMaxMessageLengthBytes, "msg size");
@@ -837,6 +981,7 @@ namespace proofps_dd
             msgBulletUpdate.m_eDamageAreaEffect = damageAreaEffect;
             msgBulletUpdate.m_fDamageAreaPulse = damageAreaPulse;
             msgBulletUpdate.m_delete = BulletDelete::No;
+            msgBulletUpdate.m_bNewborn = bNewborn;
 
             return true;
         }
@@ -861,6 +1006,7 @@ namespace proofps_dd
         Bullet::DamageAreaEffect m_eDamageAreaEffect; // v0.3.0: could deduct by WeaponId but might be different under different circumstances so keeping it now ...
         TPureFloat m_fDamageAreaPulse; // v0.3.0: could deduct by WeaponId but might be different under different circumstances so keeping it now ...
         BulletDelete m_delete;
+        bool m_bNewborn;  // false for late creates (bullet was fired earlier, just became relevant for client): no firing sound/effects for these
     };  // struct MsgBulletUpdateFromServer
     static_assert(std::is_trivial_v<MsgBulletUpdateFromServer>);
     static_assert(std::is_trivially_copyable_v<MsgBulletUpdateFromServer>);
@@ -911,12 +1057,11 @@ namespace proofps_dd
     struct MsgWpnUpdateFromServer
     {
         static const PRooFPSappMsgId id = PRooFPSappMsgId::WpnUpdateFromServer;
-        static const uint8_t nWpnNameNameMaxLength = 64;
 
         static bool initPkt(
             pge_network::PgePacket& pkt,
             const pge_network::PgeNetworkConnectionHandle& connHandleServerSide,
-            const std::string& sWpnName /* eMapItemType makes it obsolete */,
+            const StringTable::StringId& nWpnNameId /* eMapItemType makes it obsolete */,
             const MapItemType& eMapItemType,
             bool bAvailable,
             const Weapon::State& state,
@@ -927,6 +1072,11 @@ namespace proofps_dd
             // although preparePktMsgAppFill() does runtime check, we should fail already at compile-time if msg is too big!
             static_assert(sizeof(MsgWpnUpdateFromServer) <= pge_network::MsgApp::nMaxMessageLengthBytes, "msg size");
 
+            if (nWpnNameId == StringTable::InvalidStringId)
+            {
+                return false;
+            }
+
             // TODO: initPkt to be invoked only once by app, in future it might already contain some message we shouldnt zero out!
             pge_network::PgePacket::initPktMsgApp(pkt, connHandleServerSide);
 
@@ -938,7 +1088,7 @@ namespace proofps_dd
             }
 
             proofps_dd::MsgWpnUpdateFromServer& msgWpnUpdate = reinterpret_cast<proofps_dd::MsgWpnUpdateFromServer&>(*pMsgAppData);
-            strncpy_s(msgWpnUpdate.m_szWpnName, nWpnNameNameMaxLength, sWpnName.c_str(), sWpnName.length());
+            msgWpnUpdate.m_nWpnNameId = nWpnNameId;
             msgWpnUpdate.m_eMapItemType = eMapItemType;
             msgWpnUpdate.m_bAvailable = bAvailable;
             msgWpnUpdate.m_state = state;
@@ -956,7 +1106,7 @@ namespace proofps_dd
             return msgWpnUpdate.m_bAvailable;
         }
 
-        char m_szWpnName[nWpnNameNameMaxLength];  /* eMapItemType makes it obsolete */
+        StringTable::StringId m_nWpnNameId;  /* eMapItemType makes it obsolete */
         MapItemType m_eMapItemType; /* probably this should be replaced by WeaponId already! */
         bool m_bAvailable;
         Weapon::State m_state;
@@ -979,12 +1129,17 @@ namespace proofps_dd
         static bool initPkt(
             pge_network::PgePacket& pkt,
             const pge_network::PgeNetworkConnectionHandle& connHandleServerSide,
-            const std::string& sWpnCurrentName,
+            const StringTable::StringId& nWpnCurrentNameId,
             const Weapon::State& state)
         {
             // although preparePktMsgAppFill() does runtime check, we should fail already at compile-time if msg is too big!
             static_assert(sizeof(MsgCurrentWpnUpdateFromServer) <= pge_network::MsgApp::nMaxMessageLengthBytes, "msg size");
 
+            if (nWpnCurrentNameId == StringTable::InvalidStringId)
+            {
+                return false;
+            }
+
             // TODO: initPkt to be invoked only once by app, in future it might already contain some message we shouldnt zero out!
             pge_network::PgePacket::initPktMsgApp(pkt, connHandleServerSide);
 
@@ -996,13 +1151,13 @@ namespace proofps_dd
             }
 
             proofps_dd::MsgCurrentWpnUpdateFromServer& msgWpnUpdate = reinterpret_cast<proofps_dd::MsgCurrentWpnUpdateFromServer&>(*pMsgAppData);
-            strncpy_s(msgWpnUpdate.m_szWpnCurrentName, MsgWpnUpdateFromServer::nWpnNameNameMaxLength, sWpnCurrentName.c_str(), sWpnCurrentName.length());
+            msgWpnUpdate.m_nWpnCurrentNameId = nWpnCurrentNameId;
             msgWpnUpdate.m_state = state;
 
             return true;
         }
 
-        char m_szWpnCurrentName[MsgWpnUpdateFromServer::nWpnNameNameMaxLength];  /* should be replaced by WeaponId already! */
+        StringTable::StringId m_nWpnCurrentNameId;  /* should be replaced by WeaponId already! */
         Weapon::State m_state;
     };  // struct MsgCurrentWpnUpdateFromServer
     static_assert(std::is_trivial_v<MsgCurrentWpnUpdateFromServer>);
@@ -1214,4 +1369,101 @@ namespace proofps_dd
     static_assert(std::is_trivially_copyable_v<MsgUserInGameMenuCmd>);
     static_assert(std::is_standard_layout_v<MsgUserInGameMenuCmd>);
 
+    // server -> clients
+    // An entry of the StringTable, so other messages can refer to the string by its id.
+    // Sent to a connecting client for every existing entry before any other message, and to all clients when server adds a new entry.
+    struct MsgStringTableEntryFromServer
+    {
+        static const PRooFPSappMsgId id = PRooFPSappMsgId::StringTableEntryFromServer;
+
+        static bool initPkt(
+            pge_network::PgePacket& pkt,
+            const StringTable::StringId& nStringId,
+            const std::string& str)
+        {
+            // although preparePktMsgAppFill() does runtime check, we should fail already at compile-time if msg is too big!
+            static_assert(sizeof(MsgStringTableEntryFromServer) <= pge_network::MsgApp::nMaxMessageLengthBytes, "msg size");
+
+            if ((nStringId == StringTable::InvalidStringId) || (str.length() >= StringTable::nStringBufferLength))
+            {
+                return false;
+            }
+
+            // TODO: initPkt to be invoked only once by app, in future it might already contain some message we shouldnt zero out!
+            pge_network::PgePacket::initPktMsgApp(pkt, 0u /*m_connHandleServerSide is ignored in this message*/);
+
+            pge_network::TByte* const pMsgAppData = pge_network::PgePacket::preparePktMsgAppFill(
+                pkt, static_cast<pge_network::MsgApp::TMsgId>(id), sizeof(MsgStringTableEntryFromServer));
+            if (!pMsgAppData)
+            {
+                return false;
+            }
+
+            proofps_dd::MsgStringTableEntryFromServer& msgEntry = reinterpret_cast<proofps_dd::MsgStringTableEntryFromServer&>(*pMsgAppData);
+            msgEntry.m_nStringId = nStringId;
+            strncpy_s(msgEntry.m_szString, sizeof(msgEntry.m_szString), str.c_str(), str.length());
+
+            return true;
+        }
+
+        StringTable::StringId m_nStringId;
+        char m_szString[StringTable::nStringBufferLength];
+    }; // MsgStringTableEntryFromServer
+    static_assert(std::is_trivial_v<MsgStringTableEntryFromServer>);
+    static_assert(std::is_trivially_copyable_v<MsgStringTableEntryFromServer>);
+    static_assert(std::is_standard_layout_v<MsgStringTableEntryFromServer>);
+
+    // server -> client
+    // A chunk of a JoinSnapshot, sent only to a connecting client, see JoinSnapshot for details.
+    struct MsgJoinSnapshotChunkFromServer
+    {
+        static const PRooFPSappMsgId id = PRooFPSappMsgId::JoinSnapshotChunkFromServer;
+
+        /** Whatever is left from the max message length after the other members, rounded down so the struct is not padded beyond the max length. */
+        static constexpr size_t nDataMaxLength =
+            ((pge_network::MsgApp::nMaxMessageLengthBytes - 3 * sizeof(std::uint32_t)) / sizeof(std::uint32_t)) * sizeof(std::uint32_t);
+
+        static bool initPkt(
+            pge_network::PgePacket& pkt,
+            const std::uint32_t& nSnapshotLength,
+            const std::uint32_t& nOffset,
+            const pge_network::TByte* pData,
+            const std::uint32_t& nLength)
+        {
+            // although preparePktMsgAppFill() does runtime check, we should fail already at compile-time if msg is too big!
+            static_assert(sizeof(MsgJoinSnapshotChunkFromServer) <= pge_network::MsgApp::nMaxMessageLengthBytes, "msg size");
+
+            if (!pData || (nLength == 0) || (nLength > nDataMaxLength) || (nOffset + nLength > nSnapshotLength))
+            {
+                return false;
+            }
+
+            // TODO: initPkt to be invoked only once by app, in future it might already contain some message we shouldnt zero out!
+            pge_network::PgePacket::initPktMsgApp(pkt, 0u /*m_connHandleServerSide is ignored in this message*/);
+
+            pge_network::TByte* const pMsgAppData = pge_network::PgePacket::preparePktMsgAppFill(
+                pkt, static_cast<pge_network::MsgApp::TMsgId>(id), sizeof(MsgJoinSnapshotChunkFromServer));
+            if (!pMsgAppData)
+            {
+                return false;
+            }
+
+            proofps_dd::MsgJoinSnapshotChunkFromServer& msgChunk = reinterpret_cast<proofps_dd::MsgJoinSnapshotChunkFromServer&>(*pMsgAppData);
+            msgChunk.m_nSnapshotLength = nSnapshotLength;
+            msgChunk.m_nOffset = nOffset;
+            msgChunk.m_nLength = nLength;
+            std::memcpy(msgChunk.m_data, pData, nLength);
+
+            return true;
+        }
+
+        std::uint32_t m_nSnapshotLength;  /**< Total length of the snapshot in bytes, same in all chunks of the snapshot. */
+        std::uint32_t m_nOffset;          /**< Offset of this chunk in the snapshot, 0 for the first chunk. */
+        std::uint32_t m_nLength;          /**< Number of valid bytes in m_data. */
+        pge_network::TByte m_data[nDataMaxLength];
+    }; // MsgJoinSnapshotChunkFromServer
+    static_assert(std::is_trivial_v<MsgJoinSnapshotChunkFromServer>);
+    static_assert(std::is_trivially_copyable_v<MsgJoinSnapshotChunkFromServer>);
+    static_assert(std::is_standard_layout_v<MsgJoinSnapshotChunkFromServer>);
+
 } // namespace proofps_dd
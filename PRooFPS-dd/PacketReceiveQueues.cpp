@@ -0,0 +1,100 @@
+/*
+    ###################################################################################
+    PacketReceiveQueues.cpp
+    Handoff of received packets to the simulation for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include "PacketReceiveQueues.h"
+#include "PRooFPS-dd-packet.h"
+
+
+// ############################### PUBLIC ################################
+
+
+const char* proofps_dd::PacketReceiveQueues::getLoggerModuleName()
+{
+    return "PacketReceiveQueues";
+}
+
+/**
+* @return False if the packet is not something we could handle, true otherwise.
+*/
+bool proofps_dd::PacketReceiveQueues::isValid(const pge_network::PgePacket& pkt)
+{
+    switch (pge_network::PgePacket::getPacketId(pkt))
+    {
+    case pge_network::MsgUserConnectedServerSelf::id:
+    case pge_network::MsgUserDisconnectedFromServer::id:
+        return true;
+    case pge_network::MsgApp::id:
+        // for now we support only 1 app msg per pkt
+        return (pge_network::PgePacket::getMessageAppCount(pkt) == 1) &&
+            (static_cast<size_t>(pge_network::PgePacket::getMsgAppIdFromPkt(pkt)) < static_cast<size_t>(PRooFPSappMsgId::LastMsgId));
+    default:
+        return false;
+    }
+}
+
+CConsole& proofps_dd::PacketReceiveQueues::getConsole() const
+{
+    return CConsole::getConsoleInstance(getLoggerModuleName());
+}
+
+/**
+* Validates the given packet and puts it to the end of the queue.
+*
+* @return False if the packet is invalid, true otherwise.
+*/
+bool proofps_dd::PacketReceiveQueues::push(const pge_network::PgePacket& pkt)
+{
+    if (!isValid(pkt))
+    {
+        getConsole().EOLn("PacketReceiveQueues::%s(): invalid pkt, pktId: %u!", __func__, pge_network::PgePacket::getPacketId(pkt));
+        return false;
+    }
+
+    m_queue.push_back(pkt);
+    return true;
+}
+
+/**
+* @return False if the queue is empty, in such case pkt is not touched.
+*/
+bool proofps_dd::PacketReceiveQueues::pop(pge_network::PgePacket& pkt)
+{
+    if (m_queue.empty())
+    {
+        return false;
+    }
+
+    pkt = m_queue.front();
+    m_queue.pop_front();
+    return true;
+}
+
+/**
+* @return Number of packets waiting in the queue.
+*/
+size_t proofps_dd::PacketReceiveQueues::size() const
+{
+    return m_queue.size();
+}
+
+/**
+* Drops all queued packets.
+*/
+void proofps_dd::PacketReceiveQueues::clear()
+{
+    m_queue.clear();
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
@@ -0,0 +1,67 @@
+#pragma once
+
+/*
+    ###################################################################################
+    PacketReceiveQueues.h
+    Handoff of received packets to the simulation for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <deque>
+
+#include "CConsole.h"
+
+#include "PGE.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Decouples receiving packets from handling them.
+    *
+    * Every received packet is validated and pushed into the queue, without handling it.
+    * The packets are popped and handled at defined points of the main loop: at the beginning of the frame and at the beginning of
+    * each tick, so their effect is applied at a deterministic moment, not interleaved with other parts of the frame.
+    *
+    * All packets are handled in the order of receiving, regardless of their delivery, since the connection delivers 1 ordered stream and
+    * handlers depend on that order, e.g. a respawn must not be applied after a weapon update received later.
+    *
+    * PGE polls the sockets in its own frame loop on the main thread, so both pushing and popping happen on the main thread, there is
+    * no synchronization. The queue is unbounded so receiving never fails due to lack of space, e.g. during a join burst.
+    */
+    class PacketReceiveQueues
+    {
+    public:
+
+        static const char* getLoggerModuleName();
+
+        static bool isValid(const pge_network::PgePacket& pkt);
+
+        // ---------------------------------------------------------------------------
+
+        CConsole& getConsole() const;
+
+        PacketReceiveQueues() = default;
+
+        PacketReceiveQueues(const PacketReceiveQueues&) = delete;
+        PacketReceiveQueues& operator=(const PacketReceiveQueues&) = delete;
+        PacketReceiveQueues(PacketReceiveQueues&&) = delete;
+        PacketReceiveQueues&& operator=(PacketReceiveQueues&&) = delete;
+
+        bool push(const pge_network::PgePacket& pkt);
+        bool pop(pge_network::PgePacket& pkt);
+
+        size_t size() const;
+        void clear();
+
+    protected:
+
+    private:
+
+        std::deque<pge_network::PgePacket> m_queue;
+
+    }; // class PacketReceiveQueues
+
+} // namespace proofps_dd
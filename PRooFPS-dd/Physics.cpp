@@ -9,6 +9,7 @@
 
 #include "stdafx.h"  // PCH
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 
@@ -17,6 +18,11 @@
 #include "Benchmarks.h"
 
 
+static constexpr float fPlayerAlignCloseToWallExtraPadding = 0.001f;
+static constexpr float fHeightPlayerCanStillStepUpOnto = 0.3f;
+static constexpr float GAME_FALL_GRAVITY_MIN = -15.f;
+
+
 // ############################### PUBLIC ################################
 
 
@@ -124,6 +130,61 @@ bool proofps_dd::Physics::colliding2_NoZ(
         );
 }
 
+/**
+* Swept version of colliding2_NoZ(): object 1 moves along a straight line from its start to its end position, object 2 is static.
+* Unlike testing only the end position, this cannot miss a thin object 2 even if object 1 moves much more than its size.
+* Touching counts as colliding, same as with colliding2_NoZ().
+*
+* @param fHitTime Set to the fraction of the movement in [0, 1] where the objects start colliding, only if they collide.
+*                 It is 0 if they are already colliding at the start position.
+*
+* @return True if the objects collide anywhere along the movement, false otherwise.
+*/
+bool proofps_dd::Physics::colliding2_NoZ_swept(
+    float o1pxStart, float o1pyStart, float o1pxEnd, float o1pyEnd, float o1sx, float o1sy,
+    float o2px, float o2py, float o2sx, float o2sy,
+    float& fHitTime)
+{
+    // moving box vs static box is the same as moving point vs static box enlarged by the moving box (Minkowski sum),
+    // which is then a ray vs AABB test done by clipping the movement with the slabs of both axes.
+    const float o1pStart[2] = { o1pxStart, o1pyStart };
+    const float o1pDelta[2] = { o1pxEnd - o1pxStart, o1pyEnd - o1pyStart };
+    const float fHalfSizeSum[2] = { (o1sx + o2sx) / 2, (o1sy + o2sy) / 2 };
+    const float o2p[2] = { o2px, o2py };
+
+    float fTimeEnter = 0.f;
+    float fTimeExit = 1.f;
+    for (int i = 0; i < 2; i++)
+    {
+        const float fSlabMin = o2p[i] - fHalfSizeSum[i];
+        const float fSlabMax = o2p[i] + fHalfSizeSum[i];
+        if (o1pDelta[i] == 0.f)
+        {
+            if ((o1pStart[i] < fSlabMin) || (o1pStart[i] > fSlabMax))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        float fTimeSlabEnter = (fSlabMin - o1pStart[i]) / o1pDelta[i];
+        float fTimeSlabExit = (fSlabMax - o1pStart[i]) / o1pDelta[i];
+        if (fTimeSlabEnter > fTimeSlabExit)
+        {
+            std::swap(fTimeSlabEnter, fTimeSlabExit);
+        }
+        fTimeEnter = std::max(fTimeEnter, fTimeSlabEnter);
+        fTimeExit = std::min(fTimeExit, fTimeSlabExit);
+        if (fTimeEnter > fTimeExit)
+        {
+            return false;
+        }
+    }
+
+    fHitTime = fTimeEnter;
+    return true;
+}
+
 float proofps_dd::Physics::distance_NoZ(
     float o1px, float o1py,
     float o2px, float o2py)
@@ -235,12 +296,18 @@ bool proofps_dd::Physics::colliding3(
 // ############################## PROTECTED ##############################
 
 
-void proofps_dd::Physics::serverSetAllowStrafeMidAir(bool bAllow)
+/**
+* Server sets this from its config, clients set this from MsgServerInfoFromServer for predicting their own player's movement.
+*/
+void proofps_dd::Physics::setAllowStrafeMidAir(bool bAllow)
 {
     m_bAllowStrafeMidAir = bAllow;
 }
 
-void proofps_dd::Physics::serverSetAllowStrafeMidAirFull(bool bAllow)
+/**
+* Server sets this from its config, clients set this from MsgServerInfoFromServer for predicting their own player's movement.
+*/
+void proofps_dd::Physics::setAllowStrafeMidAirFull(bool bAllow)
 {
     m_bAllowStrafeMidAirFull = bAllow;
 }
@@ -362,8 +429,7 @@ void proofps_dd::Physics::serverGravity(
        Note that originally I wanted to lerp GAME_JUMP_GRAVITY_START as commented at its definition. */
 
     const float GAME_PHYSICS_RATE_LERP_FACTOR = (nPhysicsRate - GAME_TICKRATE_MIN) / static_cast<float>(GAME_TICKRATE_MAX - GAME_TICKRATE_MIN);
-    const float GAME_GRAVITY_CONST = PFL::lerp(80.f /* 20 Hz */, 90.f /* 60 Hz */, GAME_PHYSICS_RATE_LERP_FACTOR);
-    static constexpr float GAME_FALL_GRAVITY_MIN = -15.f;
+    const float GAME_GRAVITY_CONST = getGravityConst(nPhysicsRate);
 
     //const std::chrono::time_point<std::chrono::steady_clock> timeStart = std::chrono::steady_clock::now();
 
@@ -540,14 +606,190 @@ void proofps_dd::Physics::serverPlayerCollisionWithWalls(
     {
         serverPlayerCollisionWithWalls_legacy(nPhysicsRate, xhair, gameMode, vecCamShakeForce);
     }
+
+    // clients need this for reconciling their predicted position, see clientPredictLocalPlayerMovement()
+    for (auto& playerPair : m_mapPlayers)
+    {
+        playerPair.second.incPhysicsIterationsSinceLastCmd();
+    }
 } // serverPlayerCollisionWithWalls()
 
+/**
+* Client-side prediction of our own player's movement, to be invoked by client in every physics iteration.
+* Server player does not need this since its inputs are processed without network delay.
+* 
+* Gravity, jump and strafe are simulated by the same rules as in serverGravity() and serverPlayerCollisionWithWalls_common_strafe(),
+* including the mid-air strafe rules received in MsgServerInfoFromServer, without waiting for the authoritative position from server.
+* Walls are known by client too, so we don't move into them, and we land on top of the object below us.
+* Anything more complex (stepping onto stairs, jumppads, wall jumps, impact forces, antigravity) is left to server: reconciliation in
+* PlayerHandling::handleUserUpdateFromServer() corrects our position when the authoritative position arrives.
+* 
+* @param player              Our own player.
+* @param nLastUserCmdSeqSent Sequence number of the last MsgUserCmdFromClient we have sent.
+* @param nPhysicsRate        The usual physics rate.
+* @param gameMode            The usual GameMode instance.
+*/
+void proofps_dd::Physics::clientPredictLocalPlayerMovement(
+    proofps_dd::Player& player,
+    const std::uint32_t& nLastUserCmdSeqSent,
+    const unsigned int& nPhysicsRate,
+    const proofps_dd::GameMode& gameMode)
+{
+    assert(!m_pge.getNetwork().isServer());
+    assert(nPhysicsRate > 0);
+
+    const auto& playerConst = player;
+    if ((playerConst.getHealth() <= 0) || player.hasAntiGravityActive() || player.isJustCreatedAndExpectingStartPos() ||
+        !gameMode.isPlayerAllowedForGameplay(player))
+    {
+        // steps without movement are also recorded, so step indices are in line with server's physics iterations
+        getClientPrediction().addStep(nLastUserCmdSeqSent, 0.f, 0.f);
+        return;
+    }
+
+    const PureVector vecPosStart = playerConst.getPos().getNew();
+    const PureVector vecPlayerScaledSize = player.getObject3D()->getScaledSizeVec();
+    const bool bWasOnGround = !player.isInAir();
+    const float fOriginalJumpForceX = player.getJumpForce().getX();
+
+    // vertical movement, same as in serverGravity() without the server-driven impact forces
+    player.setGravity(player.getGravity() - getGravityConst(nPhysicsRate) / nPhysicsRate);
+    if (player.isJumping())
+    {
+        if (player.getGravity() < 0.f)
+        {
+            player.setGravity(0.f);
+            player.stopJumping();
+            player.setCanFall(true);
+        }
+    }
+    else
+    {
+        player.setCanFall(true);
+        player.setGravity(std::max(player.getGravity(), GAME_FALL_GRAVITY_MIN));
+    }
+
+    float fNewPosY = vecPosStart.getY() + player.getGravity() / nPhysicsRate;
+    const PureObject3D* const pObjVertical = m_maps.getBVH().findOneColliderObject_startFromFirstNode(
+        PureAxisAlignedBoundingBox(PureVector(vecPosStart.getX(), fNewPosY, vecPosStart.getZ()), vecPlayerScaledSize),
+        nullptr);
+    if (pObjVertical)
+    {
+        // same alignment as in serverPlayerCollisionWithWalls_common_LoopKernelVertical_actualCollHandler()
+        const int nAlignUnderOrAboveWall = pObjVertical->getPosVec().getY() < vecPosStart.getY() ? 1 : -1;
+        fNewPosY = pObjVertical->getPosVec().getY() +
+            nAlignUnderOrAboveWall * (pObjVertical->getSizeVec().getY() / 2.f + vecPlayerScaledSize.getY() / 2.f + fPlayerAlignCloseToWallExtraPadding);
+        if (nAlignUnderOrAboveWall == 1)
+        {
+            // landed
+            player.setCanFall(false);
+            player.getJumpForce().Set(0.f, 0.f, 0.f);
+        }
+        else
+        {
+            // hit ceiling with our head during jumping
+            player.setCanFall(true);
+            player.stopJumping();
+        }
+        player.setGravity(0.f);
+    }
+    // simplified form of the condition in serverPlayerCollisionWithWalls_common_verticalCollisionAlreadyHandled(), our jump input
+    // is turned into jump in the next iteration only if this allows, see InputHandling::clientUpdatePlayerAsPerInputAndSendUserCmdMoveToServer()
+    player.setJumpAllowed(!player.isJumping() && !player.canFall());
+
+    // horizontal movement, same rules as in serverPlayerCollisionWithWalls_common_strafe()
+    float fDeltaX = 0.f;
+    float fJumpForceX = fOriginalJumpForceX;
+    if (gameMode.isPlayerMovementAllowed() && (player.getStrafe() != proofps_dd::Strafe::NONE))
+    {
+        player.getStrafeSpeed() = Player::getNextStrafeSpeed(player.getStrafeSpeed(), player.getTargetStrafeSpeed(nPhysicsRate), nPhysicsRate);
+
+        if (bWasOnGround && !pObjVertical && !player.isJumping())
+        {
+            // just started falling naturally e.g. strafed off the edge of a box, so we carry on the strafe speed
+            player.getJumpForce().SetX(player.getStrafeSpeed());
+            fJumpForceX = player.getJumpForce().getX();
+        }
+
+        if (!player.isInAir() ||
+            (m_bAllowStrafeMidAir &&
+                (
+                    (fJumpForceX == 0.f) ||
+                    ((fJumpForceX > 0.f) && (player.getStrafeSpeed() < 0.f)) ||
+                    ((fJumpForceX < 0.f) && (player.getStrafeSpeed() > 0.f))
+                    ))
+            )
+        {
+            if (m_bAllowStrafeMidAirFull)
+            {
+                player.getJumpForce().SetX(0.f);
+                fJumpForceX = 0.f;
+            }
+            fDeltaX = player.getStrafeSpeed();
+        }
+    }
+
+    if (player.getWillJumpYInNextTick() > 0.f)
+    {
+        const bool bWasJumping = player.isJumping();
+        player.jump(Player::fBaseSpeedRun / nPhysicsRate); // resets setWillJumpInNextTick()
+        if (!bWasJumping && player.isJumping())
+        {
+            // jump() takes horizontal jump force from the difference of old and new positions, but client commits positions only
+            // when receiving the authoritative position, so we take it from this step instead
+            player.getJumpForce().SetX(fDeltaX);
+        }
+    }
+
+    // server also adds the horizontal jump force from before the vertical collision, see serverPlayerCollisionWithWalls_common_strafe()
+    fDeltaX += fJumpForceX;
+    if ((fDeltaX != 0.f) &&
+        m_maps.getBVH().findOneColliderObject_startFromFirstNode(
+            PureAxisAlignedBoundingBox(PureVector(vecPosStart.getX() + fDeltaX, fNewPosY, vecPosStart.getZ()), vecPlayerScaledSize),
+            nullptr))
+    {
+        fDeltaX = 0.f;
+        if (m_bAllowStrafeMidAir || player.canFall())
+        {
+            // horizontal collision stops horizontal jump-induced force, same as in server's horizontal collision handling
+            player.getJumpForce().SetX(0.f);
+        }
+    }
+
+    const float fDeltaY = fNewPosY - vecPosStart.getY();
+    // steps without movement are also recorded, so step indices are in line with server's physics iterations
+    getClientPrediction().addStep(nLastUserCmdSeqSent, fDeltaX, fDeltaY);
+    if ((fDeltaX == 0.f) && (fDeltaY == 0.f))
+    {
+        return;
+    }
+
+    // PPPKKKGGGGGG
+    player.getPos().set(
+        PureVector(
+            vecPosStart.getX() + fDeltaX,
+            fNewPosY,
+            vecPosStart.getZ()
+        ));
+    player.getObject3D()->getPosVec() = player.getPos().getNew();
+    if (player.getWeaponManager().getCurrentWeapon())
+    {
+        player.getWeaponManager().getCurrentWeapon()->UpdatePosition(player.getObject3D()->getPosVec(), player.isSomersaulting());
+    }
+} // clientPredictLocalPlayerMovement()
+
 
 // ############################### PRIVATE ###############################
 
 
-static constexpr float fPlayerAlignCloseToWallExtraPadding = 0.001f;
-static constexpr float fHeightPlayerCanStillStepUpOnto = 0.3f;
+/**
+* Gravity constant depending on physics rate, see serverGravity() for details.
+*/
+float proofps_dd::Physics::getGravityConst(const unsigned int& nPhysicsRate)
+{
+    const float GAME_PHYSICS_RATE_LERP_FACTOR = (nPhysicsRate - GAME_TICKRATE_MIN) / static_cast<float>(GAME_TICKRATE_MAX - GAME_TICKRATE_MIN);
+    return PFL::lerp(80.f /* 20 Hz */, 90.f /* 60 Hz */, GAME_PHYSICS_RATE_LERP_FACTOR);
+}
 
 
 /**
@@ -967,9 +1209,7 @@ void proofps_dd::Physics::serverPlayerCollisionWithWalls_common_strafe(
     ScopeBenchmarker<std::chrono::microseconds> bm(__func__);
     assert(nPhysicsRate > 0);
 
-    const float GAME_PLAYER_SPEED_WALK = Player::fBaseSpeedWalk / nPhysicsRate;
     const float GAME_PLAYER_SPEED_RUN = Player::fBaseSpeedRun / nPhysicsRate;
-    const float GAME_PLAYER_SPEED_CROUCH = Player::fBaseSpeedCrouch / nPhysicsRate;
     const float GAME_PHYSICS_RATE_LERP_FACTOR = (nPhysicsRate - GAME_TICKRATE_MIN) / static_cast<float>(GAME_TICKRATE_MAX - GAME_TICKRATE_MIN);
 
     static unsigned int nContinuousStrafeCountForDebugServerPlayerMovement = 0;
@@ -981,40 +1221,8 @@ void proofps_dd::Physics::serverPlayerCollisionWithWalls_common_strafe(
     if ((playerConst.getHealth() > 0) && (player.getStrafe() != proofps_dd::Strafe::NONE) && !player.hasAntiGravityActive())
     {
         bStrafeMayHappen1 = true;
-        float fTargetStrafeSpeed =
-            player.getCrouchStateCurrent() ?
-            (player.isSomersaulting() ? GAME_PLAYER_SPEED_RUN : GAME_PLAYER_SPEED_CROUCH) :
-            (player.isRunning() ? GAME_PLAYER_SPEED_RUN : GAME_PLAYER_SPEED_WALK);
-        if (player.getStrafe() == proofps_dd::Strafe::LEFT)
-        {
-            fTargetStrafeSpeed = -fTargetStrafeSpeed;
-        }
-
-        // in case of strafe input direction change, always start changing strafe speed from 0, otherwise it will feel like
-        // we have thruster that we need to work against :D (jetpack-like)
-        if (((fTargetStrafeSpeed > 0.f) && (player.getStrafeSpeed() < 0.f))
-            ||
-            ((fTargetStrafeSpeed < 0.f) && (player.getStrafeSpeed() > 0.f)))
-        {
-            player.getStrafeSpeed() = 0.f;
-        }
-
-        // using same way of calculation here as in serverGravity()
-        const float GAME_STRAFE_PHYSICS_RATE_DIVIDER = PFL::lerp(5.f /* 20 Hz */, 10.f /* 60 Hz */, GAME_PHYSICS_RATE_LERP_FACTOR);
-        // unlike as in serverGravity() here I divide by the lerped value instead of multiply, I dont know why I multiply in serverGravity() anyway, but
-        // obviously I need to divide here as lower physics rate results in higher strafe speeds, need to have the per-tick change higher also!
-        const float fPlayerStrafeChangePerTick =
-            fTargetStrafeSpeed / GAME_STRAFE_PHYSICS_RATE_DIVIDER
-            /* no need to divide by nPhysicsRate as those const values assigned to fTargetStrafeSpeed are already divided by it */;
-        player.getStrafeSpeed() += fPlayerStrafeChangePerTick;
-
-        // always limit strafe speed to target strafe speed
-        if (((fTargetStrafeSpeed > 0.f) && (player.getStrafeSpeed() > fTargetStrafeSpeed))
-            ||
-            ((fTargetStrafeSpeed < 0.f) && (player.getStrafeSpeed() < fTargetStrafeSpeed)))
-        {
-            player.getStrafeSpeed() = fTargetStrafeSpeed;
-        }
+        // client-side prediction uses the same functions, see clientPredictLocalPlayerMovement()
+        player.getStrafeSpeed() = Player::getNextStrafeSpeed(player.getStrafeSpeed(), player.getTargetStrafeSpeed(nPhysicsRate), nPhysicsRate);
 
         if (player.getHasJustStartedFallingNaturallyInThisTick())
         {
@@ -60,6 +60,10 @@ namespace proofps_dd
         static bool colliding2_NoZ(
             float o1px, float o1py, float o1sx, float o1sy,
             float o2px, float o2py, float o2sx, float o2sy);
+        static bool colliding2_NoZ_swept(
+            float o1pxStart, float o1pyStart, float o1pxEnd, float o1pyEnd, float o1sx, float o1sy,
+            float o2px, float o2py, float o2sx, float o2sy,
+            float& fHitTime);
         static bool colliding3(
             const PureVector& vecPosMin, const PureVector& vecPosMax,
             const PureVector& vecObjPos, const PureVector& vecObjSize);
@@ -80,8 +84,8 @@ namespace proofps_dd
 
     protected:
         
-        void serverSetAllowStrafeMidAir(bool bAllow);
-        void serverSetAllowStrafeMidAirFull(bool bAllow);
+        void setAllowStrafeMidAir(bool bAllow);
+        void setAllowStrafeMidAirFull(bool bAllow);
         void serverSetFallDamageMultiplier(int n);
         void serverSetCollisionModeBvh(bool state);
         void serverGravity(
@@ -93,6 +97,11 @@ namespace proofps_dd
             XHair& xhair,
             proofps_dd::GameMode& gameMode /* TODO: get rid of GameMode, Physics should not have it */,
             PureVector& vecCamShakeForce);
+        void clientPredictLocalPlayerMovement(
+            proofps_dd::Player& player,
+            const std::uint32_t& nLastUserCmdSeqSent,
+            const unsigned int& nPhysicsRate,
+            const proofps_dd::GameMode& gameMode);
 
     private:
 
@@ -108,6 +117,8 @@ namespace proofps_dd
         int m_nFallDamageMultiplier;
         bool m_bCollisionModeBvh;
 
+        static float getGravityConst(const unsigned int& nPhysicsRate);
+
         void serverPlayerCollisionWithWalls_common_LoopKernelVertical_actualCollHandler(
             Player& player,
             const PureObject3D* obj,
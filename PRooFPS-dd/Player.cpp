@@ -12,6 +12,8 @@
 #include "Player.h"
 #include "Config.h"
 #include "Consts.h"
+#include "MsgTrafficStats.h"
+#include "StringTable.h"
 
 
 static constexpr float SndPlayerLandedDistMin = 6.f;
@@ -236,7 +238,6 @@ proofps_dd::Player::Player(const proofps_dd::Player& other) :
     m_connHandleServerSide(other.m_connHandleServerSide),
     m_sIpAddress(other.m_sIpAddress),
     m_sName(other.m_sName),
-    m_bExpectingAfterBootUpDelayedUpdate(other.m_bExpectingAfterBootUpDelayedUpdate),
     m_vecOldNewValues(other.m_vecOldNewValues),
     m_bNetDirty(other.m_bNetDirty),
     m_timeDied(other.m_timeDied),
@@ -281,6 +282,11 @@ proofps_dd::Player::Player(const proofps_dd::Player& other) :
     m_fSomersaultAngleZ(other.m_fSomersaultAngleZ),
     m_bRunning(other.m_bRunning),
     m_bJustCreatedAndExpectingStartPos(other.m_bJustCreatedAndExpectingStartPos),
+    m_nLastCmdSeqProcessed(other.m_nLastCmdSeqProcessed),
+    m_nPhysicsIterationsSinceLastCmd(other.m_nPhysicsIterationsSinceLastCmd),
+    m_nLagCompensationTicks(other.m_nLagCompensationTicks),
+    m_clockSync(other.m_clockSync),
+    m_lastRateLimitedCmdTimes(other.m_lastRateLimitedCmdTimes),
     m_strafe(other.m_strafe),
     m_prevActualStrafe(other.m_prevActualStrafe),
     m_bAttack(other.m_bAttack),
@@ -339,16 +345,6 @@ bool proofps_dd::Player::hasBootedUp() const
     return m_timeBootedUp.time_since_epoch().count() != 0;
 }
 
-bool proofps_dd::Player::isExpectingAfterBootUpDelayedUpdate() const
-{
-    return m_bExpectingAfterBootUpDelayedUpdate;
-}
-
-void proofps_dd::Player::setExpectingAfterBootUpDelayedUpdate(bool b)
-{
-    m_bExpectingAfterBootUpDelayedUpdate = b;
-}
-
 const pge_network::PgeNetworkConnectionHandle& proofps_dd::Player::getServerSideConnectionHandle() const
 {
     return m_connHandleServerSide;
@@ -430,7 +426,7 @@ const std::chrono::time_point<std::chrono::steady_clock>& proofps_dd::Player::ge
 * 
 * @param bAllowedForGameplay Shall come from GameMode::isPlayerAllowedForGameplay().
 */
-void proofps_dd::Player::updateAudioVisuals(const proofps_dd::Config& config, bool bServer, bool bAllowedForGameplay)
+void proofps_dd::Player::updateAudioVisuals(bool bAllowedForGameplay)
 {
     if (!bAllowedForGameplay || isForcedSpectating())
     {
@@ -443,14 +439,9 @@ void proofps_dd::Player::updateAudioVisuals(const proofps_dd::Config& config, bo
     {
         constexpr auto nBlinkPeriodMillisecs = 100;
         const auto nInvulTimeElapsedMillisecs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_timeStartedInvulnerability).count();
-        // only server instance is allowed to decide about ENDING invulnerability, client will be notified over network msg
-        const bool bEndInvul = bServer && (nInvulTimeElapsedMillisecs >= static_cast<long long>(config.getPlayerRespawnInvulnerabilityDelaySeconds()) * 1000);
-        const bool bShowPlayer = (getHealth() > 0) && (bEndInvul || ((nInvulTimeElapsedMillisecs / nBlinkPeriodMillisecs) % 2) == 0);
+        // invulnerability is ended by server's timer in PlayerHandling, client will be notified over network msg
+        const bool bShowPlayer = (getHealth() > 0) && (((nInvulTimeElapsedMillisecs / nBlinkPeriodMillisecs) % 2) == 0);
         setVisibilityState(bShowPlayer);
-        if (bEndInvul)
-        {
-            setInvulnerability(false);
-        }
     }
     else
     {
@@ -815,7 +806,7 @@ void proofps_dd::Player::resettleAndRespawnShared()
     // only put here stuff that both server and client can understand, or only server uses but replicated by server automatically
     // in case only server invokes this for player resettle!
 
-    // these are used by server to calculate physics, client just doesn't care
+    // these are used by server to calculate physics, and by client to predict its own player's movement
     getImpactForce().SetZero();
     getAntiGravityForce().SetZero();
     getJumpForce().SetZero();
@@ -856,6 +847,73 @@ void proofps_dd::Player::setJustCreatedAndExpectingStartPos(bool b)
     m_bJustCreatedAndExpectingStartPos = b;
 }
 
+const std::uint32_t& proofps_dd::Player::getLastCmdSeqProcessed() const
+{
+    return m_nLastCmdSeqProcessed;
+}
+
+/**
+* Server-only.
+* Also resets the physics iteration counter, since the client needs to know how many iterations were simulated after this cmd.
+*/
+void proofps_dd::Player::setLastCmdSeqProcessed(const std::uint32_t& nCmdSeq)
+{
+    m_nLastCmdSeqProcessed = nCmdSeq;
+    m_nPhysicsIterationsSinceLastCmd = 0;
+}
+
+const std::uint32_t& proofps_dd::Player::getPhysicsIterationsSinceLastCmd() const
+{
+    return m_nPhysicsIterationsSinceLastCmd;
+}
+
+void proofps_dd::Player::incPhysicsIterationsSinceLastCmd()
+{
+    ++m_nPhysicsIterationsSinceLastCmd;
+}
+
+const std::uint32_t& proofps_dd::Player::getLagCompensationTicks() const
+{
+    return m_nLagCompensationTicks;
+}
+
+/**
+* Server-only.
+* Hit tests of bullets newly fired by this player are done against player hitboxes rewound by this many ticks.
+*/
+void proofps_dd::Player::setLagCompensationTicks(const std::uint32_t& nTicks)
+{
+    m_nLagCompensationTicks = nTicks;
+}
+
+/**
+* Server-only.
+* Updated by every MsgUserCmdFromClient received from this player.
+*/
+proofps_dd::ClockSync& proofps_dd::Player::getClockSync()
+{
+    return m_clockSync;
+}
+
+const proofps_dd::ClockSync& proofps_dd::Player::getClockSync() const
+{
+    return m_clockSync;
+}
+
+/**
+* Server-only.
+* Times of the last user cmd in which the given action was accepted, so server can rate limit it by client time.
+*/
+proofps_dd::ClockSync::MsgTime& proofps_dd::Player::getLastRateLimitedCmdTime(const RateLimitedCmd& cmd)
+{
+    return m_lastRateLimitedCmdTimes[static_cast<size_t>(cmd)];
+}
+
+const proofps_dd::ClockSync::MsgTime& proofps_dd::Player::getLastRateLimitedCmdTime(const RateLimitedCmd& cmd) const
+{
+    return m_lastRateLimitedCmdTimes[static_cast<size_t>(cmd)];
+}
+
 PgeOldNewValue<TPureFloat>& proofps_dd::Player::getAngleY()
 {
     // m_vecOldNewValues.at() should not throw due to how m_vecOldNewValues is initialized in class
@@ -1852,6 +1910,63 @@ float& proofps_dd::Player::getStrafeSpeed()
     return m_strafeSpeed;
 }
 
+/**
+* Strafe speed the player is accelerating towards, as per current strafe direction, crouching, somersaulting and running states.
+* Negative for Strafe::LEFT, 0 for Strafe::NONE.
+* Used by both server physics and client-side prediction so they are calculating the same way.
+*/
+float proofps_dd::Player::getTargetStrafeSpeed(const unsigned int& nPhysicsRate) const
+{
+    assert(nPhysicsRate > 0);
+    if (getStrafe() == proofps_dd::Strafe::NONE)
+    {
+        return 0.f;
+    }
+
+    const float fTargetStrafeSpeed =
+        (getCrouchStateCurrent() ?
+            (isSomersaulting() ? fBaseSpeedRun : fBaseSpeedCrouch) :
+            (isRunning() ? fBaseSpeedRun : fBaseSpeedWalk)) / nPhysicsRate;
+    return (getStrafe() == proofps_dd::Strafe::LEFT) ? -fTargetStrafeSpeed : fTargetStrafeSpeed;
+}
+
+/**
+* One physics iteration of strafe speed change towards the given target strafe speed.
+* In case of strafe direction change, always starts changing strafe speed from 0, otherwise it would feel like
+* we have thruster that we need to work against (jetpack-like).
+* 
+* @return The new strafe speed, never exceeding the target strafe speed.
+*/
+float proofps_dd::Player::getNextStrafeSpeed(
+    const float& fStrafeSpeed,
+    const float& fTargetStrafeSpeed,
+    const unsigned int& nPhysicsRate)
+{
+    assert(nPhysicsRate > 0);
+    float fNewStrafeSpeed = fStrafeSpeed;
+    if (((fTargetStrafeSpeed > 0.f) && (fNewStrafeSpeed < 0.f))
+        ||
+        ((fTargetStrafeSpeed < 0.f) && (fNewStrafeSpeed > 0.f)))
+    {
+        fNewStrafeSpeed = 0.f;
+    }
+
+    // using same way of calculation here as in Physics::serverGravity(), but here we divide by the lerped value instead of multiply,
+    // as lower physics rate results in higher strafe speeds, need to have the per-tick change higher also!
+    const float GAME_PHYSICS_RATE_LERP_FACTOR = (nPhysicsRate - GAME_TICKRATE_MIN) / static_cast<float>(GAME_TICKRATE_MAX - GAME_TICKRATE_MIN);
+    const float GAME_STRAFE_PHYSICS_RATE_DIVIDER = PFL::lerp(5.f /* 20 Hz */, 10.f /* 60 Hz */, GAME_PHYSICS_RATE_LERP_FACTOR);
+    fNewStrafeSpeed += fTargetStrafeSpeed / GAME_STRAFE_PHYSICS_RATE_DIVIDER;
+
+    // always limit strafe speed to target strafe speed
+    if (((fTargetStrafeSpeed > 0.f) && (fNewStrafeSpeed > fTargetStrafeSpeed))
+        ||
+        ((fTargetStrafeSpeed < 0.f) && (fNewStrafeSpeed < fTargetStrafeSpeed)))
+    {
+        fNewStrafeSpeed = fTargetStrafeSpeed;
+    }
+    return fNewStrafeSpeed;
+}
+
 const PgeOldNewValue<bool>& proofps_dd::Player::getActuallyRunningOnGround() const
 {
     // m_vecOldNewValues.at() should not throw due to how m_vecOldNewValues is initialized in class
@@ -2082,7 +2197,7 @@ void proofps_dd::Player::takeItem(MapItem& item, pge_network::PgePacket& pktWpnU
         proofps_dd::MsgWpnUpdateFromServer::initPkt(
             pktWpnUpdate,
             0 /* ignored by client anyway */,
-            pWpnBecomingAvailable->getFilename() /* TODO: hopefully soon we can get rid of this member from the msg, since item.getType() should be enough!!! */,
+            StringTable::serverIntern(m_network, pWpnBecomingAvailable->getFilename()) /* TODO: hopefully soon we can get rid of this member from the msg, since item.getType() should be enough!!! */,
             item.getType(),
             pWpnBecomingAvailable->isAvailable(),
             pWpnBecomingAvailable->getState().getNew(),
@@ -2264,7 +2379,7 @@ void proofps_dd::Player::handleFallingFromHigh(int iServerScream /* valid only i
         getServerSideConnectionHandle(),
         PlayerEventId::FallingFromHigh,
         iServerScream);
-    m_network.getServer().sendToAllClientsExcept(pktPlayerEvent);
+    MsgTrafficStats::serverSendToAllClientsExcept(m_network, pktPlayerEvent);
 }
 
 void proofps_dd::Player::handleLanded(
@@ -2339,7 +2454,7 @@ void proofps_dd::Player::handleLanded(
         fFallHeight,
         bDamageTaken,
         bDied);
-    m_network.getServer().sendToAllClientsExcept(pktPlayerEvent);
+    MsgTrafficStats::serverSendToAllClientsExcept(m_network, pktPlayerEvent);
 }
 
 void proofps_dd::Player::handleActuallyRunningOnGround()
@@ -2448,7 +2563,7 @@ void proofps_dd::Player::handleTakeNonWeaponItem(
             getServerSideConnectionHandle(),
             PlayerEventId::ItemTake,
             static_cast<int>(eMapItemType));
-        m_network.getServer().sendToAllClientsExcept(pktPlayerEvent);
+        MsgTrafficStats::serverSendToAllClientsExcept(m_network, pktPlayerEvent);
     }
     else if (!bMe /* no need to inform them about server player took non-inventory item */)
     {
@@ -2458,7 +2573,7 @@ void proofps_dd::Player::handleTakeNonWeaponItem(
             getServerSideConnectionHandle(),
             PlayerEventId::ItemTake,
             static_cast<int>(eMapItemType));
-        m_network.getServer().send(pktPlayerEvent, getServerSideConnectionHandle());
+        MsgTrafficStats::serverSend(m_network, pktPlayerEvent, getServerSideConnectionHandle());
     }
     
 } // handleTakeNonWeaponItem()
@@ -2582,7 +2697,7 @@ void proofps_dd::Player::handleToggleInventoryItem(
         PlayerEventId::InventoryItemToggle,
         static_cast<int>(eMapItemType),
         false /* bSyncHistory */);
-    m_network.getServer().sendToAllClientsExcept(pktPlayerEvent);
+    MsgTrafficStats::serverSendToAllClientsExcept(m_network, pktPlayerEvent);
 } // handleToggleInventoryItem()
 
 void proofps_dd::Player::handleUntakeInventoryItem(
@@ -2617,7 +2732,7 @@ void proofps_dd::Player::handleUntakeInventoryItem(
         getServerSideConnectionHandle(),
         PlayerEventId::ItemUntake,
         static_cast<int>(eMapItemType));
-    m_network.getServer().sendToAllClientsExcept(pktPlayerEvent);
+    MsgTrafficStats::serverSendToAllClientsExcept(m_network, pktPlayerEvent);
 } // handleUntakeInventoryItem()
 
 void proofps_dd::Player::handleTakeWeaponItem(
@@ -2674,7 +2789,7 @@ void proofps_dd::Player::handleJumppadActivated()
             pktPlayerEvent,
             getServerSideConnectionHandle(),
             PlayerEventId::JumppadActivated);
-        m_network.getServer().send(pktPlayerEvent, getServerSideConnectionHandle());
+        MsgTrafficStats::serverSend(m_network, pktPlayerEvent, getServerSideConnectionHandle());
     }
 }
 
@@ -2710,7 +2825,7 @@ void proofps_dd::Player::handleTeamIdChanged(const unsigned int& iTeamId)
         getServerSideConnectionHandle(),
         PlayerEventId::TeamIdChanged,
         static_cast<int>(iTeamId));
-    m_network.getServer().sendToAllClientsExcept(pktPlayerEvent);
+    MsgTrafficStats::serverSendToAllClientsExcept(m_network, pktPlayerEvent);
 }
 
 void proofps_dd::Player::handleToggleSpectatorMode()
@@ -2746,7 +2861,7 @@ void proofps_dd::Player::handleToggleSpectatorMode()
         pktPlayerEvent,
         getServerSideConnectionHandle(),
         PlayerEventId::ToggledSpectatorMode);
-    m_network.getServer().sendToAllClientsExcept(pktPlayerEvent);
+    MsgTrafficStats::serverSendToAllClientsExcept(m_network, pktPlayerEvent);
 }
 
 
@@ -9,6 +9,7 @@
     ###################################################################################
 */
 
+#include <array>
 #include <chrono>      // requires cpp11
 #include <list>
 #include <map>
@@ -20,6 +21,7 @@
 #include "PGE.h" // we use audio also from here so it is easier to just include everything
 #include "Config/PgeOldNewValue.h"
 
+#include "ClockSync.h"
 #include "Durations.h"
 #include "EventLister.h"
 #include "PRooFPS-dd-packet.h"
@@ -48,6 +50,17 @@ namespace proofps_dd
     {
     public:
 
+        /** User cmd actions rate limited by server, see getLastRateLimitedCmdTime(). */
+        enum class RateLimitedCmd
+        {
+            ToggleRun = 0,
+            ToggleUseItem,
+            Jump,
+            WpnReload,
+            WpnSwitch,
+            Count
+        };
+
         /**
         * See explanation of this at Smoke::smokeEmitOperValues.
         */
@@ -185,9 +198,6 @@ namespace proofps_dd
         void setTimeBootedUp();
         bool hasBootedUp() const;
 
-        bool isExpectingAfterBootUpDelayedUpdate() const;
-        void setExpectingAfterBootUpDelayedUpdate(bool b);
-
         const pge_network::PgeNetworkConnectionHandle& getServerSideConnectionHandle() const;
         const std::string& getIpAddress() const;
         const std::string& getName() const;
@@ -198,8 +208,7 @@ namespace proofps_dd
         const bool& isForcedSpectating() const;
         void setForcedSpectating(bool value);
 
-        void updateAudioVisuals(
-            const proofps_dd::Config& config, bool bServer, bool bAllowedForGameplay);
+        void updateAudioVisuals(bool bAllowedForGameplay);
 
         void show();
         void hide();
@@ -256,6 +265,17 @@ namespace proofps_dd
         bool isJustCreatedAndExpectingStartPos() const;
         void setJustCreatedAndExpectingStartPos(bool b);
 
+        const std::uint32_t& getLastCmdSeqProcessed() const;
+        void setLastCmdSeqProcessed(const std::uint32_t& nCmdSeq);
+        const std::uint32_t& getPhysicsIterationsSinceLastCmd() const;
+        void incPhysicsIterationsSinceLastCmd();
+        const std::uint32_t& getLagCompensationTicks() const;
+        void setLagCompensationTicks(const std::uint32_t& nTicks);
+        ClockSync& getClockSync();
+        const ClockSync& getClockSync() const;
+        ClockSync::MsgTime& getLastRateLimitedCmdTime(const RateLimitedCmd& cmd);
+        const ClockSync::MsgTime& getLastRateLimitedCmdTime(const RateLimitedCmd& cmd) const;
+
         PgeOldNewValue<TPureFloat>& getAngleY();
         const PgeOldNewValue<TPureFloat>& getAngleY() const;
         PgeOldNewValue<TPureFloat>& getAngleZ();
@@ -347,6 +367,11 @@ namespace proofps_dd
         const std::chrono::time_point<std::chrono::steady_clock>& getTimeLastActualStrafe() const;
 
         float& getStrafeSpeed();
+        float getTargetStrafeSpeed(const unsigned int& nPhysicsRate) const;
+        static float getNextStrafeSpeed(
+            const float& fStrafeSpeed,
+            const float& fTargetStrafeSpeed,
+            const unsigned int& nPhysicsRate);
 
         const PgeOldNewValue<bool>& getActuallyRunningOnGround() const;
         PgeOldNewValue<bool>& getActuallyRunningOnGround();
@@ -462,8 +487,6 @@ namespace proofps_dd
         /** Timestamp of server-side processing of UserNameChangeAndBootupDone (after MsgUserConnectedServerSelf and MsgUserSetupFromServer is already processed */
         std::chrono::time_point<std::chrono::steady_clock> m_timeBootedUp;
 
-        bool m_bExpectingAfterBootUpDelayedUpdate = true;
-
         bool m_bSpectatorMode = true;
         bool m_bForcedSpectating = false;
 
@@ -621,6 +644,11 @@ namespace proofps_dd
         std::chrono::time_point<std::chrono::steady_clock> m_timeLastToggleUseItem;
 
         bool m_bJustCreatedAndExpectingStartPos = true;
+        std::uint32_t m_nLastCmdSeqProcessed = 0;            /**< Server-only: last MsgUserCmdFromClient::m_nCmdSeq processed, 0 if none yet. */
+        std::uint32_t m_nPhysicsIterationsSinceLastCmd = 0;  /**< Server-only: physics iterations since m_nLastCmdSeqProcessed. */
+        std::uint32_t m_nLagCompensationTicks = 0;           /**< Server-only: how many ticks behind the server this player sees other players. */
+        proofps_dd::ClockSync m_clockSync;                   /**< Server-only: client clock and connection timing estimated from received user cmds. */
+        std::array<ClockSync::MsgTime, static_cast<size_t>(RateLimitedCmd::Count)> m_lastRateLimitedCmdTimes{};  /**< Server-only: see getLastRateLimitedCmdTime(). */
 
         proofps_dd::Strafe m_strafe = Strafe::NONE;  // continuous op
         proofps_dd::Strafe m_prevActualStrafe = Strafe::NONE;
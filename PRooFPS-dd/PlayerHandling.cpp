@@ -9,7 +9,11 @@
 
 #include "stdafx.h"  // PCH
 
+#include <cmath>
+
 #include "PlayerHandling.h"
+#include "MsgTrafficStats.h"
+#include "StringTable.h"
 #include "Physics.h"
 #include "PRooFPS-dd-packet.h"
 
@@ -138,13 +142,24 @@ void proofps_dd::PlayerHandling::handlePlayerDied(
             pktDeathNotificationFromServer,
             player.getServerSideConnectionHandle(),
             nKillerConnHandleServerSide);
-        m_pge.getNetwork().getServer().sendToAllClientsExcept(pktDeathNotificationFromServer);
+        MsgTrafficStats::serverSendToAllClientsExcept(m_pge.getNetwork(), pktDeathNotificationFromServer);
 
         // from v0.2.5, server shows countdown here for themselves, client shows upon receiving MsgDeathNotificationFromServer
         if (isMyConnection(player.getServerSideConnectionHandle()))
         {
             m_gui.showCountdownTimerForRespawnOrForcedSpectating(pPlayerKiller);
         }
+
+        if (gameMode->isRespawnAllowedAfterDie())
+        {
+            // respawned by serverRespawnPlayerByTimer()
+            const proofps_dd::Config& config = proofps_dd::Config::getConfigInstance(m_pge, m_maps);
+            serverSchedulePlayerTimer(
+                m_mapPlayerRespawnTimers,
+                ServerTimerKind::PlayerRespawn,
+                player.getServerSideConnectionHandle(),
+                config.getPlayerRespawnDelaySeconds() * config.getTickRate());
+        }
     }
 }
 
@@ -205,7 +220,9 @@ void proofps_dd::PlayerHandling::serverRespawnPlayer(
     player.setHealth(100);
     player.setArmor(0);
     player.getRespawnFlag() = true;
-    player.setInvulnerability(true, config.getPlayerRespawnInvulnerabilityDelaySeconds());
+    // respawn might happen earlier than the respawn timer expires, e.g. game restart or new round
+    serverCancelPlayerTimer(m_mapPlayerRespawnTimers, player.getServerSideConnectionHandle());
+    serverSetPlayerInvulnerability(player, config);
     // dead player needs to exit forced-spectating mode
     player.setForcedSpectating(false);  // clients will set this once they receive MsgUserUpdateFromServer with respawn flag set
 
@@ -265,46 +282,66 @@ void proofps_dd::PlayerHandling::serverResettlePlayer(
     // to resettle, we just need to set these values, because SendUserUpdates() will automatically send out changes to everyone
     player.getPos() = m_maps.getRandomSpawnpoint(GameMode::getGameMode()->isTeamBasedGame(), player.getTeamId());
     player.setHealth(100);
-    player.setInvulnerability(true, config.getPlayerRespawnInvulnerabilityDelaySeconds());
+    serverSetPlayerInvulnerability(player, config);
     serverUpdatePlayerOldValues(player, config, smokes);
     player.resettleAndRespawnShared();
     // alive player is not in forced-spectating mode, no need to set it to false
 }
 
-void proofps_dd::PlayerHandling::serverUpdateRespawnTimers(
+/**
+* Invoked when the respawn timer of the given dead player expires, scheduled by handlePlayerDied().
+*/
+void proofps_dd::PlayerHandling::serverRespawnPlayerByTimer(
+    const pge_network::PgeNetworkConnectionHandle& connHandleServerSide,
     const proofps_dd::Config& config,
     PGEcfgProfiles& cfgProfiles,
     proofps_dd::GameMode& gameMode,
-    proofps_dd::Durations& durations,
     PgeObjectPool<proofps_dd::Smoke>& smokes)
 {
+    m_mapPlayerRespawnTimers.erase(connHandleServerSide);
+
     if (gameMode.isGameWon() || !gameMode.isRespawnAllowedAfterDie())
     {
+        // all players are respawned anyway by the restart after winning or by the next round
         return;
     }
 
-    const std::chrono::time_point<std::chrono::steady_clock> timeStart = std::chrono::steady_clock::now();
-
-    for (auto& playerPair : m_mapPlayers)
+    const auto playerIt = m_mapPlayers.find(connHandleServerSide);
+    if ((playerIt == m_mapPlayers.end()) || (std::as_const(playerIt->second).getHealth() > 0))
     {
-        auto& player = playerPair.second;
-        const auto& playerConst = player;
+        return;
+    }
 
-        if (playerConst.getHealth() > 0)
-        {
-            continue;
-        }
+    serverRespawnPlayer(playerIt->second, proofps_dd::GameRestartType_KeepPlayers::None, config, cfgProfiles, smokes);
+}
 
-        const auto timeDiffSeconds = std::chrono::duration_cast<std::chrono::seconds>(
-            std::chrono::steady_clock::now() - playerConst.getTimeDied()).count();
-        if (timeDiffSeconds >= static_cast<std::chrono::seconds::rep>(config.getPlayerRespawnDelaySeconds()))
-        {
-            serverRespawnPlayer(player, proofps_dd::GameRestartType_KeepPlayers::None, config, cfgProfiles, smokes);
-        }
+/**
+* Invoked when the invulnerability timer of the given player expires, scheduled by serverSetPlayerInvulnerability().
+* Clients are notified by the regular user updates.
+*/
+void proofps_dd::PlayerHandling::serverEndPlayerInvulnerabilityByTimer(
+    const pge_network::PgeNetworkConnectionHandle& connHandleServerSide)
+{
+    m_mapPlayerInvulnerabilityTimers.erase(connHandleServerSide);
+
+    const auto playerIt = m_mapPlayers.find(connHandleServerSide);
+    if (playerIt == m_mapPlayers.end())
+    {
+        return;
     }
 
-    durations.m_nUpdateRespawnTimersDurationUSecs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - timeStart).count();
-} // serverUpdateRespawnTimers()
+    playerIt->second.setInvulnerability(false);
+}
+
+/**
+* Forgets all server timers, e.g. when the game session is left, since they refer to entities of the game session.
+*/
+void proofps_dd::PlayerHandling::serverClearTimers()
+{
+    m_serverTimers.clear();
+    m_mapPlayerRespawnTimers.clear();
+    m_mapPlayerInvulnerabilityTimers.clear();
+}
 
 void proofps_dd::PlayerHandling::handlePlayerTeamIdChangedOrToggledSpectatorMode(
     Player& player,
@@ -588,7 +625,8 @@ bool proofps_dd::PlayerHandling::handleUserConnected(
                 __func__, connHandleServerSide);
 
             pge_network::PgePacket newPktSetup;
-            if (proofps_dd::MsgUserSetupFromServer::initPkt(newPktSetup, connHandleServerSide, true, msg.m_szIpAddress, m_maps.getNextMapToBeLoaded().c_str()))
+            if (proofps_dd::MsgUserSetupFromServer::initPkt(
+                newPktSetup, connHandleServerSide, true, msg.m_szIpAddress, StringTable::serverIntern(m_pge.getNetwork(), m_maps.getNextMapToBeLoaded())))
             {
                 const PureVector& vecStartPos = cfgProfiles.getVars()["testing"].getAsBool() ?
                     m_maps.getLeftMostSpawnpoint() :
@@ -601,7 +639,7 @@ bool proofps_dd::PlayerHandling::handleUserConnected(
                     0.f /* player angle Y */, 0.f /* player angle Z */,
                     0.f /* weapon angle Z */,
                     0.f /* weapon momentary accuracy */,
-                    false /* bActuallyRunningOnGround*/, false /* bCrouch */, 0.f /* fSomersaultAngle */,
+                    false /* bActuallyRunningOnGround*/, true /* bRunning, as Player default */, false /* bCrouch */, 0.f /* fSomersaultAngle */,
                     0 /* AP */, 0 /* HP */,
                     false /* bRespawn */,
                     0 /* nFrags */, 0 /* nDeaths */,
@@ -612,8 +650,8 @@ bool proofps_dd::PlayerHandling::handleUserConnected(
                     0.f /* fCurrentInventoryItemPower */))
                 {
                     // server injects this msg to self so resources for player will be allocated upon processing these
-                    m_pge.getNetwork().getServer().send(newPktSetup);
-                    m_pge.getNetwork().getServer().send(newPktUserUpdate);
+                    MsgTrafficStats::serverSend(m_pge.getNetwork(), newPktSetup);
+                    MsgTrafficStats::serverSend(m_pge.getNetwork(), newPktUserUpdate);
                 }
                 else
                 {
@@ -660,11 +698,19 @@ bool proofps_dd::PlayerHandling::handleUserConnected(
             return false;
         }
 
+        // Strings are referred to by ids in many messages, so client must receive all strings before anything else.
+        if (!StringTable::serverSendAllEntries(m_pge.getNetwork(), connHandleServerSide))
+        {
+            getConsole().EOLn("PlayerHandling::%s(): serverSendAllEntries() FAILED at line %d!", __func__, __LINE__);
+            assert(false);
+            return false;
+        }
+
         // Send server config now, for example remaining game time on client side will start from server's remaining time
         // upon receiving this message, and also it is crucial that BEFORE client receives any player info, it recreates GameMode instance if needed, so
         // that any player info can be added to the proper GameMode instance at client-side.
-        // This message will be received by client late enough to make the timeRemainingSecs annoying delayed, so we send updated message a bit later
-        // as well in serverSendUserUpdates().
+        // Client will spend some time with loading the map after receiving this, so the remaining game time in this message will be outdated by then,
+        // that is why we send this message again when client has booted up, in handleUserNameChange().
         if (!config.serverSendServerInfo(connHandleServerSide))
         {
             getConsole().EOLn("PlayerHandling::%s(): serverSendServerInfo() FAILED at line %d!", __func__, __LINE__);
@@ -675,7 +721,8 @@ bool proofps_dd::PlayerHandling::handleUserConnected(
         // MsgGameRoundStateFromServer will be sent out later by GameMode::addPlayer(), when player is detected as booted up in handleUserNameChange()
 
         pge_network::PgePacket newPktSetup;
-        if (!proofps_dd::MsgUserSetupFromServer::initPkt(newPktSetup, connHandleServerSide, false, msg.m_szIpAddress, m_maps.getFilename()))
+        if (!proofps_dd::MsgUserSetupFromServer::initPkt(
+            newPktSetup, connHandleServerSide, false, msg.m_szIpAddress, StringTable::serverIntern(m_pge.getNetwork(), m_maps.getFilename())))
         {
             getConsole().EOLn("PlayerHandling::%s(): initPkt() FAILED at line %d!", __func__, __LINE__);
             assert(false);
@@ -693,7 +740,7 @@ bool proofps_dd::PlayerHandling::handleUserConnected(
             0.f /* player angle Y */, 0.f /* player angle Z */,
             0.f /* weapon angle Z */,
             0.f /* weapon momentary accuracy */,
-            false /* bActuallyRunningOnGround*/, false /* bCrouch */, 0.f /* fSomersaultAngle*/,
+            false /* bActuallyRunningOnGround*/, true /* bRunning, as Player default */, false /* bCrouch */, 0.f /* fSomersaultAngle*/,
             0 /* AP */, 0 /* HP */,
             false /* bRespawn */,
             0 /* nFrags */, 0 /* nDeaths */,
@@ -709,18 +756,18 @@ bool proofps_dd::PlayerHandling::handleUserConnected(
         }
 
         // server injects this msg to self so resources for player will be allocated upon processing these
-        m_pge.getNetwork().getServer().send(newPktSetup);
-        m_pge.getNetwork().getServer().send(newPktUserUpdate);
+        MsgTrafficStats::serverSend(m_pge.getNetwork(), newPktSetup);
+        MsgTrafficStats::serverSend(m_pge.getNetwork(), newPktUserUpdate);
 
         // inform all other clients about this new user
-        m_pge.getNetwork().getServer().sendToAllClientsExcept(newPktSetup, connHandleServerSide);
-        m_pge.getNetwork().getServer().sendToAllClientsExcept(newPktUserUpdate, connHandleServerSide);
+        MsgTrafficStats::serverSendToAllClientsExcept(m_pge.getNetwork(), newPktSetup, connHandleServerSide);
+        MsgTrafficStats::serverSendToAllClientsExcept(m_pge.getNetwork(), newPktUserUpdate, connHandleServerSide);
 
         // now we send this msg to the client with this bool flag set so client will know it is their connect
         proofps_dd::MsgUserSetupFromServer& msgUserSetup = pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgUserSetupFromServer>(newPktSetup);
         msgUserSetup.m_bCurrentClient = true;
-        m_pge.getNetwork().getServer().send(newPktSetup, connHandleServerSide);
-        m_pge.getNetwork().getServer().send(newPktUserUpdate, connHandleServerSide);
+        MsgTrafficStats::serverSend(m_pge.getNetwork(), newPktSetup, connHandleServerSide);
+        MsgTrafficStats::serverSend(m_pge.getNetwork(), newPktUserUpdate, connHandleServerSide);
     }
 
     return true;
@@ -779,6 +826,11 @@ bool proofps_dd::PlayerHandling::handleUserDisconnected(
 
     gameMode.removePlayer(playerIt->second, m_pge.getNetwork());
     m_mapPlayers.erase(playerIt);
+    serverCancelPlayerTimer(m_mapPlayerRespawnTimers, connHandleServerSide);
+    serverCancelPlayerTimer(m_mapPlayerInvulnerabilityTimers, connHandleServerSide);
+    m_sendScheduler.removeClient(connHandleServerSide);
+    m_sendScheduler.removeEntity(connHandleServerSide);
+    m_mapRemotePlayerSnapshots.erase(connHandleServerSide);
 
     if (bClientShouldRemoveAllPlayers)
     {
@@ -799,6 +851,11 @@ bool proofps_dd::PlayerHandling::handleUserDisconnected(
         m_gui.getPlayerAmmoChangeEvents()->clear();
         gameMode.restart(m_pge.getNetwork());
         m_mapPlayers.clear();
+        m_sendScheduler.clear();
+        m_mapRemotePlayerSnapshots.clear();
+        m_playerHitboxHistory.clear();
+        m_nClientNewestServerTick = 0;
+        m_nClientNewestServerTimeMillisecs = 0;
     }
 
     m_pge.getNetwork().WriteList();
@@ -877,7 +934,7 @@ bool proofps_dd::PlayerHandling::handleUserNameChange(
             assert(false);
             return false;
         }
-        m_pge.getNetwork().getServer().sendToAllClientsExcept(newPktUserNameChange, connHandleServerSide);
+        MsgTrafficStats::serverSendToAllClientsExcept(m_pge.getNetwork(), newPktUserNameChange, connHandleServerSide);
 
         if (connHandleServerSide != pge_network::ServerConnHandle)
         {
@@ -885,7 +942,16 @@ bool proofps_dd::PlayerHandling::handleUserNameChange(
             // we also let this one know its own name change (only if this is not server)
             proofps_dd::MsgUserNameChangeAndBootupDone& msgUserNameChange = pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgUserNameChangeAndBootupDone>(newPktUserNameChange);
             msgUserNameChange.m_bCurrentClient = true;
-            m_pge.getNetwork().getServer().send(newPktUserNameChange, connHandleServerSide);
+            MsgTrafficStats::serverSend(m_pge.getNetwork(), newPktUserNameChange, connHandleServerSide);
+
+            // Client has loaded the map by now, so we refresh the server info sent in handleUserConnected(), so the remaining game time on
+            // client side will not be late by the map loading time.
+            if (!config.serverSendServerInfo(connHandleServerSide))
+            {
+                getConsole().EOLn("PlayerHandling::%s(): serverSendServerInfo() FAILED at line %d!", __func__, __LINE__);
+                assert(false);
+                return false;
+            }
         }
 
         // In the future we need something better than GameMode not having some funcs like getFragLimit()
@@ -936,7 +1002,9 @@ bool proofps_dd::PlayerHandling::handleUserNameChange(
                 config.getPlayerRespawnInvulnerabilityDelaySeconds(),
                 config.getFriendlyFire(),
                 nRoundTimeLimitSecs,
-                nRoundPrepareTimeSecs);
+                nRoundPrepareTimeSecs,
+                cfgProfiles.getVars()[CVAR_SV_ALLOW_STRAFE_MID_AIR].getAsBool(),
+                cfgProfiles.getVars()[CVAR_SV_ALLOW_STRAFE_MID_AIR_FULL].getAsBool());
             
             m_pge.getAudio().stopSoundInstance(m_sounds.m_sndMenuMusicHandle);
 
@@ -953,7 +1021,7 @@ bool proofps_dd::PlayerHandling::handleUserNameChange(
 
         // from our point of view, player has now fully booted up so NOW we are arming the respawn invulnerability
         getConsole().OLn("PlayerHandling::%s(): Player BOOTED UP, arming 1st-spawn invulnerability for connHandleServerSide: %u!", __func__, connHandleServerSide);
-        playerIt->second.setInvulnerability(true, config.getPlayerRespawnInvulnerabilityDelaySeconds());
+        serverSetPlayerInvulnerability(playerIt->second, config);
     }
     else
     {
@@ -1077,7 +1145,7 @@ void proofps_dd::PlayerHandling::serverSendUserUpdates(
     PGEcfgProfiles& /*cfgProfiles*/,
     proofps_dd::Config& config,
     proofps_dd::Durations& durations,
-    proofps_dd::GameMode& gameMode)
+    proofps_dd::GameMode& /*gameMode*/)
 {
     if (!m_pge.getNetwork().isServer())
     {
@@ -1089,110 +1157,79 @@ void proofps_dd::PlayerHandling::serverSendUserUpdates(
 
     const std::chrono::time_point<std::chrono::steady_clock> timeStart = std::chrono::steady_clock::now();
     const bool bSendUserUpdates = (m_nSendClientUpdatesCntr == m_nSendClientUpdatesInEveryNthTick);
+    ++m_nServerTick;
+    if (m_nServerTick == 0)
+    {
+        // 0 is reserved for not sequenced updates
+        ++m_nServerTick;
+    }
+
+    // this is invoked at the end of the tick so positions are final for this tick, same as what we send to clients below
+    m_playerHitboxHistory.beginTick(m_nServerTick);
 
     for (auto& playerPair : m_mapPlayers)
     {
         auto& player = playerPair.second;
         const auto& playerConst = player;
 
-        static constexpr std::chrono::seconds::rep nAfterBootUpDelayedUpdateSeconds = 3;
-        if (playerConst.isExpectingAfterBootUpDelayedUpdate() &&
-            (playerConst.getTimeBootedUp().time_since_epoch().count() != 0) &&
-            ((std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - playerConst.getTimeBootedUp()).count()) >= nAfterBootUpDelayedUpdateSeconds))
+        if (player.getRespawnFlag() || player.getResettlingFlag())
         {
-            player.setExpectingAfterBootUpDelayedUpdate(false);
-
-            bool bSendAfterBootupDelayedUpdatesSuccessful = true;
-            if (!config.serverSendServerInfo(playerPair.first))
-            {
-                getConsole().EOLn("PlayerHandling::%s(): serverSendServerInfo() FAILED at line %d!", __func__, __LINE__);
-                bSendAfterBootupDelayedUpdatesSuccessful = false;
-                assert(false);
-                return;
-            }
-
-            if (gameMode.isRoundBased())
-            {
-                // TODO: instead of casting, and checking for game mode type, just send it out always. So code will be more general.
-                TeamRoundGameMode* const pTRGmode = dynamic_cast<proofps_dd::TeamRoundGameMode*>(&gameMode);
-                if (pTRGmode)
-                {
-                    pTRGmode->serverSendRoundStateToClient(m_pge.getNetwork(), playerPair.first);
-                }
-                else
-                {
-                    bSendAfterBootupDelayedUpdatesSuccessful = false;
-                    getConsole().EOLn("PlayerHandling::%s(): ERROR: pTRGmode null at line %d!", __func__, __LINE__);
-                }
-            }
-
-            if (bSendAfterBootupDelayedUpdatesSuccessful)
-            {
-                getConsole().OLn("PlayerHandling::%s(): WA: sent out after-bootup delayed updates to: %u", __func__, playerPair.first);
-            }
-            else
-            {
-                getConsole().EOLn("PlayerHandling::%s(): WA: ERROR: could NOT send out all after-bootup delayed updates to: %u", __func__, playerPair.first);
-            }
-        } // isExpectingAfterBootUpDelayedUpdate()
+            // player is at a new place now, bullets fired by others a moment ago shall not hit them at the previous place
+            m_playerHitboxHistory.invalidatePlayer(playerPair.first);
+        }
+        const auto playerScaledSizeVec = player.getObject3D()->getScaledSizeVec();
+        m_playerHitboxHistory.addHitbox(
+            playerPair.first,
+            playerConst.getPos().getNew().getX(),
+            playerConst.getPos().getNew().getY(),
+            playerScaledSizeVec.getX(),
+            playerScaledSizeVec.getY());
 
         if (bSendUserUpdates && player.isNetDirty())
         {
-            pge_network::PgePacket newPktUserUpdate;
-            //getConsole().EOLn("PlayerHandling::%s(): send 1!", __func__);
-            if (proofps_dd::MsgUserUpdateFromServer::initPkt(
-                newPktUserUpdate,
-                playerPair.second.getServerSideConnectionHandle(),
-                playerConst.getPos().getNew().getX(),
-                playerConst.getPos().getNew().getY(),
-                playerConst.getPos().getNew().getZ(),
-                playerConst.getAngleY(),
-                playerConst.getAngleZ(),
-                player.getWeaponAngle().getNew().getZ(),
-                playerConst.getWeaponMomentaryAccuracy(),
-                player.getActuallyRunningOnGround(),
-                player.getCrouchStateCurrent(),
-                player.getSomersaultAngle(),
-                playerConst.getArmor().getNew(),
-                playerConst.getHealth().getNew(),
-                player.getRespawnFlag(),
-                playerConst.getFrags(),
-                playerConst.getDeaths(),
-                playerConst.getSuicides(),
-                playerConst.getFiringAccuracy(),
-                playerConst.getShotsFiredCount(),
-                playerConst.getInvulnerability(),
-                playerConst.getCurrentInventoryItemPower()))
+            if (player.getRespawnFlag() || player.getResettlingFlag())
             {
-                player.clearNetDirty();
-
-                //if (playerPair.second.getRespawnFlag())
-                //{
-                //    getConsole().EOLn(
-                //        "%s(): player XY: %f, %f",
-                //        __func__,
-                //        player.getPos().getNew().getX(), player.getPos().getNew().getY());
-                //}
-
-                // we always reset respawn flag here
-                playerPair.second.getRespawnFlag() = false;
-                playerPair.second.getResettlingFlag() = false;
-
-                // Note that health is not needed by server since it already has the updated health, but for convenience
-                // we put that into MsgUserUpdateFromServer and send anyway like all the other stuff.
-                m_pge.getNetwork().getServer().sendToAll(newPktUserUpdate);
-                //getConsole().EOLn("PlayerHandling::%s(): send 2, invul: %b!", __func__, playerConst.getInvulnerability());
+                // Respawn and resettling flags are transient, they are reset right after sending, so these updates cannot be deferred by
+                // the scheduler, everyone must receive them right now.
+                pge_network::PgePacket newPktUserUpdate;
+                if (serverInitUserUpdatePkt(player, newPktUserUpdate, m_nServerTick))
+                {
+                    // Note that health is not needed by server since it already has the updated health, but for convenience
+                    // we put that into MsgUserUpdateFromServer and send anyway like all the other stuff.
+                    MsgTrafficStats::serverSendToAll(m_pge.getNetwork(), newPktUserUpdate);
+                    for (const auto& clientPair : m_mapPlayers)
+                    {
+                        m_sendScheduler.clearPending(clientPair.first, playerPair.first);
+                    }
+                }
             }
             else
             {
-                getConsole().EOLn("PlayerHandling::%s(): initPkt() FAILED at line %d!", __func__, __LINE__);
-                assert(false);
+                // server needs its own update immediately, only the clients' updates are scheduled
+                pge_network::PgePacket newPktUserUpdate;
+                if (serverInitUserUpdatePkt(player, newPktUserUpdate, m_nServerTick))
+                {
+                    MsgTrafficStats::serverSend(m_pge.getNetwork(), newPktUserUpdate);
+                    for (const auto& clientPair : m_mapPlayers)
+                    {
+                        if (clientPair.first != pge_network::ServerConnHandle)
+                        {
+                            m_sendScheduler.markPending(clientPair.first, playerPair.first);
+                        }
+                    }
+                }
             }
+            player.clearNetDirty();
+            // we always reset respawn flag here
+            player.getRespawnFlag() = false;
+            player.getResettlingFlag() = false;
         } // bSendUserUpdates
     }  // for playerPair
 
     if (bSendUserUpdates)
     {
+        serverSendScheduledUserUpdatesToClients(config);
+
         m_nSendClientUpdatesCntr = 0;
         // measure duration only if we really sent the user updates to clients
         durations.m_nSendUserUpdatesDurationUSecs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - timeStart).count();
@@ -1201,6 +1238,104 @@ void proofps_dd::PlayerHandling::serverSendUserUpdates(
     ++m_nSendClientUpdatesCntr;
 } // serverSendUserUpdates()
 
+bool proofps_dd::PlayerHandling::serverInitUserUpdatePkt(
+    proofps_dd::Player& player,
+    pge_network::PgePacket& pkt,
+    const std::uint32_t& nServerTick)
+{
+    const auto& playerConst = player;
+    if (!proofps_dd::MsgUserUpdateFromServer::initPkt(
+        pkt,
+        playerConst.getServerSideConnectionHandle(),
+        playerConst.getPos().getNew().getX(),
+        playerConst.getPos().getNew().getY(),
+        playerConst.getPos().getNew().getZ(),
+        playerConst.getAngleY(),
+        playerConst.getAngleZ(),
+        player.getWeaponAngle().getNew().getZ(),
+        playerConst.getWeaponMomentaryAccuracy(),
+        player.getActuallyRunningOnGround(),
+        playerConst.isRunning(),
+        player.getCrouchStateCurrent(),
+        player.getSomersaultAngle(),
+        playerConst.getArmor().getNew(),
+        playerConst.getHealth().getNew(),
+        player.getRespawnFlag(),
+        playerConst.getFrags(),
+        playerConst.getDeaths(),
+        playerConst.getSuicides(),
+        playerConst.getFiringAccuracy(),
+        playerConst.getShotsFiredCount(),
+        playerConst.getInvulnerability(),
+        playerConst.getCurrentInventoryItemPower(),
+        nServerTick,
+        playerConst.getLastCmdSeqProcessed(),
+        playerConst.getPhysicsIterationsSinceLastCmd(),
+        ClockSync::toMillisecs32(std::chrono::steady_clock::now())))
+    {
+        getConsole().EOLn("PlayerHandling::%s(): initPkt() FAILED at line %d!", __func__, __LINE__);
+        assert(false);
+        return false;
+    }
+    return true;
+}
+
+/**
+* Sends the scheduled user updates to each client, within the configured per-client byte budget.
+* If a client's link is already saturated, i.e. it has more reliable bytes pending than the budget, we halve its budget for this tick,
+* so the scheduler sends only the most important updates and the others keep accumulating priority until the link recovers.
+*/
+void proofps_dd::PlayerHandling::serverSendScheduledUserUpdatesToClients(const proofps_dd::Config& config)
+{
+    const size_t nBudgetBytesCfg = static_cast<size_t>(config.getClientBudgetBytesPerTick());
+
+    for (const auto& clientPair : m_mapPlayers)
+    {
+        const pge_network::PgeNetworkConnectionHandle& connHandleClient = clientPair.first;
+        if (connHandleClient == pge_network::ServerConnHandle)
+        {
+            continue;
+        }
+
+        const Player& playerClient = clientPair.second;
+        for (const auto& entityPair : m_mapPlayers)
+        {
+            const Player& playerEntity = entityPair.second;
+            const float fDx = playerEntity.getPos().getNew().getX() - playerClient.getPos().getNew().getX();
+            const float fDy = playerEntity.getPos().getNew().getY() - playerClient.getPos().getNew().getY();
+            m_sendScheduler.accumulate(
+                connHandleClient,
+                entityPair.first,
+                SendScheduler::calculatePriorityIncrement(connHandleClient == entityPair.first, std::sqrt(fDx * fDx + fDy * fDy)));
+        }
+
+        size_t nBudgetBytes = nBudgetBytesCfg;
+        if ((nBudgetBytes > 0) &&
+            (static_cast<size_t>(m_pge.getNetwork().getServer().getPendingReliableBytes(connHandleClient, false)) > nBudgetBytes))
+        {
+            nBudgetBytes /= 2;
+        }
+
+        m_sendScheduler.selectWithinBudget(connHandleClient, nBudgetBytes, sizeof(proofps_dd::MsgUserUpdateFromServer), m_vecScheduledEntities);
+        for (const auto& connHandleEntity : m_vecScheduledEntities)
+        {
+            auto itEntity = m_mapPlayers.find(connHandleEntity);
+            if (itEntity == m_mapPlayers.end())
+            {
+                // should not happen since disconnected players are removed from the scheduler
+                assert(false);
+                continue;
+            }
+
+            pge_network::PgePacket newPktUserUpdate;
+            if (serverInitUserUpdatePkt(itEntity->second, newPktUserUpdate, m_nServerTick))
+            {
+                MsgTrafficStats::serverSend(m_pge.getNetwork(), newPktUserUpdate, connHandleClient);
+            }
+        }
+    }
+}
+
 bool proofps_dd::PlayerHandling::handleUserUpdateFromServer(
     pge_network::PgeNetworkConnectionHandle connHandleServerSide,
     const proofps_dd::MsgUserUpdateFromServer& msg,
@@ -1224,6 +1359,18 @@ bool proofps_dd::PlayerHandling::handleUserUpdateFromServer(
     const auto& playerConst = player;
     //getConsole().OLn("PlayerHandling::%s(): user %s received MsgUserUpdateFromServer: %f", __func__, player.getName().c_str(), msg.m_pos.x);
 
+    // updates are delivered in order, so a known server tick is always the newest one
+    if (msg.m_nServerTick != 0)
+    {
+        m_nClientNewestServerTick = msg.m_nServerTick;
+        m_timeClientNewestServerTickReceived = std::chrono::steady_clock::now();
+        if (msg.m_nServerTimeMillisecs != 0)
+        {
+            m_nClientNewestServerTimeMillisecs = msg.m_nServerTimeMillisecs;
+            m_timeClientNewestServerTimeReceived = std::chrono::steady_clock::now();
+        }
+    }
+
     const bool bOriginalExpectingStartPos = player.isJustCreatedAndExpectingStartPos();
     if (player.isJustCreatedAndExpectingStartPos())
     {
@@ -1241,6 +1388,8 @@ bool proofps_dd::PlayerHandling::handleUserUpdateFromServer(
             // this player has not yet fully booted up but gets visible to other players so we keep protected from other players.
             // I could not find a better place for this (MsgUserConnected, MsgUserSetupFromServer, etc.), so here we are forcing it.
             //getConsole().EOLn("PlayerHandling::%s(): 1st spawn: forced invulnerability for connHandleServerSide: %u!", __func__, connHandleServerSide);
+            // No timer, invulnerability is rearmed with a timer when the player has booted up, in handleUserNameChange().
+            serverCancelPlayerTimer(m_mapPlayerInvulnerabilityTimers, connHandleServerSide);
             player.setInvulnerability(true, 999);
         }
         else
@@ -1281,11 +1430,57 @@ bool proofps_dd::PlayerHandling::handleUserUpdateFromServer(
         // changing position here on server-side could lead to applying stale position in case of
         // a resettling player, therefore we accept this for clients only.
         player.getPos().set(PureVector(msg.m_pos.x, msg.m_pos.y, msg.m_pos.z));
+
+        if (bCurrentClient)
+        {
+            if (bOriginalExpectingStartPos || msg.m_bRespawn)
+            {
+                // previous predictions are not relevant at the new spawn position
+                m_clientPrediction.reset();
+                player.stopJumping();
+            }
+            else
+            {
+                // Server reconciliation: the authoritative position contains the effect of our cmds up to the acknowledged one,
+                // replay our predicted steps not yet processed by server on top of it, see Physics::clientPredictLocalPlayerMovement().
+                m_clientPrediction.reconcile(msg.m_nLastCmdSeqProcessed, msg.m_nPhysicsIterationsSinceLastCmd);
+                // PPPKKKGGGGGG
+                player.getPos().set(
+                    PureVector(
+                        msg.m_pos.x + m_clientPrediction.getUnackedDeltaX(),
+                        msg.m_pos.y + m_clientPrediction.getUnackedDeltaY(),
+                        msg.m_pos.z
+                    ));
+            }
+        }
+
+        // Our own run toggles are predicted by InputHandling but server might have rejected some, so we take the authoritative
+        // running state and apply our toggles not yet processed by server on top of it, same way as with position above.
+        const bool bRunning = bCurrentClient ? m_clientPrediction.getPredictedRunning(msg.m_bRunning) : msg.m_bRunning;
+        if (bRunning != playerConst.isRunning())
+        {
+            player.setRun(bRunning);
+        }
     }
 
-    player.getObject3D()->getPosVec() = player.getPos().getNew();
-    player.getWeaponManager().getCurrentWeapon()->UpdatePosition(
-        player.getObject3D()->getPosVec(), player.isSomersaulting());
+    if (!m_pge.getNetwork().isServer() && !bCurrentClient && (config.getClientInterpDelayMillisecs() > 0))
+    {
+        // Remote players are rendered at a delay, interpolated between received positions, see updatePlayersVisuals().
+        // Receive time is used as snapshot time since server updates are not timestamped.
+        SnapshotInterpolation& snapshots = m_mapRemotePlayerSnapshots[connHandleServerSide];
+        if (bOriginalExpectingStartPos || msg.m_bRespawn)
+        {
+            // dont interpolate from the previous position to the spawn position
+            snapshots.clear();
+        }
+        snapshots.addSnapshot(std::chrono::steady_clock::now(), player.getPos().getNew());
+    }
+    else
+    {
+        player.getObject3D()->getPosVec() = player.getPos().getNew();
+        player.getWeaponManager().getCurrentWeapon()->UpdatePosition(
+            player.getObject3D()->getPosVec(), player.isSomersaulting());
+    }
 
     if (msg.m_fPlayerAngleY != -1.f)
     {
@@ -1647,6 +1842,10 @@ void proofps_dd::PlayerHandling::updatePlayersVisuals(
 
     const bool bXHairIdentifiesPlayers = m_pge.getConfigProfiles().getVars()[XHair::szCvarGuiXHairIdentifiesPlayers].getAsBool();
     m_gui.getXHair()->hideIdText();
+
+    // remote players are rendered this much behind the newest received snapshot, see handleUserUpdateFromServer()
+    const unsigned int nInterpDelayMillisecs = m_pge.getNetwork().isServer() ? 0 : config.getClientInterpDelayMillisecs();
+    const auto timeRender = std::chrono::steady_clock::now() - std::chrono::milliseconds(nInterpDelayMillisecs);
     for (auto& playerPair : m_mapPlayers)
     {
         auto& player = playerPair.second;
@@ -1658,8 +1857,18 @@ void proofps_dd::PlayerHandling::updatePlayersVisuals(
             continue;
         }
 
-        player.updateAudioVisuals(
-            config, m_pge.getNetwork().isServer(), gameMode.isPlayerAllowedForGameplay(player));
+        player.updateAudioVisuals(gameMode.isPlayerAllowedForGameplay(player));
+
+        if (nInterpDelayMillisecs > 0)
+        {
+            const auto itSnapshots = m_mapRemotePlayerSnapshots.find(playerPair.first);
+            if ((itSnapshots != m_mapRemotePlayerSnapshots.end()) &&
+                itSnapshots->second.getPosition(timeRender, player.getObject3D()->getPosVec()) &&
+                player.getWeaponManager().getCurrentWeapon())
+            {
+                player.getWeaponManager().getCurrentWeapon()->UpdatePosition(player.getObject3D()->getPosVec(), player.isSomersaulting());
+            }
+        }
         
         if (bXHairIdentifiesPlayers)
         {
@@ -1692,5 +1901,181 @@ void proofps_dd::PlayerHandling::updatePlayersVisuals(
     }
 }
 
+/**
+* Client-only.
+* Remote players are rendered behind the newest received server tick by the interpolation delay, this tells which server tick
+* we are actually seeing, so server can do hit tests against the same positions.
+*
+* @param config The usual Config instance.
+*
+* @return The server tick we are rendering remote players at, or 0 if unknown.
+*/
+std::uint32_t proofps_dd::PlayerHandling::clientGetViewServerTick(const proofps_dd::Config& config) const
+{
+    if (m_pge.getNetwork().isServer() || (m_nClientNewestServerTick == 0))
+    {
+        return 0;
+    }
+
+    const std::uint32_t nInterpDelayTicks = (config.getClientInterpDelayMillisecs() * config.getTickRate() + 500) / 1000;
+    std::uint32_t nViewServerTick = m_nClientNewestServerTick - nInterpDelayTicks;
+
+    // If we have not received any update for longer than the round-trip time, our newest server tick is stale: server has been
+    // advancing since then, so we would claim a view older than what our latency explains. In such case we estimate the current
+    // server tick from the time elapsed since receiving the newest one, and stay at most round-trip time plus interpolation delay behind it.
+    const auto nMillisecsSinceNewestServerTick =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_timeClientNewestServerTickReceived).count();
+    const long long nRttMillisecs = std::max(0LL, static_cast<long long>(m_pge.getNetwork().getClient().getPing(true)));
+    if (nMillisecsSinceNewestServerTick > nRttMillisecs)
+    {
+        const std::uint32_t nEstimatedServerTick =
+            m_nClientNewestServerTick + static_cast<std::uint32_t>((nMillisecsSinceNewestServerTick * config.getTickRate()) / 1000);
+        const std::uint32_t nMaxTicksBehind =
+            static_cast<std::uint32_t>(((nRttMillisecs + config.getClientInterpDelayMillisecs()) * config.getTickRate() + 500) / 1000);
+        const std::uint32_t nMinViewServerTick = nEstimatedServerTick - nMaxTicksBehind;
+        if (static_cast<std::int32_t>(nMinViewServerTick - nViewServerTick) > 0)
+        {
+            nViewServerTick = nMinViewServerTick;
+        }
+    }
+
+    // wraparound is not an issue, except hitting 0 which means unknown
+    return (nViewServerTick == 0) ? 1 : nViewServerTick;
+}
+
+/**
+* Client-only.
+* Server measures round-trip time by us echoing back the server time of the newest received user update, increased by the
+* time we have been holding it, so our processing and send rate do not count into the RTT.
+*
+* @return The server time to be echoed back in MsgUserCmdFromClient, or 0 if unknown.
+*/
+std::uint32_t proofps_dd::PlayerHandling::clientGetEchoServerTimeMillisecs() const
+{
+    if (m_pge.getNetwork().isServer() || (m_nClientNewestServerTimeMillisecs == 0))
+    {
+        return 0;
+    }
+
+    return m_nClientNewestServerTimeMillisecs + static_cast<std::uint32_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_timeClientNewestServerTimeReceived).count());
+}
+
+/**
+* Server-only.
+* Invoked when a MsgUserCmdFromClient is received, to update how many ticks the hit tests of bullets fired by the given player
+* should be rewound. This covers the whole round-trip time and the client's interpolation delay, limited by the hitbox history.
+*
+* @param connHandleServerSide Connection handle of the player who sent the cmd.
+* @param nViewServerTick      MsgUserCmdFromClient::m_nViewServerTick, 0 if unknown, in such case it is estimated from the
+*                             player's measured round-trip time and the default interpolation delay, or nothing is updated
+*                             if even that is unknown.
+* @param nTickRate            The usual tickrate.
+*/
+void proofps_dd::PlayerHandling::serverUpdateLagCompensationTicks(
+    pge_network::PgeNetworkConnectionHandle connHandleServerSide,
+    const std::uint32_t& nViewServerTick,
+    const unsigned int& nTickRate)
+{
+    const auto it = m_mapPlayers.find(connHandleServerSide);
+    if (m_mapPlayers.end() == it)
+    {
+        // this is already logged by serverHandleUserCmdMoveFromClient()
+        return;
+    }
+
+    static_assert(PlayerHitboxHistory::nTickRateMax >= GAME_TICKRATE_MAX, "Hitbox history shall cover the max rewind time with max tickrate!");
+
+    std::int32_t nTicksBehind;
+    if (nViewServerTick != 0)
+    {
+        // view tick can be newer than our tick only if client is faulty or cheating
+        nTicksBehind = static_cast<std::int32_t>(m_nServerTick - nViewServerTick);
+    }
+    else
+    {
+        const ClockSync& clockSync = it->second.getClockSync();
+        if (!clockSync.hasRtt())
+        {
+            return;
+        }
+        nTicksBehind = static_cast<std::int32_t>(
+            ((clockSync.getRttMillisecs() + SnapshotInterpolation::nInterpDelayMillisecsDef) * nTickRate) / 1000.f + 0.5f);
+    }
+    it->second.setLagCompensationTicks(
+        std::min(
+            static_cast<std::uint32_t>(std::max(0, nTicksBehind)),
+            static_cast<std::uint32_t>(PlayerHitboxHistory::getMaxRewindTicks(nTickRate))));
+}
+
+const std::uint32_t& proofps_dd::PlayerHandling::getServerTick() const
+{
+    return m_nServerTick;
+}
+
+const proofps_dd::PlayerHitboxHistory& proofps_dd::PlayerHandling::getPlayerHitboxHistory() const
+{
+    return m_playerHitboxHistory;
+}
+
+proofps_dd::ClientPrediction& proofps_dd::PlayerHandling::getClientPrediction()
+{
+    return m_clientPrediction;
+}
+
+/**
+* Server-only: timers expiring at server ticks, advanced by the server once per tick.
+* Besides the player timers managed here, other server entities can have their own kinds of timers too, see ServerTimerKind.
+*/
+proofps_dd::TickTimerWheel& proofps_dd::PlayerHandling::getServerTimers()
+{
+    return m_serverTimers;
+}
+
 
 // ############################### PRIVATE ###############################
+
+
+/**
+* Schedules the timer of the given kind for the given player, replacing the player's previous timer of the same kind if any.
+*/
+void proofps_dd::PlayerHandling::serverSchedulePlayerTimer(
+    PlayerTimers& playerTimers,
+    const ServerTimerKind& eKind,
+    const pge_network::PgeNetworkConnectionHandle& connHandleServerSide,
+    const std::uint32_t& nTicksFromNow)
+{
+    auto& timerId = playerTimers[connHandleServerSide];
+    m_serverTimers.cancel(timerId);
+    timerId = m_serverTimers.schedule(nTicksFromNow, static_cast<std::uint32_t>(eKind), static_cast<std::uint32_t>(connHandleServerSide));
+}
+
+void proofps_dd::PlayerHandling::serverCancelPlayerTimer(
+    PlayerTimers& playerTimers,
+    const pge_network::PgeNetworkConnectionHandle& connHandleServerSide)
+{
+    const auto it = playerTimers.find(connHandleServerSide);
+    if (it == playerTimers.end())
+    {
+        return;
+    }
+
+    m_serverTimers.cancel(it->second);
+    playerTimers.erase(it);
+}
+
+/**
+* Activates the respawn invulnerability of the given player, ended by serverEndPlayerInvulnerabilityByTimer().
+*/
+void proofps_dd::PlayerHandling::serverSetPlayerInvulnerability(
+    proofps_dd::Player& player,
+    const proofps_dd::Config& config)
+{
+    player.setInvulnerability(true, config.getPlayerRespawnInvulnerabilityDelaySeconds());
+    serverSchedulePlayerTimer(
+        m_mapPlayerInvulnerabilityTimers,
+        ServerTimerKind::PlayerInvulnerabilityEnd,
+        player.getServerSideConnectionHandle(),
+        config.getPlayerRespawnInvulnerabilityDelaySeconds() * config.getTickRate());
+}
+
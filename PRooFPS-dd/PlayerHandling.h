@@ -21,6 +21,8 @@
 #include "Config/PgeOldNewValue.h"
 
 #include "CameraHandling.h"
+#include "ClientPrediction.h"
+#include "ClockSync.h"
 #include "Config.h"
 #include "Consts.h"
 #include "Durations.h"
@@ -29,9 +31,13 @@
 #include "Maps.h"
 #include "Networking.h"
 #include "Player.h"
+#include "PlayerHitboxHistory.h"
 #include "PRooFPS-dd-packet.h"
+#include "SendScheduler.h"
+#include "SnapshotInterpolation.h"
 #include "Sounds.h"
 #include "Strafe.h"
+#include "TickTimerWheel.h"
 
 namespace proofps_dd
 {
@@ -63,6 +69,14 @@ namespace proofps_dd
 
     protected:
 
+        /** Kinds of server timers in getServerTimers(), the id of a timer depends on its kind. */
+        enum class ServerTimerKind : std::uint32_t
+        {
+            MapItemRespawn,           /**< Id is the MapItemId. */
+            PlayerRespawn,            /**< Id is the server-side connection handle of the dead player. */
+            PlayerInvulnerabilityEnd  /**< Id is the server-side connection handle of the invulnerable player. */
+        };
+
         bool hasPlayerBootedUp(const pge_network::PgeNetworkConnectionHandle& connHandle) const;
 
         void handlePlayerDied(
@@ -104,12 +118,15 @@ namespace proofps_dd
             const proofps_dd::Config& config,
             PgeObjectPool<proofps_dd::Smoke>& smokes);
 
-        void serverUpdateRespawnTimers(
+        void serverRespawnPlayerByTimer(
+            const pge_network::PgeNetworkConnectionHandle& connHandleServerSide,
             const proofps_dd::Config& config,
             PGEcfgProfiles& cfgProfiles,
             proofps_dd::GameMode& gameMode,
-            proofps_dd::Durations& durations,
             PgeObjectPool<proofps_dd::Smoke>& smokes);
+        void serverEndPlayerInvulnerabilityByTimer(
+            const pge_network::PgeNetworkConnectionHandle& connHandleServerSide);
+        void serverClearTimers();
         void handlePlayerTeamIdChangedOrToggledSpectatorMode(
             Player& player,
             const unsigned int& iTeamId,
@@ -178,9 +195,38 @@ namespace proofps_dd
         void updatePlayersVisuals(
             const proofps_dd::Config& config,
             proofps_dd::GameMode& gameMode);
+        std::uint32_t clientGetViewServerTick(const proofps_dd::Config& config) const;
+        std::uint32_t clientGetEchoServerTimeMillisecs() const;
+        void serverUpdateLagCompensationTicks(
+            pge_network::PgeNetworkConnectionHandle connHandleServerSide,
+            const std::uint32_t& nViewServerTick,
+            const unsigned int& nTickRate);
+        const std::uint32_t& getServerTick() const;
+        const proofps_dd::PlayerHitboxHistory& getPlayerHitboxHistory() const;
+        proofps_dd::ClientPrediction& getClientPrediction();
+        proofps_dd::TickTimerWheel& getServerTimers();
 
     private:
 
+        using PlayerTimers = std::map<pge_network::PgeNetworkConnectionHandle, proofps_dd::TickTimerWheel::TimerId>;
+
+        bool serverInitUserUpdatePkt(
+            proofps_dd::Player& player,
+            pge_network::PgePacket& pkt,
+            const std::uint32_t& nServerTick);
+        void serverSendScheduledUserUpdatesToClients(const proofps_dd::Config& config);
+        void serverSchedulePlayerTimer(
+            PlayerTimers& playerTimers,
+            const ServerTimerKind& eKind,
+            const pge_network::PgeNetworkConnectionHandle& connHandleServerSide,
+            const std::uint32_t& nTicksFromNow);
+        void serverCancelPlayerTimer(
+            PlayerTimers& playerTimers,
+            const pge_network::PgeNetworkConnectionHandle& connHandleServerSide);
+        void serverSetPlayerInvulnerability(
+            proofps_dd::Player& player,
+            const proofps_dd::Config& config);
+
         // ---------------------------------------------------------------------------
 
         PGE& m_pge;
@@ -193,6 +239,21 @@ namespace proofps_dd
         unsigned int m_nSendClientUpdatesInEveryNthTick = 1;
         unsigned int m_nSendClientUpdatesCntr = m_nSendClientUpdatesInEveryNthTick;
 
+        std::uint32_t m_nServerTick = 0;  /**< Server-only: incremented in every tick, 0 is skipped since it means not sequenced. Sent as user update seq. */
+        proofps_dd::PlayerHitboxHistory m_playerHitboxHistory;  /**< Server-only: player hitboxes of the last ticks, for lag compensation. */
+        proofps_dd::TickTimerWheel m_serverTimers;  /**< Server-only: timers expiring at server ticks, so they are not polled every tick. */
+        PlayerTimers m_mapPlayerRespawnTimers;          /**< Server-only: timers of dead players. */
+        PlayerTimers m_mapPlayerInvulnerabilityTimers;  /**< Server-only: timers of invulnerable players. */
+        std::uint32_t m_nClientNewestServerTick = 0;  /**< Client-only: newest server tick we have received user update for. */
+        std::chrono::time_point<std::chrono::steady_clock> m_timeClientNewestServerTickReceived;  /**< Client-only: when we received m_nClientNewestServerTick. */
+        std::uint32_t m_nClientNewestServerTimeMillisecs = 0;  /**< Client-only: server's send time of the newest server tick, 0 if unknown. */
+        std::chrono::time_point<std::chrono::steady_clock> m_timeClientNewestServerTimeReceived;  /**< Client-only: when we received m_nClientNewestServerTimeMillisecs. */
+        proofps_dd::SendScheduler m_sendScheduler;
+        std::vector<pge_network::PgeNetworkConnectionHandle> m_vecScheduledEntities;  /**< Kept as member to avoid allocation per tick. */
+
+        proofps_dd::ClientPrediction m_clientPrediction;  /**< Client-only: steps predicted for our own player, not yet acknowledged by server. */
+        std::map<pge_network::PgeNetworkConnectionHandle, proofps_dd::SnapshotInterpolation> m_mapRemotePlayerSnapshots;  /**< Client-only. */
+
     }; // class PlayerHandling
 
 } // namespace proofps_dd
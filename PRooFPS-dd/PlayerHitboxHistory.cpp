@@ -0,0 +1,144 @@
+/*
+    ###################################################################################
+    PlayerHitboxHistory.cpp
+    Server-side history of player hitboxes for lag compensation in PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <algorithm>
+
+#include "PlayerHitboxHistory.h"
+
+
+// ############################### PUBLIC ################################
+
+
+/**
+* @return The number of ticks server can rewind with the given tickrate, based on nMaxRewindMillisecs,
+*         but never more than the number of stored past ticks.
+*/
+size_t proofps_dd::PlayerHitboxHistory::getMaxRewindTicks(const unsigned int& nTickRate)
+{
+    return std::min(nMaxRewindTicks, static_cast<size_t>((nMaxRewindMillisecs * nTickRate) / 1000));
+}
+
+/**
+* Forgets all recorded ticks, e.g. when a new map is loaded.
+*/
+void proofps_dd::PlayerHitboxHistory::clear()
+{
+    for (auto& tickHitboxes : m_ticks)
+    {
+        tickHitboxes.m_nTick = 0;
+        tickHitboxes.m_nHitboxCount = 0;
+    }
+    m_pCurrentTick = nullptr;
+}
+
+/**
+* Starts recording the hitboxes of the given tick, overwriting the oldest stored tick.
+* Subsequent addHitbox() calls will store hitboxes for this tick.
+*
+* @param nTick Server tick sequence number, 0 is ignored since it means not sequenced.
+*/
+void proofps_dd::PlayerHitboxHistory::beginTick(const std::uint32_t& nTick)
+{
+    if (nTick == 0)
+    {
+        m_pCurrentTick = nullptr;
+        return;
+    }
+
+    m_pCurrentTick = &m_ticks[nTick % nCapacityTicks];
+    m_pCurrentTick->m_nTick = nTick;
+    m_pCurrentTick->m_nHitboxCount = 0;
+}
+
+/**
+* Stores the hitbox of the given player for the tick started by the last beginTick() call.
+*
+* @return False if beginTick() was not called yet, or the tick is already full, in such case the hitbox is not stored.
+*/
+bool proofps_dd::PlayerHitboxHistory::addHitbox(
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const float& fPosX,
+    const float& fPosY,
+    const float& fSizeX,
+    const float& fSizeY)
+{
+    if (!m_pCurrentTick || (m_pCurrentTick->m_nHitboxCount == nMaxHitboxesPerTick))
+    {
+        return false;
+    }
+
+    m_pCurrentTick->m_hitboxes[m_pCurrentTick->m_nHitboxCount] = Hitbox{ connHandle, fPosX, fPosY, fSizeX, fSizeY };
+    ++m_pCurrentTick->m_nHitboxCount;
+    return true;
+}
+
+/**
+* Forgets all recorded hitboxes of the given player, e.g. when player is respawned or teleported, so hit tests are not done
+* against a position the player is not anywhere near anymore. Hit tests fall back to the current position until history is recorded again.
+*/
+void proofps_dd::PlayerHitboxHistory::invalidatePlayer(const pge_network::PgeNetworkConnectionHandle& connHandle)
+{
+    for (auto& tickHitboxes : m_ticks)
+    {
+        for (size_t i = 0; i < tickHitboxes.m_nHitboxCount; i++)
+        {
+            if (tickHitboxes.m_hitboxes[i].m_connHandle == connHandle)
+            {
+                // order of hitboxes within a tick does not matter
+                tickHitboxes.m_hitboxes[i] = tickHitboxes.m_hitboxes[tickHitboxes.m_nHitboxCount - 1];
+                --tickHitboxes.m_nHitboxCount;
+                break;
+            }
+        }
+    }
+}
+
+/**
+* Retrieves the hitbox of the given player as it was at the end of the given tick.
+*
+* @param hitbox Output: the recorded hitbox. Untouched if not found.
+*
+* @return False if the given tick is not stored anymore (or yet), or the player was not recorded in that tick, true otherwise.
+*/
+bool proofps_dd::PlayerHitboxHistory::getHitbox(
+    const std::uint32_t& nTick,
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    Hitbox& hitbox) const
+{
+    if (nTick == 0)
+    {
+        return false;
+    }
+
+    const TickHitboxes& tickHitboxes = m_ticks[nTick % nCapacityTicks];
+    if (tickHitboxes.m_nTick != nTick)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < tickHitboxes.m_nHitboxCount; i++)
+    {
+        if (tickHitboxes.m_hitboxes[i].m_connHandle == connHandle)
+        {
+            hitbox = tickHitboxes.m_hitboxes[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
+
+
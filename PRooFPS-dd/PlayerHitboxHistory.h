@@ -0,0 +1,98 @@
+#pragma once
+
+/*
+    ###################################################################################
+    PlayerHitboxHistory.h
+    Server-side history of player hitboxes for lag compensation in PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "PGE.h"
+
+#include "SnapshotInterpolation.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Player hitboxes recorded by server at the end of every tick, so hit tests can be done against the world as a shooter
+    * saw it when firing, i.e. a few ticks earlier than the current server tick, due to network latency and client-side
+    * snapshot interpolation delay.
+    *
+    * Stores a fixed number of ticks, each with a fixed number of hitboxes, so memory footprint is bounded and no allocation
+    * happens during gameplay. Recording a tick overwrites the oldest stored tick.
+    * The number of stored ticks is derived from the maximum supported rewind time at the maximum tickrate, so with lower
+    * tickrate the same number of ticks covers even longer time.
+    */
+    class PlayerHitboxHistory
+    {
+    public:
+
+        struct Hitbox
+        {
+            pge_network::PgeNetworkConnectionHandle m_connHandle;
+            float m_fPosX;
+            float m_fPosY;
+            float m_fSizeX;
+            float m_fSizeY;
+        };
+
+        static constexpr unsigned int nMaxSupportedPingMillisecs = 300;
+        /** Client renders remote players delayed by interpolation, the default delay is also compensated. */
+        static constexpr unsigned int nMaxRewindMillisecs = nMaxSupportedPingMillisecs + SnapshotInterpolation::nInterpDelayMillisecsDef;
+        static constexpr unsigned int nTickRateMax = 60;  /**< Must not be less than GAME_TICKRATE_MAX. */
+        static constexpr size_t nMaxRewindTicks = (nMaxRewindMillisecs * nTickRateMax) / 1000;
+        static constexpr size_t nCapacityTicks = nMaxRewindTicks + 1;  /**< +1 for the current tick. */
+        static constexpr size_t nMaxHitboxesPerTick = 32;
+
+        static size_t getMaxRewindTicks(const unsigned int& nTickRate);
+
+        // ---------------------------------------------------------------------------
+
+        PlayerHitboxHistory() = default;
+
+        PlayerHitboxHistory(const PlayerHitboxHistory&) = delete;
+        PlayerHitboxHistory& operator=(const PlayerHitboxHistory&) = delete;
+        PlayerHitboxHistory(PlayerHitboxHistory&&) = delete;
+        PlayerHitboxHistory&& operator=(PlayerHitboxHistory&&) = delete;
+
+        void clear();
+        void beginTick(const std::uint32_t& nTick);
+        bool addHitbox(
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const float& fPosX,
+            const float& fPosY,
+            const float& fSizeX,
+            const float& fSizeY);
+        void invalidatePlayer(const pge_network::PgeNetworkConnectionHandle& connHandle);
+
+        bool getHitbox(
+            const std::uint32_t& nTick,
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            Hitbox& hitbox) const;
+
+    protected:
+
+    private:
+
+        struct TickHitboxes
+        {
+            std::uint32_t m_nTick = 0;  /**< 0 means slot is unused. */
+            size_t m_nHitboxCount = 0;
+            std::array<Hitbox, nMaxHitboxesPerTick> m_hitboxes;
+        };
+
+        // ---------------------------------------------------------------------------
+
+        std::array<TickHitboxes, nCapacityTicks> m_ticks;
+        TickHitboxes* m_pCurrentTick = nullptr;  /**< The tick being recorded, set by beginTick(). */
+
+    }; // class PlayerHitboxHistory
+
+} // namespace proofps_dd
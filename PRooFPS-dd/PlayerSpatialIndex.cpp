@@ -0,0 +1,216 @@
+/*
+    ###################################################################################
+    PlayerSpatialIndex.cpp
+    Uniform grid of player bounding boxes for area queries in PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "PlayerSpatialIndex.h"
+
+
+// ############################### PUBLIC ################################
+
+
+/**
+* @param fCellSize Size of a grid cell in both dimensions, must be positive.
+*/
+proofps_dd::PlayerSpatialIndex::PlayerSpatialIndex(const float& fCellSize) :
+    m_fCellSize(fCellSize > 0.f ? fCellSize : fCellSizeDef)
+{
+    assert(fCellSize > 0.f);
+}
+
+const float& proofps_dd::PlayerSpatialIndex::getCellSize() const
+{
+    return m_fCellSize;
+}
+
+/**
+* @return Number of players added since the last clear().
+*/
+size_t proofps_dd::PlayerSpatialIndex::size() const
+{
+    return m_vecEntries.size();
+}
+
+/**
+* Removes all players, to be invoked before adding the players of the current tick.
+*/
+void proofps_dd::PlayerSpatialIndex::clear()
+{
+    m_vecEntries.clear();
+    m_vecCellEntries.clear();
+    m_bBuilt = false;
+}
+
+/**
+* Adds a player with its center position and size, same as used by the collision functions in Physics.
+* build() shall be invoked after adding all players.
+*/
+void proofps_dd::PlayerSpatialIndex::add(
+    const pge_network::PgeNetworkConnectionHandle& connHandle,
+    const float& fPosX,
+    const float& fPosY,
+    const float& fSizeX,
+    const float& fSizeY)
+{
+    const std::uint32_t nEntryIndex = static_cast<std::uint32_t>(m_vecEntries.size());
+    const Entry entry{
+        connHandle,
+        fPosX - std::abs(fSizeX) / 2.f,
+        fPosY - std::abs(fSizeY) / 2.f,
+        fPosX + std::abs(fSizeX) / 2.f,
+        fPosY + std::abs(fSizeY) / 2.f };
+    m_vecEntries.push_back(entry);
+
+    const std::int32_t nCellMinX = getCellCoord(entry.m_fMinX);
+    const std::int32_t nCellMaxX = getCellCoord(entry.m_fMaxX);
+    const std::int32_t nCellMinY = getCellCoord(entry.m_fMinY);
+    const std::int32_t nCellMaxY = getCellCoord(entry.m_fMaxY);
+    for (std::int32_t nCellX = nCellMinX; nCellX <= nCellMaxX; nCellX++)
+    {
+        for (std::int32_t nCellY = nCellMinY; nCellY <= nCellMaxY; nCellY++)
+        {
+            m_vecCellEntries.push_back(CellEntry{ getCellKey(nCellX, nCellY), nEntryIndex });
+        }
+    }
+    m_bBuilt = false;
+}
+
+/**
+* Makes the players added since the last clear() queryable.
+*/
+void proofps_dd::PlayerSpatialIndex::build()
+{
+    std::sort(
+        m_vecCellEntries.begin(),
+        m_vecCellEntries.end(),
+        [](const CellEntry& a, const CellEntry& b)
+        {
+            return (a.m_nCellKey < b.m_nCellKey) || ((a.m_nCellKey == b.m_nCellKey) && (a.m_nEntryIndex < b.m_nEntryIndex));
+        });
+
+    if (m_vecQueryStamps.size() < m_vecEntries.size())
+    {
+        m_vecQueryStamps.resize(m_vecEntries.size(), 0);
+    }
+    m_bBuilt = true;
+}
+
+/**
+* Collects the players whose bounding box overlaps the bounding box of the given circle.
+*
+* @param vecResult Cleared first, then filled with the connection handles of the found players in the order they were added,
+*                  so iterating the result gives the same order as iterating the players in the order of adding them.
+*/
+void proofps_dd::PlayerSpatialIndex::queryRadius(
+    const float& fPosX,
+    const float& fPosY,
+    const float& fRadius,
+    std::vector<pge_network::PgeNetworkConnectionHandle>& vecResult) const
+{
+    vecResult.clear();
+    assert(m_bBuilt);
+    if (!m_bBuilt || m_vecEntries.empty() || (fRadius < 0.f))
+    {
+        return;
+    }
+
+    const float fMinX = fPosX - fRadius;
+    const float fMinY = fPosY - fRadius;
+    const float fMaxX = fPosX + fRadius;
+    const float fMaxY = fPosY + fRadius;
+    const auto isOverlapping = [&](const Entry& entry)
+    {
+        return (entry.m_fMinX <= fMaxX) && (fMinX <= entry.m_fMaxX) && (entry.m_fMinY <= fMaxY) && (fMinY <= entry.m_fMaxY);
+    };
+
+    const std::int32_t nCellMinX = getCellCoord(fMinX);
+    const std::int32_t nCellMaxX = getCellCoord(fMaxX);
+    const std::int32_t nCellMinY = getCellCoord(fMinY);
+    const std::int32_t nCellMaxY = getCellCoord(fMaxY);
+    const std::int64_t nCellCount = (static_cast<std::int64_t>(nCellMaxX) - nCellMinX + 1) * (static_cast<std::int64_t>(nCellMaxY) - nCellMinY + 1);
+
+    m_vecQueryEntryIndices.clear();
+    if (nCellCount > static_cast<std::int64_t>(m_vecCellEntries.size()))
+    {
+        // huge radius compared to the number of players: visiting the cells would be slower than checking all players
+        for (std::uint32_t nEntryIndex = 0; nEntryIndex < m_vecEntries.size(); nEntryIndex++)
+        {
+            if (isOverlapping(m_vecEntries[nEntryIndex]))
+            {
+                vecResult.push_back(m_vecEntries[nEntryIndex].m_connHandle);
+            }
+        }
+        return;
+    }
+
+    m_nQueryStamp++;
+    if (m_nQueryStamp == 0)
+    {
+        // wrapped around, old stamps might look current
+        std::fill(m_vecQueryStamps.begin(), m_vecQueryStamps.end(), 0);
+        m_nQueryStamp = 1;
+    }
+
+    for (std::int32_t nCellX = nCellMinX; nCellX <= nCellMaxX; nCellX++)
+    {
+        for (std::int32_t nCellY = nCellMinY; nCellY <= nCellMaxY; nCellY++)
+        {
+            const std::int64_t nCellKey = getCellKey(nCellX, nCellY);
+            auto it = std::lower_bound(
+                m_vecCellEntries.begin(),
+                m_vecCellEntries.end(),
+                nCellKey,
+                [](const CellEntry& cellEntry, const std::int64_t& nKey)
+                {
+                    return cellEntry.m_nCellKey < nKey;
+                });
+            for (; (it != m_vecCellEntries.end()) && (it->m_nCellKey == nCellKey); it++)
+            {
+                if (m_vecQueryStamps[it->m_nEntryIndex] == m_nQueryStamp)
+                {
+                    continue;
+                }
+                m_vecQueryStamps[it->m_nEntryIndex] = m_nQueryStamp;
+                if (isOverlapping(m_vecEntries[it->m_nEntryIndex]))
+                {
+                    m_vecQueryEntryIndices.push_back(it->m_nEntryIndex);
+                }
+            }
+        }
+    }
+
+    std::sort(m_vecQueryEntryIndices.begin(), m_vecQueryEntryIndices.end());
+    for (const auto& nEntryIndex : m_vecQueryEntryIndices)
+    {
+        vecResult.push_back(m_vecEntries[nEntryIndex].m_connHandle);
+    }
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
+
+
+std::int32_t proofps_dd::PlayerSpatialIndex::getCellCoord(const float& fCoord) const
+{
+    // clamped so that a bogus position cannot overflow, maps are much smaller than this anyway
+    static constexpr float fCellCoordLimit = 1000000.f;
+    return static_cast<std::int32_t>(std::clamp(std::floor(fCoord / m_fCellSize), -fCellCoordLimit, fCellCoordLimit));
+}
+
+std::int64_t proofps_dd::PlayerSpatialIndex::getCellKey(const std::int32_t& nCellX, const std::int32_t& nCellY)
+{
+    return (static_cast<std::int64_t>(nCellX) << 32) | static_cast<std::uint32_t>(nCellY);
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+/*
+    ###################################################################################
+    PlayerSpatialIndex.h
+    Uniform grid of player bounding boxes for area queries in PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "PGE.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Server-side index of player bounding boxes, rebuilt every tick, so an explosion needs to look at only the players
+    * around it instead of all players.
+    *
+    * Every player is added to all cells of a uniform grid its bounding box overlaps, then build() sorts the cell entries,
+    * so a query is a binary search per overlapped cell. Memory is reused between rebuilds, no allocation happens during
+    * gameplay once the vectors have grown to the number of players.
+    *
+    * Queries are conservative: they return players whose bounding box overlaps the bounding box of the query circle,
+    * exact damage calculation is still the job of the caller.
+    */
+    class PlayerSpatialIndex
+    {
+    public:
+
+        static constexpr float fCellSizeDef = 4.f;  /**< A few times the size of a player. */
+
+        // ---------------------------------------------------------------------------
+
+        explicit PlayerSpatialIndex(const float& fCellSize = fCellSizeDef);
+
+        PlayerSpatialIndex(const PlayerSpatialIndex&) = delete;
+        PlayerSpatialIndex& operator=(const PlayerSpatialIndex&) = delete;
+        PlayerSpatialIndex(PlayerSpatialIndex&&) = delete;
+        PlayerSpatialIndex&& operator=(PlayerSpatialIndex&&) = delete;
+
+        const float& getCellSize() const;
+        size_t size() const;
+
+        void clear();
+        void add(
+            const pge_network::PgeNetworkConnectionHandle& connHandle,
+            const float& fPosX,
+            const float& fPosY,
+            const float& fSizeX,
+            const float& fSizeY);
+        void build();
+
+        void queryRadius(
+            const float& fPosX,
+            const float& fPosY,
+            const float& fRadius,
+            std::vector<pge_network::PgeNetworkConnectionHandle>& vecResult) const;
+
+    protected:
+
+    private:
+
+        struct Entry
+        {
+            pge_network::PgeNetworkConnectionHandle m_connHandle;
+            float m_fMinX;
+            float m_fMinY;
+            float m_fMaxX;
+            float m_fMaxY;
+        };
+
+        struct CellEntry
+        {
+            std::int64_t m_nCellKey;
+            std::uint32_t m_nEntryIndex;
+        };
+
+        // ---------------------------------------------------------------------------
+
+        float m_fCellSize;
+        std::vector<Entry> m_vecEntries;                /**< In the order of add(). */
+        std::vector<CellEntry> m_vecCellEntries;        /**< Sorted by cell key, then by entry index, after build(). */
+        bool m_bBuilt = false;
+        mutable std::vector<std::uint32_t> m_vecQueryStamps;  /**< Per entry, to return an entry only once even if found in multiple cells. */
+        mutable std::vector<std::uint32_t> m_vecQueryEntryIndices;
+        mutable std::uint32_t m_nQueryStamp = 0;
+
+        // ---------------------------------------------------------------------------
+
+        std::int32_t getCellCoord(const float& fCoord) const;
+        static std::int64_t getCellKey(const std::int32_t& nCellX, const std::int32_t& nCellY);
+
+    }; // class PlayerSpatialIndex
+
+} // namespace proofps_dd
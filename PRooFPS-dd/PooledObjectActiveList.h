@@ -0,0 +1,144 @@
+#pragma once
+
+/*
+    ###################################################################################
+    PooledObjectActiveList.h
+    Dense list of the used elements of an object pool for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <vector>
+
+namespace proofps_dd
+{
+
+    /**
+    * Dense list of the used elements of an object pool, so we can iterate over exactly the live objects instead of walking
+    * the whole pool and skipping the free slots.
+    *
+    * The pool itself does not notify anyone about creating or freeing an element, therefore:
+    *  - add() shall be invoked with any element we create ourselves;
+    *  - elements freed during iteration stay in the list until the next compact() or sync(), iteration shall skip them by checking used(),
+    *    this way the list can be safely iterated by index even by nested loops freeing elements;
+    *  - after iteration, or after freeing an element outside of iteration, compact() shall be invoked before the next add(), otherwise
+    *    the pool might give the same slot again, and the list would contain it twice;
+    *  - sync() rebuilds the list by walking the whole pool only if the pool has used elements not in the list, e.g. when the
+    *    engine created some, otherwise its cost depends only on the number of elements in the list.
+    *
+    * TPool shall have begin(), end() and size() returning the number of used elements, T shall have used().
+    * Element addresses must not change while they are in the list, which is true for the pool until it is deallocated.
+    */
+    template <class T>
+    class PooledObjectActiveList
+    {
+    public:
+
+        PooledObjectActiveList() = default;
+
+        PooledObjectActiveList(const PooledObjectActiveList&) = delete;
+        PooledObjectActiveList& operator=(const PooledObjectActiveList&) = delete;
+        PooledObjectActiveList(PooledObjectActiveList&&) = delete;
+        PooledObjectActiveList&& operator=(PooledObjectActiveList&&) = delete;
+
+        /**
+        * Number of elements in the list, might include elements already freed since the last compact() or sync().
+        */
+        size_t size() const
+        {
+            return m_vecElems.size();
+        }
+
+        bool empty() const
+        {
+            return m_vecElems.empty();
+        }
+
+        T& operator[](const size_t& i)
+        {
+            return *m_vecElems[i];
+        }
+
+        const T& operator[](const size_t& i) const
+        {
+            return *m_vecElems[i];
+        }
+
+        /**
+        * To be invoked with the element just created in the pool.
+        * The list shall not contain freed elements at this point, see class description.
+        */
+        void add(T& elem)
+        {
+            m_vecElems.push_back(&elem);
+        }
+
+        /**
+        * Removes the elements not used anymore. Order of the remaining elements is kept.
+        * Must not be invoked while iterating over the list.
+        */
+        void compact()
+        {
+            size_t iDst = 0;
+            for (size_t iSrc = 0; iSrc < m_vecElems.size(); iSrc++)
+            {
+                if (m_vecElems[iSrc]->used())
+                {
+                    m_vecElems[iDst++] = m_vecElems[iSrc];
+                }
+            }
+            m_vecElems.resize(iDst);
+        }
+
+        /**
+        * Makes the list contain exactly the used elements of the given pool.
+        * Must not be invoked while iterating over the list.
+        *
+        * @return True if the whole pool had to be walked because the list was not complete, false otherwise.
+        */
+        template <class TPool>
+        bool sync(TPool& pool)
+        {
+            compact();
+            if (m_vecElems.size() == pool.size())
+            {
+                return false;
+            }
+
+            m_vecElems.clear();
+            for (auto it = pool.begin(); (m_vecElems.size() != pool.size()) && (it != pool.end()); it++)
+            {
+                if (it->used())
+                {
+                    m_vecElems.push_back(&(*it));
+                }
+            }
+            m_nFullSyncCount++;
+            return true;
+        }
+
+        /**
+        * To be invoked when the pool is cleared or deallocated.
+        */
+        void clear()
+        {
+            m_vecElems.clear();
+        }
+
+        /**
+        * @return Number of times sync() had to walk the whole pool.
+        */
+        size_t getFullSyncCount() const
+        {
+            return m_nFullSyncCount;
+        }
+
+    private:
+
+        std::vector<T*> m_vecElems;
+        size_t m_nFullSyncCount = 0;
+
+    }; // class PooledObjectActiveList
+
+} // namespace proofps_dd
@@ -0,0 +1,253 @@
+/*
+    ###################################################################################
+    SendScheduler.cpp
+    Priority-accumulator based per-client send scheduler for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <algorithm>
+#include <cassert>
+
+#include "SendScheduler.h"
+
+
+// ############################### PUBLIC ################################
+
+
+const char* proofps_dd::SendScheduler::getLoggerModuleName()
+{
+    return "SendScheduler";
+}
+
+/**
+* Calculates how much the priority of an entity shall grow in a tick for a specific client.
+* Closer entities grow faster, the client's own entity grows the fastest.
+*
+* @param bOwnEntity True if the entity is the client's own player.
+* @param fDistance  Distance between the entity and the client's player.
+*
+* @return The priority increment to be passed to accumulate().
+*/
+float proofps_dd::SendScheduler::calculatePriorityIncrement(
+    const bool& bOwnEntity,
+    const float& fDistance)
+{
+    const float fImportance = bOwnEntity ? fImportanceOwnEntity : fImportanceOtherEntity;
+    return fImportance / (1.f + (std::max(0.f, fDistance) / fDistanceFalloff));
+}
+
+CConsole& proofps_dd::SendScheduler::getConsole() const
+{
+    return CConsole::getConsoleInstance(getLoggerModuleName());
+}
+
+proofps_dd::SendScheduler::SendScheduler()
+{
+}
+
+void proofps_dd::SendScheduler::clear()
+{
+    m_clients.clear();
+    m_vecCandidates.clear();
+    m_nDeferredUpdatesCount = 0;
+}
+
+void proofps_dd::SendScheduler::removeClient(const pge_network::PgeNetworkConnectionHandle& client)
+{
+    m_clients.erase(client);
+}
+
+void proofps_dd::SendScheduler::removeEntity(const pge_network::PgeNetworkConnectionHandle& entity)
+{
+    for (auto& clientPair : m_clients)
+    {
+        clientPair.second.erase(entity);
+    }
+}
+
+void proofps_dd::SendScheduler::markPending(
+    const pge_network::PgeNetworkConnectionHandle& client,
+    const pge_network::PgeNetworkConnectionHandle& entity)
+{
+    m_clients[client][entity].m_bPending = true;
+}
+
+/**
+* Shall be invoked when the latest state of the entity has been sent to the client bypassing the scheduler, e.g. an important
+* state change that must be sent out immediately to everyone.
+*/
+void proofps_dd::SendScheduler::clearPending(
+    const pge_network::PgeNetworkConnectionHandle& client,
+    const pge_network::PgeNetworkConnectionHandle& entity)
+{
+    const auto itClient = m_clients.find(client);
+    if (itClient == m_clients.end())
+    {
+        return;
+    }
+
+    const auto itEntity = itClient->second.find(entity);
+    if (itEntity == itClient->second.end())
+    {
+        return;
+    }
+
+    itEntity->second.m_bPending = false;
+    itEntity->second.m_fPriority = 0.f;
+}
+
+bool proofps_dd::SendScheduler::isPending(
+    const pge_network::PgeNetworkConnectionHandle& client,
+    const pge_network::PgeNetworkConnectionHandle& entity) const
+{
+    const auto itClient = m_clients.find(client);
+    if (itClient == m_clients.end())
+    {
+        return false;
+    }
+
+    const auto itEntity = itClient->second.find(entity);
+    return (itEntity != itClient->second.end()) && itEntity->second.m_bPending;
+}
+
+size_t proofps_dd::SendScheduler::getPendingCount(
+    const pge_network::PgeNetworkConnectionHandle& client) const
+{
+    const auto itClient = m_clients.find(client);
+    if (itClient == m_clients.end())
+    {
+        return 0;
+    }
+
+    size_t nCount = 0;
+    for (const auto& entityPair : itClient->second)
+    {
+        if (entityPair.second.m_bPending)
+        {
+            ++nCount;
+        }
+    }
+    return nCount;
+}
+
+/**
+* Increases the priority accumulator of the entity for the client, if there is a pending update for it.
+* Entities without pending update do not accumulate, otherwise a long-idle entity would immediately starve all others
+* once it starts moving again.
+*/
+void proofps_dd::SendScheduler::accumulate(
+    const pge_network::PgeNetworkConnectionHandle& client,
+    const pge_network::PgeNetworkConnectionHandle& entity,
+    const float& fPriorityIncrement)
+{
+    const auto itClient = m_clients.find(client);
+    if (itClient == m_clients.end())
+    {
+        return;
+    }
+
+    const auto itEntity = itClient->second.find(entity);
+    if ((itEntity == itClient->second.end()) || !itEntity->second.m_bPending)
+    {
+        return;
+    }
+
+    itEntity->second.m_fPriority += fPriorityIncrement;
+}
+
+float proofps_dd::SendScheduler::getPriority(
+    const pge_network::PgeNetworkConnectionHandle& client,
+    const pge_network::PgeNetworkConnectionHandle& entity) const
+{
+    const auto itClient = m_clients.find(client);
+    if (itClient == m_clients.end())
+    {
+        return 0.f;
+    }
+
+    const auto itEntity = itClient->second.find(entity);
+    return (itEntity == itClient->second.end()) ? 0.f : itEntity->second.m_fPriority;
+}
+
+/**
+* Selects the pending entities with the highest accumulated priority for the client, as many as fit into the byte budget.
+* At least 1 entity is always selected if there is any pending, so a client is never fully starved even with a tiny budget.
+* The selected entities are not pending anymore and their priority is reset.
+*
+* @param client              The client we are about to send updates to.
+* @param nBudgetBytes        Bytes we are allowed to send to the client in this tick. 0 means unlimited.
+* @param nBytesPerUpdate     Size of a single entity update in bytes.
+* @param vecSelectedEntities Output: the selected entities in descending priority order. Cleared by this function first.
+*/
+void proofps_dd::SendScheduler::selectWithinBudget(
+    const pge_network::PgeNetworkConnectionHandle& client,
+    const size_t& nBudgetBytes,
+    const size_t& nBytesPerUpdate,
+    std::vector<pge_network::PgeNetworkConnectionHandle>& vecSelectedEntities)
+{
+    vecSelectedEntities.clear();
+
+    const auto itClient = m_clients.find(client);
+    if (itClient == m_clients.end())
+    {
+        return;
+    }
+
+    m_vecCandidates.clear();
+    for (const auto& entityPair : itClient->second)
+    {
+        if (entityPair.second.m_bPending)
+        {
+            m_vecCandidates.push_back({ entityPair.second.m_fPriority, entityPair.first });
+        }
+    }
+
+    if (m_vecCandidates.empty())
+    {
+        return;
+    }
+
+    assert(nBytesPerUpdate > 0);
+    const size_t nMaxUpdates = ((nBudgetBytes == 0) || (nBytesPerUpdate == 0)) ?
+        m_vecCandidates.size() :
+        std::max(static_cast<size_t>(1), nBudgetBytes / nBytesPerUpdate);
+
+    if (nMaxUpdates < m_vecCandidates.size())
+    {
+        // we need only the first nMaxUpdates in order, no need to sort all of them
+        std::partial_sort(
+            m_vecCandidates.begin(), m_vecCandidates.begin() + nMaxUpdates, m_vecCandidates.end(),
+            [](const auto& a, const auto& b) { return a.first > b.first; });
+        m_nDeferredUpdatesCount += m_vecCandidates.size() - nMaxUpdates;
+        m_vecCandidates.resize(nMaxUpdates);
+    }
+    else
+    {
+        std::sort(
+            m_vecCandidates.begin(), m_vecCandidates.end(),
+            [](const auto& a, const auto& b) { return a.first > b.first; });
+    }
+
+    for (const auto& candidate : m_vecCandidates)
+    {
+        EntityState& entityState = itClient->second[candidate.second];
+        entityState.m_bPending = false;
+        entityState.m_fPriority = 0.f;
+        vecSelectedEntities.push_back(candidate.second);
+    }
+}
+
+const size_t& proofps_dd::SendScheduler::getDeferredUpdatesCount() const
+{
+    return m_nDeferredUpdatesCount;
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
@@ -0,0 +1,110 @@
+#pragma once
+
+/*
+    ###################################################################################
+    SendScheduler.h
+    Priority-accumulator based per-client send scheduler for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <map>
+#include <vector>
+
+#include "CConsole.h"
+
+#include "PGE.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Decides which entity updates are sent to which client in the current tick, within a per-client byte budget.
+    *
+    * For each client, every entity with a not-yet-sent change has a priority accumulator. In every tick the accumulator is increased
+    * by the entity's priority increment (based on importance and distance to the client's player), and the highest-priority entities
+    * are selected until the byte budget of the client is used up. Selected entities get their accumulator reset, the others keep
+    * accumulating so starved entities will eventually win over the others.
+    * Since an update message always carries the latest full state of an entity, a deferred entity is not queued multiple times, only its
+    * latest state is sent once it is selected, so a saturated link catches up gracefully.
+    *
+    * Entities and clients are both identified by server-side connection handles, since the entities are the players for now.
+    */
+    class SendScheduler
+    {
+    public:
+
+        static constexpr char* szCVarSvNetClientBudgetBytesPerTick = "sv_net_client_budget_bytes_per_tick";
+        static constexpr unsigned int nClientBudgetBytesPerTickDef = 0;  /**< 0 means unlimited, in such case all pending updates are sent in every tick. */
+
+        static constexpr float fImportanceOwnEntity = 8.f;   /**< Client's own player is the most important for the client. */
+        static constexpr float fImportanceOtherEntity = 1.f;
+        static constexpr float fDistanceFalloff = 13.f;      /**< Priority of an entity this far from the client is half of the priority of a very close entity. */
+
+        static const char* getLoggerModuleName();
+
+        static float calculatePriorityIncrement(
+            const bool& bOwnEntity,
+            const float& fDistance);
+
+        // ---------------------------------------------------------------------------
+
+        CConsole& getConsole() const;
+
+        SendScheduler();
+
+        SendScheduler(const SendScheduler&) = delete;
+        SendScheduler& operator=(const SendScheduler&) = delete;
+        SendScheduler(SendScheduler&&) = delete;
+        SendScheduler&& operator=(SendScheduler&&) = delete;
+
+        void clear();
+        void removeClient(const pge_network::PgeNetworkConnectionHandle& client);
+        void removeEntity(const pge_network::PgeNetworkConnectionHandle& entity);
+
+        void markPending(
+            const pge_network::PgeNetworkConnectionHandle& client,
+            const pge_network::PgeNetworkConnectionHandle& entity);
+        void clearPending(
+            const pge_network::PgeNetworkConnectionHandle& client,
+            const pge_network::PgeNetworkConnectionHandle& entity);
+        bool isPending(
+            const pge_network::PgeNetworkConnectionHandle& client,
+            const pge_network::PgeNetworkConnectionHandle& entity) const;
+        size_t getPendingCount(
+            const pge_network::PgeNetworkConnectionHandle& client) const;
+
+        void accumulate(
+            const pge_network::PgeNetworkConnectionHandle& client,
+            const pge_network::PgeNetworkConnectionHandle& entity,
+            const float& fPriorityIncrement);
+        float getPriority(
+            const pge_network::PgeNetworkConnectionHandle& client,
+            const pge_network::PgeNetworkConnectionHandle& entity) const;
+
+        void selectWithinBudget(
+            const pge_network::PgeNetworkConnectionHandle& client,
+            const size_t& nBudgetBytes,
+            const size_t& nBytesPerUpdate,
+            std::vector<pge_network::PgeNetworkConnectionHandle>& vecSelectedEntities);
+
+        const size_t& getDeferredUpdatesCount() const;
+
+    protected:
+
+    private:
+
+        struct EntityState
+        {
+            float m_fPriority = 0.f;
+            bool m_bPending = false;
+        };
+
+        std::map<pge_network::PgeNetworkConnectionHandle, std::map<pge_network::PgeNetworkConnectionHandle, EntityState>> m_clients;
+        std::vector<std::pair<float, pge_network::PgeNetworkConnectionHandle>> m_vecCandidates;  /**< Kept as member to avoid allocation per tick. */
+        size_t m_nDeferredUpdatesCount = 0;  /**< Total number of pending updates not selected due to budget, for debugging purpose. */
+
+    }; // class SendScheduler
+
+} // namespace proofps_dd
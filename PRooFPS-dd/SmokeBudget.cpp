@@ -0,0 +1,64 @@
+/*
+    ###################################################################################
+    SmokeBudget.cpp
+    Distance-based emission LOD and live count limit for smoke in PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <algorithm>
+#include <cmath>
+
+#include "SmokeBudget.h"
+
+
+// ############################### PUBLIC ################################
+
+
+/**
+* @param nEmitInEveryNPhysicsIteration The emit interval defined by smoke amount config, as if the emitter were near the camera.
+* @param fPosX, fPosY                  Position of the emitter.
+* @param fCamPosX, fCamPosY            Position of the camera.
+*
+* @return The number of physics iterations between 2 smoke emissions for the emitter at the given position,
+*         0 if the emitter shall not emit smoke at all because it is too far from the camera.
+*/
+int proofps_dd::SmokeBudget::getEmitInterval(
+    const int& nEmitInEveryNPhysicsIteration,
+    const float& fPosX,
+    const float& fPosY,
+    const float& fCamPosX,
+    const float& fCamPosY)
+{
+    const float fDistanceSquared = (fPosX - fCamPosX) * (fPosX - fCamPosX) + (fPosY - fCamPosY) * (fPosY - fCamPosY);
+    if (!(fDistanceSquared <= fLodDistanceCull * fLodDistanceCull) /* NaN position is also culled */)
+    {
+        return 0;
+    }
+
+    const int nInterval = std::max(1, nEmitInEveryNPhysicsIteration);
+    if (fDistanceSquared <= fLodDistanceNear * fLodDistanceNear)
+    {
+        return nInterval;
+    }
+
+    const float fFactor = (std::sqrt(fDistanceSquared) - fLodDistanceNear) / (fLodDistanceCull - fLodDistanceNear);
+    const float fMultiplier = 1.f + fFactor * static_cast<float>(nLodEmitIntervalMultiplierMax - 1);
+    return static_cast<int>(std::lround(nInterval * fMultiplier));
+}
+
+size_t proofps_dd::SmokeBudget::getLiveSmokesMax(const Smoke::SmokeConfigAmount& eSmokeConfigAmount)
+{
+    const size_t nIndex = static_cast<size_t>(eSmokeConfigAmount);
+    return (nIndex < liveSmokesMax.size()) ? liveSmokesMax[nIndex] : 0;
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
+
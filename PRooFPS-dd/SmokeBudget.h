@@ -0,0 +1,71 @@
+#pragma once
+
+/*
+    ###################################################################################
+    SmokeBudget.h
+    Distance-based emission LOD and live count limit for smoke in PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <cstddef>
+
+#include "Smoke.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Decides how often a smoke-trailing object shall emit smoke based on its distance to the camera, and how many smokes
+    * can be alive at the same time, so that many rockets fired at the same time cannot eat up the frame time.
+    *
+    * Distances are measured on the XY-plane only, since the camera always looks along the Z-axis from the same depth.
+    * Stateless, it does not own or access any smoke.
+    */
+    class SmokeBudget
+    {
+    public:
+
+        /** Within this distance from the camera, smoke is emitted at the rate defined by smoke amount config. */
+        static constexpr float fLodDistanceNear = 10.f;
+
+        /** Beyond this distance from the camera, no smoke is emitted. Far enough from the visible area so that
+            trails of objects just entering the view are already there. */
+        static constexpr float fLodDistanceCull = 24.f;
+
+        /** Emit interval is multiplied by this at fLodDistanceCull, linearly increasing from 1 at fLodDistanceNear. */
+        static constexpr int nLodEmitIntervalMultiplierMax = 4;
+
+        /**
+        * Max number of smokes alive at the same time, based on user configuration SmokeConfigAmount.
+        * If a new smoke is to be emitted when this is reached, the oldest one shall be removed first.
+        * Rough numbers: a rocket at max smoke amount config has 30 smokes at a time, so Extreme can show 15 rocket trails in full.
+        */
+        static constexpr auto liveSmokesMax = PFL::std_array_of<size_t>(
+            static_cast<size_t>(0),   /* SmokeConfigAmount::None */
+            static_cast<size_t>(150), /* SmokeConfigAmount::Moderate */
+            static_cast<size_t>(300), /* SmokeConfigAmount::Normal */
+            static_cast<size_t>(450)  /* SmokeConfigAmount::Extreme */
+        );
+
+        static_assert(
+            (static_cast<int>(Smoke::SmokeConfigAmount::Extreme) + 1) == liveSmokesMax.size(),
+            "SmokeConfigAmount enum labels count should match liveSmokesMax");
+
+        static int getEmitInterval(
+            const int& nEmitInEveryNPhysicsIteration,
+            const float& fPosX,
+            const float& fPosY,
+            const float& fCamPosX,
+            const float& fCamPosY);
+
+        static size_t getLiveSmokesMax(const Smoke::SmokeConfigAmount& eSmokeConfigAmount);
+
+        // ---------------------------------------------------------------------------
+
+        SmokeBudget() = delete;
+
+    }; // class SmokeBudget
+
+} // namespace proofps_dd
@@ -0,0 +1,135 @@
+/*
+    ###################################################################################
+    SnapshotInterpolation.cpp
+    Client-side snapshot interpolation of remote entities for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <algorithm>
+
+#include "SnapshotInterpolation.h"
+
+
+// ############################### PUBLIC ################################
+
+
+/**
+* Drops all snapshots, e.g. when entity is respawned, so we don't interpolate between the old and the new spawn position.
+*/
+void proofps_dd::SnapshotInterpolation::clear()
+{
+    m_iOldest = 0;
+    m_nCount = 0;
+}
+
+/**
+* Stores a new snapshot.
+*
+* @return False if the given snapshot is not newer than the newest stored snapshot, in such case it is not stored.
+*/
+bool proofps_dd::SnapshotInterpolation::addSnapshot(const TimePoint& time, const PureVector& vecPos)
+{
+    if ((m_nCount > 0) && (time <= at(m_nCount - 1).m_time))
+    {
+        return false;
+    }
+
+    if (m_nCount == nCapacity)
+    {
+        m_iOldest = (m_iOldest + 1) % nCapacity;
+        --m_nCount;
+    }
+    m_snapshots[(m_iOldest + m_nCount) % nCapacity] = Snapshot{ time, vecPos };
+    ++m_nCount;
+    return true;
+}
+
+size_t proofps_dd::SnapshotInterpolation::size() const
+{
+    return m_nCount;
+}
+
+bool proofps_dd::SnapshotInterpolation::empty() const
+{
+    return m_nCount == 0;
+}
+
+/**
+* Calculates the position to be rendered at the given time.
+* The rendering time is expected to be behind the current time by the interpolation delay.
+*
+* @param timeRender The time we want to know the position at.
+* @param vecPos     Output: the interpolated or extrapolated position. Untouched if there is no snapshot.
+*
+* @return False if there is no snapshot, true otherwise.
+*/
+bool proofps_dd::SnapshotInterpolation::getPosition(const TimePoint& timeRender, PureVector& vecPos) const
+{
+    if (m_nCount == 0)
+    {
+        return false;
+    }
+
+    if ((m_nCount == 1) || (timeRender <= at(0).m_time))
+    {
+        vecPos = at(0).m_vecPos;
+        return true;
+    }
+
+    const Snapshot& snapNewest = at(m_nCount - 1);
+    if (timeRender >= snapNewest.m_time)
+    {
+        // Extrapolation based on the last 2 snapshots, limited in time.
+        // Server sends updates only about changes, so if there is still no newer snapshot after the extrapolation time, most probably
+        // the entity has simply stopped at the newest snapshot, so we move it back there during the same amount of time.
+        const Snapshot& snapPrev = at(m_nCount - 2);
+        const float fSecsSinceNewest = std::chrono::duration<float>(timeRender - snapNewest.m_time).count();
+        const float fExtrapolationMaxSecs = nExtrapolationMaxMillisecs / 1000.f;
+        const float fExtrapolationSecs =
+            (fSecsSinceNewest <= fExtrapolationMaxSecs) ?
+            fSecsSinceNewest :
+            std::max(0.f, 2 * fExtrapolationMaxSecs - fSecsSinceNewest);
+        const float fFactor = fExtrapolationSecs / std::chrono::duration<float>(snapNewest.m_time - snapPrev.m_time).count();
+        vecPos.Set(
+            snapNewest.m_vecPos.getX() + (snapNewest.m_vecPos.getX() - snapPrev.m_vecPos.getX()) * fFactor,
+            snapNewest.m_vecPos.getY() + (snapNewest.m_vecPos.getY() - snapPrev.m_vecPos.getY()) * fFactor,
+            snapNewest.m_vecPos.getZ() + (snapNewest.m_vecPos.getZ() - snapPrev.m_vecPos.getZ()) * fFactor);
+        return true;
+    }
+
+    // at this point we have at least 2 snapshots and timeRender is between the oldest and the newest
+    size_t iTo = 1;
+    while (at(iTo).m_time < timeRender)
+    {
+        ++iTo;
+    }
+    const Snapshot& snapFrom = at(iTo - 1);
+    const Snapshot& snapTo = at(iTo);
+    const float fFactor =
+        std::chrono::duration<float>(timeRender - snapFrom.m_time).count() /
+        std::chrono::duration<float>(snapTo.m_time - snapFrom.m_time).count();
+    vecPos.Set(
+        PFL::lerp(snapFrom.m_vecPos.getX(), snapTo.m_vecPos.getX(), fFactor),
+        PFL::lerp(snapFrom.m_vecPos.getY(), snapTo.m_vecPos.getY(), fFactor),
+        PFL::lerp(snapFrom.m_vecPos.getZ(), snapTo.m_vecPos.getZ(), fFactor));
+    return true;
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
+
+
+/**
+* @param i Index relative to the oldest snapshot, i.e. 0 is the oldest.
+*/
+const proofps_dd::SnapshotInterpolation::Snapshot& proofps_dd::SnapshotInterpolation::at(const size_t& i) const
+{
+    return m_snapshots[(m_iOldest + i) % nCapacity];
+}
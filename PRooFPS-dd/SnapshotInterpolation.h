@@ -0,0 +1,74 @@
+#pragma once
+
+/*
+    ###################################################################################
+    SnapshotInterpolation.h
+    Client-side snapshot interpolation of remote entities for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <array>
+#include <chrono>
+
+#include "PGE.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Timestamped positions of a remote entity received from server, so the client can render the entity at a position
+    * interpolated between 2 received positions, at a configurable delay behind the newest one.
+    * This way the entity moves smoothly even if server updates arrive less frequently than we render, or with some jitter.
+    *
+    * If the rendering time is beyond the newest snapshot (i.e. the next update is late or lost), the position is extrapolated
+    * based on the last 2 snapshots, but only for a short time, after that the entity is moved back to the newest snapshot, since
+    * server doesn't send updates about stationary entities.
+    *
+    * Stores a fixed number of snapshots, the oldest one is overwritten by the newest one when full.
+    */
+    class SnapshotInterpolation
+    {
+    public:
+
+        using TimePoint = std::chrono::steady_clock::time_point;
+
+        static constexpr char* szCVarClInterpDelayMillisecs = "cl_interp_delay_ms";
+        static constexpr unsigned int nInterpDelayMillisecsDef = 100;   /**< 0 means interpolation is disabled, received positions are applied immediately. */
+        static constexpr unsigned int nInterpDelayMillisecsMax = 1000;
+        static constexpr unsigned int nExtrapolationMaxMillisecs = 50;  /**< Enough for covering 1 lost update at 20 Hz cl_updaterate. */
+        static constexpr size_t nCapacity = 32;
+
+        // ---------------------------------------------------------------------------
+
+        SnapshotInterpolation() = default;
+
+        void clear();
+        bool addSnapshot(const TimePoint& time, const PureVector& vecPos);
+        size_t size() const;
+        bool empty() const;
+
+        bool getPosition(const TimePoint& timeRender, PureVector& vecPos) const;
+
+    protected:
+
+    private:
+
+        struct Snapshot
+        {
+            TimePoint m_time;
+            PureVector m_vecPos;
+        };
+
+        const Snapshot& at(const size_t& i) const;
+
+        // ---------------------------------------------------------------------------
+
+        std::array<Snapshot, nCapacity> m_snapshots;
+        size_t m_iOldest = 0;
+        size_t m_nCount = 0;
+
+    }; // class SnapshotInterpolation
+
+} // namespace proofps_dd
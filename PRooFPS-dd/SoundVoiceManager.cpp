@@ -0,0 +1,173 @@
+/*
+    ###################################################################################
+    SoundVoiceManager.cpp
+    Limiting concurrent 3D sound voices for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <cassert>
+
+#include "SoundVoiceManager.h"
+
+
+// ############################### PUBLIC ################################
+
+
+const char* proofps_dd::SoundVoiceManager::getLoggerModuleName()
+{
+    return "SoundVoiceManager";
+}
+
+proofps_dd::SoundVoiceManager::SoundVoiceManager()
+{
+    for (size_t i = 0; i < m_voices.size(); i++)
+    {
+        m_voices[i].reserve(maxVoicesPerSoundClass[i]);
+    }
+}
+
+CConsole& proofps_dd::SoundVoiceManager::getConsole() const
+{
+    return CConsole::getConsoleInstance(getLoggerModuleName());
+}
+
+/**
+* Decides if a new voice of the given class can be started, and if needed, stops a voice of the same class to make room for it.
+*
+* @param fDistanceToListener Distance of the sound source from the 3D listener.
+* @param fCullDistance       3D max distance of the voice to be started, the voice is not audible farther than this.
+*
+* @return True if the caller can start the new voice and add it by addVoice(), false if the new voice shall not be started.
+*/
+bool proofps_dd::SoundVoiceManager::reserveVoice(
+    SoLoud::Soloud& audioEngineCore,
+    const SoundClass& eSoundClass,
+    const float& fDistanceToListener,
+    const float& fCullDistance)
+{
+    if (!(fDistanceToListener <= fCullDistance) /* NaN distance is also culled */)
+    {
+        m_nCulledCount++;
+        return false;
+    }
+
+    const size_t iClass = static_cast<size_t>(eSoundClass);
+    assert(iClass < m_voices.size());
+    auto& vecVoices = m_voices[iClass];
+    if (vecVoices.size() < maxVoicesPerSoundClass[iClass])
+    {
+        return true;
+    }
+
+    removeFinishedVoices(audioEngineCore, eSoundClass);
+    if (vecVoices.size() < maxVoicesPerSoundClass[iClass])
+    {
+        return true;
+    }
+
+    if (vecVoices.empty())
+    {
+        // class is disabled by 0 max voices
+        m_nRejectedCount++;
+        return false;
+    }
+
+    size_t iVictim = 0;
+    for (size_t i = 1; i < vecVoices.size(); i++)
+    {
+        if ((vecVoices[i].m_fDistanceToListener > vecVoices[iVictim].m_fDistanceToListener) ||
+            ((vecVoices[i].m_fDistanceToListener == vecVoices[iVictim].m_fDistanceToListener) &&
+             (vecVoices[i].m_nSequence < vecVoices[iVictim].m_nSequence)))
+        {
+            iVictim = i;
+        }
+    }
+
+    if (fDistanceToListener > vecVoices[iVictim].m_fDistanceToListener)
+    {
+        m_nRejectedCount++;
+        return false;
+    }
+
+    audioEngineCore.stop(vecVoices[iVictim].m_handle);
+    vecVoices[iVictim] = vecVoices.back();
+    vecVoices.pop_back();
+    m_nStolenCount++;
+    return true;
+}
+
+/**
+* To be invoked with the voice just started after reserveVoice() returned true.
+*/
+void proofps_dd::SoundVoiceManager::addVoice(
+    const SoundClass& eSoundClass,
+    const SoLoud::handle& handle,
+    const float& fDistanceToListener)
+{
+    const size_t iClass = static_cast<size_t>(eSoundClass);
+    assert(iClass < m_voices.size());
+    if (handle == 0)
+    {
+        // audio engine could not start the voice
+        return;
+    }
+
+    auto& vecVoices = m_voices[iClass];
+    if (vecVoices.size() >= maxVoicesPerSoundClass[iClass])
+    {
+        getConsole().EOLn("SoundVoiceManager::%s(): class %u is full, reserveVoice() should have been invoked first!", __func__, static_cast<unsigned int>(iClass));
+        assert(false);
+        return;
+    }
+
+    vecVoices.push_back(Voice{ handle, fDistanceToListener, m_nSequence++ });
+}
+
+/**
+* @return Number of voices of the given class still playing.
+*/
+size_t proofps_dd::SoundVoiceManager::getVoiceCount(SoLoud::Soloud& audioEngineCore, const SoundClass& eSoundClass)
+{
+    removeFinishedVoices(audioEngineCore, eSoundClass);
+    return m_voices[static_cast<size_t>(eSoundClass)].size();
+}
+
+const size_t& proofps_dd::SoundVoiceManager::getCulledCount() const
+{
+    return m_nCulledCount;
+}
+
+const size_t& proofps_dd::SoundVoiceManager::getRejectedCount() const
+{
+    return m_nRejectedCount;
+}
+
+const size_t& proofps_dd::SoundVoiceManager::getStolenCount() const
+{
+    return m_nStolenCount;
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
+
+
+void proofps_dd::SoundVoiceManager::removeFinishedVoices(SoLoud::Soloud& audioEngineCore, const SoundClass& eSoundClass)
+{
+    auto& vecVoices = m_voices[static_cast<size_t>(eSoundClass)];
+    size_t iDst = 0;
+    for (size_t iSrc = 0; iSrc < vecVoices.size(); iSrc++)
+    {
+        if (audioEngineCore.isValidVoiceHandle(vecVoices[iSrc].m_handle))
+        {
+            vecVoices[iDst++] = vecVoices[iSrc];
+        }
+    }
+    vecVoices.resize(iDst);
+}
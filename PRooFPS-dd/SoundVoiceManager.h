@@ -0,0 +1,114 @@
+#pragma once
+
+/*
+    ###################################################################################
+    SoundVoiceManager.h
+    Limiting concurrent 3D sound voices for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "CConsole.h"
+
+// not nice, included only for the SoLoud headers
+#include "PGE.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Decides if a new 3D voice of frequently played sounds shall be started at all, so a storm of bullet bounces or shots
+    * cannot flood the audio engine with voices, which would increase mixing time.
+    *
+    * A voice is not started if it would be culled anyway by its 3D max distance. Every sound class has its own limit of
+    * concurrent voices; when a class is full, the farthest voice of the class (the oldest one among equally far voices)
+    * is stopped for the new voice, unless the new voice is even farther, in which case the new voice is rejected.
+    *
+    * It does not start voices itself, the caller shall start the voice after reserveVoice() returned true, then add it with addVoice().
+    * Voices finished on their own are detected using the audio engine when a class is full.
+    * The audio engine is passed to the functions, because it might not be initialized yet when this is constructed.
+    */
+    class SoundVoiceManager
+    {
+    public:
+
+        enum class SoundClass
+        {
+            WeaponFire = 0,
+            BulletBounce,
+            MeleeHit
+        };
+
+        /**
+        * Max concurrent voices per SoundClass.
+        * Shots of up to 8 players in a close fight can be heard at once, bounces and melee hits are less important.
+        */
+        static constexpr auto maxVoicesPerSoundClass = PFL::std_array_of<size_t>(
+            static_cast<size_t>(8), /* SoundClass::WeaponFire */
+            static_cast<size_t>(6), /* SoundClass::BulletBounce */
+            static_cast<size_t>(4)  /* SoundClass::MeleeHit */
+        );
+
+        static_assert(
+            (static_cast<int>(SoundClass::MeleeHit) + 1) == maxVoicesPerSoundClass.size(),
+            "SoundClass enum labels count should match maxVoicesPerSoundClass");
+
+        static const char* getLoggerModuleName();          /**< Returns the logger module name of this class. */
+
+        // ---------------------------------------------------------------------------
+
+        SoundVoiceManager();
+
+        SoundVoiceManager(const SoundVoiceManager&) = delete;
+        SoundVoiceManager& operator=(const SoundVoiceManager&) = delete;
+        SoundVoiceManager(SoundVoiceManager&&) = delete;
+        SoundVoiceManager&& operator=(SoundVoiceManager&&) = delete;
+
+        CConsole& getConsole() const;                      /**< Returns access to console preset with logger module name as this class. */
+
+        bool reserveVoice(
+            SoLoud::Soloud& audioEngineCore,
+            const SoundClass& eSoundClass,
+            const float& fDistanceToListener,
+            const float& fCullDistance);
+        void addVoice(
+            const SoundClass& eSoundClass,
+            const SoLoud::handle& handle,
+            const float& fDistanceToListener);
+
+        size_t getVoiceCount(SoLoud::Soloud& audioEngineCore, const SoundClass& eSoundClass);
+        const size_t& getCulledCount() const;
+        const size_t& getRejectedCount() const;
+        const size_t& getStolenCount() const;
+
+    protected:
+
+    private:
+
+        struct Voice
+        {
+            SoLoud::handle m_handle;
+            float m_fDistanceToListener;
+            std::uint32_t m_nSequence;     /**< Increasing with every added voice, for finding the oldest one. */
+        };
+
+        // ---------------------------------------------------------------------------
+
+        std::array<std::vector<Voice>, maxVoicesPerSoundClass.size()> m_voices;  /**< Indexed by SoundClass, voices maybe not yet known to be finished. */
+        std::uint32_t m_nSequence = 0;
+        size_t m_nCulledCount = 0;    /**< Voices not started because they would be too far from the listener. */
+        size_t m_nRejectedCount = 0;  /**< Voices not started because their class was full with closer voices. */
+        size_t m_nStolenCount = 0;    /**< Voices stopped to make room for a closer voice. */
+
+        // ---------------------------------------------------------------------------
+
+        void removeFinishedVoices(SoLoud::Soloud& audioEngineCore, const SoundClass& eSoundClass);
+
+    }; // class SoundVoiceManager
+
+} // namespace proofps_dd
@@ -0,0 +1,121 @@
+#pragma once
+
+/*
+    ###################################################################################
+    SpscQueue.h
+    Lock-free single-producer single-consumer queue for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <atomic>
+#include <vector>
+
+namespace proofps_dd
+{
+
+    /**
+    * Fixed-capacity lock-free ring buffer for exactly 1 producer thread and exactly 1 consumer thread.
+    * push() shall be invoked only by the producer, pop() shall be invoked only by the consumer.
+    * Producer and consumer can also be the same thread.
+    * Capacity is rounded up to power of 2 so we can index with a mask instead of modulo.
+    * Elements are copied in and out, so T shall be cheap enough to copy, and default constructible.
+    */
+    template <class T>
+    class SpscQueue
+    {
+    public:
+
+        static size_t roundUpToPowerOf2(const size_t& n)
+        {
+            size_t nRes = 2;
+            while (nRes < n)
+            {
+                nRes <<= 1;
+            }
+            return nRes;
+        }
+
+        // ---------------------------------------------------------------------------
+
+        explicit SpscQueue(const size_t& nCapacity) :
+            m_nMask(roundUpToPowerOf2(nCapacity) - 1),
+            m_vecItems(m_nMask + 1)
+        {}
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+        SpscQueue(SpscQueue&&) = delete;
+        SpscQueue&& operator=(SpscQueue&&) = delete;
+
+        size_t capacity() const
+        {
+            return m_nMask + 1;
+        }
+
+        /**
+        * Approximate number of elements, exact only if neither the producer nor the consumer is active at the moment.
+        */
+        size_t size() const
+        {
+            return m_nTail.load(std::memory_order_acquire) - m_nHead.load(std::memory_order_acquire);
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /**
+        * Producer only.
+        * @return False if the queue is full, in such case the element is not stored.
+        */
+        bool push(const T& item)
+        {
+            const size_t nTail = m_nTail.load(std::memory_order_relaxed);
+            if ((nTail - m_nHead.load(std::memory_order_acquire)) > m_nMask)
+            {
+                return false;
+            }
+            m_vecItems[nTail & m_nMask] = item;
+            m_nTail.store(nTail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+        * Consumer only.
+        * @return False if the queue is empty, in such case item is not touched.
+        */
+        bool pop(T& item)
+        {
+            const size_t nHead = m_nHead.load(std::memory_order_relaxed);
+            if (nHead == m_nTail.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            item = m_vecItems[nHead & m_nMask];
+            m_nHead.store(nHead + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+        * Consumer only. Drops all elements currently in the queue.
+        */
+        void clear()
+        {
+            m_nHead.store(m_nTail.load(std::memory_order_acquire), std::memory_order_release);
+        }
+
+    private:
+
+        const size_t m_nMask;
+        std::vector<T> m_vecItems;
+
+        // head and tail are written by different threads, keep them on different cache lines to avoid false sharing
+        alignas(64) std::atomic<size_t> m_nHead{ 0 };  /**< Next element to be popped, written only by the consumer. */
+        alignas(64) std::atomic<size_t> m_nTail{ 0 };  /**< Next free slot to be pushed to, written only by the producer. */
+
+    }; // class SpscQueue
+
+} // namespace proofps_dd
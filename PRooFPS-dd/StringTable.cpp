@@ -0,0 +1,205 @@
+/*
+    ###################################################################################
+    StringTable.cpp
+    Session-wide table of strings referred to by small ids in network messages for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <cassert>
+
+#include "StringTable.h"
+#include "MsgTrafficStats.h"
+#include "PRooFPS-dd-packet.h"
+
+
+// ############################### PUBLIC ################################
+
+
+const char* proofps_dd::StringTable::getLoggerModuleName()
+{
+    return "StringTable";
+}
+
+/**
+* The table used by the game, so any code having access to the network can refer to strings by ids.
+*/
+proofps_dd::StringTable& proofps_dd::StringTable::getInstance()
+{
+    static StringTable instance;
+    return instance;
+}
+
+/**
+* Server-only.
+* Returns the id of the given string. If the string is not yet in the table, adds it and announces it to all clients, so the
+* returned id can be put into the next message to any client.
+*
+* @return Id of the given string, or InvalidStringId if the string is too long or the table is full.
+*/
+proofps_dd::StringTable::StringId proofps_dd::StringTable::serverIntern(
+    pge_network::PgeINetwork& network,
+    const std::string& str)
+{
+    bool bAdded = false;
+    const StringId id = getInstance().intern(str, bAdded);
+    if (!bAdded)
+    {
+        return id;
+    }
+
+    pge_network::PgePacket pkt;
+    if (!proofps_dd::MsgStringTableEntryFromServer::initPkt(pkt, id, str))
+    {
+        getInstance().getConsole().EOLn("StringTable::%s(): initPkt() FAILED at line %d!", __func__, __LINE__);
+        assert(false);
+        return InvalidStringId;
+    }
+    MsgTrafficStats::serverSendToAllClientsExcept(network, pkt);
+    return id;
+}
+
+/**
+* Server-only.
+* Sends all entries to the given client. Shall be invoked for a connecting client before sending any message referring to ids.
+*/
+bool proofps_dd::StringTable::serverSendAllEntries(
+    pge_network::PgeINetwork& network,
+    const pge_network::PgeNetworkConnectionHandle& connHandle)
+{
+    const StringTable& table = getInstance();
+    for (size_t i = 0; i < table.m_vecStrings.size(); i++)
+    {
+        pge_network::PgePacket pkt;
+        if (!proofps_dd::MsgStringTableEntryFromServer::initPkt(pkt, static_cast<StringId>(i + 1), table.m_vecStrings[i]))
+        {
+            table.getConsole().EOLn("StringTable::%s(): initPkt() FAILED at line %d!", __func__, __LINE__);
+            assert(false);
+            return false;
+        }
+        MsgTrafficStats::serverSend(network, pkt, connHandle);
+    }
+    return true;
+}
+
+CConsole& proofps_dd::StringTable::getConsole() const
+{
+    return CConsole::getConsoleInstance(getLoggerModuleName());
+}
+
+void proofps_dd::StringTable::clear()
+{
+    m_vecStrings.clear();
+    m_mapStringToId.clear();
+}
+
+size_t proofps_dd::StringTable::size() const
+{
+    return m_vecStrings.size();
+}
+
+/**
+* Returns the id of the given string, adding it to the table if not yet there.
+*
+* @param bAdded Set to true if the string has just been added, false otherwise.
+*
+* @return Id of the given string, or InvalidStringId if the string is too long or the table is full.
+*/
+proofps_dd::StringTable::StringId proofps_dd::StringTable::intern(const std::string& str, bool& bAdded)
+{
+    bAdded = false;
+    const StringId idExisting = find(str);
+    if (idExisting != InvalidStringId)
+    {
+        return idExisting;
+    }
+
+    if (str.empty() || (str.length() >= nStringBufferLength))
+    {
+        getConsole().EOLn("StringTable::%s(): invalid length: %u of string: %s!", __func__, str.length(), str.c_str());
+        return InvalidStringId;
+    }
+
+    if (m_vecStrings.size() >= nStringsMaxCount)
+    {
+        getConsole().EOLn("StringTable::%s(): table is full, cannot add: %s!", __func__, str.c_str());
+        return InvalidStringId;
+    }
+
+    m_vecStrings.push_back(str);
+    const StringId id = static_cast<StringId>(m_vecStrings.size());
+    m_mapStringToId[str] = id;
+    bAdded = true;
+    return id;
+}
+
+/**
+* Adds the given entry with the given id, as assigned by server. Overwrites the entry if it already exists with the same id.
+*
+* @return False if the entry is invalid, true otherwise.
+*/
+bool proofps_dd::StringTable::add(const StringId& id, const std::string& str)
+{
+    if ((id == InvalidStringId) || str.empty() || (str.length() >= nStringBufferLength))
+    {
+        getConsole().EOLn("StringTable::%s(): invalid entry: %u: %s!", __func__, id, str.c_str());
+        return false;
+    }
+
+    if (m_vecStrings.size() < id)
+    {
+        m_vecStrings.resize(id);
+    }
+
+    std::string& sEntry = m_vecStrings[id - 1];
+    if (!sEntry.empty())
+    {
+        const auto it = m_mapStringToId.find(sEntry);
+        if ((it != m_mapStringToId.end()) && (it->second == id))
+        {
+            m_mapStringToId.erase(it);
+        }
+    }
+    sEntry = str;
+    m_mapStringToId[str] = id;
+    return true;
+}
+
+/**
+* @return Id of the given string, or InvalidStringId if not in the table.
+*/
+proofps_dd::StringTable::StringId proofps_dd::StringTable::find(const std::string& str) const
+{
+    const auto it = m_mapStringToId.find(str);
+    return (it == m_mapStringToId.end()) ? InvalidStringId : it->second;
+}
+
+/**
+* @return The string having the given id, or empty string if not in the table.
+*/
+const std::string& proofps_dd::StringTable::getString(const StringId& id) const
+{
+    static const std::string sEmpty;
+    return ((id == InvalidStringId) || (id > m_vecStrings.size())) ? sEmpty : m_vecStrings[id - 1];
+}
+
+bool proofps_dd::StringTable::clientHandleStringTableEntryFromServer(const MsgStringTableEntryFromServer& msg)
+{
+    // make sure the received string is null-terminated, someone else could had sent that, e.g. malicious server
+    const std::string str(msg.m_szString, strnlen(msg.m_szString, sizeof(msg.m_szString)));
+    if (!add(msg.m_nStringId, str))
+    {
+        // not fatal, a message referring to this id will fail to be handled anyway
+        getConsole().EOLn("StringTable::%s(): failed to add entry: %u: %s!", __func__, msg.m_nStringId, str.c_str());
+    }
+    return true;
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
@@ -0,0 +1,91 @@
+#pragma once
+
+/*
+    ###################################################################################
+    StringTable.h
+    Session-wide table of strings referred to by small ids in network messages for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CConsole.h"
+
+#include "PGE.h"
+
+namespace proofps_dd
+{
+
+    struct MsgStringTableEntryFromServer;
+
+    /**
+    * Strings like weapon and map filenames are not carried by messages, instead messages refer to them by small ids
+    * assigned by server.
+    *
+    * Server interns a string when it is first referred to by an outgoing message, and announces the new entry to all clients
+    * with MsgStringTableEntryFromServer. A connecting client receives all existing entries before any other message.
+    * Since these are reliable messages, a client always knows a string by the time it receives an id referring to it.
+    * Ids are valid for the whole session, i.e. until networking is reinitialized, and on client side until disconnecting.
+    *
+    * Player names are not interned: a player name is sent to each client once per name change, so interning would not save
+    * anything but it would need an extra message.
+    *
+    * Not thread-safe: all functions shall be invoked from the main thread.
+    */
+    class StringTable
+    {
+    public:
+
+        using StringId = std::uint16_t;
+
+        static constexpr StringId InvalidStringId = 0;
+        static constexpr size_t nStringBufferLength = 64;  /**< Max string length including terminating zero. */
+        static constexpr size_t nStringsMaxCount = UINT16_MAX;
+
+        static const char* getLoggerModuleName();
+        static StringTable& getInstance();
+
+        static StringId serverIntern(
+            pge_network::PgeINetwork& network,
+            const std::string& str);
+        static bool serverSendAllEntries(
+            pge_network::PgeINetwork& network,
+            const pge_network::PgeNetworkConnectionHandle& connHandle);
+
+        // ---------------------------------------------------------------------------
+
+        CConsole& getConsole() const;
+
+        StringTable() = default;
+
+        StringTable(const StringTable&) = delete;
+        StringTable& operator=(const StringTable&) = delete;
+        StringTable(StringTable&&) = delete;
+        StringTable&& operator=(StringTable&&) = delete;
+
+        void clear();
+        size_t size() const;
+
+        StringId intern(const std::string& str, bool& bAdded);
+        bool add(const StringId& id, const std::string& str);
+
+        StringId find(const std::string& str) const;
+        const std::string& getString(const StringId& id) const;
+
+        bool clientHandleStringTableEntryFromServer(const MsgStringTableEntryFromServer& msg);
+
+    protected:
+
+    private:
+
+        std::vector<std::string> m_vecStrings;                      /**< Index is id - 1. */
+        std::unordered_map<std::string, StringId> m_mapStringToId;
+
+    }; // class StringTable
+
+} // namespace proofps_dd
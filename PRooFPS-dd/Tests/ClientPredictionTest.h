@@ -0,0 +1,209 @@
+#pragma once
+
+/*
+    ###################################################################################
+    ClientPredictionTest.h
+    Unit test for PRooFPS-dd ClientPrediction.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "UnitTest.h"
+
+#include "ClientPrediction.h"
+
+class ClientPredictionTest :
+    public UnitTest
+{
+public:
+
+    ClientPredictionTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    ClientPredictionTest(const ClientPredictionTest&) = delete;
+    ClientPredictionTest& operator=(const ClientPredictionTest&) = delete;
+    ClientPredictionTest(ClientPredictionTest&&) = delete;
+    ClientPredictionTest& operator=(ClientPredictionTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&ClientPredictionTest::test_initial_values);
+        addSubTest("test_add_step", (PFNUNITSUBTEST)&ClientPredictionTest::test_add_step);
+        addSubTest("test_add_step_limited", (PFNUNITSUBTEST)&ClientPredictionTest::test_add_step_limited);
+        addSubTest("test_reconcile_older_cmds", (PFNUNITSUBTEST)&ClientPredictionTest::test_reconcile_older_cmds);
+        addSubTest("test_reconcile_iterations_of_acked_cmd", (PFNUNITSUBTEST)&ClientPredictionTest::test_reconcile_iterations_of_acked_cmd);
+        addSubTest("test_reconcile_vertical", (PFNUNITSUBTEST)&ClientPredictionTest::test_reconcile_vertical);
+        addSubTest("test_reconcile_stale_ack", (PFNUNITSUBTEST)&ClientPredictionTest::test_reconcile_stale_ack);
+        addSubTest("test_reconcile_seq_wraparound", (PFNUNITSUBTEST)&ClientPredictionTest::test_reconcile_seq_wraparound);
+        addSubTest("test_reconcile_run_toggles", (PFNUNITSUBTEST)&ClientPredictionTest::test_reconcile_run_toggles);
+        addSubTest("test_reset", (PFNUNITSUBTEST)&ClientPredictionTest::test_reset);
+    }
+
+private:
+
+    bool test_initial_values()
+    {
+        const proofps_dd::ClientPrediction cp;
+
+        return (assertEquals(0u, cp.getUnackedStepCount(), "step count") &
+            assertEquals(0.f, cp.getUnackedDeltaX(), "delta x") &
+            assertEquals(0.f, cp.getUnackedDeltaY(), "delta y") &
+            assertEquals(0u, cp.getUnackedRunToggleCount(), "run toggle count") &
+            assertTrue(cp.getPredictedRunning(true), "running")) != 0;
+    }
+
+    bool test_add_step()
+    {
+        proofps_dd::ClientPrediction cp;
+        cp.addStep(1, 0.25f, 0.f);
+        cp.addStep(1, 0.25f, 0.f);
+        cp.addStep(2, -0.5f, 0.f);
+        cp.addStep(2, 0.f, 0.f);
+
+        return (assertEquals(4u, cp.getUnackedStepCount(), "step count") &
+            assertEquals(0.f, cp.getUnackedDeltaX(), "delta")) != 0;
+    }
+
+    bool test_add_step_limited()
+    {
+        proofps_dd::ClientPrediction cp;
+        for (size_t i = 0; i < proofps_dd::ClientPrediction::nMaxUnackedSteps + 10; i++)
+        {
+            cp.addStep(1, 1.f, 0.f);
+        }
+
+        return (assertEquals(proofps_dd::ClientPrediction::nMaxUnackedSteps, cp.getUnackedStepCount(), "step count") &
+            assertEquals(static_cast<float>(proofps_dd::ClientPrediction::nMaxUnackedSteps), cp.getUnackedDeltaX(), "delta")) != 0;
+    }
+
+    bool test_reconcile_older_cmds()
+    {
+        proofps_dd::ClientPrediction cp;
+        cp.addStep(1, 1.f, 0.f);
+        cp.addStep(1, 1.f, 0.f);
+        cp.addStep(2, 2.f, 0.f);
+        cp.addStep(3, 4.f, 0.f);
+
+        // server processed cmd 2 but did not simulate anything after it yet
+        cp.reconcile(2, 0);
+
+        return (assertEquals(2u, cp.getUnackedStepCount(), "step count") &
+            assertEquals(6.f, cp.getUnackedDeltaX(), "delta")) != 0;
+    }
+
+    bool test_reconcile_iterations_of_acked_cmd()
+    {
+        proofps_dd::ClientPrediction cp;
+        cp.addStep(5, 1.f, 0.f);
+        cp.addStep(5, 2.f, 0.f);
+        cp.addStep(5, 4.f, 0.f);
+        cp.addStep(5, 8.f, 0.f);
+
+        cp.reconcile(5, 2);
+        bool b = assertEquals(12.f, cp.getUnackedDeltaX(), "delta 1");
+        b &= assertEquals(2u, cp.getUnackedStepCount(), "step count 1");
+
+        // server simulated more iterations than we did, nothing remains to replay
+        cp.reconcile(5, 10);
+        b &= assertEquals(0.f, cp.getUnackedDeltaX(), "delta 2");
+        b &= assertEquals(0u, cp.getUnackedStepCount(), "step count 2");
+
+        return b;
+    }
+
+    bool test_reconcile_vertical()
+    {
+        proofps_dd::ClientPrediction cp;
+        cp.addStep(1, 0.f, 0.5f);   // jumped
+        cp.addStep(1, 0.25f, 0.25f);
+        cp.addStep(2, 0.25f, -0.25f);
+        cp.addStep(2, 0.f, -0.5f);  // falling
+
+        cp.reconcile(1, 1);
+        bool b = assertEquals(3u, cp.getUnackedStepCount(), "step count 1");
+        b &= assertEquals(0.5f, cp.getUnackedDeltaX(), "delta x 1");
+        b &= assertEquals(-0.5f, cp.getUnackedDeltaY(), "delta y 1");
+
+        cp.reconcile(2, 1);
+        b &= assertEquals(1u, cp.getUnackedStepCount(), "step count 2");
+        b &= assertEquals(0.f, cp.getUnackedDeltaX(), "delta x 2");
+        b &= assertEquals(-0.5f, cp.getUnackedDeltaY(), "delta y 2");
+
+        return b;
+    }
+
+    bool test_reconcile_stale_ack()
+    {
+        proofps_dd::ClientPrediction cp;
+        cp.addStep(3, 1.f, 0.f);
+        cp.addStep(4, 1.f, 0.f);
+
+        cp.reconcile(4, 0);
+        // an older ack must not bring back or drop anything
+        cp.reconcile(3, 5);
+
+        return (assertEquals(1u, cp.getUnackedStepCount(), "step count") &
+            assertEquals(1.f, cp.getUnackedDeltaX(), "delta")) != 0;
+    }
+
+    bool test_reconcile_seq_wraparound()
+    {
+        proofps_dd::ClientPrediction cp;
+        cp.addStep(0xFFFFFFFFu, 1.f, 0.f);
+        cp.addStep(1, 2.f, 0.f);  // 0 is skipped by sender
+
+        cp.reconcile(1, 0);
+
+        return (assertEquals(1u, cp.getUnackedStepCount(), "step count") &
+            assertEquals(2.f, cp.getUnackedDeltaX(), "delta")) != 0;
+    }
+
+    bool test_reconcile_run_toggles()
+    {
+        proofps_dd::ClientPrediction cp;
+        cp.addRunToggle(2);
+        cp.addRunToggle(5);
+
+        // both toggles unacked: server state is still the state before the 1st toggle
+        bool b = assertFalse(cp.getPredictedRunning(false), "predicted 1");
+        b &= assertEquals(2u, cp.getUnackedRunToggleCount(), "run toggle count 1");
+
+        // server processed cmd 2 but might have rejected its toggle, we go with the authoritative state + toggle of cmd 5
+        cp.reconcile(2, 0);
+        b &= assertEquals(1u, cp.getUnackedRunToggleCount(), "run toggle count 2");
+        b &= assertTrue(cp.getPredictedRunning(false), "predicted 2a");
+        b &= assertFalse(cp.getPredictedRunning(true), "predicted 2b");
+
+        // stale ack does not bring back anything
+        cp.reconcile(1, 0);
+        b &= assertEquals(1u, cp.getUnackedRunToggleCount(), "run toggle count 3");
+
+        cp.reconcile(5, 0);
+        b &= assertEquals(0u, cp.getUnackedRunToggleCount(), "run toggle count 4");
+        b &= assertFalse(cp.getPredictedRunning(false), "predicted 4a");
+        b &= assertTrue(cp.getPredictedRunning(true), "predicted 4b");
+
+        return b;
+    }
+
+    bool test_reset()
+    {
+        proofps_dd::ClientPrediction cp;
+        cp.addStep(1, 1.f, -1.f);
+        cp.addStep(2, 1.f, -1.f);
+        cp.addRunToggle(2);
+        cp.reset();
+
+        return (assertEquals(0u, cp.getUnackedStepCount(), "step count") &
+            assertEquals(0.f, cp.getUnackedDeltaX(), "delta x") &
+            assertEquals(0.f, cp.getUnackedDeltaY(), "delta y") &
+            assertEquals(0u, cp.getUnackedRunToggleCount(), "run toggle count")) != 0;
+    }
+
+};
@@ -0,0 +1,266 @@
+#pragma once
+
+/*
+    ###################################################################################
+    ClockSyncTest.h
+    Unit test for PRooFPS-dd ClockSync.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "UnitTest.h"
+
+#include "ClockSync.h"
+
+class ClockSyncTest :
+    public UnitTest
+{
+public:
+
+    ClockSyncTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    ClockSyncTest(const ClockSyncTest&) = delete;
+    ClockSyncTest& operator=(const ClockSyncTest&) = delete;
+    ClockSyncTest(ClockSyncTest&&) = delete;
+    ClockSyncTest& operator=(ClockSyncTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&ClockSyncTest::test_initial_values);
+        addSubTest("test_add_client_timestamp_ignores_zero", (PFNUNITSUBTEST)&ClockSyncTest::test_add_client_timestamp_ignores_zero);
+        addSubTest("test_clock_offset_is_min_offset", (PFNUNITSUBTEST)&ClockSyncTest::test_clock_offset_is_min_offset);
+        addSubTest("test_clock_offset_wraparound", (PFNUNITSUBTEST)&ClockSyncTest::test_clock_offset_wraparound);
+        addSubTest("test_jitter", (PFNUNITSUBTEST)&ClockSyncTest::test_jitter);
+        addSubTest("test_drift", (PFNUNITSUBTEST)&ClockSyncTest::test_drift);
+        addSubTest("test_rtt", (PFNUNITSUBTEST)&ClockSyncTest::test_rtt);
+        addSubTest("test_rtt_ignores_invalid_samples", (PFNUNITSUBTEST)&ClockSyncTest::test_rtt_ignores_invalid_samples);
+        addSubTest("test_to_server_time", (PFNUNITSUBTEST)&ClockSyncTest::test_to_server_time);
+        addSubTest("test_client_interval", (PFNUNITSUBTEST)&ClockSyncTest::test_client_interval);
+        addSubTest("test_client_interval_insane_drift_uses_arrival", (PFNUNITSUBTEST)&ClockSyncTest::test_client_interval_insane_drift_uses_arrival);
+        addSubTest("test_reset", (PFNUNITSUBTEST)&ClockSyncTest::test_reset);
+    }
+
+private:
+
+    bool test_initial_values()
+    {
+        const proofps_dd::ClockSync cs;
+
+        return (assertFalse(cs.isSynced(), "synced") &
+            assertEquals(0.f, cs.getClockDriftPpm(), "drift") &
+            assertEquals(0.f, cs.getJitterMillisecs(), "jitter") &
+            assertFalse(cs.hasRtt(), "has rtt") &
+            assertEquals(0.f, cs.getRttMillisecs(), "rtt") &
+            assertTrue(proofps_dd::ClockSync::TimePoint{} == cs.toServerTime(1000), "to server time")) != 0;
+    }
+
+    bool test_add_client_timestamp_ignores_zero()
+    {
+        proofps_dd::ClockSync cs;
+        cs.addClientTimestamp(0, std::chrono::steady_clock::now());
+
+        return assertFalse(cs.isSynced(), "synced");
+    }
+
+    bool test_clock_offset_is_min_offset()
+    {
+        proofps_dd::ClockSync cs;
+        const auto t0 = std::chrono::steady_clock::now();
+        const std::int32_t nExpectedOffset = static_cast<std::int32_t>(proofps_dd::ClockSync::toMillisecs32(t0) - 1000u);
+
+        cs.addClientTimestamp(1000, t0);
+        bool b = assertTrue(cs.isSynced(), "synced");
+        b &= assertEquals(nExpectedOffset, static_cast<std::int32_t>(cs.getClockOffsetMillisecs()), "offset 1");
+
+        // delayed more than the first one
+        cs.addClientTimestamp(1100, t0 + std::chrono::milliseconds(130));
+        b &= assertEquals(nExpectedOffset, static_cast<std::int32_t>(cs.getClockOffsetMillisecs()), "offset 2");
+
+        // delayed less than the first one
+        cs.addClientTimestamp(1200, t0 + std::chrono::milliseconds(190));
+        b &= assertEquals(nExpectedOffset - 10, static_cast<std::int32_t>(cs.getClockOffsetMillisecs()), "offset 3");
+
+        return b;
+    }
+
+    bool test_clock_offset_wraparound()
+    {
+        proofps_dd::ClockSync cs;
+        const auto t0 = std::chrono::steady_clock::now();
+        const std::uint32_t nClientTime0 = UINT32_MAX - 49;
+
+        cs.addClientTimestamp(nClientTime0, t0);
+        cs.addClientTimestamp(nClientTime0 + 100 /* wraps around */, t0 + std::chrono::milliseconds(90));
+
+        // min offset decreased by 10 ms since the 2nd message took 10 ms less than the 1st message
+        return assertTrue(
+            std::chrono::milliseconds(90) ==
+            std::chrono::duration_cast<std::chrono::milliseconds>(cs.toServerTime(nClientTime0 + 100) - t0), "to server time");
+    }
+
+    bool test_jitter()
+    {
+        proofps_dd::ClockSync cs;
+        const auto t0 = std::chrono::steady_clock::now();
+
+        // constant delay, no jitter
+        for (unsigned int i = 0; i < 10; i++)
+        {
+            cs.addClientTimestamp(1000 + i * 16, t0 + std::chrono::milliseconds(i * 16));
+        }
+        bool b = assertEquals(0.f, cs.getJitterMillisecs(), 0.001f, "jitter 1");
+
+        // delay alternating between 0 and 10 ms, jitter converges to 10 ms
+        for (unsigned int i = 10; i < 200; i++)
+        {
+            cs.addClientTimestamp(1000 + i * 16, t0 + std::chrono::milliseconds(i * 16 + ((i % 2) * 10)));
+        }
+        b &= assertEquals(10.f, cs.getJitterMillisecs(), 0.1f, "jitter 2");
+
+        return b;
+    }
+
+    bool test_drift()
+    {
+        proofps_dd::ClockSync cs;
+        const auto t0 = std::chrono::steady_clock::now();
+
+        // client clock is 1000 ppm slower: in every 100 ms of server time, client time elapses 99.9 ms
+        for (unsigned int i = 0; i <= 400; i++)
+        {
+            cs.addClientTimestamp(1000 + i * 100 - i / 10, t0 + std::chrono::milliseconds(i * 100));
+        }
+
+        return assertEquals(1000.f, cs.getClockDriftPpm(), 50.f, "drift");
+    }
+
+    bool test_rtt()
+    {
+        proofps_dd::ClockSync cs;
+        const auto t0 = std::chrono::steady_clock::now();
+        const std::uint32_t nServerTime0 = proofps_dd::ClockSync::toMillisecs32(t0);
+
+        bool b = assertTrue(cs.addRttSample(nServerTime0, t0 + std::chrono::milliseconds(80)), "add 1");
+        b &= assertTrue(cs.hasRtt(), "has rtt");
+        b &= assertEquals(80.f, cs.getRttMillisecs(), 0.001f, "rtt 1");
+
+        b &= assertTrue(cs.addRttSample(nServerTime0, t0 + std::chrono::milliseconds(160)), "add 2");
+        b &= assertEquals(80.f + 80.f * proofps_dd::ClockSync::fRttGain, cs.getRttMillisecs(), 0.001f, "rtt 2");
+
+        return b;
+    }
+
+    bool test_rtt_ignores_invalid_samples()
+    {
+        proofps_dd::ClockSync cs;
+        const auto t0 = std::chrono::steady_clock::now();
+        const std::uint32_t nServerTime0 = proofps_dd::ClockSync::toMillisecs32(t0);
+
+        bool b = assertFalse(cs.addRttSample(0, t0), "zero");
+        b &= assertFalse(cs.addRttSample(nServerTime0 + 100, t0), "future");
+        b &= assertFalse(
+            cs.addRttSample(nServerTime0, t0 + std::chrono::milliseconds(proofps_dd::ClockSync::nRttSampleMaxMillisecs + 1)),
+            "too big");
+        b &= assertFalse(cs.hasRtt(), "has rtt");
+        b &= assertEquals(0.f, cs.getRttMillisecs(), "rtt");
+
+        return b;
+    }
+
+    bool test_to_server_time()
+    {
+        proofps_dd::ClockSync cs;
+        const auto t0 = std::chrono::steady_clock::now();
+
+        cs.addClientTimestamp(5000, t0 + std::chrono::milliseconds(30));
+        cs.addClientTimestamp(5100, t0 + std::chrono::milliseconds(170));
+
+        // first message had the smaller delay, so later delays do not shift the conversion
+        bool b = assertTrue(
+            std::chrono::milliseconds(30) ==
+            std::chrono::duration_cast<std::chrono::milliseconds>(cs.toServerTime(5000) - t0), "to server time 1");
+        b &= assertTrue(
+            std::chrono::milliseconds(530) ==
+            std::chrono::duration_cast<std::chrono::milliseconds>(cs.toServerTime(5500) - t0), "to server time 2");
+
+        return b;
+    }
+
+    bool test_client_interval()
+    {
+        proofps_dd::ClockSync cs;
+        const auto t0 = std::chrono::steady_clock::now();
+        const proofps_dd::ClockSync::MsgTime msgTimeFrom{ 5000, t0 + std::chrono::milliseconds(50) };
+
+        // not synced yet
+        bool b = assertEquals(470, static_cast<int>(cs.getClientIntervalMillisecs(
+            msgTimeFrom, proofps_dd::ClockSync::MsgTime{ 5500, t0 + std::chrono::milliseconds(520) }, 30)), "not synced");
+
+        cs.addClientTimestamp(5000, t0 + std::chrono::milliseconds(50));
+        cs.addClientTimestamp(5500, t0 + std::chrono::milliseconds(520));
+
+        // second message had less delay, still client interval is used
+        b &= assertEquals(500, static_cast<int>(cs.getClientIntervalMillisecs(
+            msgTimeFrom, proofps_dd::ClockSync::MsgTime{ 5500, t0 + std::chrono::milliseconds(520) }, 30)), "less delay");
+        b &= assertEquals(500, static_cast<int>(cs.getClientIntervalMillisecs(
+            msgTimeFrom, proofps_dd::ClockSync::MsgTime{ 5500, t0 + std::chrono::milliseconds(600) }, 30)), "more delay");
+
+        // faked client timestamp cannot gain more than the given deviation
+        b &= assertEquals(500, static_cast<int>(cs.getClientIntervalMillisecs(
+            msgTimeFrom, proofps_dd::ClockSync::MsgTime{ 5800, t0 + std::chrono::milliseconds(520) }, 30)), "faked");
+
+        // client clock stepped back
+        b &= assertEquals(-100, static_cast<int>(cs.getClientIntervalMillisecs(
+            msgTimeFrom, proofps_dd::ClockSync::MsgTime{ 4900, t0 + std::chrono::milliseconds(520) }, 30)), "stepped back");
+
+        // unknown timestamp or no earlier message
+        b &= assertEquals(470, static_cast<int>(cs.getClientIntervalMillisecs(
+            msgTimeFrom, proofps_dd::ClockSync::MsgTime{ 0, t0 + std::chrono::milliseconds(520) }, 30)), "unknown");
+        b &= assertTrue(cs.getClientIntervalMillisecs(
+            proofps_dd::ClockSync::MsgTime{}, proofps_dd::ClockSync::MsgTime{ 5500, t0 + std::chrono::hours(1) }, 30) >= 3600000, "no earlier msg");
+
+        return b;
+    }
+
+    bool test_client_interval_insane_drift_uses_arrival()
+    {
+        proofps_dd::ClockSync cs;
+        const auto t0 = std::chrono::steady_clock::now();
+
+        // client clock is 5000 ppm slower
+        for (unsigned int i = 0; i <= 400; i++)
+        {
+            cs.addClientTimestamp(1000 + i * 100 - i / 2, t0 + std::chrono::milliseconds(i * 100));
+        }
+
+        bool b = assertTrue(cs.getClockDriftPpm() > proofps_dd::ClockSync::fDriftPpmSaneMax, "drift");
+        b &= assertEquals(470, static_cast<int>(cs.getClientIntervalMillisecs(
+            proofps_dd::ClockSync::MsgTime{ 5000, t0 + std::chrono::milliseconds(50) },
+            proofps_dd::ClockSync::MsgTime{ 5500, t0 + std::chrono::milliseconds(520) }, 30)), "interval");
+
+        return b;
+    }
+
+    bool test_reset()
+    {
+        proofps_dd::ClockSync cs;
+        const auto t0 = std::chrono::steady_clock::now();
+        cs.addClientTimestamp(1000, t0);
+        cs.addClientTimestamp(1016, t0 + std::chrono::milliseconds(30));
+        cs.addRttSample(proofps_dd::ClockSync::toMillisecs32(t0), t0 + std::chrono::milliseconds(50));
+
+        cs.reset();
+
+        return (assertFalse(cs.isSynced(), "synced") &
+            assertEquals(0.f, cs.getJitterMillisecs(), "jitter") &
+            assertFalse(cs.hasRtt(), "has rtt")) != 0;
+    }
+
+};
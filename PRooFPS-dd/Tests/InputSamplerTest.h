@@ -0,0 +1,307 @@
+#pragma once
+
+/*
+    ###################################################################################
+    InputSamplerTest.h
+    Unit test for PRooFPS-dd InputSampler.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <atomic>
+#include <thread>
+
+#include "UnitTest.h"
+
+#include "InputSampler.h"
+
+class InputSamplerTest :
+    public UnitTest
+{
+public:
+
+    InputSamplerTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    InputSamplerTest(const InputSamplerTest&) = delete;
+    InputSamplerTest& operator=(const InputSamplerTest&) = delete;
+    InputSamplerTest(InputSamplerTest&&) = delete;
+    InputSamplerTest& operator=(InputSamplerTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        //CConsole::getConsoleInstance().SetLoggingState(proofps_dd::InputSampler::getLoggerModuleName(), true);
+
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&InputSamplerTest::test_initial_values);
+        addSubTest("test_sample_generates_events_only_on_change", (PFNUNITSUBTEST)&InputSamplerTest::test_sample_generates_events_only_on_change);
+        addSubTest("test_consume_until_respects_event_time", (PFNUNITSUBTEST)&InputSamplerTest::test_consume_until_respects_event_time);
+        addSubTest("test_short_press_between_consumes_is_not_lost", (PFNUNITSUBTEST)&InputSamplerTest::test_short_press_between_consumes_is_not_lost);
+        addSubTest("test_pressed_once_triggers_on_press_then_after_min_wait", (PFNUNITSUBTEST)&InputSamplerTest::test_pressed_once_triggers_on_press_then_after_min_wait);
+        addSubTest("test_disabled_samples_keys_released", (PFNUNITSUBTEST)&InputSamplerTest::test_disabled_samples_keys_released);
+        addSubTest("test_full_queue_drops_and_resamples", (PFNUNITSUBTEST)&InputSamplerTest::test_full_queue_drops_and_resamples);
+        addSubTest("test_clear", (PFNUNITSUBTEST)&InputSamplerTest::test_clear);
+        addSubTest("test_thread", (PFNUNITSUBTEST)&InputSamplerTest::test_thread);
+    }
+
+    virtual void finalize() override
+    {
+        CConsole::getConsoleInstance().SetLoggingState(proofps_dd::InputSampler::getLoggerModuleName(), false);
+    }
+
+private:
+
+    static constexpr proofps_dd::InputSampler::TKey nKeyA = 'A';
+    static constexpr proofps_dd::InputSampler::TKey nKeyB = 'B';
+    static constexpr proofps_dd::InputSampler::TKey nKeyNotSampled = 'C';
+
+    /** Key states as seen by the sampler, set by the tests. */
+    std::atomic<bool> m_bKeyADown{ false };
+    std::atomic<bool> m_bKeyBDown{ false };
+
+    proofps_dd::InputSampler::TKeyStateFunc getFakeKeyStateFunc()
+    {
+        return [this](proofps_dd::InputSampler::TKey nKey)
+        {
+            return ((nKey == nKeyA) && m_bKeyADown) || ((nKey == nKeyB) && m_bKeyBDown);
+        };
+    }
+
+    void resetFakeKeys()
+    {
+        m_bKeyADown = false;
+        m_bKeyBDown = false;
+    }
+
+    bool test_initial_values()
+    {
+        resetFakeKeys();
+        proofps_dd::InputSampler sampler({ nKeyA, nKeyB }, getFakeKeyStateFunc());
+
+        return (assertFalse(sampler.isRunning(), "running") &
+            assertTrue(sampler.isEnabled(), "enabled") &
+            assertFalse(sampler.isKeyDown(nKeyA), "down A") &
+            assertFalse(sampler.isKeyHeld(nKeyA), "held A") &
+            assertFalse(sampler.isKeyDown(nKeyNotSampled), "down not sampled") &
+            assertFalse(sampler.isKeyHeld(nKeyNotSampled), "held not sampled") &
+            assertTrue(sampler.getTimeLastConsumed().time_since_epoch().count() == 0, "time last consumed") &
+            assertEquals(0u, sampler.getDroppedEventsCount(), "dropped")) != 0;
+    }
+
+    bool test_sample_generates_events_only_on_change()
+    {
+        resetFakeKeys();
+        proofps_dd::InputSampler sampler({ nKeyA, nKeyB }, getFakeKeyStateFunc(), proofps_dd::InputSampler::nSamplingPeriodDef, 4);
+        const auto timeStart = std::chrono::steady_clock::now();
+
+        // if every sample generated an event, the queue of capacity 4 would be full and events would be dropped
+        m_bKeyADown = true;
+        for (int i = 0; i < 10; i++)
+        {
+            sampler.sample(timeStart + std::chrono::milliseconds(i));
+        }
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(10));
+
+        return (assertTrue(sampler.isKeyDown(nKeyA), "down A") &
+            assertFalse(sampler.isKeyDown(nKeyB), "down B") &
+            assertEquals(0u, sampler.getDroppedEventsCount(), "dropped")) != 0;
+    }
+
+    bool test_consume_until_respects_event_time()
+    {
+        resetFakeKeys();
+        proofps_dd::InputSampler sampler({ nKeyA, nKeyB }, getFakeKeyStateFunc());
+        const auto timeStart = std::chrono::steady_clock::now();
+
+        m_bKeyADown = true;
+        sampler.sample(timeStart + std::chrono::milliseconds(5));
+        m_bKeyBDown = true;
+        sampler.sample(timeStart + std::chrono::milliseconds(20));
+        m_bKeyADown = false;
+        sampler.sample(timeStart + std::chrono::milliseconds(40));
+
+        sampler.consumeEventsUntil(timeStart);
+        bool b = assertFalse(sampler.isKeyDown(nKeyA), "down A 1");
+        b &= assertFalse(sampler.isKeyDown(nKeyB), "down B 1");
+
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(16));
+        b &= assertTrue(sampler.isKeyDown(nKeyA), "down A 2");
+        b &= assertFalse(sampler.isKeyDown(nKeyB), "down B 2");
+        b &= assertTrue(timeStart + std::chrono::milliseconds(16) == sampler.getTimeLastConsumed(), "time last consumed 2");
+
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(33));
+        b &= assertTrue(sampler.isKeyDown(nKeyA), "down A 3");
+        b &= assertTrue(sampler.isKeyDown(nKeyB), "down B 3");
+
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(50));
+        b &= assertFalse(sampler.isKeyDown(nKeyA), "down A 4");
+        b &= assertTrue(sampler.isKeyDown(nKeyB), "down B 4");
+
+        return b;
+    }
+
+    bool test_short_press_between_consumes_is_not_lost()
+    {
+        resetFakeKeys();
+        proofps_dd::InputSampler sampler({ nKeyA, nKeyB }, getFakeKeyStateFunc());
+        const auto timeStart = std::chrono::steady_clock::now();
+
+        // pressed for 3 ms only, way shorter than a frame
+        m_bKeyADown = true;
+        sampler.sample(timeStart + std::chrono::milliseconds(2));
+        m_bKeyADown = false;
+        sampler.sample(timeStart + std::chrono::milliseconds(5));
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(16));
+
+        bool b = assertFalse(sampler.isKeyDown(nKeyA), "down A");
+        b &= assertTrue(sampler.isKeyHeld(nKeyA), "held A 1");
+        b &= assertFalse(sampler.isKeyHeld(nKeyA), "held A 2");  // latch is cleared by the previous query
+        b &= assertFalse(sampler.isKeyHeld(nKeyB), "held B");
+
+        // still pressed, latch is not needed
+        m_bKeyBDown = true;
+        sampler.sample(timeStart + std::chrono::milliseconds(20));
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(33));
+        b &= assertTrue(sampler.isKeyHeld(nKeyB), "held B 1");
+        b &= assertTrue(sampler.isKeyHeld(nKeyB), "held B 2");
+
+        return b;
+    }
+
+    bool test_pressed_once_triggers_on_press_then_after_min_wait()
+    {
+        resetFakeKeys();
+        proofps_dd::InputSampler sampler({ nKeyA, nKeyB }, getFakeKeyStateFunc());
+        const auto timeStart = std::chrono::steady_clock::now();
+        const std::chrono::milliseconds nMinWait(50);
+
+        bool b = assertFalse(sampler.isKeyPressedOnce(nKeyA, nMinWait), "once A 0");
+
+        // short press between 2 queries still triggers once
+        m_bKeyADown = true;
+        sampler.sample(timeStart + std::chrono::milliseconds(2));
+        m_bKeyADown = false;
+        sampler.sample(timeStart + std::chrono::milliseconds(5));
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(16));
+        b &= assertTrue(sampler.isKeyPressedOnce(nKeyA, nMinWait), "once A 1");
+        b &= assertFalse(sampler.isKeyPressedOnce(nKeyA, nMinWait), "once A 2");
+        // isKeyHeld() has its own latch
+        b &= assertTrue(sampler.isKeyHeld(nKeyA), "held A");
+
+        // held key triggers again only after min wait
+        m_bKeyBDown = true;
+        sampler.sample(timeStart + std::chrono::milliseconds(20));
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(33));
+        b &= assertTrue(sampler.isKeyPressedOnce(nKeyB, nMinWait), "once B 1");
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(66));
+        b &= assertFalse(sampler.isKeyPressedOnce(nKeyB, nMinWait), "once B 2");
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(83));
+        b &= assertTrue(sampler.isKeyPressedOnce(nKeyB, nMinWait), "once B 3");
+
+        return b;
+    }
+
+    bool test_disabled_samples_keys_released()
+    {
+        resetFakeKeys();
+        proofps_dd::InputSampler sampler({ nKeyA, nKeyB }, getFakeKeyStateFunc());
+        const auto timeStart = std::chrono::steady_clock::now();
+
+        m_bKeyADown = true;
+        sampler.sample(timeStart + std::chrono::milliseconds(1));
+        sampler.setEnabled(false);
+        sampler.sample(timeStart + std::chrono::milliseconds(2));
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(3));
+
+        bool b = assertFalse(sampler.isEnabled(), "enabled 1");
+        b &= assertFalse(sampler.isKeyDown(nKeyA), "down A 1");
+
+        // key still held when enabled again
+        sampler.setEnabled(true);
+        sampler.sample(timeStart + std::chrono::milliseconds(4));
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(5));
+        b &= assertTrue(sampler.isEnabled(), "enabled 2");
+        b &= assertTrue(sampler.isKeyDown(nKeyA), "down A 2");
+
+        return b;
+    }
+
+    bool test_full_queue_drops_and_resamples()
+    {
+        resetFakeKeys();
+        proofps_dd::InputSampler sampler({ nKeyA, nKeyB }, getFakeKeyStateFunc(), proofps_dd::InputSampler::nSamplingPeriodDef, 2);
+        const auto timeStart = std::chrono::steady_clock::now();
+
+        m_bKeyADown = true;
+        m_bKeyBDown = true;
+        sampler.sample(timeStart + std::chrono::milliseconds(1));
+        m_bKeyADown = false;
+        sampler.sample(timeStart + std::chrono::milliseconds(2));  // queue is full
+        bool b = assertEquals(1u, sampler.getDroppedEventsCount(), "dropped");
+
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(3));
+        b &= assertTrue(sampler.isKeyDown(nKeyA), "down A 1");
+        b &= assertTrue(sampler.isKeyDown(nKeyB), "down B 1");
+
+        // dropped change is sampled again
+        sampler.sample(timeStart + std::chrono::milliseconds(4));
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(5));
+        b &= assertFalse(sampler.isKeyDown(nKeyA), "down A 2");
+        b &= assertTrue(sampler.isKeyDown(nKeyB), "down B 2");
+
+        return b;
+    }
+
+    bool test_clear()
+    {
+        resetFakeKeys();
+        proofps_dd::InputSampler sampler({ nKeyA, nKeyB }, getFakeKeyStateFunc());
+        const auto timeStart = std::chrono::steady_clock::now();
+
+        m_bKeyADown = true;
+        sampler.sample(timeStart + std::chrono::milliseconds(1));
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(2));
+        m_bKeyBDown = true;
+        sampler.sample(timeStart + std::chrono::milliseconds(3));
+
+        sampler.clear();
+        sampler.consumeEventsUntil(timeStart + std::chrono::milliseconds(4));
+
+        return (assertFalse(sampler.isKeyDown(nKeyA), "down A") &
+            assertFalse(sampler.isKeyHeld(nKeyA), "held A") &
+            assertFalse(sampler.isKeyDown(nKeyB), "down B") &
+            assertFalse(sampler.isKeyHeld(nKeyB), "held B")) != 0;
+    }
+
+    bool test_thread()
+    {
+        resetFakeKeys();
+        proofps_dd::InputSampler sampler({ nKeyA, nKeyB }, getFakeKeyStateFunc());
+
+        bool b = assertTrue(sampler.start(), "start");
+        b &= assertTrue(sampler.isRunning(), "running 1");
+        b &= assertFalse(sampler.start(), "start again");
+
+        const auto timePressed = std::chrono::steady_clock::now();
+        m_bKeyADown = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        m_bKeyADown = false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        sampler.stop();
+        b &= assertFalse(sampler.isRunning(), "running 2");
+
+        sampler.consumeEventsUntil(std::chrono::steady_clock::now());
+        b &= assertFalse(sampler.isKeyDown(nKeyA), "down A");
+        b &= assertTrue(sampler.isKeyHeld(nKeyA), "held A");
+        b &= assertFalse(sampler.isKeyHeld(nKeyB), "held B");
+        b &= assertTrue(timePressed < sampler.getTimeLastConsumed(), "time last consumed");
+
+        return b;
+    }
+
+};
@@ -0,0 +1,165 @@
+#pragma once
+
+/*
+    ###################################################################################
+    InterestManagementTest.h
+    Unit test for PRooFPS-dd InterestManagement.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "UnitTest.h"
+
+#include "InterestManagement.h"
+
+class InterestManagementTest :
+    public UnitTest
+{
+public:
+
+    InterestManagementTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    InterestManagementTest(const InterestManagementTest&) = delete;
+    InterestManagementTest& operator=(const InterestManagementTest&) = delete;
+    InterestManagementTest(InterestManagementTest&&) = delete;
+    InterestManagementTest& operator=(InterestManagementTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        //CConsole::getConsoleInstance().SetLoggingState(proofps_dd::InterestManagement::getLoggerModuleName(), true);
+
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&InterestManagementTest::test_initial_values);
+        addSubTest("test_unknown_client_everything_relevant", (PFNUNITSUBTEST)&InterestManagementTest::test_unknown_client_everything_relevant);
+        addSubTest("test_relevance_window", (PFNUNITSUBTEST)&InterestManagementTest::test_relevance_window);
+        addSubTest("test_disabled_everything_relevant", (PFNUNITSUBTEST)&InterestManagementTest::test_disabled_everything_relevant);
+        addSubTest("test_bullet_known_by_clients", (PFNUNITSUBTEST)&InterestManagementTest::test_bullet_known_by_clients);
+        addSubTest("test_remove_client", (PFNUNITSUBTEST)&InterestManagementTest::test_remove_client);
+        addSubTest("test_clear", (PFNUNITSUBTEST)&InterestManagementTest::test_clear);
+    }
+
+    virtual void finalize() override
+    {
+        CConsole::getConsoleInstance().SetLoggingState(proofps_dd::InterestManagement::getLoggerModuleName(), false);
+    }
+
+private:
+
+    bool test_initial_values()
+    {
+        const proofps_dd::InterestManagement im;
+
+        return (assertTrue(im.isEnabled(), "enabled") &
+            assertEquals(0u, im.getClientViewCount(), "client views") &
+            assertEquals(0u, im.getKnownBulletCount(), "known bullets")) != 0;
+    }
+
+    bool test_unknown_client_everything_relevant()
+    {
+        proofps_dd::InterestManagement im;
+
+        bool b = assertTrue(im.isRelevantForClient(1, 1000.f), "not registered client");
+
+        im.updateClientView(1, 0.f);
+        b &= assertFalse(im.isRelevantForClient(1, 1000.f), "known view");
+
+        im.setClientViewUnknown(1);
+        b &= assertTrue(im.isRelevantForClient(1, 1000.f), "unknown view");
+        b &= assertEquals(1u, im.getClientViewCount(), "client views");
+
+        return b;
+    }
+
+    bool test_relevance_window()
+    {
+        proofps_dd::InterestManagement im;
+        constexpr float fHalf = proofps_dd::InterestManagement::fRelevanceHalfWidthX;
+
+        im.updateClientView(1, 10.f);
+        im.updateClientView(2, 100.f);
+
+        return (assertTrue(im.isRelevantForClient(1, 10.f), "center") &
+            assertTrue(im.isRelevantForClient(1, 10.f + fHalf), "right edge") &
+            assertTrue(im.isRelevantForClient(1, 10.f - fHalf), "left edge") &
+            assertFalse(im.isRelevantForClient(1, 10.f + fHalf + 0.1f), "right outside") &
+            assertFalse(im.isRelevantForClient(1, 10.f - fHalf - 0.1f), "left outside") &
+            assertTrue(im.isRelevantForClient(1, -1000.f, 1000.f), "range covering window") &
+            assertTrue(im.isRelevantForClient(1, 10.f + fHalf - 1.f, 1000.f), "range overlapping right edge") &
+            assertFalse(im.isRelevantForClient(1, 50.f, 60.f), "range between clients") &
+            assertTrue(im.isRelevantForClient(2, 100.f), "other client center") &
+            assertFalse(im.isRelevantForClient(2, 10.f), "other client far")) != 0;
+    }
+
+    bool test_disabled_everything_relevant()
+    {
+        proofps_dd::InterestManagement im;
+        im.updateClientView(1, 0.f);
+
+        im.setEnabled(false);
+        bool b = assertFalse(im.isEnabled(), "enabled 1");
+        b &= assertTrue(im.isRelevantForClient(1, 1000.f), "relevant 1");
+
+        im.setEnabled(true);
+        b &= assertTrue(im.isEnabled(), "enabled 2");
+        b &= assertFalse(im.isRelevantForClient(1, 1000.f), "relevant 2");
+
+        return b;
+    }
+
+    bool test_bullet_known_by_clients()
+    {
+        proofps_dd::InterestManagement im;
+
+        bool b = assertFalse(im.isBulletKnownByClient(5, 1), "known 1");
+
+        im.setBulletKnownByClient(5, 1);
+        im.setBulletKnownByClient(5, 1);  // no duplicates
+        im.setBulletKnownByClient(6, 2);
+        b &= assertTrue(im.isBulletKnownByClient(5, 1), "known 2");
+        b &= assertFalse(im.isBulletKnownByClient(5, 2), "known 3");
+        b &= assertTrue(im.isBulletKnownByClient(6, 2), "known 4");
+        b &= assertEquals(2u, im.getKnownBulletCount(), "known bullets 1");
+
+        im.forgetBullet(5);
+        b &= assertFalse(im.isBulletKnownByClient(5, 1), "known 5");
+        b &= assertTrue(im.isBulletKnownByClient(6, 2), "known 6");
+        b &= assertEquals(1u, im.getKnownBulletCount(), "known bullets 2");
+
+        return b;
+    }
+
+    bool test_remove_client()
+    {
+        proofps_dd::InterestManagement im;
+        im.updateClientView(1, 0.f);
+        im.updateClientView(2, 0.f);
+        im.setBulletKnownByClient(5, 1);
+        im.setBulletKnownByClient(5, 2);
+
+        im.removeClient(1);
+
+        return (assertEquals(1u, im.getClientViewCount(), "client views") &
+            assertFalse(im.isBulletKnownByClient(5, 1), "known 1") &
+            assertTrue(im.isBulletKnownByClient(5, 2), "known 2")) != 0;
+    }
+
+    bool test_clear()
+    {
+        proofps_dd::InterestManagement im;
+        im.updateClientView(1, 0.f);
+        im.setBulletKnownByClient(5, 1);
+
+        im.clear();
+
+        return (assertTrue(im.isEnabled(), "enabled") &
+            assertEquals(0u, im.getClientViewCount(), "client views") &
+            assertEquals(0u, im.getKnownBulletCount(), "known bullets")) != 0;
+    }
+
+}; // class InterestManagementTest
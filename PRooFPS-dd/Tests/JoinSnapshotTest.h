@@ -0,0 +1,270 @@
+#pragma once
+
+/*
+    ###################################################################################
+    JoinSnapshotTest.h
+    Unit test for PRooFPS-dd JoinSnapshot.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <cstring>
+#include <vector>
+
+#include "UnitTest.h"
+
+#include "JoinSnapshot.h"
+#include "PRooFPS-dd-packet.h"
+
+class JoinSnapshotTest :
+    public UnitTest
+{
+public:
+
+    JoinSnapshotTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    JoinSnapshotTest(const JoinSnapshotTest&) = delete;
+    JoinSnapshotTest& operator=(const JoinSnapshotTest&) = delete;
+    JoinSnapshotTest(JoinSnapshotTest&&) = delete;
+    JoinSnapshotTest& operator=(JoinSnapshotTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        //CConsole::getConsoleInstance().SetLoggingState(proofps_dd::JoinSnapshot::getLoggerModuleName(), true);
+
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&JoinSnapshotTest::test_initial_values);
+        addSubTest("test_add", (PFNUNITSUBTEST)&JoinSnapshotTest::test_add);
+        addSubTest("test_add_invalid", (PFNUNITSUBTEST)&JoinSnapshotTest::test_add_invalid);
+        addSubTest("test_chunks", (PFNUNITSUBTEST)&JoinSnapshotTest::test_chunks);
+        addSubTest("test_client_reassemble_and_get_records", (PFNUNITSUBTEST)&JoinSnapshotTest::test_client_reassemble_and_get_records);
+        addSubTest("test_client_rejects_unexpected_chunk", (PFNUNITSUBTEST)&JoinSnapshotTest::test_client_rejects_unexpected_chunk);
+        addSubTest("test_client_rejects_too_big_snapshot", (PFNUNITSUBTEST)&JoinSnapshotTest::test_client_rejects_too_big_snapshot);
+        addSubTest("test_clear", (PFNUNITSUBTEST)&JoinSnapshotTest::test_clear);
+    }
+
+    virtual void finalize() override
+    {
+        CConsole::getConsoleInstance().SetLoggingState(proofps_dd::JoinSnapshot::getLoggerModuleName(), false);
+    }
+
+private:
+
+    /** Adds enough string table entry msgs to the given snapshot so that it will need more than 2 chunks. */
+    static size_t addManyRecords(proofps_dd::JoinSnapshot& snapshot)
+    {
+        size_t nRecords = 0;
+        while (snapshot.getLength() <= 2 * proofps_dd::MsgJoinSnapshotChunkFromServer::nDataMaxLength)
+        {
+            pge_network::PgePacket pkt;
+            if (!proofps_dd::MsgStringTableEntryFromServer::initPkt(
+                    pkt, static_cast<proofps_dd::StringTable::StringId>(nRecords + 1), "weapon" + std::to_string(nRecords) + ".txt") ||
+                !snapshot.add<proofps_dd::MsgStringTableEntryFromServer>(pkt))
+            {
+                return 0;
+            }
+            nRecords++;
+        }
+        return nRecords;
+    }
+
+    /** Feeds all chunks of the given server-side snapshot to the given client-side snapshot. */
+    static bool transfer(const proofps_dd::JoinSnapshot& snapshotServer, proofps_dd::JoinSnapshot& snapshotClient)
+    {
+        for (size_t i = 0; i < snapshotServer.getChunkCount(); i++)
+        {
+            pge_network::PgePacket pkt;
+            if (!snapshotServer.getChunkAsPkt(i, pkt) ||
+                !snapshotClient.clientHandleJoinSnapshotChunkFromServer(
+                    pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgJoinSnapshotChunkFromServer>(pkt)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool test_initial_values()
+    {
+        const proofps_dd::JoinSnapshot snapshot;
+        std::vector<pge_network::PgePacket> vecPkts;
+
+        return (assertEquals(0u, snapshot.getLength(), "length") &
+            assertEquals(0u, snapshot.getRecordCount(), "record count") &
+            assertEquals(0u, snapshot.getChunkCount(), "chunk count") &
+            assertFalse(snapshot.isComplete(), "complete") &
+            assertFalse(snapshot.getRecordsAsPkts(vecPkts), "get records") &
+            assertTrue(vecPkts.empty(), "records empty")) != 0;
+    }
+
+    bool test_add()
+    {
+        proofps_dd::JoinSnapshot snapshot;
+        pge_network::PgePacket pkt;
+
+        bool b = assertTrue(proofps_dd::MsgStringTableEntryFromServer::initPkt(pkt, 1, "pistol.txt"), "initPkt");
+        b &= assertTrue(snapshot.add<proofps_dd::MsgStringTableEntryFromServer>(pkt), "add 1");
+        const size_t nLengthAfter1stRecord = snapshot.getLength();
+        b &= assertLess(sizeof(proofps_dd::MsgStringTableEntryFromServer), nLengthAfter1stRecord, "length 1");
+
+        const pge_network::TByte data[3] = { 1, 2, 3 };
+        b &= assertTrue(snapshot.addRecord(5, 12345, data, sizeof(data)), "add 2");
+        b &= assertLess(nLengthAfter1stRecord + sizeof(data), snapshot.getLength(), "length 2");
+
+        b &= assertEquals(2u, snapshot.getRecordCount(), "record count");
+        b &= assertEquals(1u, snapshot.getChunkCount(), "chunk count");
+
+        return b;
+    }
+
+    bool test_add_invalid()
+    {
+        proofps_dd::JoinSnapshot snapshot;
+        const pge_network::TByte data[3] = { 1, 2, 3 };
+        const std::vector<pge_network::TByte> vecTooBig(proofps_dd::JoinSnapshot::nSnapshotMaxLength, 0);
+
+        bool b = assertFalse(snapshot.addRecord(5, 12345, nullptr, sizeof(data)), "null");
+        b &= assertFalse(snapshot.addRecord(5, 12345, data, 0), "zero length");
+        b &= assertFalse(snapshot.addRecord(5, 12345, vecTooBig.data(), vecTooBig.size()), "too big");
+        b &= assertEquals(0u, snapshot.getLength(), "length");
+        b &= assertEquals(0u, snapshot.getRecordCount(), "record count");
+
+        return b;
+    }
+
+    bool test_chunks()
+    {
+        proofps_dd::JoinSnapshot snapshot;
+        bool b = assertLess(0u, addManyRecords(snapshot), "add");
+        b &= assertEquals(3u, snapshot.getChunkCount(), "chunk count");
+
+        pge_network::PgePacket pkt;
+        size_t nTotalLength = 0;
+        for (size_t i = 0; i < snapshot.getChunkCount(); i++)
+        {
+            b &= assertTrue(snapshot.getChunkAsPkt(i, pkt), ("get chunk " + std::to_string(i)).c_str());
+            const auto& msgChunk = pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgJoinSnapshotChunkFromServer>(pkt);
+            b &= assertEquals(static_cast<std::uint32_t>(snapshot.getLength()), msgChunk.m_nSnapshotLength, ("snapshot length " + std::to_string(i)).c_str());
+            b &= assertEquals(static_cast<std::uint32_t>(nTotalLength), msgChunk.m_nOffset, ("offset " + std::to_string(i)).c_str());
+            nTotalLength += msgChunk.m_nLength;
+        }
+        b &= assertEquals(snapshot.getLength(), nTotalLength, "total length");
+        b &= assertFalse(snapshot.getChunkAsPkt(snapshot.getChunkCount(), pkt), "get chunk out of range");
+
+        return b;
+    }
+
+    bool test_client_reassemble_and_get_records()
+    {
+        proofps_dd::JoinSnapshot snapshotServer;
+        const size_t nRecords = addManyRecords(snapshotServer);
+        const pge_network::TByte data[3] = { 1, 2, 3 };
+        bool b = assertTrue(snapshotServer.addRecord(5, 12345, data, sizeof(data)), "add raw");
+
+        proofps_dd::JoinSnapshot snapshotClient;
+        b &= assertTrue(transfer(snapshotServer, snapshotClient), "transfer");
+        b &= assertTrue(snapshotClient.isComplete(), "complete");
+        b &= assertEquals(snapshotServer.getLength(), snapshotClient.getLength(), "length");
+
+        std::vector<pge_network::PgePacket> vecPkts;
+        b &= assertTrue(snapshotClient.getRecordsAsPkts(vecPkts), "get records");
+        if (!assertEquals(nRecords + 1, vecPkts.size(), "records count"))
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < nRecords; i++)
+        {
+            const auto& pkt = vecPkts[i];
+            b &= assertEquals(static_cast<pge_network::MsgApp::TMsgId>(proofps_dd::MsgStringTableEntryFromServer::id),
+                pge_network::PgePacket::getMsgAppIdFromPkt(pkt), ("msg id " + std::to_string(i)).c_str());
+            const auto& msgEntry = pge_network::PgePacket::getMsgAppDataFromPkt<const proofps_dd::MsgStringTableEntryFromServer>(pkt);
+            b &= assertEquals(static_cast<proofps_dd::StringTable::StringId>(i + 1), msgEntry.m_nStringId, ("string id " + std::to_string(i)).c_str());
+            b &= assertEquals("weapon" + std::to_string(i) + ".txt", std::string(msgEntry.m_szString), ("string " + std::to_string(i)).c_str());
+        }
+
+        const auto& pktRaw = vecPkts.back();
+        b &= assertEquals(static_cast<pge_network::MsgApp::TMsgId>(5), pge_network::PgePacket::getMsgAppIdFromPkt(pktRaw), "raw msg id");
+        b &= assertEquals(static_cast<pge_network::PgeNetworkConnectionHandle>(12345), pge_network::PgePacket::getServerSideConnectionHandle(pktRaw), "raw conn handle");
+        b &= assertEquals(0, std::memcmp(data, &pge_network::PgePacket::getMsgAppDataFromPkt<const pge_network::TByte>(pktRaw), sizeof(data)), "raw data");
+
+        return b;
+    }
+
+    bool test_client_rejects_unexpected_chunk()
+    {
+        proofps_dd::JoinSnapshot snapshotServer;
+        bool b = assertLess(0u, addManyRecords(snapshotServer), "add");
+
+        pge_network::PgePacket pkt0;
+        pge_network::PgePacket pkt1;
+        pge_network::PgePacket pkt2;
+        b &= assertTrue(snapshotServer.getChunkAsPkt(0, pkt0), "get chunk 0");
+        b &= assertTrue(snapshotServer.getChunkAsPkt(1, pkt1), "get chunk 1");
+        b &= assertTrue(snapshotServer.getChunkAsPkt(2, pkt2), "get chunk 2");
+
+        proofps_dd::JoinSnapshot snapshotClient;
+        // chunk without its preceding chunks
+        b &= assertFalse(snapshotClient.clientHandleJoinSnapshotChunkFromServer(
+            pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgJoinSnapshotChunkFromServer>(pkt1)), "chunk 1 first");
+
+        // skipping a chunk
+        b &= assertTrue(snapshotClient.clientHandleJoinSnapshotChunkFromServer(
+            pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgJoinSnapshotChunkFromServer>(pkt0)), "chunk 0");
+        b &= assertFalse(snapshotClient.clientHandleJoinSnapshotChunkFromServer(
+            pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgJoinSnapshotChunkFromServer>(pkt2)), "chunk 2 after 0");
+        b &= assertFalse(snapshotClient.isComplete(), "complete 1");
+        b &= assertEquals(0u, snapshotClient.getLength(), "length after rejected");
+
+        // first chunk always restarts
+        b &= assertTrue(transfer(snapshotServer, snapshotClient), "transfer");
+        b &= assertTrue(snapshotClient.isComplete(), "complete 2");
+
+        return b;
+    }
+
+    bool test_client_rejects_too_big_snapshot()
+    {
+        proofps_dd::JoinSnapshot snapshotServer;
+        bool b = assertLess(0u, addManyRecords(snapshotServer), "add");
+
+        pge_network::PgePacket pkt;
+        b &= assertTrue(snapshotServer.getChunkAsPkt(0, pkt), "get chunk 0");
+        auto& msgChunk = pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgJoinSnapshotChunkFromServer>(pkt);
+        msgChunk.m_nSnapshotLength = static_cast<std::uint32_t>(proofps_dd::JoinSnapshot::nSnapshotMaxLength + 1);
+
+        proofps_dd::JoinSnapshot snapshotClient;
+        b &= assertFalse(snapshotClient.clientHandleJoinSnapshotChunkFromServer(msgChunk), "too big");
+        b &= assertFalse(snapshotClient.isComplete(), "complete");
+        b &= assertEquals(0u, snapshotClient.getLength(), "length");
+
+        return b;
+    }
+
+    bool test_clear()
+    {
+        proofps_dd::JoinSnapshot snapshotServer;
+        bool b = assertLess(0u, addManyRecords(snapshotServer), "add");
+
+        proofps_dd::JoinSnapshot snapshotClient;
+        b &= assertTrue(transfer(snapshotServer, snapshotClient), "transfer");
+
+        snapshotServer.clear();
+        snapshotClient.clear();
+
+        b &= assertEquals(0u, snapshotServer.getLength(), "server length");
+        b &= assertEquals(0u, snapshotServer.getRecordCount(), "server record count");
+        b &= assertEquals(0u, snapshotServer.getChunkCount(), "server chunk count");
+        b &= assertEquals(0u, snapshotClient.getLength(), "client length");
+        b &= assertFalse(snapshotClient.isComplete(), "client complete");
+
+        return b;
+    }
+
+};
@@ -96,7 +96,7 @@ private:
 
     bool test_is_valid_map_filename()
     {
-        std::string sTooLooongFilename(proofps_dd::MsgMapChangeFromServer::nMapFilenameMaxLength, 'a');
+        std::string sTooLooongFilename(proofps_dd::StringTable::nStringBufferLength, 'a');
         return (assertFalse(proofps_dd::Mapcycle::isValidMapFilename("map.txt"), "map.txt") &
             assertFalse(proofps_dd::Mapcycle::isValidMapFilename("map_.tx"), "map_.tx") &
             assertFalse(proofps_dd::Mapcycle::isValidMapFilename("_map.txt"), "_map.txt") &
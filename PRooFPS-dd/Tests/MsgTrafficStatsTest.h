@@ -0,0 +1,253 @@
+#pragma once
+
+/*
+    ###################################################################################
+    MsgTrafficStatsTest.h
+    Unit test for PRooFPS-dd MsgTrafficStats.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <filesystem>  // requires cpp17
+
+#include "UnitTest.h"
+
+#include "MsgTrafficStats.h"
+#include "PRooFPS-dd-packet.h"
+
+class MsgTrafficStatsTest :
+    public UnitTest
+{
+public:
+
+    MsgTrafficStatsTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    MsgTrafficStatsTest(const MsgTrafficStatsTest&) = delete;
+    MsgTrafficStatsTest& operator=(const MsgTrafficStatsTest&) = delete;
+    MsgTrafficStatsTest(MsgTrafficStatsTest&&) = delete;
+    MsgTrafficStatsTest& operator=(MsgTrafficStatsTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        //CConsole::getConsoleInstance().SetLoggingState(proofps_dd::MsgTrafficStats::getLoggerModuleName(), true);
+
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&MsgTrafficStatsTest::test_initial_values);
+        addSubTest("test_tx_rx_per_connection", (PFNUNITSUBTEST)&MsgTrafficStatsTest::test_tx_rx_per_connection);
+        addSubTest("test_tx_to_all_clients", (PFNUNITSUBTEST)&MsgTrafficStatsTest::test_tx_to_all_clients);
+        addSubTest("test_clients_total_excludes_server", (PFNUNITSUBTEST)&MsgTrafficStatsTest::test_clients_total_excludes_server);
+        addSubTest("test_handler_duration", (PFNUNITSUBTEST)&MsgTrafficStatsTest::test_handler_duration);
+        addSubTest("test_clear_keeps_connected_only", (PFNUNITSUBTEST)&MsgTrafficStatsTest::test_clear_keeps_connected_only);
+        addSubTest("test_reset_forgets_connections", (PFNUNITSUBTEST)&MsgTrafficStatsTest::test_reset_forgets_connections);
+        addSubTest("test_dump_to_file", (PFNUNITSUBTEST)&MsgTrafficStatsTest::test_dump_to_file);
+    }
+
+    virtual void finalize() override
+    {
+        CConsole::getConsoleInstance().SetLoggingState(proofps_dd::MsgTrafficStats::getLoggerModuleName(), false);
+    }
+
+private:
+
+    static constexpr pge_network::PgeNetworkConnectionHandle connHandleClient1 = pge_network::ServerConnHandle + 1;
+    static constexpr pge_network::PgeNetworkConnectionHandle connHandleClient2 = pge_network::ServerConnHandle + 2;
+    static constexpr char* szDumpFilename = "MsgTrafficStatsTest.txt";
+
+    static pge_network::PgePacket makeDeathPkt()
+    {
+        pge_network::PgePacket pkt;
+        proofps_dd::MsgDeathNotificationFromServer::initPkt(pkt, connHandleClient1, connHandleClient2);
+        return pkt;
+    }
+
+    static pge_network::PgePacket makeMapChangePkt()
+    {
+        pge_network::PgePacket pkt;
+        proofps_dd::MsgMapChangeFromServer::initPkt(pkt, 1 /* any valid StringTable id */);
+        return pkt;
+    }
+
+    static size_t getBytes(const pge_network::PgePacket& pkt)
+    {
+        return static_cast<size_t>(pge_network::PgePacket::getMessageAppsTotalActualLengthBytes(pkt));
+    }
+
+    bool assertCounters(
+        const proofps_dd::MsgTrafficStats::Counters& counters,
+        size_t nTxMsgs, size_t nTxBytes, size_t nRxMsgs, size_t nRxBytes,
+        const std::string& sMsg)
+    {
+        return (assertEquals(nTxMsgs, counters.m_nTxMsgs, (sMsg + " tx msgs").c_str()) &
+            assertEquals(nTxBytes, counters.m_nTxBytes, (sMsg + " tx bytes").c_str()) &
+            assertEquals(nRxMsgs, counters.m_nRxMsgs, (sMsg + " rx msgs").c_str()) &
+            assertEquals(nRxBytes, counters.m_nRxBytes, (sMsg + " rx bytes").c_str())) != 0;
+    }
+
+    bool test_initial_values()
+    {
+        const proofps_dd::MsgTrafficStats mts;
+
+        bool b = true;
+        for (const auto& msgId2ZStringPair : proofps_dd::MapMsgAppId2String)
+        {
+            const std::string sMsg = msgId2ZStringPair.zstring;
+            b &= assertCounters(mts.getCounters(pge_network::ServerConnHandle, msgId2ZStringPair.msgId), 0, 0, 0, 0, sMsg + " server");
+            b &= assertCounters(mts.getCounters(connHandleClient1, msgId2ZStringPair.msgId), 0, 0, 0, 0, sMsg + " client");
+            b &= assertCounters(mts.getClientsTotalCounters(msgId2ZStringPair.msgId), 0, 0, 0, 0, sMsg + " total");
+            b &= assertEquals(static_cast<size_t>(0), mts.getHandlerStats(msgId2ZStringPair.msgId).m_nCalls, (sMsg + " calls").c_str());
+        }
+        return b;
+    }
+
+    bool test_tx_rx_per_connection()
+    {
+        proofps_dd::MsgTrafficStats mts;
+        const pge_network::PgePacket pktDeath = makeDeathPkt();
+        const pge_network::PgePacket pktMapChange = makeMapChangePkt();
+        const size_t nDeathBytes = getBytes(pktDeath);
+        const size_t nMapChangeBytes = getBytes(pktMapChange);
+
+        mts.addTx(connHandleClient1, pktDeath);
+        mts.addTx(connHandleClient1, pktDeath);
+        mts.addTx(connHandleClient2, pktMapChange);
+        mts.addRx(connHandleClient2, pktDeath);
+
+        return (assertLess(static_cast<size_t>(0), nDeathBytes, "death bytes") &
+            assertCounters(mts.getCounters(connHandleClient1, proofps_dd::MsgDeathNotificationFromServer::id), 2, 2 * nDeathBytes, 0, 0, "client 1 death") &
+            assertCounters(mts.getCounters(connHandleClient1, proofps_dd::MsgMapChangeFromServer::id), 0, 0, 0, 0, "client 1 map change") &
+            assertCounters(mts.getCounters(connHandleClient2, proofps_dd::MsgDeathNotificationFromServer::id), 0, 0, 1, nDeathBytes, "client 2 death") &
+            assertCounters(mts.getCounters(connHandleClient2, proofps_dd::MsgMapChangeFromServer::id), 1, nMapChangeBytes, 0, 0, "client 2 map change") &
+            assertCounters(mts.getCounters(pge_network::ServerConnHandle, proofps_dd::MsgDeathNotificationFromServer::id), 0, 0, 0, 0, "server death")) != 0;
+    }
+
+    bool test_tx_to_all_clients()
+    {
+        proofps_dd::MsgTrafficStats mts;
+        const pge_network::PgePacket pktDeath = makeDeathPkt();
+        const size_t nDeathBytes = getBytes(pktDeath);
+        constexpr auto msgId = proofps_dd::MsgDeathNotificationFromServer::id;
+
+        mts.addConnection(pge_network::ServerConnHandle);  // ignored, server is never a client connection
+        mts.addConnection(connHandleClient1);
+        mts.addConnection(connHandleClient2);
+
+        // like sendToAll()
+        mts.addTxToAllClients(pktDeath, true, pge_network::ServerConnHandle);
+        bool b = assertCounters(mts.getCounters(pge_network::ServerConnHandle, msgId), 1, nDeathBytes, 0, 0, "server 1");
+        b &= assertCounters(mts.getCounters(connHandleClient1, msgId), 1, nDeathBytes, 0, 0, "client 1 1");
+        b &= assertCounters(mts.getCounters(connHandleClient2, msgId), 1, nDeathBytes, 0, 0, "client 2 1");
+
+        // like sendToAllClientsExcept(client 1)
+        mts.addTxToAllClients(pktDeath, false, connHandleClient1);
+        b &= assertCounters(mts.getCounters(pge_network::ServerConnHandle, msgId), 1, nDeathBytes, 0, 0, "server 2");
+        b &= assertCounters(mts.getCounters(connHandleClient1, msgId), 1, nDeathBytes, 0, 0, "client 1 2");
+        b &= assertCounters(mts.getCounters(connHandleClient2, msgId), 2, 2 * nDeathBytes, 0, 0, "client 2 2");
+
+        // disconnected clients are not targets anymore but their counters are kept
+        mts.removeConnection(connHandleClient2);
+        mts.addTxToAllClients(pktDeath, false, pge_network::ServerConnHandle);
+        b &= assertCounters(mts.getCounters(connHandleClient1, msgId), 2, 2 * nDeathBytes, 0, 0, "client 1 3");
+        b &= assertCounters(mts.getCounters(connHandleClient2, msgId), 2, 2 * nDeathBytes, 0, 0, "client 2 3");
+
+        return b;
+    }
+
+    bool test_clients_total_excludes_server()
+    {
+        proofps_dd::MsgTrafficStats mts;
+        const pge_network::PgePacket pktDeath = makeDeathPkt();
+        const size_t nDeathBytes = getBytes(pktDeath);
+        constexpr auto msgId = proofps_dd::MsgDeathNotificationFromServer::id;
+
+        mts.addConnection(connHandleClient1);
+        mts.addConnection(connHandleClient2);
+        mts.addTxToAllClients(pktDeath, true, pge_network::ServerConnHandle);
+        mts.addRx(connHandleClient1, pktDeath);
+        mts.addRx(pge_network::ServerConnHandle, pktDeath);
+
+        return assertCounters(mts.getClientsTotalCounters(msgId), 2, 2 * nDeathBytes, 1, nDeathBytes, "total");
+    }
+
+    bool test_handler_duration()
+    {
+        proofps_dd::MsgTrafficStats mts;
+        constexpr auto msgId = proofps_dd::MsgDeathNotificationFromServer::id;
+
+        mts.addHandlerDuration(msgId, 10);
+        mts.addHandlerDuration(msgId, 30);
+        mts.addHandlerDuration(msgId, 20);
+        mts.addHandlerDuration(proofps_dd::PRooFPSappMsgId::LastMsgId, 1000);  // ignored
+
+        const proofps_dd::MsgTrafficStats::HandlerStats& handlerStats = mts.getHandlerStats(msgId);
+        return (assertEquals(static_cast<size_t>(3), handlerStats.m_nCalls, "calls") &
+            assertEquals(60ll, static_cast<long long>(handlerStats.m_nTotalUSecs), "total") &
+            assertEquals(30ll, static_cast<long long>(handlerStats.m_nMaxUSecs), "max") &
+            assertEquals(static_cast<size_t>(0), mts.getHandlerStats(proofps_dd::MsgMapChangeFromServer::id).m_nCalls, "other calls")) != 0;
+    }
+
+    bool test_clear_keeps_connected_only()
+    {
+        proofps_dd::MsgTrafficStats mts;
+        const pge_network::PgePacket pktDeath = makeDeathPkt();
+        const size_t nDeathBytes = getBytes(pktDeath);
+        constexpr auto msgId = proofps_dd::MsgDeathNotificationFromServer::id;
+
+        mts.addConnection(connHandleClient1);
+        mts.addConnection(connHandleClient2);
+        mts.addTxToAllClients(pktDeath, false, pge_network::ServerConnHandle);
+        mts.addHandlerDuration(msgId, 10);
+        mts.removeConnection(connHandleClient2);
+
+        mts.clear();
+        bool b = assertCounters(mts.getCounters(connHandleClient1, msgId), 0, 0, 0, 0, "client 1 cleared");
+        b &= assertCounters(mts.getCounters(connHandleClient2, msgId), 0, 0, 0, 0, "client 2 cleared");
+        b &= assertEquals(static_cast<size_t>(0), mts.getHandlerStats(msgId).m_nCalls, "calls");
+
+        // client 1 is still a broadcast target, client 2 is gone
+        mts.addTxToAllClients(pktDeath, false, pge_network::ServerConnHandle);
+        b &= assertCounters(mts.getCounters(connHandleClient1, msgId), 1, nDeathBytes, 0, 0, "client 1");
+        b &= assertCounters(mts.getCounters(connHandleClient2, msgId), 0, 0, 0, 0, "client 2");
+
+        return b;
+    }
+
+    bool test_reset_forgets_connections()
+    {
+        proofps_dd::MsgTrafficStats mts;
+        const pge_network::PgePacket pktDeath = makeDeathPkt();
+        constexpr auto msgId = proofps_dd::MsgDeathNotificationFromServer::id;
+
+        mts.addConnection(connHandleClient1);
+        mts.addTxToAllClients(pktDeath, false, pge_network::ServerConnHandle);
+
+        mts.reset();
+        mts.addTxToAllClients(pktDeath, false, pge_network::ServerConnHandle);
+
+        return assertCounters(mts.getCounters(connHandleClient1, msgId), 0, 0, 0, 0, "client 1");
+    }
+
+    bool test_dump_to_file()
+    {
+        proofps_dd::MsgTrafficStats mts;
+        const pge_network::PgePacket pktDeath = makeDeathPkt();
+
+        mts.addConnection(connHandleClient1);
+        mts.addTxToAllClients(pktDeath, true, pge_network::ServerConnHandle);
+        mts.addHandlerDuration(proofps_dd::MsgDeathNotificationFromServer::id, 10);
+
+        std::filesystem::remove(szDumpFilename);
+        bool b = assertTrue(mts.dumpToFile(szDumpFilename), "dump");
+        b &= assertTrue(std::filesystem::exists(szDumpFilename), "exists");
+        b &= assertLess(static_cast<std::uintmax_t>(0), std::filesystem::file_size(szDumpFilename), "size");
+        std::filesystem::remove(szDumpFilename);
+
+        return b;
+    }
+
+};
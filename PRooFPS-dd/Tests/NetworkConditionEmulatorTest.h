@@ -0,0 +1,216 @@
+#pragma once
+
+/*
+    ###################################################################################
+    NetworkConditionEmulatorTest.h
+    Unit test for PRooFPS-dd NetworkConditionEmulator.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "UnitTest.h"
+
+#include "NetworkConditionEmulator.h"
+#include "PRooFPS-dd-packet.h"
+
+class NetworkConditionEmulatorTest :
+    public UnitTest
+{
+public:
+
+    NetworkConditionEmulatorTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    NetworkConditionEmulatorTest(const NetworkConditionEmulatorTest&) = delete;
+    NetworkConditionEmulatorTest& operator=(const NetworkConditionEmulatorTest&) = delete;
+    NetworkConditionEmulatorTest(NetworkConditionEmulatorTest&&) = delete;
+    NetworkConditionEmulatorTest& operator=(NetworkConditionEmulatorTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        //CConsole::getConsoleInstance().SetLoggingState(proofps_dd::NetworkConditionEmulator::getLoggerModuleName(), true);
+
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&NetworkConditionEmulatorTest::test_initial_values);
+        addSubTest("test_conditions_per_connection", (PFNUNITSUBTEST)&NetworkConditionEmulatorTest::test_conditions_per_connection);
+        addSubTest("test_latency", (PFNUNITSUBTEST)&NetworkConditionEmulatorTest::test_latency);
+        addSubTest("test_unreliable_loss_and_stale", (PFNUNITSUBTEST)&NetworkConditionEmulatorTest::test_unreliable_loss_and_stale);
+        addSubTest("test_reliable_never_lost_and_in_order", (PFNUNITSUBTEST)&NetworkConditionEmulatorTest::test_reliable_never_lost_and_in_order);
+        addSubTest("test_same_seed_same_result", (PFNUNITSUBTEST)&NetworkConditionEmulatorTest::test_same_seed_same_result);
+    }
+
+    virtual void finalize() override
+    {
+        CConsole::getConsoleInstance().SetLoggingState(proofps_dd::NetworkConditionEmulator::getLoggerModuleName(), false);
+    }
+
+private:
+
+    using Direction = proofps_dd::NetworkConditionEmulator::Direction;
+
+    static constexpr auto msgIdUserUpdate = static_cast<pge_network::MsgApp::TMsgId>(proofps_dd::MsgUserUpdateFromServer::id);
+    static constexpr auto msgIdDeath = static_cast<pge_network::MsgApp::TMsgId>(proofps_dd::MsgDeathNotificationFromServer::id);
+
+    static pge_network::PgePacket makeUserUpdatePkt(const pge_network::PgeNetworkConnectionHandle& connHandle)
+    {
+        pge_network::PgePacket pkt;
+        proofps_dd::MsgUserUpdateFromServer::initPkt(
+            pkt, connHandle, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, false, false, false, 0.f, 0, 100, false, 0, 0, 0, 0.f, 0, false, 0.f);
+        return pkt;
+    }
+
+    static pge_network::PgePacket makeDeathPkt(const pge_network::PgeNetworkConnectionHandle& connHandle)
+    {
+        pge_network::PgePacket pkt;
+        proofps_dd::MsgDeathNotificationFromServer::initPkt(pkt, connHandle, connHandle);
+        return pkt;
+    }
+
+    bool test_initial_values()
+    {
+        const proofps_dd::NetworkConditionEmulator nce(1);
+        const auto& conditions = nce.getConditions(1, Direction::ServerToClient);
+        const auto& stats = nce.getMsgStats(msgIdUserUpdate);
+
+        return (assertEquals(0u, nce.getInFlightCount(), "in flight") &
+            assertEquals(0u, conditions.m_nLatencyMillisecs, "latency") &
+            assertEquals(0.f, conditions.m_fLossRate, "loss") &
+            assertEquals(0u, stats.m_nSent, "sent")) != 0;
+    }
+
+    bool test_conditions_per_connection()
+    {
+        proofps_dd::NetworkConditionEmulator nce(1);
+        proofps_dd::NetworkConditionEmulator::Conditions condDef;
+        condDef.m_nLatencyMillisecs = 10;
+        proofps_dd::NetworkConditionEmulator::Conditions cond2;
+        cond2.m_nLatencyMillisecs = 20;
+
+        nce.setDefaultConditions(Direction::ServerToClient, condDef);
+        nce.setConditions(2, Direction::ServerToClient, cond2);
+
+        return (assertEquals(10u, nce.getConditions(1, Direction::ServerToClient).m_nLatencyMillisecs, "default") &
+            assertEquals(20u, nce.getConditions(2, Direction::ServerToClient).m_nLatencyMillisecs, "conn 2") &
+            assertEquals(0u, nce.getConditions(2, Direction::ClientToServer).m_nLatencyMillisecs, "other direction")) != 0;
+    }
+
+    bool test_latency()
+    {
+        proofps_dd::NetworkConditionEmulator nce(1);
+        proofps_dd::NetworkConditionEmulator::Conditions cond;
+        cond.m_nLatencyMillisecs = 50;
+        nce.setDefaultConditions(Direction::ClientToServer, cond);
+
+        const auto timeStart = std::chrono::steady_clock::now();
+        nce.submit(1, Direction::ClientToServer, makeUserUpdatePkt(1), timeStart);
+
+        pge_network::PgePacket pkt;
+        pge_network::PgeNetworkConnectionHandle connHandle = 0;
+        Direction dir = Direction::ServerToClient;
+        bool b = assertFalse(nce.poll(timeStart + std::chrono::milliseconds(49), pkt, connHandle, dir), "poll early");
+        b &= assertTrue(nce.poll(timeStart + std::chrono::milliseconds(50), pkt, connHandle, dir), "poll due");
+        b &= assertEquals(1u, connHandle, "conn");
+        b &= assertTrue(dir == Direction::ClientToServer, "dir");
+        b &= assertEquals(1u, nce.getMsgStats(msgIdUserUpdate).m_nDelivered, "delivered");
+        b &= assertEquals(50000, static_cast<int>(nce.getMsgStats(msgIdUserUpdate).m_durQueueDelayTotal.count()), "queue delay");
+
+        return b;
+    }
+
+    bool test_unreliable_loss_and_stale()
+    {
+        proofps_dd::NetworkConditionEmulator nce(1);
+        proofps_dd::NetworkConditionEmulator::Conditions cond;
+        cond.m_nLatencyMillisecs = 50;
+        cond.m_nJitterMillisecs = 30;
+        cond.m_fLossRate = 0.2f;
+        cond.m_fReorderRate = 0.2f;
+        nce.setDefaultConditions(Direction::ServerToClient, cond);
+
+        const auto timeStart = std::chrono::steady_clock::now();
+        for (int i = 0; i < 1000; i++)
+        {
+            nce.submit(1, Direction::ServerToClient, makeUserUpdatePkt(1), timeStart + std::chrono::milliseconds(i * 16));
+        }
+
+        pge_network::PgePacket pkt;
+        pge_network::PgeNetworkConnectionHandle connHandle = 0;
+        Direction dir = Direction::ServerToClient;
+        size_t nStalePolled = 0;
+        while (nce.poll(timeStart + std::chrono::seconds(100), pkt, connHandle, dir))
+        {
+            if (nce.isLastPolledStale())
+            {
+                nStalePolled++;
+            }
+        }
+
+        const auto& stats = nce.getMsgStats(msgIdUserUpdate);
+        return (assertEquals(0u, nce.getInFlightCount(), "in flight") &
+            assertEquals(stats.m_nStale, nStalePolled, "stale polled") &
+            assertEquals(1000u, stats.m_nSent, "sent") &
+            assertLess(0u, stats.m_nLost, "lost") &
+            assertEquals(0u, stats.m_nResent, "resent") &
+            assertEquals(stats.m_nSent, stats.m_nLost + stats.m_nDelivered, "lost + delivered") &
+            assertLess(0u, stats.m_nStale, "stale")) != 0;
+    }
+
+    bool test_reliable_never_lost_and_in_order()
+    {
+        proofps_dd::NetworkConditionEmulator nce(1);
+        proofps_dd::NetworkConditionEmulator::Conditions cond;
+        cond.m_nLatencyMillisecs = 50;
+        cond.m_nJitterMillisecs = 30;
+        cond.m_fLossRate = 0.2f;
+        cond.m_fReorderRate = 0.2f;
+        nce.setDefaultConditions(Direction::ServerToClient, cond);
+
+        const auto timeStart = std::chrono::steady_clock::now();
+        for (int i = 0; i < 1000; i++)
+        {
+            nce.submit(1, Direction::ServerToClient, makeDeathPkt(1), timeStart + std::chrono::milliseconds(i * 16));
+        }
+
+        pge_network::PgePacket pkt;
+        pge_network::PgeNetworkConnectionHandle connHandle = 0;
+        Direction dir = Direction::ServerToClient;
+        while (nce.poll(timeStart + std::chrono::seconds(100), pkt, connHandle, dir))
+        {
+        }
+
+        const auto& stats = nce.getMsgStats(msgIdDeath);
+        return (assertEquals(1000u, stats.m_nDelivered, "delivered") &
+            assertEquals(0u, stats.m_nLost, "lost") &
+            assertLess(0u, stats.m_nResent, "resent") &
+            assertEquals(0u, stats.m_nStale, "stale")) != 0;
+    }
+
+    bool test_same_seed_same_result()
+    {
+        proofps_dd::NetworkConditionEmulator nce(1234);
+        proofps_dd::NetworkConditionEmulator::Conditions cond;
+        cond.m_nJitterMillisecs = 30;
+        cond.m_fLossRate = 0.3f;
+        nce.setDefaultConditions(Direction::ServerToClient, cond);
+
+        const auto timeStart = std::chrono::steady_clock::now();
+        size_t nLost[2]{};
+        for (int iRun = 0; iRun < 2; iRun++)
+        {
+            nce.reset(1234);
+            for (int i = 0; i < 100; i++)
+            {
+                nce.submit(1, Direction::ServerToClient, makeUserUpdatePkt(1), timeStart);
+            }
+            nLost[iRun] = nce.getMsgStats(msgIdUserUpdate).m_nLost;
+        }
+
+        return assertLess(0u, nLost[0], "lost") & assertEquals(nLost[0], nLost[1], "reproducible");
+    }
+
+}; // class NetworkConditionEmulatorTest
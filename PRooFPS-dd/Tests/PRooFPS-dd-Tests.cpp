@@ -22,15 +22,37 @@
 
 // unit tests
 #include "CameraHandlingTest.h"
+#include "ClientPredictionTest.h"
+#include "ClockSyncTest.h"
 #include "EventListerTest.h"
 #include "GameModeTest.h"
+#include "InputSamplerTest.h"
+#include "InterestManagementTest.h"
+#include "SendSchedulerTest.h"
+#include "JoinSnapshotTest.h"
 #include "MapItemTest.h"
 #include "MapcycleTest.h"
 #include "MapsTest.h"
+#include "MsgTrafficStatsTest.h"
+#include "NetworkConditionEmulatorTest.h"
+#include "PacketReceiveQueuesTest.h"
+#include "PhysicsTest.h"
+#include "PlayerHitboxHistoryTest.h"
+#include "PlayerSpatialIndexTest.h"
 #include "PlayerTest.h"
+#include "PooledObjectActiveListTest.h"
+#include "SendSchedulerTest.h"
+#include "SmokeBudgetTest.h"
+#include "SnapshotInterpolationTest.h"
+#include "SoundVoiceManagerTest.h"
+#include "SpscQueueTest.h"
+#include "StringTableTest.h"
+#include "TickTimerWheelTest.h"
+#include "WeaponDefinitionsTest.h"
 
 // performance tests (benchmarks)
 #include "EventListerPerfTest.h"
+#include "PlayerHitboxHistoryPerfTest.h"
 
 // regression smoke tests
 #include "RegTestBasicServerClient2Players.h"
@@ -86,15 +108,37 @@ int WINAPI WinMain(const _In_ HINSTANCE /*hInstance*/, const _In_opt_ HINSTANCE
     
     //// unit tests
     //unitTests.push_back(std::unique_ptr<Test>(new CameraHandlingTest(cfgProfiles)));
+    //unitTests.push_back(std::unique_ptr<Test>(new ClientPredictionTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new ClockSyncTest()));
     //unitTests.push_back(std::unique_ptr<Test>(new EventListerTest()));
     //unitTests.push_back(std::unique_ptr<Test>(new GameModeTest(cfgProfiles)));
+    //unitTests.push_back(std::unique_ptr<Test>(new InputSamplerTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new InterestManagementTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new SendSchedulerTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new JoinSnapshotTest()));
     //unitTests.push_back(std::unique_ptr<Test>(new MapItemTest(cfgProfiles)));
     //unitTests.push_back(std::unique_ptr<Test>(new MapsTest(cfgProfiles)));
     //unitTests.push_back(std::unique_ptr<Test>(new MapcycleTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new MsgTrafficStatsTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new NetworkConditionEmulatorTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new PacketReceiveQueuesTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new PhysicsTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new PlayerHitboxHistoryTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new PlayerSpatialIndexTest()));
     //unitTests.push_back(std::unique_ptr<Test>(new PlayerTest(cfgProfiles)));
+    //unitTests.push_back(std::unique_ptr<Test>(new PooledObjectActiveListTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new SendSchedulerTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new SmokeBudgetTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new SnapshotInterpolationTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new SoundVoiceManagerTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new SpscQueueTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new StringTableTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new TickTimerWheelTest()));
+    //unitTests.push_back(std::unique_ptr<Test>(new WeaponDefinitionsTest(cfgProfiles)));
     //
     //// performance tests (benchmarks)
     //perfTests.push_back(std::unique_ptr<Test>(new EventListerPerfTest()));
+    //perfTests.push_back(std::unique_ptr<Test>(new PlayerHitboxHistoryPerfTest()));
     
     // regression tests
     const proofps_dd::GameModeType gamemode = proofps_dd::GameModeType::TeamDeathMatch;
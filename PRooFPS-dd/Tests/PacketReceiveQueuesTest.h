@@ -0,0 +1,167 @@
+#pragma once
+
+/*
+    ###################################################################################
+    PacketReceiveQueuesTest.h
+    Unit test for PRooFPS-dd PacketReceiveQueues.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <cstring>
+
+#include "UnitTest.h"
+
+#include "PacketReceiveQueues.h"
+#include "PRooFPS-dd-packet.h"
+
+class PacketReceiveQueuesTest :
+    public UnitTest
+{
+public:
+
+    PacketReceiveQueuesTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    PacketReceiveQueuesTest(const PacketReceiveQueuesTest&) = delete;
+    PacketReceiveQueuesTest& operator=(const PacketReceiveQueuesTest&) = delete;
+    PacketReceiveQueuesTest(PacketReceiveQueuesTest&&) = delete;
+    PacketReceiveQueuesTest& operator=(PacketReceiveQueuesTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        //CConsole::getConsoleInstance().SetLoggingState(proofps_dd::PacketReceiveQueues::getLoggerModuleName(), true);
+
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&PacketReceiveQueuesTest::test_initial_values);
+        addSubTest("test_is_valid", (PFNUNITSUBTEST)&PacketReceiveQueuesTest::test_is_valid);
+        addSubTest("test_push_invalid", (PFNUNITSUBTEST)&PacketReceiveQueuesTest::test_push_invalid);
+        addSubTest("test_push_pop_keeps_order_of_receiving", (PFNUNITSUBTEST)&PacketReceiveQueuesTest::test_push_pop_keeps_order_of_receiving);
+        addSubTest("test_clear", (PFNUNITSUBTEST)&PacketReceiveQueuesTest::test_clear);
+    }
+
+    virtual void finalize() override
+    {
+        CConsole::getConsoleInstance().SetLoggingState(proofps_dd::PacketReceiveQueues::getLoggerModuleName(), false);
+    }
+
+private:
+
+    /** Initializes the given packet with an app msg of the given id, having the given number as its first byte. */
+    static bool initPkt(
+        pge_network::PgePacket& pkt,
+        const proofps_dd::PRooFPSappMsgId& msgId,
+        const pge_network::TByte& nTag)
+    {
+        pge_network::PgePacket::initPktMsgApp(pkt, 0);
+        pge_network::TByte* const pMsgAppData = pge_network::PgePacket::preparePktMsgAppFill(
+            pkt, static_cast<pge_network::MsgApp::TMsgId>(msgId), 1);
+        if (!pMsgAppData)
+        {
+            return false;
+        }
+        *pMsgAppData = nTag;
+        return true;
+    }
+
+    static pge_network::TByte getTag(const pge_network::PgePacket& pkt)
+    {
+        return pge_network::PgePacket::getMsgAppDataFromPkt<const pge_network::TByte>(pkt);
+    }
+
+    bool test_initial_values()
+    {
+        const proofps_dd::PacketReceiveQueues queues;
+
+        return assertEquals(0u, queues.size(), "size");
+    }
+
+    bool test_is_valid()
+    {
+        pge_network::PgePacket pkt;
+
+        bool b = assertTrue(initPkt(pkt, proofps_dd::PRooFPSappMsgId::MapChangeFromServer, 0), "initPkt 1");
+        b &= assertTrue(proofps_dd::PacketReceiveQueues::isValid(pkt), "valid 1");
+
+        b &= assertTrue(initPkt(pkt, proofps_dd::PRooFPSappMsgId::UserCmdFromClient, 0), "initPkt 2");
+        b &= assertTrue(proofps_dd::PacketReceiveQueues::isValid(pkt), "valid 2");
+
+        b &= assertTrue(initPkt(pkt, proofps_dd::PRooFPSappMsgId::LastMsgId, 0), "initPkt 3");
+        b &= assertFalse(proofps_dd::PacketReceiveQueues::isValid(pkt), "valid 3");
+
+        return b;
+    }
+
+    bool test_push_invalid()
+    {
+        proofps_dd::PacketReceiveQueues queues;
+        pge_network::PgePacket pkt;
+
+        bool b = assertTrue(initPkt(pkt, proofps_dd::PRooFPSappMsgId::LastMsgId, 0), "initPkt");
+        b &= assertFalse(queues.push(pkt), "push");
+        b &= assertEquals(0u, queues.size(), "size");
+
+        return b;
+    }
+
+    bool test_push_pop_keeps_order_of_receiving()
+    {
+        proofps_dd::PacketReceiveQueues queues;
+        pge_network::PgePacket pkt;
+
+        // messages of different delivery are still handled in the order of receiving
+        const proofps_dd::PRooFPSappMsgId msgIds[] = {
+            proofps_dd::PRooFPSappMsgId::UserUpdateFromServer,
+            proofps_dd::PRooFPSappMsgId::WpnUpdateFromServer,
+            proofps_dd::PRooFPSappMsgId::UserCmdFromClient };
+
+        bool b = true;
+        for (pge_network::TByte i = 0; i < 9; i++)
+        {
+            b &= assertTrue(initPkt(pkt, msgIds[i % 3], i), "initPkt");
+            b &= assertTrue(queues.push(pkt), "push");
+        }
+        b &= assertEquals(9u, queues.size(), "size");
+
+        for (pge_network::TByte i = 0; i < 9; i++)
+        {
+            b &= assertTrue(queues.pop(pkt), "pop");
+            b &= assertEquals(static_cast<int>(i), static_cast<int>(getTag(pkt)), "tag");
+        }
+        b &= assertFalse(queues.pop(pkt), "pop empty");
+
+        return b;
+    }
+
+    bool test_clear()
+    {
+        proofps_dd::PacketReceiveQueues queues;
+        pge_network::PgePacket pkt;
+
+        bool b = true;
+        for (pge_network::TByte i = 0; i < 4; i++)
+        {
+            b &= assertTrue(initPkt(pkt, proofps_dd::PRooFPSappMsgId::MapItemUpdateFromServer, i), "initPkt 1");
+            b &= assertTrue(queues.push(pkt), "push 1");
+        }
+
+        queues.clear();
+
+        b &= assertEquals(0u, queues.size(), "size");
+        b &= assertFalse(queues.pop(pkt), "pop 1");
+
+        // queue is still usable after clearing
+        b &= assertTrue(initPkt(pkt, proofps_dd::PRooFPSappMsgId::MapItemUpdateFromServer, 9), "initPkt 2");
+        b &= assertTrue(queues.push(pkt), "push 2");
+        b &= assertTrue(queues.pop(pkt), "pop 2");
+        b &= assertEquals(9, static_cast<int>(getTag(pkt)), "tag 2");
+
+        return b;
+    }
+
+};
@@ -0,0 +1,164 @@
+#pragma once
+
+/*
+    ###################################################################################
+    PhysicsTest.h
+    Unit test for PRooFPS-dd Physics.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "UnitTest.h"
+
+#include "Physics.h"
+
+class PhysicsTest :
+    public UnitTest
+{
+public:
+
+    PhysicsTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    PhysicsTest(const PhysicsTest&) = delete;
+    PhysicsTest& operator=(const PhysicsTest&) = delete;
+    PhysicsTest(PhysicsTest&&) = delete;
+    PhysicsTest& operator=(PhysicsTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        addSubTest("test_colliding2_NoZ_swept_miss", (PFNUNITSUBTEST)&PhysicsTest::test_colliding2_NoZ_swept_miss);
+        addSubTest("test_colliding2_NoZ_swept_passing_through_thin_object", (PFNUNITSUBTEST)&PhysicsTest::test_colliding2_NoZ_swept_passing_through_thin_object);
+        addSubTest("test_colliding2_NoZ_swept_diagonal", (PFNUNITSUBTEST)&PhysicsTest::test_colliding2_NoZ_swept_diagonal);
+        addSubTest("test_colliding2_NoZ_swept_already_colliding", (PFNUNITSUBTEST)&PhysicsTest::test_colliding2_NoZ_swept_already_colliding);
+        addSubTest("test_colliding2_NoZ_swept_not_moving", (PFNUNITSUBTEST)&PhysicsTest::test_colliding2_NoZ_swept_not_moving);
+        addSubTest("test_colliding2_NoZ_swept_touching_at_end", (PFNUNITSUBTEST)&PhysicsTest::test_colliding2_NoZ_swept_touching_at_end);
+    }
+
+private:
+
+    bool test_colliding2_NoZ_swept_miss()
+    {
+        float fHitTime = -1.f;
+
+        // moving parallel to the object, above it
+        bool b = assertFalse(proofps_dd::Physics::colliding2_NoZ_swept(
+            -10.f, 2.f, 10.f, 2.f, 1.f, 1.f,
+            0.f, 0.f, 1.f, 1.f,
+            fHitTime), "parallel");
+
+        // moving towards the object but stopping before it
+        b &= assertFalse(proofps_dd::Physics::colliding2_NoZ_swept(
+            -10.f, 0.f, -2.f, 0.f, 1.f, 1.f,
+            0.f, 0.f, 1.f, 1.f,
+            fHitTime), "stopping before");
+
+        // moving away from the object
+        b &= assertFalse(proofps_dd::Physics::colliding2_NoZ_swept(
+            -2.f, 0.f, -10.f, 0.f, 1.f, 1.f,
+            0.f, 0.f, 1.f, 1.f,
+            fHitTime), "moving away");
+
+        b &= assertEquals(-1.f, fHitTime, "hit time untouched");
+
+        return b;
+    }
+
+    bool test_colliding2_NoZ_swept_passing_through_thin_object()
+    {
+        // end position is already beyond the thin object, so testing only the end position would miss it
+        bool b = assertFalse(proofps_dd::Physics::colliding2_NoZ(
+            10.f, 0.f, 0.2f, 0.2f,
+            0.f, 0.f, 0.1f, 4.f), "end position");
+
+        float fHitTime = -1.f;
+        b &= assertTrue(proofps_dd::Physics::colliding2_NoZ_swept(
+            -10.f, 0.f, 10.f, 0.f, 0.2f, 0.2f,
+            0.f, 0.f, 0.1f, 4.f,
+            fHitTime), "swept");
+        // touching when center is at -0.15, that is 9.85 units from the 20 units long path
+        b &= assertEquals(9.85f / 20.f, fHitTime, 0.0001f, "hit time");
+
+        // same but moving the other way
+        b &= assertTrue(proofps_dd::Physics::colliding2_NoZ_swept(
+            10.f, 0.f, -10.f, 0.f, 0.2f, 0.2f,
+            0.f, 0.f, 0.1f, 4.f,
+            fHitTime), "swept backwards");
+        b &= assertEquals(9.85f / 20.f, fHitTime, 0.0001f, "hit time backwards");
+
+        return b;
+    }
+
+    bool test_colliding2_NoZ_swept_diagonal()
+    {
+        float fHitTime = -1.f;
+
+        // both slabs are entered at the same time
+        bool b = assertTrue(proofps_dd::Physics::colliding2_NoZ_swept(
+            -4.f, -4.f, 4.f, 4.f, 1.f, 1.f,
+            0.f, 0.f, 2.f, 2.f,
+            fHitTime), "diagonal");
+        // touching when center is at -1.5 on both axes
+        b &= assertEquals(2.5f / 8.f, fHitTime, 0.0001f, "hit time");
+
+        // diagonal path missing the object: X slab is left before Y slab is entered
+        b &= assertFalse(proofps_dd::Physics::colliding2_NoZ_swept(
+            -4.f, 0.f, 0.f, 6.f, 1.f, 1.f,
+            0.f, 0.f, 2.f, 2.f,
+            fHitTime), "diagonal miss");
+
+        return b;
+    }
+
+    bool test_colliding2_NoZ_swept_already_colliding()
+    {
+        float fHitTime = -1.f;
+
+        bool b = assertTrue(proofps_dd::Physics::colliding2_NoZ_swept(
+            0.2f, 0.f, 10.f, 0.f, 1.f, 1.f,
+            0.f, 0.f, 1.f, 1.f,
+            fHitTime), "colliding at start");
+        b &= assertEquals(0.f, fHitTime, "hit time");
+
+        return b;
+    }
+
+    bool test_colliding2_NoZ_swept_not_moving()
+    {
+        float fHitTime = -1.f;
+
+        bool b = assertTrue(proofps_dd::Physics::colliding2_NoZ_swept(
+            0.5f, 0.5f, 0.5f, 0.5f, 1.f, 1.f,
+            0.f, 0.f, 1.f, 1.f,
+            fHitTime), "not moving, colliding");
+        b &= assertEquals(0.f, fHitTime, "hit time");
+
+        b &= assertFalse(proofps_dd::Physics::colliding2_NoZ_swept(
+            3.f, 0.f, 3.f, 0.f, 1.f, 1.f,
+            0.f, 0.f, 1.f, 1.f,
+            fHitTime), "not moving, not colliding");
+
+        return b;
+    }
+
+    bool test_colliding2_NoZ_swept_touching_at_end()
+    {
+        float fHitTime = -1.f;
+
+        // same as with colliding2_NoZ(), touching counts as colliding
+        bool b = assertTrue(proofps_dd::Physics::colliding2_NoZ_swept(
+            -5.f, 0.f, -1.f, 0.f, 1.f, 1.f,
+            0.f, 0.f, 1.f, 1.f,
+            fHitTime), "touching at end");
+        b &= assertEquals(1.f, fHitTime, "hit time");
+
+        return b;
+    }
+
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+/*
+    ###################################################################################
+    PlayerHitboxHistoryPerfTest.h
+    Performance test for PRooFPS-dd PlayerHitboxHistory.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "Benchmarks.h"
+
+#include "PlayerHitboxHistory.h"
+
+class PlayerHitboxHistoryPerfTest :
+    public Benchmark
+{
+public:
+
+    PlayerHitboxHistoryPerfTest() :
+        Benchmark(__FILE__)
+    {
+    }
+
+    PlayerHitboxHistoryPerfTest(const PlayerHitboxHistoryPerfTest&) = delete;
+    PlayerHitboxHistoryPerfTest& operator=(const PlayerHitboxHistoryPerfTest&) = delete;
+    PlayerHitboxHistoryPerfTest(PlayerHitboxHistoryPerfTest&&) = delete;
+    PlayerHitboxHistoryPerfTest& operator=(PlayerHitboxHistoryPerfTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        addSubTest("test_benchmark_record_and_rewind_15_players", (PFNUNITSUBTEST)&PlayerHitboxHistoryPerfTest::test_benchmark_record_and_rewind_15_players);
+    }
+
+private:
+
+    // ---------------------------------------------------------------------------
+
+
+    /**
+    * In every tick the hitboxes of 15 players are recorded, then every player fires a bullet which is hit-tested against
+    * all other players rewound by a different amount of ticks, up to the max rewind, like with 15 clients having different pings.
+    */
+    bool test_benchmark_record_and_rewind_15_players()
+    {
+        constexpr pge_network::PgeNetworkConnectionHandle nPlayers = 15u;
+        constexpr std::uint32_t nTicks = 100000u;
+        proofps_dd::PlayerHitboxHistory history;
+
+        size_t nHitboxesFound = 0;
+        float fSumPosX = 0.f;  // so the lookups are not optimized out
+        {
+            ScopeBenchmarker<std::chrono::milliseconds> scopeBm("bm record and rewind 15 players");
+            proofps_dd::PlayerHitboxHistory::Hitbox hitbox{};
+            for (std::uint32_t nTick = 1; nTick <= nTicks; nTick++)
+            {
+                history.beginTick(nTick);
+                for (pge_network::PgeNetworkConnectionHandle iPlayer = 0; iPlayer < nPlayers; iPlayer++)
+                {
+                    history.addHitbox(iPlayer, static_cast<float>(nTick % 100) + iPlayer, 0.f, 1.f, 2.f);
+                }
+
+                for (pge_network::PgeNetworkConnectionHandle iShooter = 0; iShooter < nPlayers; iShooter++)
+                {
+                    const std::uint32_t nRewindTicks = (iShooter * 2) % (proofps_dd::PlayerHitboxHistory::nMaxRewindTicks + 1);
+                    for (pge_network::PgeNetworkConnectionHandle iTarget = 0; iTarget < nPlayers; iTarget++)
+                    {
+                        if ((iTarget != iShooter) && history.getHitbox(nTick - nRewindTicks, iTarget, hitbox))
+                        {
+                            ++nHitboxesFound;
+                            fSumPosX += hitbox.m_fPosX;
+                        }
+                    }
+                }
+            }
+        }
+
+        CConsole::getConsoleInstance().OLn("Hitboxes found: %u, sum x: %f", nHitboxesFound, fSumPosX);
+
+        // only the first few ticks cannot be rewound by the shooters with non-zero rewind
+        return assertLess(static_cast<size_t>(nTicks - 100) * nPlayers * (nPlayers - 1), nHitboxesFound, "hitboxes found");
+    }
+
+}; // class PlayerHitboxHistoryPerfTest
@@ -0,0 +1,187 @@
+#pragma once
+
+/*
+    ###################################################################################
+    PlayerHitboxHistoryTest.h
+    Unit test for PRooFPS-dd PlayerHitboxHistory.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "UnitTest.h"
+
+#include "PlayerHitboxHistory.h"
+
+class PlayerHitboxHistoryTest :
+    public UnitTest
+{
+public:
+
+    PlayerHitboxHistoryTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    PlayerHitboxHistoryTest(const PlayerHitboxHistoryTest&) = delete;
+    PlayerHitboxHistoryTest& operator=(const PlayerHitboxHistoryTest&) = delete;
+    PlayerHitboxHistoryTest(PlayerHitboxHistoryTest&&) = delete;
+    PlayerHitboxHistoryTest& operator=(PlayerHitboxHistoryTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        addSubTest("test_get_max_rewind_ticks", (PFNUNITSUBTEST)&PlayerHitboxHistoryTest::test_get_max_rewind_ticks);
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&PlayerHitboxHistoryTest::test_initial_values);
+        addSubTest("test_add_hitbox_without_begin_tick", (PFNUNITSUBTEST)&PlayerHitboxHistoryTest::test_add_hitbox_without_begin_tick);
+        addSubTest("test_add_hitbox_fails_when_tick_full", (PFNUNITSUBTEST)&PlayerHitboxHistoryTest::test_add_hitbox_fails_when_tick_full);
+        addSubTest("test_get_hitbox", (PFNUNITSUBTEST)&PlayerHitboxHistoryTest::test_get_hitbox);
+        addSubTest("test_invalidate_player", (PFNUNITSUBTEST)&PlayerHitboxHistoryTest::test_invalidate_player);
+        addSubTest("test_oldest_tick_overwritten", (PFNUNITSUBTEST)&PlayerHitboxHistoryTest::test_oldest_tick_overwritten);
+        addSubTest("test_clear", (PFNUNITSUBTEST)&PlayerHitboxHistoryTest::test_clear);
+    }
+
+private:
+
+    bool test_get_max_rewind_ticks()
+    {
+        return (assertEquals(proofps_dd::PlayerHitboxHistory::nMaxRewindTicks, proofps_dd::PlayerHitboxHistory::getMaxRewindTicks(proofps_dd::PlayerHitboxHistory::nTickRateMax), "max tickrate") &
+            assertEquals(proofps_dd::PlayerHitboxHistory::nMaxRewindTicks / 3, proofps_dd::PlayerHitboxHistory::getMaxRewindTicks(20), "20 Hz") &
+            assertEquals(proofps_dd::PlayerHitboxHistory::nMaxRewindTicks, proofps_dd::PlayerHitboxHistory::getMaxRewindTicks(1000), "too high tickrate")) != 0;
+    }
+
+    bool test_initial_values()
+    {
+        const proofps_dd::PlayerHitboxHistory history;
+        proofps_dd::PlayerHitboxHistory::Hitbox hitbox{ 5u, 1.f, 2.f, 3.f, 4.f };
+
+        return (assertFalse(history.getHitbox(0, 5u, hitbox), "get hitbox tick 0") &
+            assertFalse(history.getHitbox(1, 5u, hitbox), "get hitbox tick 1") &
+            assertEquals(1.f, hitbox.m_fPosX, "hitbox untouched")) != 0;
+    }
+
+    bool test_add_hitbox_without_begin_tick()
+    {
+        proofps_dd::PlayerHitboxHistory history;
+        bool b = assertFalse(history.addHitbox(5u, 1.f, 2.f, 3.f, 4.f), "add 1");
+
+        // tick 0 is not sequenced, cannot be recorded
+        history.beginTick(0);
+        b &= assertFalse(history.addHitbox(5u, 1.f, 2.f, 3.f, 4.f), "add 2");
+
+        return b;
+    }
+
+    bool test_add_hitbox_fails_when_tick_full()
+    {
+        proofps_dd::PlayerHitboxHistory history;
+        history.beginTick(1);
+        bool b = true;
+        for (pge_network::PgeNetworkConnectionHandle i = 0; i < proofps_dd::PlayerHitboxHistory::nMaxHitboxesPerTick; i++)
+        {
+            b &= assertTrue(history.addHitbox(i, 1.f, 2.f, 3.f, 4.f), ("add " + std::to_string(i)).c_str());
+        }
+        b &= assertFalse(history.addHitbox(1000u, 1.f, 2.f, 3.f, 4.f), "add over capacity");
+
+        // next tick has space again
+        history.beginTick(2);
+        b &= assertTrue(history.addHitbox(1000u, 1.f, 2.f, 3.f, 4.f), "add next tick");
+
+        return b;
+    }
+
+    bool test_get_hitbox()
+    {
+        proofps_dd::PlayerHitboxHistory history;
+        history.beginTick(10);
+        history.addHitbox(5u, 1.f, 2.f, 3.f, 4.f);
+        history.addHitbox(6u, 5.f, 6.f, 7.f, 8.f);
+        history.beginTick(11);
+        history.addHitbox(5u, 11.f, 12.f, 13.f, 14.f);
+
+        proofps_dd::PlayerHitboxHistory::Hitbox hitbox{};
+        bool b = assertTrue(history.getHitbox(10, 6u, hitbox), "get 10 6");
+        b &= assertEquals(6u, hitbox.m_connHandle, "connhandle 10 6");
+        b &= assertEquals(5.f, hitbox.m_fPosX, "x 10 6");
+        b &= assertEquals(6.f, hitbox.m_fPosY, "y 10 6");
+        b &= assertEquals(7.f, hitbox.m_fSizeX, "sx 10 6");
+        b &= assertEquals(8.f, hitbox.m_fSizeY, "sy 10 6");
+
+        b &= assertTrue(history.getHitbox(11, 5u, hitbox), "get 11 5");
+        b &= assertEquals(11.f, hitbox.m_fPosX, "x 11 5");
+
+        b &= assertFalse(history.getHitbox(11, 6u, hitbox), "get 11 6");
+        b &= assertFalse(history.getHitbox(12, 5u, hitbox), "get 12 5");
+        b &= assertFalse(history.getHitbox(9, 5u, hitbox), "get 9 5");
+        b &= assertEquals(11.f, hitbox.m_fPosX, "hitbox untouched");
+
+        return b;
+    }
+
+    bool test_invalidate_player()
+    {
+        proofps_dd::PlayerHitboxHistory history;
+        for (std::uint32_t nTick = 1; nTick <= 3; nTick++)
+        {
+            history.beginTick(nTick);
+            history.addHitbox(5u, 1.f, 0.f, 1.f, 1.f);
+            history.addHitbox(6u, 2.f, 0.f, 1.f, 1.f);
+            history.addHitbox(7u, 3.f, 0.f, 1.f, 1.f);
+        }
+
+        history.invalidatePlayer(5u);
+
+        proofps_dd::PlayerHitboxHistory::Hitbox hitbox{};
+        bool b = true;
+        for (std::uint32_t nTick = 1; nTick <= 3; nTick++)
+        {
+            b &= assertFalse(history.getHitbox(nTick, 5u, hitbox), "get 5");
+            b &= assertTrue(history.getHitbox(nTick, 6u, hitbox), "get 6");
+            b &= assertEquals(2.f, hitbox.m_fPosX, "x 6");
+            b &= assertTrue(history.getHitbox(nTick, 7u, hitbox), "get 7");
+            b &= assertEquals(3.f, hitbox.m_fPosX, "x 7");
+        }
+
+        // recording continues in the current tick
+        b &= assertTrue(history.addHitbox(5u, 10.f, 0.f, 1.f, 1.f), "add 5");
+        b &= assertTrue(history.getHitbox(3, 5u, hitbox), "get 5 again");
+        b &= assertEquals(10.f, hitbox.m_fPosX, "x 5 again");
+
+        return b;
+    }
+
+    bool test_oldest_tick_overwritten()
+    {
+        proofps_dd::PlayerHitboxHistory history;
+        constexpr std::uint32_t nTicks = static_cast<std::uint32_t>(proofps_dd::PlayerHitboxHistory::nCapacityTicks) + 5;
+        for (std::uint32_t nTick = 1; nTick <= nTicks; nTick++)
+        {
+            history.beginTick(nTick);
+            history.addHitbox(5u, static_cast<float>(nTick), 0.f, 1.f, 1.f);
+        }
+
+        proofps_dd::PlayerHitboxHistory::Hitbox hitbox{};
+        bool b = assertFalse(history.getHitbox(nTicks - static_cast<std::uint32_t>(proofps_dd::PlayerHitboxHistory::nCapacityTicks), 5u, hitbox), "get overwritten");
+        b &= assertTrue(history.getHitbox(nTicks - proofps_dd::PlayerHitboxHistory::nMaxRewindTicks, 5u, hitbox), "get oldest");
+        b &= assertEquals(static_cast<float>(nTicks - proofps_dd::PlayerHitboxHistory::nMaxRewindTicks), hitbox.m_fPosX, "x oldest");
+        b &= assertTrue(history.getHitbox(nTicks, 5u, hitbox), "get newest");
+        b &= assertEquals(static_cast<float>(nTicks), hitbox.m_fPosX, "x newest");
+
+        return b;
+    }
+
+    bool test_clear()
+    {
+        proofps_dd::PlayerHitboxHistory history;
+        history.beginTick(1);
+        history.addHitbox(5u, 1.f, 2.f, 3.f, 4.f);
+        history.clear();
+
+        proofps_dd::PlayerHitboxHistory::Hitbox hitbox{};
+        return (assertFalse(history.getHitbox(1, 5u, hitbox), "get") &
+            assertFalse(history.addHitbox(5u, 1.f, 2.f, 3.f, 4.f), "add without begin tick")) != 0;
+    }
+
+};
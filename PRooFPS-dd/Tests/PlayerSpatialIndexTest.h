@@ -0,0 +1,183 @@
+#pragma once
+
+/*
+    ###################################################################################
+    PlayerSpatialIndexTest.h
+    Unit test for PRooFPS-dd PlayerSpatialIndex.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "UnitTest.h"
+
+#include "PlayerSpatialIndex.h"
+
+class PlayerSpatialIndexTest :
+    public UnitTest
+{
+public:
+
+    PlayerSpatialIndexTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    PlayerSpatialIndexTest(const PlayerSpatialIndexTest&) = delete;
+    PlayerSpatialIndexTest& operator=(const PlayerSpatialIndexTest&) = delete;
+    PlayerSpatialIndexTest(PlayerSpatialIndexTest&&) = delete;
+    PlayerSpatialIndexTest& operator=(PlayerSpatialIndexTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&PlayerSpatialIndexTest::test_initial_values);
+        addSubTest("test_query_empty", (PFNUNITSUBTEST)&PlayerSpatialIndexTest::test_query_empty);
+        addSubTest("test_query_finds_only_players_in_range", (PFNUNITSUBTEST)&PlayerSpatialIndexTest::test_query_finds_only_players_in_range);
+        addSubTest("test_query_player_spanning_multiple_cells_found_once", (PFNUNITSUBTEST)&PlayerSpatialIndexTest::test_query_player_spanning_multiple_cells_found_once);
+        addSubTest("test_query_result_in_order_of_adding", (PFNUNITSUBTEST)&PlayerSpatialIndexTest::test_query_result_in_order_of_adding);
+        addSubTest("test_query_negative_coords", (PFNUNITSUBTEST)&PlayerSpatialIndexTest::test_query_negative_coords);
+        addSubTest("test_query_huge_radius", (PFNUNITSUBTEST)&PlayerSpatialIndexTest::test_query_huge_radius);
+        addSubTest("test_clear", (PFNUNITSUBTEST)&PlayerSpatialIndexTest::test_clear);
+    }
+
+private:
+
+    using HandleVec = std::vector<pge_network::PgeNetworkConnectionHandle>;
+
+    bool test_initial_values()
+    {
+        const proofps_dd::PlayerSpatialIndex index;
+        const proofps_dd::PlayerSpatialIndex index2(2.f);
+
+        return (assertEquals(proofps_dd::PlayerSpatialIndex::fCellSizeDef, index.getCellSize(), "cell size def") &
+            assertEquals(2.f, index2.getCellSize(), "cell size 2") &
+            assertEquals(0u, index.size(), "size")) != 0;
+    }
+
+    bool test_query_empty()
+    {
+        proofps_dd::PlayerSpatialIndex index;
+        index.build();
+
+        HandleVec vecResult{ 5u };
+        index.queryRadius(0.f, 0.f, 10.f, vecResult);
+
+        return assertTrue(vecResult.empty(), "result");
+    }
+
+    bool test_query_finds_only_players_in_range()
+    {
+        proofps_dd::PlayerSpatialIndex index;
+        index.add(1u, 0.f, 0.f, 1.f, 2.f);
+        index.add(2u, 3.f, 0.f, 1.f, 2.f);
+        index.add(3u, 30.f, 0.f, 1.f, 2.f);
+        index.add(4u, 0.f, 30.f, 1.f, 2.f);
+        index.build();
+
+        HandleVec vecResult;
+        index.queryRadius(1.f, 0.f, 2.f, vecResult);
+        bool b = assertTrue(HandleVec{ 1u, 2u } == vecResult, "query 1");
+
+        // edge of player 2's box is at 2.5, touching counts
+        index.queryRadius(0.f, 0.f, 2.5f, vecResult);
+        b &= assertTrue(HandleVec{ 1u, 2u } == vecResult, "query 2");
+
+        index.queryRadius(0.f, 0.f, 1.9f, vecResult);
+        b &= assertTrue(HandleVec{ 1u } == vecResult, "query 3");
+
+        index.queryRadius(30.f, 1.5f, 1.f, vecResult);
+        b &= assertTrue(HandleVec{ 3u } == vecResult, "query 4");
+
+        index.queryRadius(15.f, 15.f, 3.f, vecResult);
+        b &= assertTrue(vecResult.empty(), "query 5");
+
+        return b & assertEquals(4u, index.size(), "size");
+    }
+
+    bool test_query_player_spanning_multiple_cells_found_once()
+    {
+        proofps_dd::PlayerSpatialIndex index(1.f);
+        index.add(7u, 0.f, 0.f, 5.f, 5.f);
+        index.build();
+
+        HandleVec vecResult;
+        index.queryRadius(0.f, 0.f, 3.f, vecResult);
+        bool b = assertTrue(HandleVec{ 7u } == vecResult, "query 1");
+
+        index.queryRadius(2.4f, -2.4f, 0.5f, vecResult);
+        b &= assertTrue(HandleVec{ 7u } == vecResult, "query 2");
+
+        return b;
+    }
+
+    bool test_query_result_in_order_of_adding()
+    {
+        proofps_dd::PlayerSpatialIndex index(1.f);
+        // cells are visited in a different order than the order of adding
+        index.add(9u, 2.f, 2.f, 1.f, 1.f);
+        index.add(3u, -2.f, -2.f, 1.f, 1.f);
+        index.add(5u, 2.f, -2.f, 1.f, 1.f);
+        index.add(1u, -2.f, 2.f, 1.f, 1.f);
+        index.build();
+
+        HandleVec vecResult;
+        index.queryRadius(0.f, 0.f, 3.f, vecResult);
+
+        return assertTrue(HandleVec{ 9u, 3u, 5u, 1u } == vecResult, "result");
+    }
+
+    bool test_query_negative_coords()
+    {
+        proofps_dd::PlayerSpatialIndex index;
+        index.add(1u, -0.5f, -0.5f, 0.5f, 0.5f);
+        index.add(2u, 0.5f, 0.5f, 0.5f, 0.5f);
+        index.add(3u, -100.f, -50.f, 1.f, 2.f);
+        index.build();
+
+        HandleVec vecResult;
+        index.queryRadius(-0.5f, -0.5f, 0.3f, vecResult);
+        bool b = assertTrue(HandleVec{ 1u } == vecResult, "query 1");
+
+        index.queryRadius(-101.f, -50.f, 1.f, vecResult);
+        b &= assertTrue(HandleVec{ 3u } == vecResult, "query 2");
+
+        return b;
+    }
+
+    bool test_query_huge_radius()
+    {
+        proofps_dd::PlayerSpatialIndex index(1.f);
+        index.add(1u, 0.f, 0.f, 1.f, 2.f);
+        index.add(2u, 500.f, 0.f, 1.f, 2.f);
+        index.add(3u, 5000.f, 0.f, 1.f, 2.f);
+        index.build();
+
+        HandleVec vecResult;
+        index.queryRadius(0.f, 0.f, 1000.f, vecResult);
+
+        return assertTrue(HandleVec{ 1u, 2u } == vecResult, "result");
+    }
+
+    bool test_clear()
+    {
+        proofps_dd::PlayerSpatialIndex index;
+        index.add(1u, 0.f, 0.f, 1.f, 2.f);
+        index.build();
+        index.clear();
+        index.add(2u, 10.f, 0.f, 1.f, 2.f);
+        index.build();
+
+        HandleVec vecResult;
+        index.queryRadius(0.f, 0.f, 2.f, vecResult);
+        bool b = assertTrue(vecResult.empty(), "query 1");
+
+        index.queryRadius(10.f, 0.f, 2.f, vecResult);
+        b &= assertTrue(HandleVec{ 2u } == vecResult, "query 2");
+
+        return b & assertEquals(1u, index.size(), "size");
+    }
+
+}; // class PlayerSpatialIndexTest
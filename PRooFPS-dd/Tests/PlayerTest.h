@@ -59,7 +59,6 @@ protected:
         addSubTest("test_initial_values", (PFNUNITSUBTEST)&PlayerTest::test_initial_values);
         addSubTest("test_set_name", (PFNUNITSUBTEST)&PlayerTest::test_set_name);
         addSubTest("test_set_booted_up", (PFNUNITSUBTEST)&PlayerTest::test_set_booted_up);
-        addSubTest("test_set_expecting_after_boot_up_delayed_update", (PFNUNITSUBTEST)&PlayerTest::test_set_expecting_after_boot_up_delayed_update);
         addSubTest("test_show", (PFNUNITSUBTEST)&PlayerTest::test_show);
         addSubTest("test_hide", (PFNUNITSUBTEST)&PlayerTest::test_hide);
         addSubTest("test_set_visibility_state", (PFNUNITSUBTEST)&PlayerTest::test_set_visibility_state);
@@ -68,6 +67,7 @@ protected:
         addSubTest("test_dirtiness_one_by_one", (PFNUNITSUBTEST)&PlayerTest::test_dirtiness_one_by_one);
         addSubTest("test_update_old_frags_and_deaths", (PFNUNITSUBTEST)&PlayerTest::test_update_old_frags_and_deaths);
         addSubTest("test_set_just_created_and_expecting_start_pos", (PFNUNITSUBTEST)&PlayerTest::test_set_just_created_and_expecting_start_pos);
+        addSubTest("test_set_last_cmd_seq_processed", (PFNUNITSUBTEST)&PlayerTest::test_set_last_cmd_seq_processed);
         addSubTest("test_update_old_pos", (PFNUNITSUBTEST)&PlayerTest::test_update_old_pos);
         addSubTest("test_set_armor_and_update_old_armor", (PFNUNITSUBTEST)&PlayerTest::test_set_armor_and_update_old_armor);
         addSubTest("test_set_health_and_update_old_health", (PFNUNITSUBTEST)&PlayerTest::test_set_health_and_update_old_health);
@@ -88,6 +88,7 @@ protected:
         addSubTest("test_step_somersault_angle_server", (PFNUNITSUBTEST)&PlayerTest::test_step_somersault_angle_server);
         addSubTest("test_set_somersault_client", (PFNUNITSUBTEST)&PlayerTest::test_set_somersault_client);
         addSubTest("test_set_run", (PFNUNITSUBTEST)&PlayerTest::test_set_run);
+        addSubTest("test_strafe_speed", (PFNUNITSUBTEST)&PlayerTest::test_strafe_speed);
         addSubTest("test_toggle_has_antigravityactive", (PFNUNITSUBTEST)&PlayerTest::test_toggle_has_antigravityactive);
         addSubTest("test_set_strafe", (PFNUNITSUBTEST)&PlayerTest::test_set_strafe);
         addSubTest("test_server_do_crouch", (PFNUNITSUBTEST)&PlayerTest::test_server_do_crouch);
@@ -329,7 +330,6 @@ private:
             assertLess(0, player.getTimeConstructed().time_since_epoch().count(), "time constructed") &
             assertEquals(0, player.getTimeBootedUp().time_since_epoch().count(), "time booted up") &
             assertFalse(player.hasBootedUp(), "has booted up") &
-            assertTrue(player.isExpectingAfterBootUpDelayedUpdate(), "expecting after bootup delayed update") &
             assertNotNull(player.getObject3D(), "object3d") &
             assertTrue(player.getObject3D() && !player.getObject3D()->isRenderingAllowed(), "object3d visible") &
             assertTrue(player.isInSpectatorMode(), "spectator mode") &
@@ -379,6 +379,13 @@ private:
             assertFalse(player.isSomersaulting(), "isSomersaulting") &
             assertEquals(0.f, player.getSomersaultAngle(), "getSomersaultAngle") &
             assertTrue(player.isJustCreatedAndExpectingStartPos(), "expecting start pos") &
+            assertEquals(0u, player.getLastCmdSeqProcessed(), "last cmd seq processed") &
+            assertEquals(0u, player.getPhysicsIterationsSinceLastCmd(), "physics iterations since last cmd") &
+            assertEquals(0u, player.getLagCompensationTicks(), "lag compensation ticks") &
+            assertFalse(player.getClockSync().isSynced(), "clock synced") &
+            assertFalse(player.getClockSync().hasRtt(), "clock has rtt") &
+            assertEquals(0u, player.getLastRateLimitedCmdTime(proofps_dd::Player::RateLimitedCmd::Jump).m_nClientTimeMillisecs, "last rate limited cmd client time") &
+            assertEquals(0, player.getLastRateLimitedCmdTime(proofps_dd::Player::RateLimitedCmd::Jump).m_timeArrival.time_since_epoch().count(), "last rate limited cmd arrival") &
             assertTrue(player.isRunning(), "running default") &
             assertEquals(0, player.getTimeLastToggleRun().time_since_epoch().count(), "time last run toggle") &
             assertEquals(proofps_dd::Strafe::NONE, player.getStrafe(), "strafe") &
@@ -449,19 +456,6 @@ private:
         return b;
     }
 
-    bool test_set_expecting_after_boot_up_delayed_update()
-    {
-        proofps_dd::Player player(m_audio, m_cfgProfiles, m_bullets, m_itemPickupEvents, m_inventoryChangeEvents, m_ammoChangeEvents, *m_engine, m_network, static_cast<pge_network::PgeNetworkConnectionHandle>(12345), "192.168.1.12");
-
-        player.setExpectingAfterBootUpDelayedUpdate(false);
-        bool b = assertFalse(player.isExpectingAfterBootUpDelayedUpdate(), "exp 1");
-
-        player.setExpectingAfterBootUpDelayedUpdate(true);
-        b &= assertTrue(player.isExpectingAfterBootUpDelayedUpdate(), "exp 2");
-
-        return b;
-    }
-
     bool test_show()
     {
         const pge_network::PgeNetworkConnectionHandle connHandleExpected = static_cast<pge_network::PgeNetworkConnectionHandle>(12345);
@@ -577,7 +571,7 @@ private:
 
     bool test_update_audio_visuals()
     {
-        // cannot run this test now because I cannot pass Config instance to updateAudioVisuals()
+        // cannot run this test now because visibility depends on time while the initial invulnerability makes the player blink
         // 
         //const pge_network::PgeNetworkConnectionHandle connHandleExpected = static_cast<pge_network::PgeNetworkConnectionHandle>(12345);
         //proofps_dd::Player player(m_audio, m_cfgProfiles, m_bullets, m_itemPickupEvents, m_inventoryChangeEvents, m_ammoChangeEvents, *m_engine, m_network, connHandleExpected, "192.168.1.12");
@@ -588,18 +582,18 @@ private:
         //
         //bool b = assertTrue(player.isVisible(), "isVisible 1");
         //
-        //player.updateAudioVisuals(/* cannot instantiate Config */, true, true);
+        //player.updateAudioVisuals(true);
         //b &= assertTrue(player.isVisible(), "isVisible 2");
         //
         //player.setHealth(0);
-        //player.updateAudioVisuals(/* cannot instantiate Config */, true, true);
+        //player.updateAudioVisuals(true);
         //b &= assertFalse(player.isVisible(), "isVisible 3");
         //
         //player.setHealth(100);
-        //player.updateAudioVisuals(/* cannot instantiate Config */, true, true);
+        //player.updateAudioVisuals(true);
         //b &= assertTrue(player.isVisible(), "isVisible 4");
         //
-        //player.updateAudioVisuals(/* cannot instantiate Config */, true, false);
+        //player.updateAudioVisuals(false);
         //b &= assertFalse(player.isVisible(), "isVisible 5");
 
         return true;
@@ -808,6 +802,21 @@ private:
         return b;
     }
 
+    bool test_set_last_cmd_seq_processed()
+    {
+        proofps_dd::Player player(m_audio, m_cfgProfiles, m_bullets, m_itemPickupEvents, m_inventoryChangeEvents, m_ammoChangeEvents, *m_engine, m_network, static_cast<pge_network::PgeNetworkConnectionHandle>(12345), "192.168.1.12");
+
+        player.incPhysicsIterationsSinceLastCmd();
+        player.incPhysicsIterationsSinceLastCmd();
+        bool b = assertEquals(2u, player.getPhysicsIterationsSinceLastCmd(), "iterations 1");
+
+        player.setLastCmdSeqProcessed(7u);
+        b &= assertEquals(7u, player.getLastCmdSeqProcessed(), "seq");
+        b &= assertEquals(0u, player.getPhysicsIterationsSinceLastCmd(), "iterations 2");
+
+        return b;
+    }
+
     bool test_update_old_pos()
     {
         proofps_dd::Player player(m_audio, m_cfgProfiles, m_bullets, m_itemPickupEvents, m_inventoryChangeEvents, m_ammoChangeEvents, *m_engine, m_network, static_cast<pge_network::PgeNetworkConnectionHandle>(12345), "192.168.1.12");
@@ -2004,6 +2013,41 @@ private:
         return (b & assertFalse(player.isRunning(), "running")) != 0;
     }
 
+    bool test_strafe_speed()
+    {
+        proofps_dd::Player player(m_audio, m_cfgProfiles, m_bullets, m_itemPickupEvents, m_inventoryChangeEvents, m_ammoChangeEvents, *m_engine, m_network, static_cast<pge_network::PgeNetworkConnectionHandle>(12345), "192.168.1.12");
+        const unsigned int nPhysicsRate = 60;
+
+        bool b = assertEquals(0.f, player.getTargetStrafeSpeed(nPhysicsRate), "target none");
+
+        player.setStrafe(proofps_dd::Strafe::RIGHT);
+        const float fTargetRun = player.getTargetStrafeSpeed(nPhysicsRate);
+        b &= assertEquals(proofps_dd::Player::fBaseSpeedRun / nPhysicsRate, fTargetRun, "target run right");
+
+        player.setRun(false);
+        player.setStrafe(proofps_dd::Strafe::LEFT);
+        const float fTargetWalkLeft = player.getTargetStrafeSpeed(nPhysicsRate);
+        b &= assertEquals(-proofps_dd::Player::fBaseSpeedWalk / nPhysicsRate, fTargetWalkLeft, "target walk left");
+
+        // accelerating, then limited to target
+        const float fSpeed1 = proofps_dd::Player::getNextStrafeSpeed(0.f, fTargetRun, nPhysicsRate);
+        b &= assertLess(0.f, fSpeed1, "speed 1 positive");
+        b &= assertLess(fSpeed1, fTargetRun, "speed 1 below target");
+        float fSpeed = fSpeed1;
+        for (int i = 0; i < 100; i++)
+        {
+            fSpeed = proofps_dd::Player::getNextStrafeSpeed(fSpeed, fTargetRun, nPhysicsRate);
+        }
+        b &= assertEquals(fTargetRun, fSpeed, "speed limited");
+
+        // direction change restarts from 0
+        const float fSpeedAfterDirChange = proofps_dd::Player::getNextStrafeSpeed(fSpeed, fTargetWalkLeft, nPhysicsRate);
+        b &= assertLess(fSpeedAfterDirChange, 0.f, "direction change negative");
+        b &= assertLess(fTargetWalkLeft, fSpeedAfterDirChange, "direction change above target");
+
+        return b;
+    }
+
     bool test_toggle_has_antigravityactive()
     {
         proofps_dd::Player player(m_audio, m_cfgProfiles, m_bullets, m_itemPickupEvents, m_inventoryChangeEvents, m_ammoChangeEvents, *m_engine, m_network, static_cast<pge_network::PgeNetworkConnectionHandle>(12345), "192.168.1.12");
@@ -2425,10 +2469,9 @@ private:
         };
 
         player.takeItem(miPistol, pktWpnUpdate, bHasJustBecomeAvailable);
-        bool bStrSafeChecked = strncmp(
-            player.getWeaponManager().getWeapons()[1]->getFilename().c_str(),
-            msgWpnUpdate.m_szWpnName,
-            proofps_dd::MsgWpnUpdateFromServer::nWpnNameNameMaxLength) == 0;
+        bool bStrSafeChecked =
+            player.getWeaponManager().getWeapons()[1]->getFilename() ==
+            proofps_dd::StringTable::getInstance().getString(msgWpnUpdate.m_nWpnNameId);
 
         bool b = (assertEquals(player.getWeaponManager().getWeapons()[1]->getVars()["reloadable"].getAsInt(),
             static_cast<int>(player.getWeaponManager().getWeapons()[1]->getUnmagBulletCount()), "wpn 1 unmag") &
@@ -2449,10 +2492,9 @@ private:
 
         bHasJustBecomeAvailable = false;
         player.takeItem(miMchGun, pktWpnUpdate, bHasJustBecomeAvailable);
-        bStrSafeChecked = strncmp(
-            player.getWeaponManager().getWeapons()[2]->getFilename().c_str(),
-            msgWpnUpdate.m_szWpnName,
-            proofps_dd::MsgWpnUpdateFromServer::nWpnNameNameMaxLength) == 0;
+        bStrSafeChecked =
+            player.getWeaponManager().getWeapons()[2]->getFilename() ==
+            proofps_dd::StringTable::getInstance().getString(msgWpnUpdate.m_nWpnNameId);
 
         b &= assertEquals(player.getWeaponManager().getWeapons()[2]->getVars()["reloadable"].getAsInt(),
             static_cast<int>(player.getWeaponManager().getWeapons()[2]->getMagBulletCount()), "wpn 2 mag") &
@@ -2474,10 +2516,9 @@ private:
 
         bHasJustBecomeAvailable = false;
         player.takeItem(miBazooka, pktWpnUpdate, bHasJustBecomeAvailable);
-        bStrSafeChecked = strncmp(
-            player.getWeaponManager().getWeapons()[3]->getFilename().c_str(),
-            msgWpnUpdate.m_szWpnName,
-            proofps_dd::MsgWpnUpdateFromServer::nWpnNameNameMaxLength) == 0;
+        bStrSafeChecked =
+            player.getWeaponManager().getWeapons()[3]->getFilename() ==
+            proofps_dd::StringTable::getInstance().getString(msgWpnUpdate.m_nWpnNameId);
 
         b &= assertEquals(player.getWeaponManager().getWeapons()[3]->getVars()["reloadable"].getAsInt(),
             static_cast<int>(player.getWeaponManager().getWeapons()[3]->getMagBulletCount()), "wpn 3 mag") &
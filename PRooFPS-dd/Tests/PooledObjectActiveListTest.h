@@ -0,0 +1,188 @@
+#pragma once
+
+/*
+    ###################################################################################
+    PooledObjectActiveListTest.h
+    Unit test for PRooFPS-dd PooledObjectActiveList.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <vector>
+
+#include "UnitTest.h"
+
+#include "PooledObjectActiveList.h"
+
+class PooledObjectActiveListTest :
+    public UnitTest
+{
+public:
+
+    PooledObjectActiveListTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    PooledObjectActiveListTest(const PooledObjectActiveListTest&) = delete;
+    PooledObjectActiveListTest& operator=(const PooledObjectActiveListTest&) = delete;
+    PooledObjectActiveListTest(PooledObjectActiveListTest&&) = delete;
+    PooledObjectActiveListTest& operator=(PooledObjectActiveListTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&PooledObjectActiveListTest::test_initial_values);
+        addSubTest("test_add_compact_keeps_order", (PFNUNITSUBTEST)&PooledObjectActiveListTest::test_add_compact_keeps_order);
+        addSubTest("test_sync_complete_list_does_not_walk_pool", (PFNUNITSUBTEST)&PooledObjectActiveListTest::test_sync_complete_list_does_not_walk_pool);
+        addSubTest("test_sync_incomplete_list_walks_pool", (PFNUNITSUBTEST)&PooledObjectActiveListTest::test_sync_incomplete_list_walks_pool);
+        addSubTest("test_clear", (PFNUNITSUBTEST)&PooledObjectActiveListTest::test_clear);
+    }
+
+private:
+
+    struct FakeElem
+    {
+        int m_nId = 0;
+        bool m_bUsed = false;
+
+        bool used() const
+        {
+            return m_bUsed;
+        }
+    };
+
+    /** Mimics the part of PgeObjectPool used by PooledObjectActiveList. */
+    struct FakePool
+    {
+        std::vector<FakeElem> m_vecElems;
+
+        explicit FakePool(size_t nCapacity) :
+            m_vecElems(nCapacity)
+        {
+            for (size_t i = 0; i < nCapacity; i++)
+            {
+                m_vecElems[i].m_nId = static_cast<int>(i);
+            }
+        }
+
+        std::vector<FakeElem>::iterator begin()
+        {
+            return m_vecElems.begin();
+        }
+
+        std::vector<FakeElem>::iterator end()
+        {
+            return m_vecElems.end();
+        }
+
+        size_t size() const
+        {
+            size_t nUsed = 0;
+            for (const auto& elem : m_vecElems)
+            {
+                nUsed += elem.used() ? 1 : 0;
+            }
+            return nUsed;
+        }
+
+        FakeElem& create(size_t i)
+        {
+            m_vecElems[i].m_bUsed = true;
+            return m_vecElems[i];
+        }
+    };
+
+    bool test_initial_values()
+    {
+        const proofps_dd::PooledObjectActiveList<FakeElem> list;
+
+        return (assertEquals(0u, list.size(), "size") &
+            assertTrue(list.empty(), "empty") &
+            assertEquals(0u, list.getFullSyncCount(), "full sync count")) != 0;
+    }
+
+    bool test_add_compact_keeps_order()
+    {
+        FakePool pool(8);
+        proofps_dd::PooledObjectActiveList<FakeElem> list;
+
+        list.add(pool.create(5));
+        list.add(pool.create(1));
+        list.add(pool.create(3));
+        list.add(pool.create(0));
+        bool b = assertEquals(4u, list.size(), "size 1");
+
+        // freed elements stay in the list until compact()
+        pool.m_vecElems[1].m_bUsed = false;
+        pool.m_vecElems[0].m_bUsed = false;
+        b &= assertEquals(4u, list.size(), "size 2");
+
+        list.compact();
+        b &= assertEquals(2u, list.size(), "size 3");
+        b &= assertEquals(5, list[0].m_nId, "elem 0");
+        b &= assertEquals(3, list[1].m_nId, "elem 1");
+        b &= assertEquals(0u, list.getFullSyncCount(), "full sync count");
+
+        return b;
+    }
+
+    bool test_sync_complete_list_does_not_walk_pool()
+    {
+        FakePool pool(8);
+        proofps_dd::PooledObjectActiveList<FakeElem> list;
+
+        list.add(pool.create(6));
+        list.add(pool.create(2));
+        pool.m_vecElems[6].m_bUsed = false;
+
+        bool b = assertFalse(list.sync(pool), "sync");
+        b &= assertEquals(1u, list.size(), "size");
+        b &= assertEquals(2, list[0].m_nId, "elem 0");
+        b &= assertEquals(0u, list.getFullSyncCount(), "full sync count");
+
+        return b;
+    }
+
+    bool test_sync_incomplete_list_walks_pool()
+    {
+        FakePool pool(8);
+        proofps_dd::PooledObjectActiveList<FakeElem> list;
+
+        list.add(pool.create(4));
+        // created by someone else, e.g. the engine, without add()
+        pool.create(1);
+        pool.create(7);
+
+        bool b = assertTrue(list.sync(pool), "sync 1");
+        b &= assertEquals(3u, list.size(), "size 1");
+        b &= assertEquals(1, list[0].m_nId, "elem 0");
+        b &= assertEquals(4, list[1].m_nId, "elem 1");
+        b &= assertEquals(7, list[2].m_nId, "elem 2");
+        b &= assertEquals(1u, list.getFullSyncCount(), "full sync count 1");
+
+        // now the list is complete again
+        b &= assertFalse(list.sync(pool), "sync 2");
+        b &= assertEquals(3u, list.size(), "size 2");
+        b &= assertEquals(1u, list.getFullSyncCount(), "full sync count 2");
+
+        return b;
+    }
+
+    bool test_clear()
+    {
+        FakePool pool(4);
+        proofps_dd::PooledObjectActiveList<FakeElem> list;
+
+        list.add(pool.create(0));
+        list.add(pool.create(1));
+        list.clear();
+
+        return (assertEquals(0u, list.size(), "size") &
+            assertTrue(list.empty(), "empty")) != 0;
+    }
+
+};
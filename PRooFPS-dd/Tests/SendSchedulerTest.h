@@ -0,0 +1,197 @@
+#pragma once
+
+/*
+    ###################################################################################
+    SendSchedulerTest.h
+    Unit test for PRooFPS-dd SendScheduler.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "UnitTest.h"
+
+#include "SendScheduler.h"
+
+class SendSchedulerTest :
+    public UnitTest
+{
+public:
+
+    SendSchedulerTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    SendSchedulerTest(const SendSchedulerTest&) = delete;
+    SendSchedulerTest& operator=(const SendSchedulerTest&) = delete;
+    SendSchedulerTest(SendSchedulerTest&&) = delete;
+    SendSchedulerTest& operator=(SendSchedulerTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        //CConsole::getConsoleInstance().SetLoggingState(proofps_dd::SendScheduler::getLoggerModuleName(), true);
+
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&SendSchedulerTest::test_initial_values);
+        addSubTest("test_priority_increment", (PFNUNITSUBTEST)&SendSchedulerTest::test_priority_increment);
+        addSubTest("test_accumulate_only_pending", (PFNUNITSUBTEST)&SendSchedulerTest::test_accumulate_only_pending);
+        addSubTest("test_select_unlimited_budget", (PFNUNITSUBTEST)&SendSchedulerTest::test_select_unlimited_budget);
+        addSubTest("test_select_within_budget", (PFNUNITSUBTEST)&SendSchedulerTest::test_select_within_budget);
+        addSubTest("test_starved_entity_eventually_selected", (PFNUNITSUBTEST)&SendSchedulerTest::test_starved_entity_eventually_selected);
+        addSubTest("test_remove_client_and_entity", (PFNUNITSUBTEST)&SendSchedulerTest::test_remove_client_and_entity);
+    }
+
+    virtual void finalize() override
+    {
+        CConsole::getConsoleInstance().SetLoggingState(proofps_dd::SendScheduler::getLoggerModuleName(), false);
+    }
+
+private:
+
+    bool test_initial_values()
+    {
+        const proofps_dd::SendScheduler sched;
+
+        return (assertEquals(0u, sched.getPendingCount(1), "pending") &
+            assertFalse(sched.isPending(1, 2), "is pending") &
+            assertEquals(0.f, sched.getPriority(1, 2), "priority") &
+            assertEquals(0u, sched.getDeferredUpdatesCount(), "deferred")) != 0;
+    }
+
+    bool test_priority_increment()
+    {
+        const float fOwnNear = proofps_dd::SendScheduler::calculatePriorityIncrement(true, 0.f);
+        const float fOtherNear = proofps_dd::SendScheduler::calculatePriorityIncrement(false, 0.f);
+        const float fOtherFalloff = proofps_dd::SendScheduler::calculatePriorityIncrement(false, proofps_dd::SendScheduler::fDistanceFalloff);
+        const float fOtherFar = proofps_dd::SendScheduler::calculatePriorityIncrement(false, 100.f);
+
+        return (assertEquals(proofps_dd::SendScheduler::fImportanceOwnEntity, fOwnNear, "own near") &
+            assertEquals(proofps_dd::SendScheduler::fImportanceOtherEntity, fOtherNear, "other near") &
+            assertEquals(fOtherNear / 2.f, fOtherFalloff, "other at falloff") &
+            assertLess(fOtherFar, fOtherFalloff, "other far")) != 0;
+    }
+
+    bool test_accumulate_only_pending()
+    {
+        proofps_dd::SendScheduler sched;
+
+        sched.markPending(1, 2);
+        sched.accumulate(1, 2, 1.5f);
+        sched.accumulate(1, 2, 1.5f);
+        sched.accumulate(1, 3, 1.5f);  // not pending
+        bool b = assertEquals(3.f, sched.getPriority(1, 2), "priority 1");
+        b &= assertEquals(0.f, sched.getPriority(1, 3), "priority 2");
+        b &= assertEquals(1u, sched.getPendingCount(1), "pending 1");
+
+        sched.clearPending(1, 2);
+        sched.accumulate(1, 2, 1.5f);
+        b &= assertFalse(sched.isPending(1, 2), "is pending");
+        b &= assertEquals(0.f, sched.getPriority(1, 2), "priority 3");
+
+        return b;
+    }
+
+    bool test_select_unlimited_budget()
+    {
+        proofps_dd::SendScheduler sched;
+        std::vector<pge_network::PgeNetworkConnectionHandle> vecSelected;
+
+        sched.markPending(1, 2);
+        sched.markPending(1, 3);
+        sched.markPending(1, 4);
+        sched.accumulate(1, 2, 1.f);
+        sched.accumulate(1, 3, 3.f);
+        sched.accumulate(1, 4, 2.f);
+
+        sched.selectWithinBudget(1, 0, 100, vecSelected);
+
+        bool b = assertEquals(3u, vecSelected.size(), "selected");
+        if (b)
+        {
+            b &= assertEquals(3u, vecSelected[0], "selected 0");
+            b &= assertEquals(4u, vecSelected[1], "selected 1");
+            b &= assertEquals(2u, vecSelected[2], "selected 2");
+        }
+        b &= assertEquals(0u, sched.getPendingCount(1), "pending");
+        b &= assertEquals(0.f, sched.getPriority(1, 3), "priority");
+        b &= assertEquals(0u, sched.getDeferredUpdatesCount(), "deferred");
+
+        return b;
+    }
+
+    bool test_select_within_budget()
+    {
+        proofps_dd::SendScheduler sched;
+        std::vector<pge_network::PgeNetworkConnectionHandle> vecSelected;
+
+        sched.markPending(1, 2);
+        sched.markPending(1, 3);
+        sched.markPending(1, 4);
+        sched.accumulate(1, 2, 1.f);
+        sched.accumulate(1, 3, 3.f);
+        sched.accumulate(1, 4, 2.f);
+
+        // budget for 2 updates
+        sched.selectWithinBudget(1, 250, 100, vecSelected);
+        bool b = assertEquals(2u, vecSelected.size(), "selected 1");
+        if (b)
+        {
+            b &= assertEquals(3u, vecSelected[0], "selected 1 0");
+            b &= assertEquals(4u, vecSelected[1], "selected 1 1");
+        }
+        b &= assertTrue(sched.isPending(1, 2), "is pending");
+        b &= assertEquals(1.f, sched.getPriority(1, 2), "priority");
+        b &= assertEquals(1u, sched.getDeferredUpdatesCount(), "deferred");
+
+        // budget even smaller than 1 update still selects 1
+        sched.selectWithinBudget(1, 10, 100, vecSelected);
+        b &= assertEquals(1u, vecSelected.size(), "selected 2");
+        b &= assertEquals(0u, sched.getPendingCount(1), "pending");
+
+        return b;
+    }
+
+    bool test_starved_entity_eventually_selected()
+    {
+        proofps_dd::SendScheduler sched;
+        std::vector<pge_network::PgeNetworkConnectionHandle> vecSelected;
+
+        // entity 2 always has new update and high priority, entity 3 changed only once and has low priority
+        sched.markPending(1, 3);
+        bool bSelected3 = false;
+        int iTick = 0;
+        for (; !bSelected3 && (iTick < 20); iTick++)
+        {
+            sched.markPending(1, 2);
+            sched.accumulate(1, 2, 4.f);
+            sched.accumulate(1, 3, 1.f);
+            sched.selectWithinBudget(1, 100, 100, vecSelected);
+            bSelected3 = assertEquals(1u, vecSelected.size(), "selected") && (vecSelected[0] == 3u);
+        }
+
+        return assertTrue(bSelected3, "selected 3") & assertLess(iTick, 20, "ticks");
+    }
+
+    bool test_remove_client_and_entity()
+    {
+        proofps_dd::SendScheduler sched;
+
+        sched.markPending(1, 2);
+        sched.markPending(1, 3);
+        sched.markPending(4, 2);
+
+        sched.removeEntity(2);
+        bool b = assertEquals(1u, sched.getPendingCount(1), "pending 1");
+        b &= assertEquals(0u, sched.getPendingCount(4), "pending 4");
+
+        sched.removeClient(1);
+        b &= assertEquals(0u, sched.getPendingCount(1), "pending 2");
+        b &= assertFalse(sched.isPending(1, 3), "is pending");
+
+        return b;
+    }
+
+}; // class SendSchedulerTest
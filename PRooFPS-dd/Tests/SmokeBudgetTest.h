@@ -0,0 +1,89 @@
+#pragma once
+
+/*
+    ###################################################################################
+    SmokeBudgetTest.h
+    Unit test for PRooFPS-dd SmokeBudget.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "UnitTest.h"
+
+#include "SmokeBudget.h"
+
+class SmokeBudgetTest :
+    public UnitTest
+{
+public:
+
+    SmokeBudgetTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    SmokeBudgetTest(const SmokeBudgetTest&) = delete;
+    SmokeBudgetTest& operator=(const SmokeBudgetTest&) = delete;
+    SmokeBudgetTest(SmokeBudgetTest&&) = delete;
+    SmokeBudgetTest& operator=(SmokeBudgetTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        addSubTest("test_emit_interval_near", (PFNUNITSUBTEST)&SmokeBudgetTest::test_emit_interval_near);
+        addSubTest("test_emit_interval_increases_with_distance", (PFNUNITSUBTEST)&SmokeBudgetTest::test_emit_interval_increases_with_distance);
+        addSubTest("test_emit_interval_culled", (PFNUNITSUBTEST)&SmokeBudgetTest::test_emit_interval_culled);
+        addSubTest("test_emit_interval_invalid_base_interval", (PFNUNITSUBTEST)&SmokeBudgetTest::test_emit_interval_invalid_base_interval);
+        addSubTest("test_live_smokes_max", (PFNUNITSUBTEST)&SmokeBudgetTest::test_live_smokes_max);
+    }
+
+private:
+
+    bool test_emit_interval_near()
+    {
+        const float fNear = proofps_dd::SmokeBudget::fLodDistanceNear;
+        return (assertEquals(3, proofps_dd::SmokeBudget::getEmitInterval(3, 0.f, 0.f, 0.f, 0.f), "same pos") &
+            assertEquals(3, proofps_dd::SmokeBudget::getEmitInterval(3, 10.f + fNear, 5.f, 10.f, 5.f), "near edge x") &
+            assertEquals(2, proofps_dd::SmokeBudget::getEmitInterval(2, -20.f, -20.f - fNear, -20.f, -20.f), "near edge y")) != 0;
+    }
+
+    bool test_emit_interval_increases_with_distance()
+    {
+        const float fNear = proofps_dd::SmokeBudget::fLodDistanceNear;
+        const float fCull = proofps_dd::SmokeBudget::fLodDistanceCull;
+        const int nMid = proofps_dd::SmokeBudget::getEmitInterval(2, (fNear + fCull) / 2.f, 0.f, 0.f, 0.f);
+        const int nFar = proofps_dd::SmokeBudget::getEmitInterval(2, 0.f, fCull, 0.f, 0.f);
+
+        return (assertLess(2, nMid, "mid vs near") &
+            assertLess(nMid, nFar, "far vs mid") &
+            assertEquals(2 * proofps_dd::SmokeBudget::nLodEmitIntervalMultiplierMax, nFar, "far")) != 0;
+    }
+
+    bool test_emit_interval_culled()
+    {
+        const float fCull = proofps_dd::SmokeBudget::fLodDistanceCull;
+        return (assertEquals(0, proofps_dd::SmokeBudget::getEmitInterval(2, fCull + 0.1f, 0.f, 0.f, 0.f), "just beyond") &
+            assertEquals(0, proofps_dd::SmokeBudget::getEmitInterval(2, fCull, fCull, 0.f, 0.f), "diagonal") &
+            assertEquals(0, proofps_dd::SmokeBudget::getEmitInterval(2, 0.f, 0.f, -1000.f, 1000.f), "far away camera")) != 0;
+    }
+
+    bool test_emit_interval_invalid_base_interval()
+    {
+        return (assertEquals(1, proofps_dd::SmokeBudget::getEmitInterval(0, 0.f, 0.f, 0.f, 0.f), "0") &
+            assertEquals(1, proofps_dd::SmokeBudget::getEmitInterval(-5, 0.f, 0.f, 0.f, 0.f), "negative")) != 0;
+    }
+
+    bool test_live_smokes_max()
+    {
+        using proofps_dd::Smoke;
+        using proofps_dd::SmokeBudget;
+        return (assertEquals(0u, SmokeBudget::getLiveSmokesMax(Smoke::SmokeConfigAmount::None), "none") &
+            assertLess(0u, SmokeBudget::getLiveSmokesMax(Smoke::SmokeConfigAmount::Moderate), "moderate") &
+            assertLess(SmokeBudget::getLiveSmokesMax(Smoke::SmokeConfigAmount::Moderate), SmokeBudget::getLiveSmokesMax(Smoke::SmokeConfigAmount::Normal), "normal") &
+            assertLess(SmokeBudget::getLiveSmokesMax(Smoke::SmokeConfigAmount::Normal), SmokeBudget::getLiveSmokesMax(Smoke::SmokeConfigAmount::Extreme), "extreme")) != 0;
+    }
+
+}; // class SmokeBudgetTest
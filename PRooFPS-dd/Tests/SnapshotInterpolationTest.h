@@ -0,0 +1,174 @@
+#pragma once
+
+/*
+    ###################################################################################
+    SnapshotInterpolationTest.h
+    Unit test for PRooFPS-dd SnapshotInterpolation.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "UnitTest.h"
+
+#include "SnapshotInterpolation.h"
+
+class SnapshotInterpolationTest :
+    public UnitTest
+{
+public:
+
+    SnapshotInterpolationTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    SnapshotInterpolationTest(const SnapshotInterpolationTest&) = delete;
+    SnapshotInterpolationTest& operator=(const SnapshotInterpolationTest&) = delete;
+    SnapshotInterpolationTest(SnapshotInterpolationTest&&) = delete;
+    SnapshotInterpolationTest& operator=(SnapshotInterpolationTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&SnapshotInterpolationTest::test_initial_values);
+        addSubTest("test_add_snapshot_drops_out_of_order", (PFNUNITSUBTEST)&SnapshotInterpolationTest::test_add_snapshot_drops_out_of_order);
+        addSubTest("test_add_snapshot_overwrites_oldest_when_full", (PFNUNITSUBTEST)&SnapshotInterpolationTest::test_add_snapshot_overwrites_oldest_when_full);
+        addSubTest("test_clear", (PFNUNITSUBTEST)&SnapshotInterpolationTest::test_clear);
+        addSubTest("test_get_position_single_snapshot", (PFNUNITSUBTEST)&SnapshotInterpolationTest::test_get_position_single_snapshot);
+        addSubTest("test_get_position_before_oldest", (PFNUNITSUBTEST)&SnapshotInterpolationTest::test_get_position_before_oldest);
+        addSubTest("test_get_position_interpolated", (PFNUNITSUBTEST)&SnapshotInterpolationTest::test_get_position_interpolated);
+        addSubTest("test_get_position_extrapolated", (PFNUNITSUBTEST)&SnapshotInterpolationTest::test_get_position_extrapolated);
+    }
+
+private:
+
+    bool test_initial_values()
+    {
+        const proofps_dd::SnapshotInterpolation si;
+        PureVector vec(1.f, 2.f, 3.f);
+
+        return (assertTrue(si.empty(), "empty") &
+            assertEquals(0u, si.size(), "size") &
+            assertFalse(si.getPosition(std::chrono::steady_clock::now(), vec), "get pos") &
+            assertEquals(PureVector(1.f, 2.f, 3.f), vec, "vec untouched")) != 0;
+    }
+
+    bool test_add_snapshot_drops_out_of_order()
+    {
+        proofps_dd::SnapshotInterpolation si;
+        const auto t0 = std::chrono::steady_clock::now();
+
+        bool b = assertTrue(si.addSnapshot(t0, PureVector(1.f, 0.f, 0.f)), "add 1");
+        b &= assertTrue(si.addSnapshot(t0 + std::chrono::milliseconds(50), PureVector(2.f, 0.f, 0.f)), "add 2");
+        b &= assertFalse(si.addSnapshot(t0 + std::chrono::milliseconds(50), PureVector(3.f, 0.f, 0.f)), "add same time");
+        b &= assertFalse(si.addSnapshot(t0 + std::chrono::milliseconds(20), PureVector(4.f, 0.f, 0.f)), "add older");
+        b &= assertEquals(2u, si.size(), "size");
+
+        return b;
+    }
+
+    bool test_add_snapshot_overwrites_oldest_when_full()
+    {
+        proofps_dd::SnapshotInterpolation si;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < proofps_dd::SnapshotInterpolation::nCapacity + 5; i++)
+        {
+            si.addSnapshot(t0 + std::chrono::milliseconds(10 * i), PureVector(static_cast<float>(i), 0.f, 0.f));
+        }
+
+        PureVector vec;
+        bool b = assertEquals(proofps_dd::SnapshotInterpolation::nCapacity, si.size(), "size");
+        // before the oldest stored snapshot, i.e. the 6th added snapshot
+        b &= assertTrue(si.getPosition(t0, vec), "get pos");
+        b &= assertEquals(5.f, vec.getX(), "x");
+
+        return b;
+    }
+
+    bool test_clear()
+    {
+        proofps_dd::SnapshotInterpolation si;
+        si.addSnapshot(std::chrono::steady_clock::now(), PureVector(1.f, 0.f, 0.f));
+        si.clear();
+
+        PureVector vec;
+        return (assertTrue(si.empty(), "empty") &
+            assertFalse(si.getPosition(std::chrono::steady_clock::now(), vec), "get pos")) != 0;
+    }
+
+    bool test_get_position_single_snapshot()
+    {
+        proofps_dd::SnapshotInterpolation si;
+        const auto t0 = std::chrono::steady_clock::now();
+        si.addSnapshot(t0, PureVector(1.f, 2.f, 3.f));
+
+        PureVector vec;
+        return (assertTrue(si.getPosition(t0 + std::chrono::milliseconds(500), vec), "get pos") &
+            assertEquals(PureVector(1.f, 2.f, 3.f), vec, "vec")) != 0;
+    }
+
+    bool test_get_position_before_oldest()
+    {
+        proofps_dd::SnapshotInterpolation si;
+        const auto t0 = std::chrono::steady_clock::now();
+        si.addSnapshot(t0, PureVector(1.f, 2.f, 3.f));
+        si.addSnapshot(t0 + std::chrono::milliseconds(100), PureVector(5.f, 6.f, 7.f));
+
+        PureVector vec;
+        return (assertTrue(si.getPosition(t0 - std::chrono::milliseconds(100), vec), "get pos") &
+            assertEquals(PureVector(1.f, 2.f, 3.f), vec, "vec")) != 0;
+    }
+
+    bool test_get_position_interpolated()
+    {
+        proofps_dd::SnapshotInterpolation si;
+        const auto t0 = std::chrono::steady_clock::now();
+        si.addSnapshot(t0, PureVector(0.f, 0.f, 0.f));
+        si.addSnapshot(t0 + std::chrono::milliseconds(100), PureVector(10.f, -4.f, 0.f));
+        si.addSnapshot(t0 + std::chrono::milliseconds(200), PureVector(10.f, 4.f, 0.f));
+
+        PureVector vec;
+        bool b = assertTrue(si.getPosition(t0 + std::chrono::milliseconds(50), vec), "get pos 1");
+        b &= assertEquals(5.f, vec.getX(), 0.001f, "x 1");
+        b &= assertEquals(-2.f, vec.getY(), 0.001f, "y 1");
+
+        b &= assertTrue(si.getPosition(t0 + std::chrono::milliseconds(175), vec), "get pos 2");
+        b &= assertEquals(10.f, vec.getX(), 0.001f, "x 2");
+        b &= assertEquals(2.f, vec.getY(), 0.001f, "y 2");
+
+        return b;
+    }
+
+    bool test_get_position_extrapolated()
+    {
+        proofps_dd::SnapshotInterpolation si;
+        const auto t0 = std::chrono::steady_clock::now();
+        const auto t1 = t0 + std::chrono::milliseconds(100);
+        si.addSnapshot(t0, PureVector(0.f, 0.f, 0.f));
+        si.addSnapshot(t1, PureVector(10.f, 0.f, 0.f));
+
+        const auto durExtrapolationMax = std::chrono::milliseconds(proofps_dd::SnapshotInterpolation::nExtrapolationMaxMillisecs);
+        const float fExtrapolatedMaxX = 10.f + 10.f * proofps_dd::SnapshotInterpolation::nExtrapolationMaxMillisecs / 100.f;
+
+        PureVector vec;
+        bool b = assertTrue(si.getPosition(t1 + durExtrapolationMax / 2, vec), "get pos 1");
+        b &= assertEquals((10.f + fExtrapolatedMaxX) / 2.f, vec.getX(), 0.001f, "x 1");
+
+        // at the limit
+        b &= assertTrue(si.getPosition(t1 + durExtrapolationMax, vec), "get pos 2");
+        b &= assertEquals(fExtrapolatedMaxX, vec.getX(), 0.001f, "x 2");
+
+        // moving back to the newest snapshot since still no newer snapshot
+        b &= assertTrue(si.getPosition(t1 + durExtrapolationMax * 3 / 2, vec), "get pos 3");
+        b &= assertEquals((10.f + fExtrapolatedMaxX) / 2.f, vec.getX(), 0.001f, "x 3");
+
+        b &= assertTrue(si.getPosition(t1 + durExtrapolationMax * 10, vec), "get pos 4");
+        b &= assertEquals(10.f, vec.getX(), 0.001f, "x 4");
+
+        return b;
+    }
+
+};
@@ -0,0 +1,235 @@
+#pragma once
+
+/*
+    ###################################################################################
+    SoundVoiceManagerTest.h
+    Unit test for PRooFPS-dd SoundVoiceManager.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <vector>
+
+#include "UnitTest.h"
+
+#include "SoundVoiceManager.h"
+
+class SoundVoiceManagerTest :
+    public UnitTest
+{
+public:
+
+    SoundVoiceManagerTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    SoundVoiceManagerTest(const SoundVoiceManagerTest&) = delete;
+    SoundVoiceManagerTest& operator=(const SoundVoiceManagerTest&) = delete;
+    SoundVoiceManagerTest(SoundVoiceManagerTest&&) = delete;
+    SoundVoiceManagerTest& operator=(SoundVoiceManagerTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        //CConsole::getConsoleInstance().SetLoggingState(proofps_dd::SoundVoiceManager::getLoggerModuleName(), true);
+
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&SoundVoiceManagerTest::test_initial_values);
+        addSubTest("test_culled_beyond_cull_distance", (PFNUNITSUBTEST)&SoundVoiceManagerTest::test_culled_beyond_cull_distance);
+        addSubTest("test_reserve_until_class_is_full", (PFNUNITSUBTEST)&SoundVoiceManagerTest::test_reserve_until_class_is_full);
+        addSubTest("test_classes_are_limited_separately", (PFNUNITSUBTEST)&SoundVoiceManagerTest::test_classes_are_limited_separately);
+        addSubTest("test_farthest_voice_is_stolen", (PFNUNITSUBTEST)&SoundVoiceManagerTest::test_farthest_voice_is_stolen);
+        addSubTest("test_oldest_voice_is_stolen_among_equally_far", (PFNUNITSUBTEST)&SoundVoiceManagerTest::test_oldest_voice_is_stolen_among_equally_far);
+        addSubTest("test_finished_voices_free_up_room", (PFNUNITSUBTEST)&SoundVoiceManagerTest::test_finished_voices_free_up_room);
+    }
+
+    virtual bool setUp() override
+    {
+        // null backend: voices are valid until stopped, since nothing mixes them
+        bool b = assertEquals(
+            SoLoud::SO_NO_ERROR,
+            m_audioEngineCore.init(SoLoud::Soloud::CLIP_ROUNDOFF, SoLoud::Soloud::NULLDRIVER),
+            "audio engine inited");
+        m_vecSamples.assign(44100, 0.f);
+        b &= assertEquals(
+            SoLoud::SO_NO_ERROR,
+            m_snd.loadRawWave(m_vecSamples.data(), static_cast<unsigned int>(m_vecSamples.size()), 44100.f, 1, true /* copy */),
+            "sound loaded");
+        return b;
+    }
+
+    virtual void tearDown() override
+    {
+        m_audioEngineCore.stopAll();
+        m_audioEngineCore.deinit();
+    }
+
+private:
+
+    using SoundClass = proofps_dd::SoundVoiceManager::SoundClass;
+
+    SoLoud::Soloud m_audioEngineCore;
+    SoLoud::Wav m_snd;
+    std::vector<float> m_vecSamples;
+
+    // ---------------------------------------------------------------------------
+
+    size_t getMaxVoices(const SoundClass& eSoundClass) const
+    {
+        return proofps_dd::SoundVoiceManager::maxVoicesPerSoundClass[static_cast<size_t>(eSoundClass)];
+    }
+
+    /**
+    * Does the same as the game: reserves, then starts and adds the voice if reserved.
+    * @return Handle of the started voice, 0 if not started.
+    */
+    SoLoud::handle play(proofps_dd::SoundVoiceManager& svm, const SoundClass& eSoundClass, const float& fDistance)
+    {
+        if (!svm.reserveVoice(m_audioEngineCore, eSoundClass, fDistance, 14.f))
+        {
+            return 0;
+        }
+        const SoLoud::handle handle = m_audioEngineCore.play3d(m_snd, fDistance, 0.f, 0.f);
+        svm.addVoice(eSoundClass, handle, fDistance);
+        return handle;
+    }
+
+    bool test_initial_values()
+    {
+        proofps_dd::SoundVoiceManager svm;
+
+        return (assertEquals(0u, svm.getVoiceCount(m_audioEngineCore, SoundClass::WeaponFire), "voices fire") &
+            assertEquals(0u, svm.getVoiceCount(m_audioEngineCore, SoundClass::BulletBounce), "voices bounce") &
+            assertEquals(0u, svm.getVoiceCount(m_audioEngineCore, SoundClass::MeleeHit), "voices melee") &
+            assertEquals(0u, svm.getCulledCount(), "culled") &
+            assertEquals(0u, svm.getRejectedCount(), "rejected") &
+            assertEquals(0u, svm.getStolenCount(), "stolen")) != 0;
+    }
+
+    bool test_culled_beyond_cull_distance()
+    {
+        proofps_dd::SoundVoiceManager svm;
+
+        bool b = assertFalse(svm.reserveVoice(m_audioEngineCore, SoundClass::BulletBounce, 14.1f, 14.f), "reserve beyond");
+        b &= assertTrue(svm.reserveVoice(m_audioEngineCore, SoundClass::BulletBounce, 14.f, 14.f), "reserve at");
+
+        return (b &
+            assertEquals(1u, svm.getCulledCount(), "culled") &
+            assertEquals(0u, svm.getRejectedCount(), "rejected")) != 0;
+    }
+
+    bool test_reserve_until_class_is_full()
+    {
+        proofps_dd::SoundVoiceManager svm;
+
+        bool b = true;
+        for (size_t i = 0; i < getMaxVoices(SoundClass::BulletBounce); i++)
+        {
+            b &= assertNotEquals(0u, play(svm, SoundClass::BulletBounce, 5.f), (std::string("play ") + std::to_string(i)).c_str());
+        }
+
+        // class is full with closer voices, a farther voice cannot steal any of them
+        b &= assertEquals(0u, play(svm, SoundClass::BulletBounce, 6.f), "play farther");
+
+        return (b &
+            assertEquals(getMaxVoices(SoundClass::BulletBounce), svm.getVoiceCount(m_audioEngineCore, SoundClass::BulletBounce), "voices") &
+            assertEquals(1u, svm.getRejectedCount(), "rejected") &
+            assertEquals(0u, svm.getStolenCount(), "stolen")) != 0;
+    }
+
+    bool test_classes_are_limited_separately()
+    {
+        proofps_dd::SoundVoiceManager svm;
+
+        for (size_t i = 0; i < getMaxVoices(SoundClass::MeleeHit); i++)
+        {
+            play(svm, SoundClass::MeleeHit, 1.f);
+        }
+
+        bool b = assertNotEquals(0u, play(svm, SoundClass::WeaponFire, 10.f), "play fire");
+        b &= assertNotEquals(0u, play(svm, SoundClass::BulletBounce, 10.f), "play bounce");
+        b &= assertEquals(0u, play(svm, SoundClass::MeleeHit, 10.f), "play melee");
+
+        return (b &
+            assertEquals(1u, svm.getVoiceCount(m_audioEngineCore, SoundClass::WeaponFire), "voices fire") &
+            assertEquals(1u, svm.getVoiceCount(m_audioEngineCore, SoundClass::BulletBounce), "voices bounce") &
+            assertEquals(getMaxVoices(SoundClass::MeleeHit), svm.getVoiceCount(m_audioEngineCore, SoundClass::MeleeHit), "voices melee")) != 0;
+    }
+
+    bool test_farthest_voice_is_stolen()
+    {
+        proofps_dd::SoundVoiceManager svm;
+
+        std::vector<SoLoud::handle> vecHandles;
+        for (size_t i = 0; i < getMaxVoices(SoundClass::WeaponFire); i++)
+        {
+            // the 2nd voice is the farthest
+            vecHandles.push_back(play(svm, SoundClass::WeaponFire, (i == 1) ? 12.f : 3.f));
+        }
+
+        bool b = assertNotEquals(0u, play(svm, SoundClass::WeaponFire, 2.f), "play closer");
+        b &= assertFalse(m_audioEngineCore.isValidVoiceHandle(vecHandles[1]), "farthest stopped");
+        for (size_t i = 0; i < vecHandles.size(); i++)
+        {
+            if (i != 1)
+            {
+                b &= assertTrue(m_audioEngineCore.isValidVoiceHandle(vecHandles[i]), (std::string("still playing ") + std::to_string(i)).c_str());
+            }
+        }
+
+        return (b &
+            assertEquals(getMaxVoices(SoundClass::WeaponFire), svm.getVoiceCount(m_audioEngineCore, SoundClass::WeaponFire), "voices") &
+            assertEquals(1u, svm.getStolenCount(), "stolen") &
+            assertEquals(0u, svm.getRejectedCount(), "rejected")) != 0;
+    }
+
+    bool test_oldest_voice_is_stolen_among_equally_far()
+    {
+        proofps_dd::SoundVoiceManager svm;
+
+        std::vector<SoLoud::handle> vecHandles;
+        for (size_t i = 0; i < getMaxVoices(SoundClass::MeleeHit); i++)
+        {
+            vecHandles.push_back(play(svm, SoundClass::MeleeHit, 4.f));
+        }
+
+        bool b = assertNotEquals(0u, play(svm, SoundClass::MeleeHit, 4.f), "play 1");
+        b &= assertFalse(m_audioEngineCore.isValidVoiceHandle(vecHandles[0]), "oldest stopped");
+        b &= assertTrue(m_audioEngineCore.isValidVoiceHandle(vecHandles[1]), "2nd oldest still playing 1");
+
+        b &= assertNotEquals(0u, play(svm, SoundClass::MeleeHit, 4.f), "play 2");
+        b &= assertFalse(m_audioEngineCore.isValidVoiceHandle(vecHandles[1]), "2nd oldest stopped");
+
+        return (b &
+            assertEquals(getMaxVoices(SoundClass::MeleeHit), svm.getVoiceCount(m_audioEngineCore, SoundClass::MeleeHit), "voices") &
+            assertEquals(2u, svm.getStolenCount(), "stolen")) != 0;
+    }
+
+    bool test_finished_voices_free_up_room()
+    {
+        proofps_dd::SoundVoiceManager svm;
+
+        std::vector<SoLoud::handle> vecHandles;
+        for (size_t i = 0; i < getMaxVoices(SoundClass::BulletBounce); i++)
+        {
+            vecHandles.push_back(play(svm, SoundClass::BulletBounce, 1.f));
+        }
+
+        // as if they finished playing
+        m_audioEngineCore.stop(vecHandles[0]);
+        m_audioEngineCore.stop(vecHandles[2]);
+
+        bool b = assertEquals(getMaxVoices(SoundClass::BulletBounce) - 2, svm.getVoiceCount(m_audioEngineCore, SoundClass::BulletBounce), "voices 1");
+        b &= assertNotEquals(0u, play(svm, SoundClass::BulletBounce, 10.f), "play 1");
+        b &= assertNotEquals(0u, play(svm, SoundClass::BulletBounce, 10.f), "play 2");
+
+        return (b &
+            assertEquals(getMaxVoices(SoundClass::BulletBounce), svm.getVoiceCount(m_audioEngineCore, SoundClass::BulletBounce), "voices 2") &
+            assertEquals(0u, svm.getStolenCount(), "stolen") &
+            assertEquals(0u, svm.getRejectedCount(), "rejected")) != 0;
+    }
+
+}; // class SoundVoiceManagerTest
@@ -0,0 +1,150 @@
+#pragma once
+
+/*
+    ###################################################################################
+    SpscQueueTest.h
+    Unit test for PRooFPS-dd SpscQueue.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <thread>
+
+#include "UnitTest.h"
+
+#include "SpscQueue.h"
+
+class SpscQueueTest :
+    public UnitTest
+{
+public:
+
+    SpscQueueTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    SpscQueueTest(const SpscQueueTest&) = delete;
+    SpscQueueTest& operator=(const SpscQueueTest&) = delete;
+    SpscQueueTest(SpscQueueTest&&) = delete;
+    SpscQueueTest& operator=(SpscQueueTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&SpscQueueTest::test_initial_values);
+        addSubTest("test_push_pop_fifo", (PFNUNITSUBTEST)&SpscQueueTest::test_push_pop_fifo);
+        addSubTest("test_push_full", (PFNUNITSUBTEST)&SpscQueueTest::test_push_full);
+        addSubTest("test_clear", (PFNUNITSUBTEST)&SpscQueueTest::test_clear);
+        addSubTest("test_producer_consumer_threads", (PFNUNITSUBTEST)&SpscQueueTest::test_producer_consumer_threads);
+    }
+
+private:
+
+    bool test_initial_values()
+    {
+        const proofps_dd::SpscQueue<int> q(5);
+
+        return (assertEquals(8u, q.capacity(), "capacity") &
+            assertEquals(0u, q.size(), "size") &
+            assertTrue(q.empty(), "empty")) != 0;
+    }
+
+    bool test_push_pop_fifo()
+    {
+        proofps_dd::SpscQueue<int> q(4);
+        int n = -1;
+
+        bool b = assertFalse(q.pop(n), "pop empty");
+        b &= assertEquals(-1, n, "untouched");
+
+        // go around the ring multiple times
+        for (int i = 0; i < 10; i++)
+        {
+            b &= assertTrue(q.push(i * 2), ("push 1 " + std::to_string(i)).c_str());
+            b &= assertTrue(q.push(i * 2 + 1), ("push 2 " + std::to_string(i)).c_str());
+            b &= assertEquals(2u, q.size(), ("size " + std::to_string(i)).c_str());
+            b &= assertTrue(q.pop(n), ("pop 1 " + std::to_string(i)).c_str());
+            b &= assertEquals(i * 2, n, ("value 1 " + std::to_string(i)).c_str());
+            b &= assertTrue(q.pop(n), ("pop 2 " + std::to_string(i)).c_str());
+            b &= assertEquals(i * 2 + 1, n, ("value 2 " + std::to_string(i)).c_str());
+        }
+        b &= assertTrue(q.empty(), "empty");
+
+        return b;
+    }
+
+    bool test_push_full()
+    {
+        proofps_dd::SpscQueue<int> q(4);
+
+        bool b = true;
+        for (int i = 0; i < 4; i++)
+        {
+            b &= assertTrue(q.push(i), ("push " + std::to_string(i)).c_str());
+        }
+        b &= assertFalse(q.push(4), "push full");
+        b &= assertEquals(4u, q.size(), "size");
+
+        int n = -1;
+        b &= assertTrue(q.pop(n), "pop");
+        b &= assertEquals(0, n, "value");
+        b &= assertTrue(q.push(4), "push after pop");
+
+        return b;
+    }
+
+    bool test_clear()
+    {
+        proofps_dd::SpscQueue<int> q(4);
+        q.push(1);
+        q.push(2);
+
+        q.clear();
+
+        int n = -1;
+        return (assertTrue(q.empty(), "empty") &
+            assertFalse(q.pop(n), "pop") &
+            assertTrue(q.push(3), "push")) != 0;
+    }
+
+    bool test_producer_consumer_threads()
+    {
+        proofps_dd::SpscQueue<int> q(64);
+        constexpr int nCount = 100000;
+
+        std::thread producer([&q]() {
+            for (int i = 0; i < nCount; i++)
+            {
+                while (!q.push(i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        bool bInOrder = true;
+        int nExpected = 0;
+        while (nExpected < nCount)
+        {
+            int n;
+            if (q.pop(n))
+            {
+                bInOrder &= (n == nExpected);
+                ++nExpected;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+
+        return (assertTrue(bInOrder, "in order") &
+            assertTrue(q.empty(), "empty")) != 0;
+    }
+
+}; // class SpscQueueTest
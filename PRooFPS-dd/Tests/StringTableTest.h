@@ -0,0 +1,187 @@
+#pragma once
+
+/*
+    ###################################################################################
+    StringTableTest.h
+    Unit test for PRooFPS-dd StringTable.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "UnitTest.h"
+
+#include "PRooFPS-dd-packet.h"
+#include "StringTable.h"
+
+class StringTableTest :
+    public UnitTest
+{
+public:
+
+    StringTableTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    StringTableTest(const StringTableTest&) = delete;
+    StringTableTest& operator=(const StringTableTest&) = delete;
+    StringTableTest(StringTableTest&&) = delete;
+    StringTableTest& operator=(StringTableTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        //CConsole::getConsoleInstance().SetLoggingState(proofps_dd::StringTable::getLoggerModuleName(), true);
+
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&StringTableTest::test_initial_values);
+        addSubTest("test_intern", (PFNUNITSUBTEST)&StringTableTest::test_intern);
+        addSubTest("test_intern_invalid", (PFNUNITSUBTEST)&StringTableTest::test_intern_invalid);
+        addSubTest("test_add", (PFNUNITSUBTEST)&StringTableTest::test_add);
+        addSubTest("test_add_overwrites", (PFNUNITSUBTEST)&StringTableTest::test_add_overwrites);
+        addSubTest("test_clear", (PFNUNITSUBTEST)&StringTableTest::test_clear);
+        addSubTest("test_client_handle_entry_msg", (PFNUNITSUBTEST)&StringTableTest::test_client_handle_entry_msg);
+    }
+
+    virtual void finalize() override
+    {
+        CConsole::getConsoleInstance().SetLoggingState(proofps_dd::StringTable::getLoggerModuleName(), false);
+    }
+
+private:
+
+    using StringId = proofps_dd::StringTable::StringId;
+
+    bool test_initial_values()
+    {
+        const proofps_dd::StringTable st;
+
+        return (assertEquals(static_cast<size_t>(0), st.size(), "size") &
+            assertEquals(proofps_dd::StringTable::InvalidStringId, st.find("pistol.txt"), "find") &
+            assertTrue(st.getString(proofps_dd::StringTable::InvalidStringId).empty(), "get invalid") &
+            assertTrue(st.getString(1).empty(), "get 1")) != 0;
+    }
+
+    bool test_intern()
+    {
+        proofps_dd::StringTable st;
+        bool bAdded = false;
+
+        const StringId idPistol = st.intern("pistol.txt", bAdded);
+        bool b = assertTrue(bAdded, "added 1");
+        b &= assertEquals(static_cast<StringId>(1), idPistol, "id 1");
+
+        const StringId idMap = st.intern("map_warhouse.txt", bAdded);
+        b &= assertTrue(bAdded, "added 2");
+        b &= assertEquals(static_cast<StringId>(2), idMap, "id 2");
+
+        // already interned
+        b &= assertEquals(idPistol, st.intern("pistol.txt", bAdded), "id 1 again");
+        b &= assertFalse(bAdded, "added 1 again");
+
+        b &= assertEquals(static_cast<size_t>(2), st.size(), "size");
+        b &= assertEquals(idPistol, st.find("pistol.txt"), "find 1");
+        b &= assertEquals(idMap, st.find("map_warhouse.txt"), "find 2");
+        b &= assertEquals(std::string("pistol.txt"), st.getString(idPistol), "get 1");
+        b &= assertEquals(std::string("map_warhouse.txt"), st.getString(idMap), "get 2");
+
+        return b;
+    }
+
+    bool test_intern_invalid()
+    {
+        proofps_dd::StringTable st;
+        bool bAdded = true;
+
+        bool b = assertEquals(proofps_dd::StringTable::InvalidStringId, st.intern("", bAdded), "empty");
+        b &= assertFalse(bAdded, "added empty");
+
+        bAdded = true;
+        const std::string sTooLong(proofps_dd::StringTable::nStringBufferLength, 'a');
+        b &= assertEquals(proofps_dd::StringTable::InvalidStringId, st.intern(sTooLong, bAdded), "too long");
+        b &= assertFalse(bAdded, "added too long");
+
+        const std::string sLongest(proofps_dd::StringTable::nStringBufferLength - 1, 'a');
+        b &= assertEquals(static_cast<StringId>(1), st.intern(sLongest, bAdded), "longest");
+        b &= assertTrue(bAdded, "added longest");
+
+        b &= assertEquals(static_cast<size_t>(1), st.size(), "size");
+
+        return b;
+    }
+
+    bool test_add()
+    {
+        proofps_dd::StringTable st;
+
+        bool b = assertFalse(st.add(proofps_dd::StringTable::InvalidStringId, "pistol.txt"), "add invalid id");
+        b &= assertFalse(st.add(1, ""), "add empty");
+        b &= assertFalse(st.add(1, std::string(proofps_dd::StringTable::nStringBufferLength, 'a')), "add too long");
+        b &= assertEquals(static_cast<size_t>(0), st.size(), "size 1");
+
+        // ids may arrive out of order in theory, gaps are allowed
+        b &= assertTrue(st.add(3, "bazooka.txt"), "add 3");
+        b &= assertTrue(st.add(1, "pistol.txt"), "add 1");
+        b &= assertEquals(static_cast<size_t>(3), st.size(), "size 2");
+        b &= assertEquals(std::string("bazooka.txt"), st.getString(3), "get 3");
+        b &= assertEquals(std::string("pistol.txt"), st.getString(1), "get 1");
+        b &= assertTrue(st.getString(2).empty(), "get 2");
+        b &= assertEquals(static_cast<StringId>(3), st.find("bazooka.txt"), "find 3");
+        b &= assertEquals(proofps_dd::StringTable::InvalidStringId, st.find(""), "find empty");
+
+        return b;
+    }
+
+    bool test_add_overwrites()
+    {
+        proofps_dd::StringTable st;
+
+        bool b = assertTrue(st.add(1, "pistol.txt"), "add 1");
+        b &= assertTrue(st.add(1, "bazooka.txt"), "add 1 again");
+        b &= assertEquals(static_cast<size_t>(1), st.size(), "size");
+        b &= assertEquals(std::string("bazooka.txt"), st.getString(1), "get 1");
+        b &= assertEquals(static_cast<StringId>(1), st.find("bazooka.txt"), "find new");
+        b &= assertEquals(proofps_dd::StringTable::InvalidStringId, st.find("pistol.txt"), "find old");
+
+        return b;
+    }
+
+    bool test_clear()
+    {
+        proofps_dd::StringTable st;
+        bool bAdded = false;
+        st.intern("pistol.txt", bAdded);
+        st.intern("map_warhouse.txt", bAdded);
+
+        st.clear();
+
+        bool b = assertEquals(static_cast<size_t>(0), st.size(), "size");
+        b &= assertEquals(proofps_dd::StringTable::InvalidStringId, st.find("pistol.txt"), "find");
+        b &= assertTrue(st.getString(1).empty(), "get");
+
+        // ids restart after clear
+        b &= assertEquals(static_cast<StringId>(1), st.intern("map_warhouse.txt", bAdded), "intern");
+
+        return b;
+    }
+
+    bool test_client_handle_entry_msg()
+    {
+        proofps_dd::StringTable st;
+        pge_network::PgePacket pkt;
+
+        bool b = assertFalse(proofps_dd::MsgStringTableEntryFromServer::initPkt(pkt, proofps_dd::StringTable::InvalidStringId, "pistol.txt"), "initPkt invalid");
+        b &= assertTrue(proofps_dd::MsgStringTableEntryFromServer::initPkt(pkt, 5, "pistol.txt"), "initPkt");
+        b &= assertTrue(
+            st.clientHandleStringTableEntryFromServer(
+                pge_network::PgePacket::getMsgAppDataFromPkt<proofps_dd::MsgStringTableEntryFromServer>(pkt)),
+            "handle");
+        b &= assertEquals(std::string("pistol.txt"), st.getString(5), "get");
+        b &= assertEquals(static_cast<StringId>(5), st.find("pistol.txt"), "find");
+
+        return b;
+    }
+
+};
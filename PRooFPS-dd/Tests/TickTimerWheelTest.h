@@ -0,0 +1,266 @@
+#pragma once
+
+/*
+    ###################################################################################
+    TickTimerWheelTest.h
+    Unit test for PRooFPS-dd TickTimerWheel.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "UnitTest.h"
+
+#include "TickTimerWheel.h"
+
+class TickTimerWheelTest :
+    public UnitTest
+{
+public:
+
+    TickTimerWheelTest() :
+        UnitTest(__FILE__)
+    {
+    }
+
+    TickTimerWheelTest(const TickTimerWheelTest&) = delete;
+    TickTimerWheelTest& operator=(const TickTimerWheelTest&) = delete;
+    TickTimerWheelTest(TickTimerWheelTest&&) = delete;
+    TickTimerWheelTest& operator=(TickTimerWheelTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&TickTimerWheelTest::test_initial_values);
+        addSubTest("test_advance_empty_jumps_to_tick", (PFNUNITSUBTEST)&TickTimerWheelTest::test_advance_empty_jumps_to_tick);
+        addSubTest("test_timer_expires_exactly_at_its_tick", (PFNUNITSUBTEST)&TickTimerWheelTest::test_timer_expires_exactly_at_its_tick);
+        addSubTest("test_zero_ticks_expires_next_tick", (PFNUNITSUBTEST)&TickTimerWheelTest::test_zero_ticks_expires_next_tick);
+        addSubTest("test_expired_in_order_of_expiry_tick", (PFNUNITSUBTEST)&TickTimerWheelTest::test_expired_in_order_of_expiry_tick);
+        addSubTest("test_timers_of_higher_levels", (PFNUNITSUBTEST)&TickTimerWheelTest::test_timers_of_higher_levels);
+        addSubTest("test_timers_expiring_at_slot_boundaries", (PFNUNITSUBTEST)&TickTimerWheelTest::test_timers_expiring_at_slot_boundaries);
+        addSubTest("test_timer_beyond_top_level", (PFNUNITSUBTEST)&TickTimerWheelTest::test_timer_beyond_top_level);
+        addSubTest("test_tick_wraparound", (PFNUNITSUBTEST)&TickTimerWheelTest::test_tick_wraparound);
+        addSubTest("test_cancel", (PFNUNITSUBTEST)&TickTimerWheelTest::test_cancel);
+        addSubTest("test_timer_id_not_reused", (PFNUNITSUBTEST)&TickTimerWheelTest::test_timer_id_not_reused);
+        addSubTest("test_clear", (PFNUNITSUBTEST)&TickTimerWheelTest::test_clear);
+    }
+
+private:
+
+    using ExpiryVec = std::vector<proofps_dd::TickTimerWheel::Expiry>;
+
+    /** Advances tick by tick, returns the tick when the first timer expired, 0 if none expired until nTickLast. */
+    std::uint32_t advanceUntilExpiry(proofps_dd::TickTimerWheel& wheel, const std::uint32_t& nTickLast, ExpiryVec& vecExpired)
+    {
+        while (wheel.getCurrentTick() != nTickLast)
+        {
+            wheel.advance(wheel.getCurrentTick() + 1, vecExpired);
+            if (!vecExpired.empty())
+            {
+                return wheel.getCurrentTick();
+            }
+        }
+        return 0;
+    }
+
+    static bool isExpiry(const proofps_dd::TickTimerWheel::Expiry& expiry, const std::uint32_t& nKind, const std::uint32_t& nId)
+    {
+        return (expiry.m_nKind == nKind) && (expiry.m_nId == nId);
+    }
+
+    bool test_initial_values()
+    {
+        const proofps_dd::TickTimerWheel wheel;
+
+        return (assertEquals(0u, wheel.getCurrentTick(), "current tick") &
+            assertEquals(0u, wheel.size(), "size") &
+            assertFalse(wheel.isScheduled(proofps_dd::TickTimerWheel::InvalidTimerId), "invalid id scheduled")) != 0;
+    }
+
+    bool test_advance_empty_jumps_to_tick()
+    {
+        proofps_dd::TickTimerWheel wheel;
+        ExpiryVec vecExpired{ proofps_dd::TickTimerWheel::Expiry{ 1u, 2u } };
+        wheel.advance(100000u, vecExpired);
+
+        return (assertEquals(100000u, wheel.getCurrentTick(), "current tick") &
+            assertTrue(vecExpired.empty(), "expired")) != 0;
+    }
+
+    bool test_timer_expires_exactly_at_its_tick()
+    {
+        proofps_dd::TickTimerWheel wheel;
+        ExpiryVec vecExpired;
+        wheel.advance(1000u, vecExpired);
+        const auto timerId = wheel.schedule(10u, 3u, 7u);
+
+        bool b = assertNotEquals(proofps_dd::TickTimerWheel::InvalidTimerId, timerId, "timer id") &
+            assertTrue(wheel.isScheduled(timerId), "scheduled 1") &
+            assertEquals(1u, wheel.size(), "size 1");
+
+        b &= assertEquals(1010u, advanceUntilExpiry(wheel, 2000u, vecExpired), "expiry tick");
+        b &= assertEquals(1u, vecExpired.size(), "expired count");
+        if (!vecExpired.empty())
+        {
+            b &= assertTrue(isExpiry(vecExpired[0], 3u, 7u), "expired");
+        }
+
+        return (b & assertFalse(wheel.isScheduled(timerId), "scheduled 2") &
+            assertEquals(0u, wheel.size(), "size 2")) != 0;
+    }
+
+    bool test_zero_ticks_expires_next_tick()
+    {
+        proofps_dd::TickTimerWheel wheel;
+        ExpiryVec vecExpired;
+        wheel.schedule(0u, 1u, 1u);
+
+        return assertEquals(1u, advanceUntilExpiry(wheel, 100u, vecExpired), "expiry tick");
+    }
+
+    bool test_expired_in_order_of_expiry_tick()
+    {
+        proofps_dd::TickTimerWheel wheel;
+        ExpiryVec vecExpired;
+        wheel.schedule(300u, 1u, 3u);
+        wheel.schedule(5u, 1u, 1u);
+        wheel.schedule(70u, 1u, 2u);
+        wheel.schedule(5000u, 1u, 4u);
+
+        // advancing many ticks at once still collects all due timers
+        wheel.advance(6000u, vecExpired);
+
+        bool b = assertEquals(4u, vecExpired.size(), "expired count");
+        for (std::uint32_t i = 0; (i < vecExpired.size()) && (i < 4u); i++)
+        {
+            b &= assertTrue(isExpiry(vecExpired[i], 1u, i + 1u), ("expired " + std::to_string(i)).c_str());
+        }
+
+        return (b & assertEquals(6000u, wheel.getCurrentTick(), "current tick") &
+            assertEquals(0u, wheel.size(), "size")) != 0;
+    }
+
+    bool test_timers_of_higher_levels()
+    {
+        // boundaries of each level, scheduled from a current tick not aligned to any slot
+        const std::uint32_t nTicksArr[] = { 63u, 64u, 65u, 4095u, 4096u, 4097u, 262143u, 262144u, 262145u, 1000000u };
+
+        bool b = true;
+        for (const auto& nTicks : nTicksArr)
+        {
+            proofps_dd::TickTimerWheel wheel;
+            ExpiryVec vecExpired;
+            wheel.advance(12345u, vecExpired);
+            wheel.schedule(nTicks, 2u, nTicks);
+            b &= assertEquals(12345u + nTicks, advanceUntilExpiry(wheel, 12345u + nTicks + 100u, vecExpired), ("expiry tick " + std::to_string(nTicks)).c_str());
+            b &= assertEquals(1u, vecExpired.size(), ("expired count " + std::to_string(nTicks)).c_str());
+        }
+
+        return b;
+    }
+
+    bool test_timers_expiring_at_slot_boundaries()
+    {
+        // these expire exactly when their slot of a higher level is moved down
+        const std::uint32_t nExpiryTicksArr[] = { 64u, 128u, 4096u, 8192u, 262144u, 524288u };
+
+        bool b = true;
+        for (const auto& nExpiryTick : nExpiryTicksArr)
+        {
+            proofps_dd::TickTimerWheel wheel;
+            ExpiryVec vecExpired;
+            wheel.advance(7u, vecExpired);
+            wheel.schedule(nExpiryTick - 7u, 2u, nExpiryTick);
+            b &= assertEquals(nExpiryTick, advanceUntilExpiry(wheel, nExpiryTick + 100u, vecExpired), ("expiry tick " + std::to_string(nExpiryTick)).c_str());
+            b &= assertEquals(1u, vecExpired.size(), ("expired count " + std::to_string(nExpiryTick)).c_str());
+        }
+
+        return b;
+    }
+
+    bool test_timer_beyond_top_level()
+    {
+        proofps_dd::TickTimerWheel wheel;
+        ExpiryVec vecExpired;
+        const std::uint32_t nTicks = (1u << (proofps_dd::TickTimerWheel::nLevels * proofps_dd::TickTimerWheel::nSlotBits)) + 1000u;
+        wheel.schedule(nTicks, 1u, 1u);
+
+        wheel.advance(nTicks - 1u, vecExpired);
+        bool b = assertTrue(vecExpired.empty(), "expired 1") & assertEquals(1u, wheel.size(), "size 1");
+
+        wheel.advance(nTicks, vecExpired);
+        return (b & assertEquals(1u, vecExpired.size(), "expired 2") &
+            assertEquals(0u, wheel.size(), "size 2")) != 0;
+    }
+
+    bool test_tick_wraparound()
+    {
+        proofps_dd::TickTimerWheel wheel;
+        ExpiryVec vecExpired;
+        wheel.advance(0xFFFFFFF0u, vecExpired);
+        wheel.schedule(100u, 1u, 1u);
+
+        // 0xFFFFFFF0 + 100 wraps around to 84
+        return (assertEquals(84u, advanceUntilExpiry(wheel, 1000u, vecExpired), "expiry tick") &
+            assertEquals(1u, vecExpired.size(), "expired count")) != 0;
+    }
+
+    bool test_cancel()
+    {
+        proofps_dd::TickTimerWheel wheel;
+        ExpiryVec vecExpired;
+        const auto timerId1 = wheel.schedule(10u, 1u, 1u);
+        const auto timerId2 = wheel.schedule(10u, 1u, 2u);
+        const auto timerId3 = wheel.schedule(5000u, 1u, 3u);
+
+        bool b = assertTrue(wheel.cancel(timerId1), "cancel 1") &
+            assertFalse(wheel.cancel(timerId1), "cancel 1 again") &
+            assertTrue(wheel.cancel(timerId3), "cancel 3") &
+            assertFalse(wheel.cancel(proofps_dd::TickTimerWheel::InvalidTimerId), "cancel invalid") &
+            assertEquals(1u, wheel.size(), "size 1");
+
+        wheel.advance(10000u, vecExpired);
+        b &= assertEquals(1u, vecExpired.size(), "expired count");
+        if (!vecExpired.empty())
+        {
+            b &= assertTrue(isExpiry(vecExpired[0], 1u, 2u), "expired");
+        }
+
+        return (b & assertFalse(wheel.cancel(timerId2), "cancel 2 after expiry") &
+            assertEquals(0u, wheel.size(), "size 2")) != 0;
+    }
+
+    bool test_timer_id_not_reused()
+    {
+        proofps_dd::TickTimerWheel wheel;
+        const auto timerId1 = wheel.schedule(10u, 1u, 1u);
+        wheel.cancel(timerId1);
+        // memory of the cancelled timer is reused but the old id shall not refer to the new timer
+        const auto timerId2 = wheel.schedule(10u, 1u, 2u);
+
+        return (assertNotEquals(timerId1, timerId2, "ids") &
+            assertFalse(wheel.isScheduled(timerId1), "scheduled 1") &
+            assertFalse(wheel.cancel(timerId1), "cancel 1") &
+            assertTrue(wheel.isScheduled(timerId2), "scheduled 2")) != 0;
+    }
+
+    bool test_clear()
+    {
+        proofps_dd::TickTimerWheel wheel;
+        ExpiryVec vecExpired;
+        wheel.advance(50u, vecExpired);
+        const auto timerId = wheel.schedule(10u, 1u, 1u);
+        wheel.schedule(100000u, 1u, 2u);
+        wheel.clear();
+
+        bool b = assertEquals(0u, wheel.size(), "size") &
+            assertEquals(50u, wheel.getCurrentTick(), "current tick") &
+            assertFalse(wheel.isScheduled(timerId), "scheduled");
+
+        wheel.advance(200000u, vecExpired);
+        return (b & assertTrue(vecExpired.empty(), "expired")) != 0;
+    }
+
+}; // class TickTimerWheelTest
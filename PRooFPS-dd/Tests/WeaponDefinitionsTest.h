@@ -0,0 +1,305 @@
+#pragma once
+
+/*
+    ###################################################################################
+    WeaponDefinitionsTest.h
+    Unit test for PRooFPS-dd WeaponDefinitions.
+    Please see UnitTest.h about my statement of using "bitwise and" operator with bool operands.
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <cassert>
+#include <string>
+
+#include "UnitTest.h"
+
+#include "WeaponDefinitions.h"
+
+class WeaponDefinitionsTest :
+    public UnitTest
+{
+public:
+
+    WeaponDefinitionsTest(PGEcfgProfiles& cfgProfiles) :
+        UnitTest(__FILE__),
+        m_audio(cfgProfiles),
+        m_cfgProfiles(cfgProfiles),
+        m_engine(nullptr)
+    {}
+
+    WeaponDefinitionsTest(const WeaponDefinitionsTest&) = delete;
+    WeaponDefinitionsTest& operator=(const WeaponDefinitionsTest&) = delete;
+    WeaponDefinitionsTest(WeaponDefinitionsTest&&) = delete;
+    WeaponDefinitionsTest& operator=(WeaponDefinitionsTest&&) = delete;
+
+protected:
+
+    virtual void initialize() override
+    {
+        //CConsole::getConsoleInstance().SetLoggingState(proofps_dd::WeaponDefinitions::getLoggerModuleName(), true);
+
+        m_audio.initialize();
+
+        PGEInputHandler& inputHandler = PGEInputHandler::createAndGet(m_cfgProfiles);
+
+        m_engine = &PR00FsUltimateRenderingEngine::createAndGet(m_cfgProfiles, inputHandler);
+        m_engine->initialize(PURE_RENDERER_HW_FP, 800, 600, PURE_WINDOWED, 0, 32, 24, 0, 0);  // pretty standard display mode, should work on most systems
+
+        addSubTest("test_initial_values", (PFNUNITSUBTEST)&WeaponDefinitionsTest::test_initial_values);
+        addSubTest("test_load_all_fails_for_bad_dir", (PFNUNITSUBTEST)&WeaponDefinitionsTest::test_load_all_fails_for_bad_dir);
+        addSubTest("test_load_all_parses_weapon_files", (PFNUNITSUBTEST)&WeaponDefinitionsTest::test_load_all_parses_weapon_files);
+        addSubTest("test_find_by_filename_unknown", (PFNUNITSUBTEST)&WeaponDefinitionsTest::test_find_by_filename_unknown);
+        addSubTest("test_find_before_bind", (PFNUNITSUBTEST)&WeaponDefinitionsTest::test_find_before_bind);
+        addSubTest("test_bind_weapon_ids_by_filename", (PFNUNITSUBTEST)&WeaponDefinitionsTest::test_bind_weapon_ids_by_filename);
+        addSubTest("test_find_unknown_id", (PFNUNITSUBTEST)&WeaponDefinitionsTest::test_find_unknown_id);
+        addSubTest("test_unbind_weapon_ids", (PFNUNITSUBTEST)&WeaponDefinitionsTest::test_unbind_weapon_ids);
+        addSubTest("test_clear", (PFNUNITSUBTEST)&WeaponDefinitionsTest::test_clear);
+    }
+
+    virtual bool setUp() override
+    {
+        bool b = assertTrue(m_engine && m_engine->isInitialized(), "engine inited");
+
+        if (b && (m_bullets.capacity() == 0))
+        {
+            assert(m_engine);
+            m_bullets.reserve("bullets", 10u, *m_engine);
+        }
+
+        return b;
+    }
+
+    virtual void tearDown() override
+    {
+        m_bullets.clear();
+    }
+
+    virtual void finalize() override
+    {
+        m_bullets.deallocate();
+        if (m_engine)
+        {
+            m_engine->shutdown();
+            m_engine = NULL;
+        }
+
+        m_audio.shutdown();
+
+        CConsole::getConsoleInstance().SetLoggingState(proofps_dd::WeaponDefinitions::getLoggerModuleName(), false);
+    }
+
+private:
+
+    pge_audio::PgeAudio m_audio;
+    PGEcfgProfiles& m_cfgProfiles;
+    PR00FsUltimateRenderingEngine* m_engine;
+    PgeObjectPool<PooledBullet> m_bullets;
+
+    // ---------------------------------------------------------------------------
+
+    /** Loads a subset of the weapon files, in different order than their filenames, so weapon ids differ from the alphabetical order. */
+    bool loadWeapons(WeaponManager& wpnMgr)
+    {
+        bool b = assertTrue(wpnMgr.load("gamedata/weapons/shotgun.txt", 0), "wm wpn load shotgun");
+        b &= assertTrue(wpnMgr.load("gamedata/weapons/knife.txt", 0), "wm wpn load knife");
+        b &= assertTrue(wpnMgr.load("gamedata/weapons/pistol.txt", 0), "wm wpn load pistol");
+        b &= assertTrue(wpnMgr.load("gamedata/weapons/grenadelauncher.txt", 0), "wm wpn load grenadelauncher");
+        return b;
+    }
+
+    bool test_initial_values()
+    {
+        const proofps_dd::WeaponDefinitions wpnDefs;
+
+        return assertEquals(0u, wpnDefs.size(), "size") &
+            assertNull(wpnDefs.find(0), "find") &
+            assertNull(wpnDefs.findByFilename("pistol.txt"), "findByFilename");
+    }
+
+    bool test_load_all_fails_for_bad_dir()
+    {
+        proofps_dd::WeaponDefinitions wpnDefs;
+
+        bool b = assertTrue(wpnDefs.loadAll("gamedata/weapons/"), "loadAll 1");
+        b &= assertFalse(wpnDefs.loadAll("gamedata/nosuchdir/"), "loadAll 2");
+        b &= assertEquals(0u, wpnDefs.size(), "size");
+
+        return b;
+    }
+
+    bool test_load_all_parses_weapon_files()
+    {
+        proofps_dd::WeaponDefinitions wpnDefs;
+
+        bool b = assertTrue(wpnDefs.loadAll("gamedata/weapons/"), "loadAll");
+        b &= assertEquals(8u, wpnDefs.size(), "size");
+        if (!b)
+        {
+            return false;
+        }
+
+        const proofps_dd::WeaponDefinition* const pKnife = wpnDefs.findByFilename("knife.txt");
+        const proofps_dd::WeaponDefinition* const pPistol = wpnDefs.findByFilename("pistol.txt");
+        const proofps_dd::WeaponDefinition* const pShotgun = wpnDefs.findByFilename("shotgun.txt");
+        const proofps_dd::WeaponDefinition* const pGrenadeLauncher = wpnDefs.findByFilename("grenadelauncher.txt");
+        b &= assertNotNull(pKnife, "knife") &
+            assertNotNull(pPistol, "pistol") &
+            assertNotNull(pShotgun, "shotgun") &
+            assertNotNull(pGrenadeLauncher, "grenadelauncher");
+        if (!b)
+        {
+            return false;
+        }
+
+        b &= assertTrue(pKnife->m_eType == Weapon::Type::Melee, "knife type");
+        b &= assertFalse(pKnife->m_bReloadPerMag, "knife reload_per_mag");
+        b &= assertEquals(std::string("knife_hitwall1.wav"), pKnife->m_sDamageWallSnd, "knife damage_wall_snd");
+        b &= assertEquals(std::string("knife_hit3.wav"), pKnife->m_sDamagePlayerSnd, "knife damage_player_snd");
+        b &= assertTrue(pKnife->m_sBulletBounceSnd.empty(), "knife bullet_bounce_snd");
+
+        b &= assertTrue(pPistol->m_eType == Weapon::Type::Ranged, "pistol type");
+        b &= assertTrue(pPistol->m_bReloadPerMag, "pistol reload_per_mag");
+        b &= assertEquals(1u, pPistol->m_nBulletSubprojectiles, "pistol bullet_subprojectiles");
+        b &= assertFalse(pPistol->m_bBulletBounces, "pistol bullet_bounces");
+
+        b &= assertFalse(pShotgun->m_bReloadPerMag, "shotgun reload_per_mag");
+        b &= assertEquals(5u, pShotgun->m_nBulletSubprojectiles, "shotgun bullet_subprojectiles");
+
+        b &= assertTrue(pGrenadeLauncher->m_bBulletBounces, "grenadelauncher bullet_bounces");
+        b &= assertEquals(std::string("he_bounce-1.wav"), pGrenadeLauncher->m_sBulletBounceSnd, "grenadelauncher bullet_bounce_snd");
+
+        // sounds are loaded only by loadSounds()
+        b &= assertNull(pKnife->m_sndDamageWall.get(), "knife damage wall snd");
+        b &= assertNull(pGrenadeLauncher->m_sndBulletBounce.get(), "grenadelauncher bullet bounce snd");
+
+        return b;
+    }
+
+    bool test_find_by_filename_unknown()
+    {
+        proofps_dd::WeaponDefinitions wpnDefs;
+
+        bool b = assertTrue(wpnDefs.loadAll("gamedata/weapons/"), "loadAll");
+        b &= assertNull(wpnDefs.findByFilename("nosuchweapon.txt"), "findByFilename 1");
+        b &= assertNull(wpnDefs.findByFilename("gamedata/weapons/pistol.txt"), "findByFilename 2");  // expects filename without path
+        b &= assertNull(wpnDefs.findByFilename(""), "findByFilename 3");
+
+        return b;
+    }
+
+    bool test_find_before_bind()
+    {
+        proofps_dd::WeaponDefinitions wpnDefs;
+
+        bool b = assertTrue(wpnDefs.loadAll("gamedata/weapons/"), "loadAll");
+        for (size_t i = 0; i < proofps_dd::WeaponDefinitions::nMaxWeaponIds; i++)
+        {
+            b &= assertNull(wpnDefs.find(static_cast<WeaponId>(i)), (std::string("find ") + std::to_string(i)).c_str());
+        }
+
+        return b;
+    }
+
+    bool test_bind_weapon_ids_by_filename()
+    {
+        proofps_dd::WeaponDefinitions wpnDefs;
+        WeaponManager wpnMgr(m_audio, m_cfgProfiles, *m_engine, m_bullets);
+
+        bool b = assertTrue(wpnDefs.loadAll("gamedata/weapons/"), "loadAll");
+        b &= loadWeapons(wpnMgr);
+        b &= assertTrue(wpnDefs.bindWeaponIds(wpnMgr), "bind");
+        if (!b)
+        {
+            return false;
+        }
+
+        size_t nBoundCount = 0;
+        for (size_t i = 0; i < proofps_dd::WeaponDefinitions::nMaxWeaponIds; i++)
+        {
+            const Weapon* const wpn = wpnMgr.getWeaponById(static_cast<WeaponId>(i));
+            if (!wpn)
+            {
+                continue;
+            }
+
+            const proofps_dd::WeaponDefinition* const pWpnDef = wpnDefs.find(static_cast<WeaponId>(i));
+            b &= assertNotNull(pWpnDef, ("find " + wpn->getFilename()).c_str());
+            b &= assertTrue(pWpnDef == wpnDefs.findByFilename(wpn->getFilename()), ("same as findByFilename " + wpn->getFilename()).c_str());
+            if (pWpnDef)
+            {
+                b &= assertTrue(pWpnDef->m_eType == wpn->getType(), ("type " + wpn->getFilename()).c_str());
+            }
+            nBoundCount++;
+        }
+        b &= assertEquals(wpnMgr.getWeapons().size(), nBoundCount, "bound count");
+
+        return b;
+    }
+
+    bool test_find_unknown_id()
+    {
+        proofps_dd::WeaponDefinitions wpnDefs;
+        WeaponManager wpnMgr(m_audio, m_cfgProfiles, *m_engine, m_bullets);
+
+        bool b = assertTrue(wpnDefs.loadAll("gamedata/weapons/"), "loadAll");
+        b &= loadWeapons(wpnMgr);
+        b &= assertTrue(wpnDefs.bindWeaponIds(wpnMgr), "bind");
+
+        // ids not used by the WeaponManager stay unbound, even though more weapon files were parsed than loaded by the WeaponManager
+        for (size_t i = 0; i < proofps_dd::WeaponDefinitions::nMaxWeaponIds; i++)
+        {
+            if (!wpnMgr.getWeaponById(static_cast<WeaponId>(i)))
+            {
+                b &= assertNull(wpnDefs.find(static_cast<WeaponId>(i)), (std::string("find ") + std::to_string(i)).c_str());
+            }
+        }
+
+        return b;
+    }
+
+    bool test_unbind_weapon_ids()
+    {
+        proofps_dd::WeaponDefinitions wpnDefs;
+        WeaponManager wpnMgr(m_audio, m_cfgProfiles, *m_engine, m_bullets);
+
+        bool b = assertTrue(wpnDefs.loadAll("gamedata/weapons/"), "loadAll");
+        b &= loadWeapons(wpnMgr);
+        b &= assertTrue(wpnDefs.bindWeaponIds(wpnMgr), "bind");
+
+        wpnDefs.unbindWeaponIds();
+
+        // definitions are kept, only the weapon ids are forgotten
+        b &= assertEquals(8u, wpnDefs.size(), "size");
+        b &= assertNotNull(wpnDefs.findByFilename("pistol.txt"), "findByFilename");
+        for (size_t i = 0; i < proofps_dd::WeaponDefinitions::nMaxWeaponIds; i++)
+        {
+            b &= assertNull(wpnDefs.find(static_cast<WeaponId>(i)), (std::string("find ") + std::to_string(i)).c_str());
+        }
+
+        return b;
+    }
+
+    bool test_clear()
+    {
+        proofps_dd::WeaponDefinitions wpnDefs;
+        WeaponManager wpnMgr(m_audio, m_cfgProfiles, *m_engine, m_bullets);
+
+        bool b = assertTrue(wpnDefs.loadAll("gamedata/weapons/"), "loadAll");
+        b &= loadWeapons(wpnMgr);
+        b &= assertTrue(wpnDefs.bindWeaponIds(wpnMgr), "bind");
+
+        wpnDefs.clear();
+
+        b &= assertEquals(0u, wpnDefs.size(), "size");
+        b &= assertNull(wpnDefs.findByFilename("pistol.txt"), "findByFilename");
+        for (size_t i = 0; i < proofps_dd::WeaponDefinitions::nMaxWeaponIds; i++)
+        {
+            b &= assertNull(wpnDefs.find(static_cast<WeaponId>(i)), (std::string("find ") + std::to_string(i)).c_str());
+        }
+
+        return b;
+    }
+
+};
@@ -0,0 +1,293 @@
+/*
+    ###################################################################################
+    TickTimerWheel.cpp
+    Hierarchical timer wheel keyed on simulation ticks for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <cassert>
+
+#include "TickTimerWheel.h"
+
+
+// ############################### PUBLIC ################################
+
+
+const char* proofps_dd::TickTimerWheel::getLoggerModuleName()
+{
+    return "TickTimerWheel";
+}
+
+CConsole& proofps_dd::TickTimerWheel::getConsole() const
+{
+    return CConsole::getConsoleInstance(getLoggerModuleName());
+}
+
+/**
+* @return The tick the wheel was last advanced to.
+*/
+const std::uint32_t& proofps_dd::TickTimerWheel::getCurrentTick() const
+{
+    return m_nCurrentTick;
+}
+
+/**
+* @return Number of scheduled timers.
+*/
+size_t proofps_dd::TickTimerWheel::size() const
+{
+    return m_nScheduledCount;
+}
+
+/**
+* Schedules a new timer to expire when the wheel is advanced to the current tick + nTicksFromNow.
+*
+* @param nTicksFromNow 0 is treated as 1, the earliest a timer can expire is the next tick.
+* @param nKind         Defined by the scheduling subsystem, returned in the expiry.
+* @param nId           Defined by the scheduling subsystem, returned in the expiry.
+*
+* @return Id of the new timer, to be used for cancel().
+*/
+proofps_dd::TickTimerWheel::TimerId proofps_dd::TickTimerWheel::schedule(
+    const std::uint32_t& nTicksFromNow,
+    const std::uint32_t& nKind,
+    const std::uint32_t& nId)
+{
+    std::int32_t iTimer = m_iFreeHead;
+    if (iTimer == nInvalidIndex)
+    {
+        iTimer = static_cast<std::int32_t>(m_vecTimers.size());
+        m_vecTimers.push_back(Timer{ 0, 0, 0, 1 /* generation */, nFreeSlot, nInvalidIndex, nInvalidIndex });
+    }
+    else
+    {
+        m_iFreeHead = m_vecTimers[iTimer].m_iNext;
+    }
+
+    Timer& timer = m_vecTimers[iTimer];
+    timer.m_nExpiryTick = m_nCurrentTick + ((nTicksFromNow == 0) ? 1 : nTicksFromNow);
+    timer.m_nKind = nKind;
+    timer.m_nId = nId;
+    insert(iTimer);
+    m_nScheduledCount++;
+
+    return makeTimerId(iTimer, timer.m_nGeneration);
+}
+
+/**
+* @return True if the timer was scheduled and now it is cancelled, false if it was not scheduled e.g. it has already expired.
+*/
+bool proofps_dd::TickTimerWheel::cancel(const TimerId& timerId)
+{
+    const std::int32_t iTimer = findTimer(timerId);
+    if (iTimer == nInvalidIndex)
+    {
+        return false;
+    }
+
+    unlink(iTimer);
+    release(iTimer);
+    return true;
+}
+
+bool proofps_dd::TickTimerWheel::isScheduled(const TimerId& timerId) const
+{
+    return findTimer(timerId) != nInvalidIndex;
+}
+
+/**
+* Advances the wheel tick by tick up to the given tick, collecting the timers expiring in these ticks.
+* If there are no timers, it jumps to the given tick immediately, even if that is behind the current tick.
+*
+* @param nTick      The tick to advance to, normally the current tick + 1. Ticks are allowed to wrap around.
+* @param vecExpired Cleared first, then filled with the expired timers, in order of their expiry tick.
+*                   The order of timers expiring in the same tick is deterministic.
+*/
+void proofps_dd::TickTimerWheel::advance(const std::uint32_t& nTick, std::vector<Expiry>& vecExpired)
+{
+    vecExpired.clear();
+
+    if ((m_nScheduledCount > 0) && ((nTick - m_nCurrentTick) > 0x80000000u))
+    {
+        getConsole().EOLn("TickTimerWheel::%s(): tick %u is behind current tick %u!", __func__, nTick, m_nCurrentTick);
+        assert(false);
+        return;
+    }
+
+    while ((m_nCurrentTick != nTick) && (m_nScheduledCount > 0))
+    {
+        m_nCurrentTick++;
+
+        // timers of higher levels whose slot has come are moved down before the due timers of level 0 are collected
+        std::uint32_t nTickShifted = m_nCurrentTick;
+        for (std::uint32_t nLevel = 1; nLevel < nLevels; nLevel++)
+        {
+            if ((nTickShifted & (nSlotsPerLevel - 1)) != 0)
+            {
+                break;
+            }
+            nTickShifted >>= nSlotBits;
+            cascade(nLevel, nTickShifted & (nSlotsPerLevel - 1));
+        }
+
+        Slot& slot = m_slots[m_nCurrentTick & (nSlotsPerLevel - 1)];
+        std::int32_t iTimer = slot.m_iHead;
+        slot.m_iHead = nInvalidIndex;
+        slot.m_iTail = nInvalidIndex;
+        while (iTimer != nInvalidIndex)
+        {
+            const std::int32_t iNext = m_vecTimers[iTimer].m_iNext;
+            assert(m_vecTimers[iTimer].m_nExpiryTick == m_nCurrentTick);
+            vecExpired.push_back(Expiry{ m_vecTimers[iTimer].m_nKind, m_vecTimers[iTimer].m_nId });
+            release(iTimer);
+            iTimer = iNext;
+        }
+    }
+
+    // nothing to do in the remaining ticks
+    m_nCurrentTick = nTick;
+}
+
+/**
+* Cancels all timers. Current tick is kept.
+*/
+void proofps_dd::TickTimerWheel::clear()
+{
+    for (auto& slot : m_slots)
+    {
+        std::int32_t iTimer = slot.m_iHead;
+        slot.m_iHead = nInvalidIndex;
+        slot.m_iTail = nInvalidIndex;
+        while (iTimer != nInvalidIndex)
+        {
+            const std::int32_t iNext = m_vecTimers[iTimer].m_iNext;
+            release(iTimer);
+            iTimer = iNext;
+        }
+    }
+    assert(m_nScheduledCount == 0);
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
+
+
+proofps_dd::TickTimerWheel::TimerId proofps_dd::TickTimerWheel::makeTimerId(const std::int32_t& iTimer, const std::uint32_t& nGeneration)
+{
+    // generation is never 0 so a valid id is never InvalidTimerId
+    return (static_cast<TimerId>(nGeneration) << 32) | static_cast<std::uint32_t>(iTimer);
+}
+
+/**
+* @return Index of the scheduled timer with the given id, nInvalidIndex if there is no such scheduled timer.
+*/
+std::int32_t proofps_dd::TickTimerWheel::findTimer(const TimerId& timerId) const
+{
+    const std::uint32_t nIndex = static_cast<std::uint32_t>(timerId & 0xFFFFFFFFu);
+    const std::uint32_t nGeneration = static_cast<std::uint32_t>(timerId >> 32);
+    if ((nIndex >= m_vecTimers.size()) ||
+        (m_vecTimers[nIndex].m_nGeneration != nGeneration) ||
+        (m_vecTimers[nIndex].m_nSlot == nFreeSlot))
+    {
+        return nInvalidIndex;
+    }
+    return static_cast<std::int32_t>(nIndex);
+}
+
+/**
+* Appends the timer to the slot for its expiry tick, on the lowest level whose range covers it.
+* Expiry tick equal to the current tick is allowed only when moving timers down in advance(), in which case the timer goes to
+* the level 0 slot of the current tick, collected right after moving down.
+*/
+void proofps_dd::TickTimerWheel::insert(const std::int32_t& iTimer)
+{
+    Timer& timer = m_vecTimers[iTimer];
+    const std::uint32_t nDelta = timer.m_nExpiryTick - m_nCurrentTick;
+    assert(nDelta <= 0x80000000u);
+
+    std::uint32_t nLevel = 0;
+    std::uint32_t nTickForSlot = timer.m_nExpiryTick;
+    while ((nLevel + 1 < nLevels) && (nDelta >= (1u << ((nLevel + 1) * nSlotBits))))
+    {
+        nLevel++;
+    }
+    if ((nLevel + 1 == nLevels) && (nDelta >= (1u << (nLevels * nSlotBits))))
+    {
+        // beyond the range of the top level: put to its farthest slot, it will be inserted again from there
+        nTickForSlot = m_nCurrentTick + (1u << (nLevels * nSlotBits)) - 1;
+    }
+
+    timer.m_nSlot = nLevel * nSlotsPerLevel + ((nTickForSlot >> (nLevel * nSlotBits)) & (nSlotsPerLevel - 1));
+    Slot& slot = m_slots[timer.m_nSlot];
+    timer.m_iPrev = slot.m_iTail;
+    timer.m_iNext = nInvalidIndex;
+    if (slot.m_iTail == nInvalidIndex)
+    {
+        slot.m_iHead = iTimer;
+    }
+    else
+    {
+        m_vecTimers[slot.m_iTail].m_iNext = iTimer;
+    }
+    slot.m_iTail = iTimer;
+}
+
+void proofps_dd::TickTimerWheel::unlink(const std::int32_t& iTimer)
+{
+    Timer& timer = m_vecTimers[iTimer];
+    Slot& slot = m_slots[timer.m_nSlot];
+    if (timer.m_iPrev == nInvalidIndex)
+    {
+        slot.m_iHead = timer.m_iNext;
+    }
+    else
+    {
+        m_vecTimers[timer.m_iPrev].m_iNext = timer.m_iNext;
+    }
+    if (timer.m_iNext == nInvalidIndex)
+    {
+        slot.m_iTail = timer.m_iPrev;
+    }
+    else
+    {
+        m_vecTimers[timer.m_iNext].m_iPrev = timer.m_iPrev;
+    }
+}
+
+/**
+* Puts the already unlinked timer to the free list.
+*/
+void proofps_dd::TickTimerWheel::release(const std::int32_t& iTimer)
+{
+    Timer& timer = m_vecTimers[iTimer];
+    timer.m_nGeneration = (timer.m_nGeneration == 0xFFFFFFFFu) ? 1 : (timer.m_nGeneration + 1);
+    timer.m_nSlot = nFreeSlot;
+    timer.m_iPrev = nInvalidIndex;
+    timer.m_iNext = m_iFreeHead;
+    m_iFreeHead = iTimer;
+    m_nScheduledCount--;
+}
+
+/**
+* Moves the timers of the given slot of the given level to lower levels, according to the current tick.
+*/
+void proofps_dd::TickTimerWheel::cascade(const std::uint32_t& nLevel, const std::uint32_t& nSlotInLevel)
+{
+    Slot& slot = m_slots[nLevel * nSlotsPerLevel + nSlotInLevel];
+    std::int32_t iTimer = slot.m_iHead;
+    slot.m_iHead = nInvalidIndex;
+    slot.m_iTail = nInvalidIndex;
+    while (iTimer != nInvalidIndex)
+    {
+        const std::int32_t iNext = m_vecTimers[iTimer].m_iNext;
+        insert(iTimer);
+        iTimer = iNext;
+    }
+}
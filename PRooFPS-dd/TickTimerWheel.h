@@ -0,0 +1,117 @@
+#pragma once
+
+/*
+    ###################################################################################
+    TickTimerWheel.h
+    Hierarchical timer wheel keyed on simulation ticks for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "CConsole.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Timers expiring at given simulation ticks, so subsystems do not need to poll the clock every tick for every entity,
+    * and expirations are deterministic in ticks.
+    *
+    * Hierarchical wheel: level 0 has a slot for each of the next nSlotsPerLevel ticks, every higher level has a slot for
+    * nSlotsPerLevel times as many ticks as a slot of the previous level, and its timers are moved down to lower levels when
+    * their slot comes. So advancing by a tick costs only the due timers and occasionally moving a slot of timers one level down.
+    * Timers farther than the range of the top level are simply moved down later than the others.
+    *
+    * A timer is identified by a kind and an id given by the subsystem scheduling it, e.g. kind of map item respawn and the map item id.
+    * Memory of freed timers is reused, no allocation happens once the timer storage has grown to the max number of timers.
+    */
+    class TickTimerWheel
+    {
+    public:
+
+        using TimerId = std::uint64_t;
+
+        static constexpr TimerId InvalidTimerId = 0;
+        static constexpr std::uint32_t nSlotBits = 6;
+        static constexpr std::uint32_t nSlotsPerLevel = 1u << nSlotBits;
+        static constexpr std::uint32_t nLevels = 4;
+
+        struct Expiry
+        {
+            std::uint32_t m_nKind;
+            std::uint32_t m_nId;
+        };
+
+        static const char* getLoggerModuleName();          /**< Returns the logger module name of this class. */
+
+        // ---------------------------------------------------------------------------
+
+        TickTimerWheel() = default;
+
+        TickTimerWheel(const TickTimerWheel&) = delete;
+        TickTimerWheel& operator=(const TickTimerWheel&) = delete;
+        TickTimerWheel(TickTimerWheel&&) = delete;
+        TickTimerWheel&& operator=(TickTimerWheel&&) = delete;
+
+        CConsole& getConsole() const;                      /**< Returns access to console preset with logger module name as this class. */
+
+        const std::uint32_t& getCurrentTick() const;
+        size_t size() const;
+
+        TimerId schedule(const std::uint32_t& nTicksFromNow, const std::uint32_t& nKind, const std::uint32_t& nId);
+        bool cancel(const TimerId& timerId);
+        bool isScheduled(const TimerId& timerId) const;
+        void advance(const std::uint32_t& nTick, std::vector<Expiry>& vecExpired);
+        void clear();
+
+    protected:
+
+    private:
+
+        static constexpr std::int32_t nInvalidIndex = -1;
+        static constexpr std::uint32_t nFreeSlot = nLevels * nSlotsPerLevel;  /**< Slot of timers in the free list. */
+
+        struct Timer
+        {
+            std::uint32_t m_nExpiryTick;
+            std::uint32_t m_nKind;
+            std::uint32_t m_nId;
+            std::uint32_t m_nGeneration;   /**< Incremented when the timer is freed, so old TimerIds do not refer to a reused timer. */
+            std::uint32_t m_nSlot;         /**< Index in m_slots, or nFreeSlot. */
+            std::int32_t m_iPrev;
+            std::int32_t m_iNext;
+        };
+
+        struct Slot
+        {
+            std::int32_t m_iHead = nInvalidIndex;
+            std::int32_t m_iTail = nInvalidIndex;
+        };
+
+        // ---------------------------------------------------------------------------
+
+        std::vector<Timer> m_vecTimers;
+        std::array<Slot, nLevels * nSlotsPerLevel> m_slots;  /**< Level 0 slots first, then level 1 slots, etc. */
+        std::int32_t m_iFreeHead = nInvalidIndex;
+        std::uint32_t m_nCurrentTick = 0;
+        size_t m_nScheduledCount = 0;
+
+        // ---------------------------------------------------------------------------
+
+        static TimerId makeTimerId(const std::int32_t& iTimer, const std::uint32_t& nGeneration);
+
+        std::int32_t findTimer(const TimerId& timerId) const;
+        void insert(const std::int32_t& iTimer);
+        void unlink(const std::int32_t& iTimer);
+        void release(const std::int32_t& iTimer);
+        void cascade(const std::uint32_t& nLevel, const std::uint32_t& nSlotInLevel);
+
+    }; // class TickTimerWheel
+
+} // namespace proofps_dd
@@ -0,0 +1,273 @@
+/*
+    ###################################################################################
+    WeaponDefinitions.cpp
+    Typed, shared weapon properties for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include "stdafx.h"  // PCH
+
+#include <cassert>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+
+#include "WeaponDefinitions.h"
+
+
+// ############################### PUBLIC ################################
+
+
+const char* proofps_dd::WeaponDefinitions::getLoggerModuleName()
+{
+    return "WeaponDefinitions";
+}
+
+CConsole& proofps_dd::WeaponDefinitions::getConsole() const
+{
+    return CConsole::getConsoleInstance(getLoggerModuleName());
+}
+
+/**
+* Parses all weapon files in the given directory, replacing the previously loaded definitions if any.
+* Weapon ids are unbound, bindWeaponIds() needs to be invoked after weapons are loaded by any player.
+*
+* @return True on success, false if the directory cannot be read or any weapon file failed to parse.
+*/
+bool proofps_dd::WeaponDefinitions::loadAll(const std::string& sWeaponsDir)
+{
+    clear();
+
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(sWeaponsDir, ec))
+    {
+        if (entry.path().extension().string() != ".txt")
+        {
+            continue;
+        }
+
+        WeaponDefinition& wpnDef = m_mapDefinitions[entry.path().filename().string()];
+        if (!parseFile(entry.path().string(), wpnDef))
+        {
+            getConsole().EOLn("WeaponDefinitions::%s(): failed to parse weapon file: %s!", __func__, entry.path().string().c_str());
+            clear();
+            return false;
+        }
+    }
+
+    if (ec)
+    {
+        getConsole().EOLn("WeaponDefinitions::%s(): failed to read directory: %s!", __func__, sWeaponsDir.c_str());
+        clear();
+        return false;
+    }
+
+    getConsole().OLn("WeaponDefinitions::%s(): loaded %u weapon definitions.", __func__, static_cast<uint32_t>(m_mapDefinitions.size()));
+    return true;
+}
+
+/**
+* Loads the hit and bounce sounds of the loaded definitions, so these can be played by weapon id without any player's weapons.
+* Sounds are shared by the definitions, thus loaded only once per weapon file instead of once per player.
+*/
+void proofps_dd::WeaponDefinitions::loadSounds(pge_audio::PgeAudio& audio, const std::string& sWeaponSoundsDir)
+{
+    for (auto& wpnDefPair : m_mapDefinitions)
+    {
+        WeaponDefinition& wpnDef = wpnDefPair.second;
+        wpnDef.m_sndDamageWall = loadSound(audio, sWeaponSoundsDir, wpnDef.m_sDamageWallSnd);
+        wpnDef.m_sndDamagePlayer = loadSound(audio, sWeaponSoundsDir, wpnDef.m_sDamagePlayerSnd);
+        wpnDef.m_sndBulletBounce = loadSound(audio, sWeaponSoundsDir, wpnDef.m_sBulletBounceSnd);
+    }
+}
+
+/**
+* Binds the loaded definitions to the weapon ids assigned by the given WeaponManager, based on weapon filenames.
+* The given WeaponManager can be owned by any player, since all players load the same weapon files.
+*
+* @return False if the WeaponManager has a weapon without loaded definition, true otherwise.
+*/
+bool proofps_dd::WeaponDefinitions::bindWeaponIds(WeaponManager& wpnMgr)
+{
+    unbindWeaponIds();
+    m_vecDefinitionsById.resize(nMaxWeaponIds, nullptr);
+
+    size_t nBoundCount = 0;
+    for (size_t i = 0; i < nMaxWeaponIds; i++)
+    {
+        const Weapon* const wpn = wpnMgr.getWeaponById(static_cast<WeaponId>(i));
+        if (!wpn)
+        {
+            continue;
+        }
+
+        const WeaponDefinition* const pWpnDef = findByFilename(wpn->getFilename());
+        if (!pWpnDef)
+        {
+            getConsole().EOLn("WeaponDefinitions::%s(): no definition loaded for weapon: %s!", __func__, wpn->getFilename().c_str());
+            assert(false);
+            unbindWeaponIds();
+            return false;
+        }
+        m_vecDefinitionsById[i] = pWpnDef;
+        nBoundCount++;
+    }
+
+    if (nBoundCount != wpnMgr.getWeapons().size())
+    {
+        getConsole().EOLn("WeaponDefinitions::%s(): bound %u weapon ids but WeaponManager has %u weapons!",
+            __func__, static_cast<uint32_t>(nBoundCount), static_cast<uint32_t>(wpnMgr.getWeapons().size()));
+        assert(false);
+        unbindWeaponIds();
+        return false;
+    }
+    return true;
+}
+
+/**
+* Forgets the weapon ids but keeps the loaded definitions, e.g. when weapons are reloaded by the players.
+*/
+void proofps_dd::WeaponDefinitions::unbindWeaponIds()
+{
+    m_vecDefinitionsById.clear();
+}
+
+/**
+* @return The definition bound to the given weapon id, nullptr if the id is not bound.
+*/
+const proofps_dd::WeaponDefinition* proofps_dd::WeaponDefinitions::find(const WeaponId& wpnId) const
+{
+    const size_t nIndex = static_cast<size_t>(wpnId);
+    if (nIndex >= m_vecDefinitionsById.size())
+    {
+        return nullptr;
+    }
+    return m_vecDefinitionsById[nIndex];
+}
+
+/**
+* @return The definition loaded from the given weapon file (filename without path), nullptr if there is no such.
+*/
+const proofps_dd::WeaponDefinition* proofps_dd::WeaponDefinitions::findByFilename(const std::string& sFilename) const
+{
+    const auto it = m_mapDefinitions.find(sFilename);
+    return (it == m_mapDefinitions.end()) ? nullptr : &(it->second);
+}
+
+/**
+* @return Number of loaded definitions.
+*/
+size_t proofps_dd::WeaponDefinitions::size() const
+{
+    return m_mapDefinitions.size();
+}
+
+/**
+* Forgets all definitions and weapon ids.
+*/
+void proofps_dd::WeaponDefinitions::clear()
+{
+    unbindWeaponIds();
+    m_mapDefinitions.clear();
+}
+
+
+// ############################## PROTECTED ##############################
+
+
+// ############################### PRIVATE ###############################
+
+
+/**
+* Parses the given weapon file into the given definition.
+* Same syntax as expected by Weapon: lines starting with hashtag are comments, variable names are case-insensitive,
+* and values can be empty.
+*
+* @return False if the file cannot be opened or has a line that is neither comment nor assignment, true otherwise.
+*/
+bool proofps_dd::WeaponDefinitions::parseFile(const std::string& sFilenameWithPath, WeaponDefinition& wpnDef) const
+{
+    std::ifstream f(sFilenameWithPath, std::ifstream::in);
+    if (!f.good())
+    {
+        getConsole().EOLn("WeaponDefinitions::%s(): failed to open file: %s!", __func__, sFilenameWithPath.c_str());
+        return false;
+    }
+
+    std::map<std::string, PGEcfgVariable> vars;
+    std::string sLine;
+    while (std::getline(f, sLine))
+    {
+        const std::string::size_type nFirst = sLine.find_first_not_of(" \t\r");
+        if ((nFirst == std::string::npos) || (sLine[nFirst] == '#'))
+        {
+            continue;
+        }
+
+        const std::string::size_type nAssignmentPos = sLine.find('=', nFirst);
+        if ((nAssignmentPos == std::string::npos) || (nAssignmentPos == nFirst))
+        {
+            getConsole().EOLn("WeaponDefinitions::%s(): not an assignment in %s: %s!", __func__, sFilenameWithPath.c_str(), sLine.c_str());
+            return false;
+        }
+
+        std::string sVar = sLine.substr(nFirst, sLine.find_last_not_of(" \t", nAssignmentPos - 1) + 1 - nFirst);
+        for (auto& c : sVar)
+        {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+
+        const std::string::size_type nValueFirst = sLine.find_first_not_of(" \t\r", nAssignmentPos + 1);
+        const std::string sValue =
+            (nValueFirst == std::string::npos) ?
+            std::string() :
+            sLine.substr(nValueFirst, sLine.find_last_not_of(" \t\r") + 1 - nValueFirst);
+
+        vars[sVar] = sValue.c_str();
+    }
+
+    wpnDef.m_eType = (vars["type"].getAsString() == "melee") ? Weapon::Type::Melee : Weapon::Type::Ranged;
+    wpnDef.m_nBulletSubprojectiles = vars["bullet_subprojectiles"].getAsUInt();
+    wpnDef.m_bReloadPerMag = vars["reload_per_mag"].getAsBool();
+    wpnDef.m_bBulletVisible = vars["bullet_visible"].getAsBool();
+    wpnDef.m_fBulletSizeX = vars["bullet_size_x"].getAsFloat();
+    wpnDef.m_fBulletSizeY = vars["bullet_size_y"].getAsFloat();
+    wpnDef.m_fBulletSizeZ = vars["bullet_size_z"].getAsFloat();
+    wpnDef.m_fBulletSpeed = vars["bullet_speed"].getAsFloat();
+    wpnDef.m_fBulletGravity = vars["bullet_gravity"].getAsFloat();
+    wpnDef.m_fBulletDrag = vars["bullet_drag"].getAsFloat();
+    wpnDef.m_fBulletDistanceMax = vars["bullet_distance_max"].getAsFloat();
+    wpnDef.m_bDamageRelDistance = vars["damage_rel_distance"].getAsBool();
+    wpnDef.m_bBulletBounces = vars["bullet_bounces"].getAsBool();
+    wpnDef.m_eBulletParticle =
+        (vars["bullet_particle"].getAsString() == "smoke") ?
+        Bullet::ParticleType::Smoke :
+        Bullet::ParticleType::None;
+    wpnDef.m_sDamageAreaGfxObj = vars["damage_area_gfx_obj"].getAsString();
+    wpnDef.m_damageAreaGfxObjRefId = PFL::calcHash(wpnDef.m_sDamageAreaGfxObj);
+    wpnDef.m_sDamageWallSnd = vars["damage_wall_snd"].getAsString();
+    wpnDef.m_sDamagePlayerSnd = vars["damage_player_snd"].getAsString();
+    wpnDef.m_sBulletBounceSnd = vars["bullet_bounce_snd"].getAsString();
+
+    return true;
+}
+
+/**
+* @return The loaded sound, nullptr if the given filename is empty.
+*/
+std::shared_ptr<SoLoud::Wav> proofps_dd::WeaponDefinitions::loadSound(
+    pge_audio::PgeAudio& audio,
+    const std::string& sWeaponSoundsDir,
+    const std::string& sFilename) const
+{
+    if (sFilename.empty())
+    {
+        return nullptr;
+    }
+
+    auto snd = std::make_shared<SoLoud::Wav>();
+    audio.loadSound(*snd, sWeaponSoundsDir + sFilename);
+    return snd;
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+/*
+    ###################################################################################
+    WeaponDefinitions.h
+    Typed, shared weapon properties for PRooFPS-dd
+    Made by PR00F88, West Whiskhyll Entertainment
+    2026
+    ###################################################################################
+*/
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CConsole.h"
+
+#include "PGE.h"
+
+#include "Explosion.h"
+
+namespace proofps_dd
+{
+
+    /**
+    * Properties of a weapon type that are the same for all players' weapons with the same WeaponId, parsed once from the weapon's
+    * file, so bullet creation and hit handling do not need any string lookup.
+    * Mutable per-player state like bullet counts stays in the players' own Weapon instances.
+    */
+    struct WeaponDefinition
+    {
+        Weapon::Type m_eType = Weapon::Type::Melee;
+        unsigned int m_nBulletSubprojectiles = 1;
+        bool m_bReloadPerMag = false;
+        bool m_bBulletVisible = true;
+        float m_fBulletSizeX = 0.f;
+        float m_fBulletSizeY = 0.f;
+        float m_fBulletSizeZ = 0.f;
+        float m_fBulletSpeed = 0.f;
+        float m_fBulletGravity = 0.f;
+        float m_fBulletDrag = 0.f;
+        float m_fBulletDistanceMax = 0.f;
+        bool m_bDamageRelDistance = false;
+        bool m_bBulletBounces = false;
+        Bullet::ParticleType m_eBulletParticle = Bullet::ParticleType::None;
+        std::string m_sDamageAreaGfxObj;
+        ExplosionObjRefId m_damageAreaGfxObjRefId = 0;  /**< Hash of m_sDamageAreaGfxObj, ready for creating explosions. */
+        std::string m_sDamageWallSnd;
+        std::string m_sDamagePlayerSnd;
+        std::string m_sBulletBounceSnd;
+        std::shared_ptr<SoLoud::Wav> m_sndDamageWall;    /**< Loaded by loadSounds(), nullptr if not loaded or m_sDamageWallSnd is empty. */
+        std::shared_ptr<SoLoud::Wav> m_sndDamagePlayer;  /**< Loaded by loadSounds(), nullptr if not loaded or m_sDamagePlayerSnd is empty. */
+        std::shared_ptr<SoLoud::Wav> m_sndBulletBounce;  /**< Loaded by loadSounds(), nullptr if not loaded or m_sBulletBounceSnd is empty. */
+    };
+
+    /**
+    * WeaponDefinition of each weapon file, parsed by loadAll() independently of any player's weapons.
+    * Since WeaponId is assigned by WeaponManager when a player loads the weapon files, the definitions are bound to weapon ids
+    * by bindWeaponIds() using any player's WeaponManager, weapon ids being the same in all WeaponManagers.
+    */
+    class WeaponDefinitions
+    {
+    public:
+
+        static constexpr size_t nMaxWeaponIds = 256;
+
+        static const char* getLoggerModuleName();          /**< Returns the logger module name of this class. */
+
+        // ---------------------------------------------------------------------------
+
+        WeaponDefinitions() = default;
+
+        WeaponDefinitions(const WeaponDefinitions&) = delete;
+        WeaponDefinitions& operator=(const WeaponDefinitions&) = delete;
+        WeaponDefinitions(WeaponDefinitions&&) = delete;
+        WeaponDefinitions&& operator=(WeaponDefinitions&&) = delete;
+
+        CConsole& getConsole() const;                      /**< Returns access to console preset with logger module name as this class. */
+
+        bool loadAll(const std::string& sWeaponsDir);
+        void loadSounds(pge_audio::PgeAudio& audio, const std::string& sWeaponSoundsDir);
+        bool bindWeaponIds(WeaponManager& wpnMgr);
+        void unbindWeaponIds();
+        const WeaponDefinition* find(const WeaponId& wpnId) const;
+        const WeaponDefinition* findByFilename(const std::string& sFilename) const;
+        size_t size() const;
+        void clear();
+
+    protected:
+
+    private:
+
+        std::map<std::string, WeaponDefinition> m_mapDefinitions;  /**< Keyed by weapon filename without path, e.g. "pistol.txt". */
+        std::vector<const WeaponDefinition*> m_vecDefinitionsById; /**< Indexed by WeaponId, elements point into m_mapDefinitions, nullptr if id is not bound. */
+
+        // ---------------------------------------------------------------------------
+
+        bool parseFile(const std::string& sFilenameWithPath, WeaponDefinition& wpnDef) const;
+        std::shared_ptr<SoLoud::Wav> loadSound(pge_audio::PgeAudio& audio, const std::string& sWeaponSoundsDir, const std::string& sFilename) const;
+
+    }; // class WeaponDefinitions
+
+} // namespace proofps_dd
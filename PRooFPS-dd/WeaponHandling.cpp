@@ -11,9 +11,13 @@
 
 #include <cassert>
 #include <chrono>
+#include <cmath>
 
 #include "WeaponHandling.h"
 
+#include "MsgTrafficStats.h"
+#include "StringTable.h"
+
 
 static constexpr float SndWpnFireDistMin = 6.f;
 static constexpr float SndWpnFireDistMax = 14.f;
@@ -91,6 +95,18 @@ bool proofps_dd::WeaponHandling::initializeWeaponHandling(PGEcfgProfiles& cfgPro
 
     Explosion::resetGlobalExplosionId();
 
+    // weapon files don't change during runtime, so they are parsed only once, independently of the players' own weapons
+    if (m_weaponDefinitions.size() == 0)
+    {
+        if (!m_weaponDefinitions.loadAll(proofps_dd::GAME_WEAPONS_DIR))
+        {
+            getConsole().EOLn("WeaponHandling::%s(): failed to load weapon definitions!", __func__);
+            return false;
+        }
+        // hit and bounce sounds are played by weapon id, not by any player's weapon
+        m_weaponDefinitions.loadSounds(m_pge.getAudio(), std::string(proofps_dd::GAME_AUDIO_DIR) + "weapons/");
+    }
+
     if (m_smokes.capacity() == 0)
     {
         /* 60 is the default min physics rate, dividing it by Extreme config's m_nEmitInEveryNPhysicsIteration should give 30 */
@@ -119,6 +135,18 @@ bool proofps_dd::WeaponHandling::initializeWeaponHandling(PGEcfgProfiles& cfgPro
         );
     }
 
+    if (m_explosions.capacity() == 0)
+    {
+        // explosion animation lasts less than a second, and explosive weapons cannot fire faster than a few times per second,
+        // so a few explosions per player is enough even with some fragile bullets exploding in a chain.
+        // If the pool is still exhausted, the oldest explosion is evicted, see evictOldestExplosion().
+        m_explosions.reserve(
+            "explosions",
+            cfgProfiles.getVars()[Player::szCVarPlayersMax].getAsUInt() * 4,
+            m_pge
+        );
+    }
+
     return true;
 }
 
@@ -178,7 +206,8 @@ void proofps_dd::WeaponHandling::handleCurrentPlayersCurrentWeaponBulletCountsCh
 
             if (((newState == Weapon::WPN_RELOADING) || (oldState == Weapon::WPN_RELOADING)) && (nNewMagCount == (nOldMagCount + 1)))
             {
-                if (!wpnCurrent.getVars()["reload_per_mag"].getAsBool())
+                const WeaponDefinition* const pWpnDef = getWeaponDefinition(wpnCurrent);
+                if (pWpnDef && !pWpnDef->m_bReloadPerMag)
                 {
                     // Reload sounds are only played for the specific player, and players cannot hear each other's reload.
                     m_sndWpnReloadStartHandle = m_pge.getAudio().play3dSound(wpnCurrent.getReloadStartSound(), player.getPos().getNew());
@@ -303,6 +332,17 @@ const PgeObjectPool<proofps_dd::Smoke>& proofps_dd::WeaponHandling::getSmokePool
 // ############################## PROTECTED ##############################
 
 
+/**
+* Binds the weapon definitions to the weapon ids of the given WeaponManager.
+* Should be invoked after the weapons of the first player are loaded, since weapon ids are the same in all WeaponManagers.
+*
+* @return False if any weapon of the given WeaponManager has no definition, true otherwise.
+*/
+bool proofps_dd::WeaponHandling::bindWeaponDefinitions(WeaponManager& wpnMgr)
+{
+    return m_weaponDefinitions.bindWeaponIds(wpnMgr);
+}
+
 void proofps_dd::WeaponHandling::deleteWeaponHandlingAll(const bool& bDeallocBullets)
 {
     // as explained at m_pWpnAutoSwitchWhenPickedUp, we need to clear these stuff!
@@ -311,23 +351,41 @@ void proofps_dd::WeaponHandling::deleteWeaponHandlingAll(const bool& bDeallocBul
     clearWeaponAutoSwitchToBestWithAnyKindOfAmmoRequest();
     clearWeaponPickupInducedAutoSwitchRequest();
 
+    // pooled explosions keep their cloned objects even when free, those must be gone before the reference objects
+    for (auto& xpl : m_explosions)
+    {
+        xpl.destroyClonedObjects();
+    }
+    m_explosionsActive.clear();
     m_explosions.clear();
     Explosion::destroyReferenceExplosions();
     Explosion::resetGlobalExplosionId();
+    m_vecChainDetonationQueue.clear();
+    m_weaponDefinitions.unbindWeaponIds();  // weapons are reloaded with the players, weapon ids will be bound again then
+
+    // bullet ids will be recycled so we must forget which client knows about which bullet
+    m_interestManagement.clear();
+    m_mapLagCompensatedBullets.clear();
 
     if (bDeallocBullets)
     {
+        m_bulletsActive.clear();
         m_pge.getBullets().deallocate();
         Bullet::destroyReferenceObject();   // we would not need explicit call if Bullet implemented reference counting
         Bullet::resetGlobalBulletId();
         
+        m_smokesActive.clear();
         m_smokes.deallocate();
         Smoke::destroyReferenceObject();    // we would not need explicit call if Smoke implemented reference counting
+
+        m_explosions.deallocate();
     }
     else
     {
         m_pge.getBullets().clear();
+        m_bulletsActive.clear();
         m_smokes.clear();
+        m_smokesActive.clear();
     }
 }
 
@@ -342,14 +400,14 @@ void proofps_dd::WeaponHandling::serverUpdateWeapons(proofps_dd::GameMode& gameM
 
     /* Do not set the momentary weapon accuracy every frame, as triggering MsgUserUpdate just for this would be overkill.
        Remember, now we are in a per - frame server function.
-       Enough to set it every Nth frame, this is only for xhair scaling anyway, not used in physics. */
-    constexpr int nEveryNthWeaponMomentaryAccuracyIsActuallySet = 4;
-    static int nWeaponMomentaryAccuracySetCounter = 0;
-    nWeaponMomentaryAccuracySetCounter++;
-    const bool bSetWeaponMomentaryAccuracyInThisFrame = (nWeaponMomentaryAccuracySetCounter == nEveryNthWeaponMomentaryAccuracyIsActuallySet);
+       Enough to set it periodically, this is only for xhair scaling anyway, not used in physics.
+       The period is measured in time, not in frames, so it does not depend on the server's frame rate. */
+    const bool bSetWeaponMomentaryAccuracyInThisFrame =
+        (std::chrono::duration_cast<std::chrono::milliseconds>(timeStart - m_timeLastWeaponMomentaryAccuracySet).count() >=
+            nWeaponMomentaryAccuracySetIntervalMillisecs);
     if (bSetWeaponMomentaryAccuracyInThisFrame)
     {
-        nWeaponMomentaryAccuracySetCounter = 0;
+        m_timeLastWeaponMomentaryAccuracySet = timeStart;
     }
 
     for (auto& playerPair : m_mapPlayers)
@@ -365,6 +423,19 @@ void proofps_dd::WeaponHandling::serverUpdateWeapons(proofps_dd::GameMode& gameM
         const auto nOldMagCount = wpn->getMagBulletCount();
         const auto nOldUnmagCount = wpn->getUnmagBulletCount();
         bool bSendPrivateWpnUpdatePktToTheClientOnly = false;
+
+        // Weapon is updated BEFORE pulling the trigger: if its cooldown or reload has finished since the previous frame, it can
+        // fire already in this frame. The other way around, every shot would be delayed by an extra frame, slightly decreasing
+        // the firing rate of fast firing weapons.
+        if (wpn->update())
+        {
+            if (playerServerSideConnHandle != pge_network::ServerConnHandle)
+            {
+                // server doesn't need to send this msg to itself, it already executed bullet count change by wpn->update()
+                bSendPrivateWpnUpdatePktToTheClientOnly = true;
+            }
+        }
+
         if (player.getAttack() && player.attack())
         {
             //getConsole().EOLn("WeaponHandling::%s(): player %u attack", __func__, playerServerSideConnHandle);
@@ -389,20 +460,16 @@ void proofps_dd::WeaponHandling::serverUpdateWeapons(proofps_dd::GameMode& gameM
                 m_pge.getAudio().stopSoundInstance(m_sndWpnReloadStartHandle);
                 m_pge.getAudio().stopSoundInstance(m_sndWpnReloadEndHandle);
             }
-            const auto sndWpnFireHandle = m_pge.getAudio().play3dSound(wpn->getFiringSound(), player.getPos().getNew());
-            m_pge.getAudio().getAudioEngineCore().set3dSourceMinMaxDistance(sndWpnFireHandle, SndWpnFireDistMin, SndWpnFireDistMax);
-            m_pge.getAudio().getAudioEngineCore().set3dSourceAttenuation(sndWpnFireHandle, SoLoud::AudioSource::ATTENUATION_MODELS::LINEAR_DISTANCE, 1.f);
+            play3dSoundWithVoiceLimit(
+                SoundVoiceManager::SoundClass::WeaponFire,
+                wpn->getFiringSound(),
+                player.getPos().getNew().getX(),
+                player.getPos().getNew().getY(),
+                player.getPos().getNew().getZ(),
+                SndWpnFireDistMin,
+                SndWpnFireDistMax);
         }  // end player.getAttack() && attack()
 
-        if (wpn->update())
-        {
-            if (playerServerSideConnHandle != pge_network::ServerConnHandle)
-            {
-                // server doesn't need to send this msg to itself, it already executed bullet count change by wpn->update()
-                bSendPrivateWpnUpdatePktToTheClientOnly = true;
-            }
-        }
-
         /* Since clients do not have enough data to calculate momentary accuracy, and does not worth implementing replicating all of those data,
            we are sending their momentary weapon accuracy in regular user updates. */
         if (bSetWeaponMomentaryAccuracyInThisFrame)
@@ -442,7 +509,7 @@ void proofps_dd::WeaponHandling::serverUpdateWeapons(proofps_dd::GameMode& gameM
             if (!proofps_dd::MsgWpnUpdateFromServer::initPkt(
                 pktWpnUpdatePrivate,
                 pge_network::ServerConnHandle /* ignored by client anyway */,
-                wpn->getFilename(),
+                StringTable::serverIntern(m_pge.getNetwork(), wpn->getFilename()),
                 MapItemType::ITEM_HEALTH /* intentionally setting nonsense type, because itemType should be valid only in case of item pickup for now */,
                 /* IMPORTANT: later if we remove wpn filename from message, even here we will need to use correct itemType, so we will be unable to distinguish
                    from wpn reload induced ammo increase or item pickup induced ammo increase in handleWpnUpdateFromServer(), thus we will need to add a flag
@@ -457,7 +524,7 @@ void proofps_dd::WeaponHandling::serverUpdateWeapons(proofps_dd::GameMode& gameM
                 assert(false);
                 continue;
             }
-            m_pge.getNetwork().getServer().send(pktWpnUpdatePrivate, playerServerSideConnHandle);
+            MsgTrafficStats::serverSend(m_pge.getNetwork(), pktWpnUpdatePrivate, playerServerSideConnHandle);
         }
 
         bool bSendPublicWpnUpdatePktToAllClients = false;
@@ -475,7 +542,7 @@ void proofps_dd::WeaponHandling::serverUpdateWeapons(proofps_dd::GameMode& gameM
             if (!proofps_dd::MsgCurrentWpnUpdateFromServer::initPkt(
                 pktWpnUpdateCurrentPublic,
                 playerServerSideConnHandle,
-                wpn->getFilename(),
+                StringTable::serverIntern(m_pge.getNetwork(), wpn->getFilename()),
                 wpn->getState().getNew()))
             {
                 getConsole().EOLn("WeaponHandling::%s(): initPkt() FAILED at line %d!", __func__, __LINE__);
@@ -483,7 +550,7 @@ void proofps_dd::WeaponHandling::serverUpdateWeapons(proofps_dd::GameMode& gameM
                 continue;
             }
             //getConsole().EOLn("WeaponHandling::%s(): sending weapon state old: %d, new: %d", __func__, wpn->getState().getOld(), wpn->getState().getNew());
-            m_pge.getNetwork().getServer().sendToAllClientsExcept(pktWpnUpdateCurrentPublic);
+            MsgTrafficStats::serverSendToAllClientsExcept(m_pge.getNetwork(), pktWpnUpdateCurrentPublic);
         }
     }  // end for playerPair
 
@@ -493,24 +560,22 @@ void proofps_dd::WeaponHandling::serverUpdateWeapons(proofps_dd::GameMode& gameM
 void proofps_dd::WeaponHandling::serverDeleteAllBulletsNow(
     proofps_dd::GameMode& gameMode, XHair& xhair, PureVector& vecCamShakeForce)
 {
-    PgeObjectPool<PooledBullet>& bullets = m_pge.getBullets();
-    size_t iti = 0; // to track how many used bullets we processed in the loop, to exit early if we already processed all used
-    // we need iti because there is no way to explicitly iterate over the used elems on the object pool
-    auto it = bullets.begin();
-    while ((iti != bullets.size()) && (it != bullets.end()))
+    serverRebuildPlayerSpatialIndex();
+    m_bulletsActive.sync(m_pge.getBullets());
+    for (size_t i = 0; i < m_bulletsActive.size(); i++)
     {
-        if (!it->used())
+        auto& bullet = m_bulletsActive[i];
+        if (!bullet.used())
         {
-            it++;
+            // already deleted by an explosion
             continue;
         }
-        iti++;
 
-        auto& bullet = *it;
         bullet.markForDeletion();
         // delete it right now, otherwise later we would send further updates to clients about this bullet
-        it = deleteBulletServer(bullets, it, false, false, xhair, vecCamShakeForce, gameMode, false /*bEndGame*/);
+        deleteBulletServer(bullet, false, false, xhair, vecCamShakeForce, gameMode, false /*bEndGame*/);
     }
+    m_bulletsActive.compact();
 }
 
 void proofps_dd::WeaponHandling::serverUpdateBulletsAndHandleHittingWallsAndPlayers(
@@ -527,25 +592,28 @@ void proofps_dd::WeaponHandling::serverUpdateBulletsAndHandleHittingWallsAndPlay
 
     const bool bCollisionModeBvh = (m_pge.getConfigProfiles().getVars()[Maps::szCVarSvMapCollisionMode].getAsInt() == 1);
     const float fAttackDamageMplier = m_config.getAttackDamageMultiplier();
+    // server tick counter is incremented at the end of the tick by serverSendUserUpdates(), so we are simulating the next one
+    std::uint32_t nCurrentServerTick = getServerTick() + 1;
+    if (nCurrentServerTick == 0)
+    {
+        ++nCurrentServerTick;
+    }
 
     // on the long run this function needs to be part of the game engine itself, however currently game engine doesn't handle collisions,
     // so once we introduce the collisions to the game engine, it will be an easy move of this function as well there
-    pge_network::PgePacket newPktBulletUpdate;
+    serverUpdateInterestManagementClientViews();
+    serverRebuildPlayerSpatialIndex();
     bool bEndGame = gameMode.isGameWon();
-    PgeObjectPool<PooledBullet>& bullets = m_pge.getBullets();
-    size_t iti = 0; // to track how many used bullets we processed in the loop, to exit early if we already processed all used
-    // we need iti because there is no way to explicitly iterate over the used elems on the object pool
-    auto it = bullets.begin();
-    while ((iti != bullets.size()) && (it != bullets.end()))
+    // bullets created by players firing since last time are not yet in the list
+    m_bulletsActive.sync(m_pge.getBullets());
+    for (size_t i = 0; i < m_bulletsActive.size(); i++)
     {
-        if (!it->used())
+        auto& bullet = m_bulletsActive[i];
+        if (!bullet.used())
         {
-            it++;
+            // already deleted by an explosion
             continue;
         }
-        iti++;
-
-        auto& bullet = *it;
 
         bool bWallHit = false;
         bool bPlayerHit = false;
@@ -564,23 +632,45 @@ void proofps_dd::WeaponHandling::serverUpdateBulletsAndHandleHittingWallsAndPlay
             }
         }
 
-        const float fBulletPosX = bullet.getObject3D().getPosVec().getX();
-        const float fBulletPosY = bullet.getObject3D().getPosVec().getY();
-        const float fBulletScaledSizeX = bullet.getObject3D().getScaledSizeVec().getX();
-        const float fBulletScaledSizeY = bullet.getObject3D().getScaledSizeVec().getY();
+        BulletBounds bulletBounds;
+        captureBulletBounds(bullet, bulletBounds);
+        const float& fBulletPosX = bulletBounds.m_fPosX;
+        const float& fBulletPosY = bulletBounds.m_fPosY;
+        const float& fBulletScaledSizeX = bulletBounds.m_fSizeX;
+        const float& fBulletScaledSizeY = bulletBounds.m_fSizeY;
 
         if (!bullet.isMarkedForDeletion())
         {
             emitParticles(bullet);
-            
+
+            // the first wall on the bullet's path in this tick: players behind it cannot be hit, and fast bullets cannot pass through it
+            float fWallHitTimeSwept = 1.f;
+            const PureObject3D* const pWallHitSwept = sharedUpdateBullets_sweptCollisionWithWalls(bCollisionModeBvh, oldPut, bulletBounds, fWallHitTimeSwept);
+
             if (bullet.hitsPlayers())
             {
                 const int nBulletDamageHp = static_cast<int>(std::lroundf(fAttackDamageMplier * bullet.getDamageHp()));
                 const int nBulletDamageAp = static_cast<int>(std::lroundf(fAttackDamageMplier * bullet.getDamageAp()));
+                const std::uint32_t nRewindTicks = serverGetBulletRewindTicks(bullet, nCurrentServerTick);
 
-                // check if bullet is hitting a player
+                const auto itShooter = m_mapPlayers.find(bullet.getOwner());
+                if ((itShooter == m_mapPlayers.end()) || !gameMode.isPlayerAllowedForGameplay(itShooter->second))
+                {
+                    // shooter either disconnected or not allowed to play anymore (e.g. spectating now)
+                    bullet.markForDeletion();
+                }
+
+                // check if bullet is hitting a player anywhere along its path in this tick, the earliest hit wins;
+                // a player behind the first wall on the path cannot be hit
+                Player* pPlayerHit = nullptr;
+                float fPlayerHitTime = pWallHitSwept ? fWallHitTimeSwept : 1.f;
                 for (auto& playerPair : m_mapPlayers)
                 {
+                    if (bullet.isMarkedForDeletion())
+                    {
+                        break;
+                    }
+
                     auto& player = playerPair.second;
                     if (bullet.getOwner() == player.getServerSideConnectionHandle())
                     {
@@ -602,83 +692,100 @@ void proofps_dd::WeaponHandling::serverUpdateBulletsAndHandleHittingWallsAndPlay
                         continue;
                     }
 
-                    const auto itShooter = m_mapPlayers.find(bullet.getOwner());
-                    if ((itShooter == m_mapPlayers.end()) || !gameMode.isPlayerAllowedForGameplay(itShooter->second))
+                    const auto& playerConst = player;
+                    if ((playerConst.getHealth() <= 0) || !canBulletHitPerFriendlyFireConfig(playerConst, itShooter))
                     {
-                        // shooter either disconnected or not allowed to play anymore (e.g. spectating now)
-                        bullet.markForDeletion();
                         continue;
                     }
 
-                    const auto& playerConst = player;
                     const auto playerScaledSizeVec = player.getObject3D()->getScaledSizeVec();
-                    if ((playerConst.getHealth() > 0) &&
-                        canBulletHitPerFriendlyFireConfig(playerConst, itShooter) &&
-                        colliding2_NoZ(
-                            player.getPos().getNew().getX(), player.getPos().getNew().getY(),
-                            playerScaledSizeVec.getX(), playerScaledSizeVec.getY(),
+                    PlayerHitboxHistory::Hitbox hitbox{
+                        playerPair.first,
+                        player.getPos().getNew().getX(), player.getPos().getNew().getY(),
+                        playerScaledSizeVec.getX(), playerScaledSizeVec.getY() };
+                    if (nRewindTicks > 0)
+                    {
+                        // lag compensation: hit-test against the player as the shooter saw it, if not in history we stay with the current hitbox
+                        getPlayerHitboxHistory().getHitbox(nCurrentServerTick - nRewindTicks, playerPair.first, hitbox);
+                    }
+
+                    float fHitTime = 1.f;
+                    if (colliding2_NoZ_swept(
+                            oldPut.getPosVec().getX(), oldPut.getPosVec().getY(),
                             fBulletPosX, fBulletPosY,
-                            fBulletScaledSizeX, fBulletScaledSizeY))
+                            fBulletScaledSizeX, fBulletScaledSizeY,
+                            hitbox.m_fPosX, hitbox.m_fPosY,
+                            hitbox.m_fSizeX, hitbox.m_fSizeY,
+                            fHitTime) &&
+                        (fHitTime <= fPlayerHitTime))
                     {
-                        bullet.markForDeletion();
-                        bPlayerHit = true;
-                        if (bullet.getAreaDamageSize() == 0.f)
+                        pPlayerHit = &player;
+                        fPlayerHitTime = fHitTime;
+                    }
+                } // for all players
+
+                if (pPlayerHit)
+                {
+                    auto& player = *pPlayerHit;
+                    const auto& playerConst = player;
+                    // a bullet can touch 1 player only at a time, it stops where it touched the player, so explosion also happens there
+                    sharedMoveBulletBackAlongPath(bullet, oldPut, fPlayerHitTime, bulletBounds);
+                    bullet.markForDeletion();
+                    bPlayerHit = true;
+                    if (bullet.getAreaDamageSize() == 0.f)
+                    {
+                        // non-explosive bullets do damage here, explosive bullets make explosions so then the explosion does damage in createExplosionServer()
+                        player.doDamage(nBulletDamageAp, nBulletDamageHp);
+                        
+                        // the attacker's weapon is used since its current firing mode also matters, not only its type
+                        Weapon* const wpnShooter = itShooter->second.getWeaponManager().getWeaponById(bullet.getWeaponId());
+                        assert(wpnShooter);  // all players load the same weapons
+                        const WeaponDefinition* const pWpnDef = getWeaponDefinition(bullet.getWeaponId());
+                        
+                        // similar to damage, non-explosive bullets push player here, other bullets push indirectly by explosion in createExplosionServer()
+                        if (wpnShooter)
                         {
-                            // non-explosive bullets do damage here, explosive bullets make explosions so then the explosion does damage in createExplosionServer()
-                            player.doDamage(nBulletDamageAp, nBulletDamageHp);
-                            
-                            // let's use any WeaponManager to retrieve weapon, even tho it is not their bullet, it doesnt matter now, we just need the weapon type!
-                            /* TODO: put back const to wpnForType after we don't need to call getVars() below! */
-                            Weapon* const wpnForType = getWeaponByIdFromAnyPlayersWeaponManager(bullet.getWeaponId());
-                            assert(wpnForType);  // null only if there are no players
-                            
-                            // similar to damage, non-explosive bullets push player here, other bullets push indirectly by explosion in createExplosionServer()
-                            // TODO: for this function, if bRecoil is passed as false, the attacker's (itShooter's) weapon shall be passed instead of any player's weapon,
-                            // since the weapon's current firing mode is also used within the function, however for now it is not a problem as of v0.7 as there is
-                            // no way to change firing mode of any weapon in the game. It will matter to auto firing mode weapons with switchable firing mode, but
-                            // that will be introduced much later in the future, even later than pistol's burst fire mode.
-                            player.updateImpactForceByBulletImpactOrRecoil(false /* bRecoil */, bullet, *wpnForType);
-                            
-                            // intentionally not counting with melee weapons for aim accuracy stat, let them swing the knife in the air and against walls
-                            // without affecting their aim accuracy stat!
-                            if (wpnForType && (wpnForType->getType() != Weapon::Type::Melee) &&
-                                /* WA for bug: https://github.com/proof88/PRooFPS-dd/issues/354 */
-                               (wpnForType->getVars()["bullet_subprojectiles"].getAsUInt() == 1))
+                            player.updateImpactForceByBulletImpactOrRecoil(false /* bRecoil */, bullet, *wpnShooter);
+                        }
+                        
+                        // intentionally not counting with melee weapons for aim accuracy stat, let them swing the knife in the air and against walls
+                        // without affecting their aim accuracy stat!
+                        if (pWpnDef && (pWpnDef->m_eType != Weapon::Type::Melee) &&
+                            /* WA for bug: https://github.com/proof88/PRooFPS-dd/issues/354 */
+                           (pWpnDef->m_nBulletSubprojectiles == 1))
+                        {
+                            ++itShooter->second.getShotsHitTarget();
+                            assert(itShooter->second.getShotsFiredCount()); // shall be non-zero if getShotsHitTarget() is non-zero; debug shall crash cause then it is logic error!
+                            itShooter->second.getFiringAccuracy() =
+                                (itShooter->second.getShotsFiredCount() == 0u) ? /* just in case of overflow which will most probably never happen */
+                                0.f :
+                                (itShooter->second.getShotsHitTarget() / static_cast<float>(itShooter->second.getShotsFiredCount()));
+                        }
+
+                        if (playerConst.getHealth() == 0)
+                        {
+                            const pge_network::PgeNetworkConnectionHandle nKillerConnHandleServerSide = itShooter->first;
+                            if (shallShooterFragsDecreasedDueToFriendlyFireIfItIsFriendlyFire(playerConst, itShooter->second))
                             {
-                                ++itShooter->second.getShotsHitTarget();
-                                assert(itShooter->second.getShotsFiredCount()); // shall be non-zero if getShotsHitTarget() is non-zero; debug shall crash cause then it is logic error!
-                                itShooter->second.getFiringAccuracy() =
-                                    (itShooter->second.getShotsFiredCount() == 0u) ? /* just in case of overflow which will most probably never happen */
-                                    0.f :
-                                    (itShooter->second.getShotsHitTarget() / static_cast<float>(itShooter->second.getShotsFiredCount()));
+                                --itShooter->second.getFrags();
                             }
-
-                            if (playerConst.getHealth() == 0)
+                            else
                             {
-                                const pge_network::PgeNetworkConnectionHandle nKillerConnHandleServerSide = itShooter->first;
-                                if (shallShooterFragsDecreasedDueToFriendlyFireIfItIsFriendlyFire(playerConst, itShooter->second))
-                                {
-                                    --itShooter->second.getFrags();
-                                }
-                                else
-                                {
-                                    ++itShooter->second.getFrags();
-                                }
-                                if (!gameMode.updatePlayer(itShooter->second, m_pge.getNetwork()))
-                                {
-                                    getConsole().EOLn("%s: failed to update player %s in GameMode!", __func__, itShooter->second.getName().c_str());
-                                }
-                                bEndGame = gameMode.isGameWon();
-                                //getConsole().OLn("WeaponHandling::%s(): Player %s has been killed by %s, who now has %d frags!",
-                                //    __func__, playerPair.first.c_str(), itShooter->first.c_str(), itShooter->second.getFrags());
-                                
-                                // server handles death here, clients will handle it when they receive MsgUserUpdateFromServer
-                                handlePlayerDied(player, xhair, nKillerConnHandleServerSide);
+                                ++itShooter->second.getFrags();
                             }
+                            if (!gameMode.updatePlayer(itShooter->second, m_pge.getNetwork()))
+                            {
+                                getConsole().EOLn("%s: failed to update player %s in GameMode!", __func__, itShooter->second.getName().c_str());
+                            }
+                            bEndGame = gameMode.isGameWon();
+                            //getConsole().OLn("WeaponHandling::%s(): Player %s has been killed by %s, who now has %d frags!",
+                            //    __func__, playerPair.first.c_str(), itShooter->first.c_str(), itShooter->second.getFrags());
+                            
+                            // server handles death here, clients will handle it when they receive MsgUserUpdateFromServer
+                            handlePlayerDied(player, xhair, nKillerConnHandleServerSide);
                         }
-                        break; // we can stop since a bullet can touch 1 playerPair only at a time
                     }
-                } // for all players
+                }
             }  // bullet.hitsPlayers()
 
             if (!bullet.isMarkedForDeletion())
@@ -695,6 +802,10 @@ void proofps_dd::WeaponHandling::serverUpdateBulletsAndHandleHittingWallsAndPlay
                 
                 if (bullet.canBounce())
                 {
+                    if (pWallHitSwept)
+                    {
+                        sharedMoveBulletIntoWallIfTunnelled(bullet, oldPut, *pWallHitSwept, fWallHitTimeSwept, bulletBounds);
+                    }
                     bWallHit = sharedUpdateBouncingBullets(
                         bCollisionModeBvh, bullet, oldPut, fBulletPosX, fBulletPosY, fBulletScaledSizeX, fBulletScaledSizeY, nPhysicsRate, GAME_FALL_GRAVITY_MIN);
                 }
@@ -702,19 +813,28 @@ void proofps_dd::WeaponHandling::serverUpdateBulletsAndHandleHittingWallsAndPlay
                 {
                     if (bullet.getAreaDamageSize() == 0.f)
                     {
+                        if (pWallHitSwept)
+                        {
+                            sharedMoveBulletIntoWallIfTunnelled(bullet, oldPut, *pWallHitSwept, fWallHitTimeSwept, bulletBounds);
+                        }
                         bWallHit = sharedUpdateRicochetingBullets(
                             bCollisionModeBvh, bullet, oldPut, fBulletPosX, fBulletPosY, fBulletScaledSizeX, fBulletScaledSizeY, nPhysicsRate, GAME_FALL_GRAVITY_MIN);
                     }
+                    else if (pWallHitSwept)
+                    {
+                        // this part leads definitely to deleting a bullet in case of hit, so this part is not present on client side;
+                        // bullet stops where it touched the wall, so explosion also happens there
+                        sharedMoveBulletBackAlongPath(bullet, oldPut, fWallHitTimeSwept, bulletBounds);
+                        bWallHit = true;
+                    }
                     else
                     {
-                        // this part leads definitely to deleting a bullet in case of hit, so this part is not present on client side
+                        // walls already touched at the old position are not found by the sweep, e.g. bullet fired from within a wall
                         if (bCollisionModeBvh)
                         {
-                            const float fBulletPosZ = bullet.getObject3D().getPosVec().getZ();
-                            const float fBulletScaledSizeZ = bullet.getObject3D().getScaledSizeVec().getZ();
                             bWallHit = (sharedUpdateBullets_collisionWithWalls_bvh(
-                                fBulletPosX, fBulletPosY, fBulletPosZ,
-                                fBulletScaledSizeX, fBulletScaledSizeY, fBulletScaledSizeZ) != nullptr);
+                                fBulletPosX, fBulletPosY, bulletBounds.m_fPosZ,
+                                fBulletScaledSizeX, fBulletScaledSizeY, bulletBounds.m_fSizeZ) != nullptr);
                         }
                         else
                         {
@@ -737,7 +857,7 @@ void proofps_dd::WeaponHandling::serverUpdateBulletsAndHandleHittingWallsAndPlay
         if (bullet.isMarkedForDeletion())
         {
             // delete it right now, otherwise later we would send further updates to clients about this bullet
-            it = deleteBulletServer(bullets, it, bPlayerHit, bWallHit, xhair, vecCamShakeForce, gameMode, bEndGame);
+            deleteBulletServer(bullet, bPlayerHit, bWallHit, xhair, vecCamShakeForce, gameMode, bEndGame);
         }
         else
         {
@@ -745,37 +865,24 @@ void proofps_dd::WeaponHandling::serverUpdateBulletsAndHandleHittingWallsAndPlay
             {
                 // new bullet, inform clients
                 bullet.isCreateSentToClients() = true;
-                proofps_dd::MsgBulletUpdateFromServer::initPkt(
-                    newPktBulletUpdate,
-                    bullet.getOwner(),
-                    bullet.getId(),
-                    bullet.getWeaponId(),
-                    /* from v0.6 clients also simulate bouncing bullet physics, but to make sure they also end up with same simulation,
-                       we have to send the original bullet positions to them, so they start simulation with same initial values e.g. gravity.
-                       Here it would be a mistake to send fBulletPosX and fBulletPosY because the related gravity and other bullets properties
-                       have been also changed on our side.
-                       The downside of sending the original positions here is that clients will see more delayed bullets. But that delay should be
-                       still minor. Later we can modify the logic, maybe move this sending stuff to the beginning of this loop. */
-                    oldPut.getPosVec().getX(),
-                    oldPut.getPosVec().getY(),
-                    /* these should be also original values but they are NOT altered by bullet.update() so they actually stay original */
-                    bullet.getObject3D().getPosVec().getZ(),
-                    bullet.getObject3D().getAngleVec().getX(),
-                    bullet.getObject3D().getAngleVec().getY(),
-                    bullet.getObject3D().getAngleVec().getZ(),
-                    bullet.getDamageHp(),
-                    bullet.getAreaDamageSize(),
-                    bullet.getAreaDamageEffect(),
-                    bullet.getAreaDamagePulse());
-                m_pge.getNetwork().getServer().sendToAllClientsExcept(newPktBulletUpdate);
+                /* from v0.6 clients also simulate bouncing bullet physics, but to make sure they also end up with same simulation,
+                   we have to send the original bullet positions to them, so they start simulation with same initial values e.g. gravity.
+                   Here it would be a mistake to send fBulletPosX and fBulletPosY because the related gravity and other bullets properties
+                   have been also changed on our side.
+                   The downside of sending the original positions here is that clients will see more delayed bullets. But that delay should be
+                   still minor. Later we can modify the logic, maybe move this sending stuff to the beginning of this loop. */
+                serverSendBulletCreateToRelevantClients(bullet, oldPut.getPosVec().getX(), oldPut.getPosVec().getY(), true /* bNewborn */);
+            }
+            else if (m_interestManagement.isEnabled())
+            {
+                // clients not informed about this bullet so far might have moved closer to it since its birth, we inform them only now
+                serverSendBulletCreateToRelevantClients(bullet, fBulletPosX, fBulletPosY, false /* bNewborn */);
             }
             // bullet didn't touch anything, go to next
-            it++;
             // since v0.1.4, server doesn't send the bullet travel updates to clients since clients simulate the travel in clientUpdateBullets()
         }
-
-        // 'it' is referring to next bullet, don't use it from here!
     }
+    m_bulletsActive.compact();
 
     if (bEndGame && (Bullet::getGlobalBulletId() > 0))
     {
@@ -805,24 +912,13 @@ void proofps_dd::WeaponHandling::serverHandleBulletsVsBullets(
     // on the long run this function needs to be part of the game engine itself, however currently game engine doesn't handle collisions,
     // so once we introduce the collisions to the game engine, it will be an easy move of this function as well there
     
-    PgeObjectPool<PooledBullet>& bullets = m_pge.getBullets();
-    size_t itiOuter = 0; // to track how many used bullets we processed in the outer loop, to exit early if we already processed all used
-    // we need iti because there is no way to explicitly iterate over the used elems on the object pool
-    auto itFragileBullet = bullets.begin();
-    while ((itiOuter < bullets.size()) && (itFragileBullet != bullets.end()))
+    serverRebuildPlayerSpatialIndex();
+    m_bulletsActive.sync(m_pge.getBullets());
+    for (size_t iFragileBullet = 0; iFragileBullet < m_bulletsActive.size(); iFragileBullet++)
     {
-        if (!itFragileBullet->used())
-        {
-            itFragileBullet++;
-            continue;
-        }
-        itiOuter++;
-
-        auto& fragileBullet = *itFragileBullet;
-
-        if (!fragileBullet.isFragile())
+        auto& fragileBullet = m_bulletsActive[iFragileBullet];
+        if (!fragileBullet.used() || !fragileBullet.isFragile())
         {
-            itFragileBullet++;
             continue;
         }
 
@@ -834,30 +930,22 @@ void proofps_dd::WeaponHandling::serverHandleBulletsVsBullets(
         // check if this bullet is hitting any other bullet?
         // OPT: could be speeden up by using a Uniform grid / spatial hash where we keep updating the dynamic objects.
         //      Such grid is much faster for updating than a BVH.
-        size_t itiInner = 0; // to track how many used bullets we processed in the inner loop, to exit early if we already processed all used
-        // we need iti because there is no way to explicitly iterate over the used elems on the object pool
-        auto itBullet = bullets.begin();
-        while ((itiInner < bullets.size()) && (itBullet != bullets.end()))
+        for (size_t iBullet = 0; iBullet < m_bulletsActive.size(); iBullet++)
         {
-            if (!itBullet->used())
+            if (iFragileBullet == iBullet)
             {
-                itBullet++;
+                // a bullet cannot hit itself
                 continue;
             }
-            itiInner++;
 
-            if (itFragileBullet == itBullet)
+            auto& bullet = m_bulletsActive[iBullet];
+            if (!bullet.used())
             {
-                // a bullet cannot hit itself
-                itBullet++;
                 continue;
             }
 
-            auto& bullet = *itBullet;
-
-            if (bullet.isFragile() && (itiOuter >= itiInner /* do not repeat same test between fragile bullets */))
+            if (bullet.isFragile() && (iFragileBullet > iBullet /* do not repeat same test between fragile bullets */))
             {
-                itBullet++;
                 continue;
             }
 
@@ -865,7 +953,6 @@ void proofps_dd::WeaponHandling::serverHandleBulletsVsBullets(
             const auto itShooter2 = m_mapPlayers.find(bullet.getOwner());
             if (!canBulletHitPerFriendlyFireConfig(itShooter1, itShooter2))
             {
-                itBullet++;
                 continue;
             }
 
@@ -888,33 +975,25 @@ void proofps_dd::WeaponHandling::serverHandleBulletsVsBullets(
             {
                 bDeleteBothBullets = true;
                 
-                // both bullets are marked immediately so that recursive calls to deleteBulletServer()/createExplosionServer() won't touch them,
-                // iterators stay valid for us.
-                itBullet->markForDeletion();
-                itFragileBullet->markForDeletion();
+                // both bullets are marked immediately so that explosions caused by deleteBulletServer() won't queue them for chain detonation.
+                bullet.markForDeletion();
+                fragileBullet.markForDeletion();
 
-                deleteBulletServer(bullets, itBullet, false /* bPlayerHit */, false /* bWallHit */, xhair, vecCamShakeForce, gameMode, gameMode.isGameWon());
+                deleteBulletServer(bullet, false /* bPlayerHit */, false /* bWallHit */, xhair, vecCamShakeForce, gameMode, gameMode.isGameWon());
 
                 break;
             }
 
-            // not yet found any bullet colliding with itFragileBullet, keep searching ...
-            itBullet++;
-        } // end while itBullet != bullets.end()
+            // not yet found any bullet colliding with fragileBullet, keep searching ...
+        } // end for iBullet
 
         if (bDeleteBothBullets)
         {
-            // itFragileBullet was hit by another bullet. Another bullet has been deleted, now delete itFragileBullet too!
-            itFragileBullet = deleteBulletServer(bullets, itFragileBullet, false /* bPlayerHit */, false /* bWallHit */, xhair, vecCamShakeForce, gameMode, gameMode.isGameWon());
+            // fragileBullet was hit by another bullet. Another bullet has been deleted, now delete fragileBullet too!
+            deleteBulletServer(fragileBullet, false /* bPlayerHit */, false /* bWallHit */, xhair, vecCamShakeForce, gameMode, gameMode.isGameWon());
         }
-        else
-        {
-            // bullet didn't touch anything, go to next
-            itFragileBullet++;
-        }
-
-        // 'itFragileBullet' is referring to next bullet, don't use it from here!
-    } // end while itFragileBullet != bullets.end()
+    } // end for iFragileBullet
+    m_bulletsActive.compact();
 
     m_durations.m_nBulletsVsBulletsDurationUSecs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - timeStart).count();
 }
@@ -932,20 +1011,10 @@ void proofps_dd::WeaponHandling::clientUpdateBullets(const unsigned int& nPhysic
     // COPY-PASTE END from WeaponHandling::serverUpdateBulletsAndHandleHittingWallsAndPlayers()
 
     const bool bCollisionModeBvh = (m_pge.getConfigProfiles().getVars()[Maps::szCVarSvMapCollisionMode].getAsInt() == 1);
-    PgeObjectPool<PooledBullet>& bullets = m_pge.getBullets();
-    size_t iti = 0; // to track how many used bullets we processed in the loop, to exit early if we already processed all used
-    // we need iti because there is no way to explicitly iterate over the used elems on the object pool
-    auto it = bullets.begin();
-    while ((iti != bullets.size()) && (it != bullets.end()))
+    m_bulletsActive.sync(m_pge.getBullets());
+    for (size_t i = 0; i < m_bulletsActive.size(); i++)
     {
-        if (!it->used())
-        {
-            it++;
-            continue;
-        }
-        iti++;
-
-        auto& bullet = *it;
+        auto& bullet = m_bulletsActive[i];
         const PurePosUpTarget oldPut = bullet.getPut();  // TODO save just position, PUT is overkill
 
         // since v0.1.4, client simulates bullet movement, without any delete condition check, because delete happens only if server says so!
@@ -964,29 +1033,30 @@ void proofps_dd::WeaponHandling::clientUpdateBullets(const unsigned int& nPhysic
 
         // clients do bounce and ricochet calculations too, so that they can visualize that kind of bullet movements without traffic from server,
         // but still server tells when to delete a bullet.
-        if (bullet.canBounce())
-        {
-            const float fBulletPosX = bullet.getObject3D().getPosVec().getX();
-            const float fBulletPosY = bullet.getObject3D().getPosVec().getY();
-            const float fBulletScaledSizeX = bullet.getObject3D().getScaledSizeVec().getX();
-            const float fBulletScaledSizeY = bullet.getObject3D().getScaledSizeVec().getY();
-            sharedUpdateBouncingBullets(
-                bCollisionModeBvh, bullet, oldPut, fBulletPosX, fBulletPosY, fBulletScaledSizeX, fBulletScaledSizeY, nPhysicsRate, GAME_FALL_GRAVITY_MIN);
-        }
-        else
+        if (bullet.canBounce() || (bullet.getAreaDamageSize() == 0.f))
         {
-            if (bullet.getAreaDamageSize() == 0.f)
+            BulletBounds bulletBounds;
+            captureBulletBounds(bullet, bulletBounds);
+
+            // same as server does, so fast bullets don't pass through thin walls on our side either
+            float fWallHitTimeSwept = 1.f;
+            const PureObject3D* const pWallHitSwept = sharedUpdateBullets_sweptCollisionWithWalls(bCollisionModeBvh, oldPut, bulletBounds, fWallHitTimeSwept);
+            if (pWallHitSwept)
+            {
+                sharedMoveBulletIntoWallIfTunnelled(bullet, oldPut, *pWallHitSwept, fWallHitTimeSwept, bulletBounds);
+            }
+
+            if (bullet.canBounce())
+            {
+                sharedUpdateBouncingBullets(
+                    bCollisionModeBvh, bullet, oldPut, bulletBounds.m_fPosX, bulletBounds.m_fPosY, bulletBounds.m_fSizeX, bulletBounds.m_fSizeY, nPhysicsRate, GAME_FALL_GRAVITY_MIN);
+            }
+            else
             {
-                const float fBulletPosX = bullet.getObject3D().getPosVec().getX();
-                const float fBulletPosY = bullet.getObject3D().getPosVec().getY();
-                const float fBulletScaledSizeX = bullet.getObject3D().getScaledSizeVec().getX();
-                const float fBulletScaledSizeY = bullet.getObject3D().getScaledSizeVec().getY();
                 sharedUpdateRicochetingBullets(
-                    bCollisionModeBvh, bullet, oldPut, fBulletPosX, fBulletPosY, fBulletScaledSizeX, fBulletScaledSizeY, nPhysicsRate, GAME_FALL_GRAVITY_MIN);
+                    bCollisionModeBvh, bullet, oldPut, bulletBounds.m_fPosX, bulletBounds.m_fPosY, bulletBounds.m_fSizeX, bulletBounds.m_fSizeY, nPhysicsRate, GAME_FALL_GRAVITY_MIN);
             }
         }
-
-        it++;
     }
 }
 
@@ -995,21 +1065,18 @@ void proofps_dd::WeaponHandling::serverUpdateExplosions(proofps_dd::GameMode& ga
     // on the long run this function needs to be part of the game engine itself, however first serverUpdateBulletsAndHandleHittingWallsAndPlayers() should be moved there!
 
     const bool bEndGame = gameMode.isGameWon();
-    auto it = m_explosions.begin();
-    while (it != m_explosions.end())
+    m_explosionsActive.sync(m_explosions);
+    for (size_t i = 0; i < m_explosionsActive.size(); i++)
     {
-        auto& xpl = *it;
+        auto& xpl = m_explosionsActive[i];
         xpl.update(nPhysicsRate);
 
         if (xpl.shouldBeDeleted())
         {
-            it = m_explosions.erase(it);
-        }
-        else
-        {
-            it++;
+            xpl.remove(); // becomes free again in the pool, keeping its objects for the next explosion
         }
     }
+    m_explosionsActive.compact();
 
     if (bEndGame && (Explosion::getGlobalExplosionId() > 0))
     {
@@ -1029,22 +1096,19 @@ void proofps_dd::WeaponHandling::updateSmokes(proofps_dd::GameMode&, const unsig
 {
     // on the long run this function needs to be part of the game engine itself
 
-    auto it = m_smokes.begin();
-    size_t iti = 0; // to track how many used bullets we processed in the loop, to exit early if we already processed all used
-    // we need iti because there is no way to explicitly iterate over the used elems on the object pool
-    while ((iti != m_smokes.size()) && (it != m_smokes.end()))
+    // smokes emitted by players are not yet in the list
+    m_smokesActive.sync(m_smokes);
+    for (size_t i = 0; i < m_smokesActive.size(); i++)
     {
-        auto& smoke = *it;
-        if (!smoke.used())
-        {
-            it++;
-            continue;
-        }
-        iti++;
-
-        smoke.update(nPhysicsRate);
-        it++;
+        // update() might free the smoke, compact() below takes care of that
+        m_smokesActive[i].update(nPhysicsRate);
     }
+    m_smokesActive.compact();
+}
+
+void proofps_dd::WeaponHandling::serverRemoveClientFromInterestManagement(const pge_network::PgeNetworkConnectionHandle& connHandleServerSide)
+{
+    m_interestManagement.removeClient(connHandleServerSide);
 }
 
 bool proofps_dd::WeaponHandling::handleBulletUpdateFromServer(
@@ -1085,9 +1149,8 @@ bool proofps_dd::WeaponHandling::handleBulletUpdateFromServer(
         if ((msg.m_fDamageAreaSize > 0.f) &&
             (msg.m_delete != proofps_dd::MsgBulletUpdateFromServer::BulletDelete::YesForcedDisappear))
         {
-            // let's use any WeaponManager to retrieve weapon, even tho it is not their bullet, it doesnt matter now, we need explosion data!
-            Weapon* const wpnForExplosionData = getWeaponByIdFromAnyPlayersWeaponManager(msg.m_weaponId);
-            if (wpnForExplosionData)
+            const WeaponDefinition* const pWpnDef = getWeaponDefinition(msg.m_weaponId);
+            if (pWpnDef)
             {
                 createExplosionClient(
                     0 /* explosion id is not used on client-side */,
@@ -1098,12 +1161,12 @@ bool proofps_dd::WeaponHandling::handleBulletUpdateFromServer(
                     msg.m_fDamageAreaSize,
                     msg.m_eDamageAreaEffect,
                     msg.m_fDamageAreaPulse,
-                    wpnForExplosionData->getVars()["damage_area_gfx_obj"].getAsString(),
+                    pWpnDef->m_damageAreaGfxObjRefId,
                     vecCamShakeForce);
             }
             else
             {
-                getConsole().EOLn("WeaponHandling::%s(): getWeaponByIdFromAnyPlayersWeaponManager() failed with weapon id: %u!", 
+                getConsole().EOLn("WeaponHandling::%s(): getWeaponDefinition() failed with weapon id: %u!", 
                    __func__, static_cast<uint32_t>(msg.m_weaponId));
                 assert(false);
                 return false;
@@ -1148,53 +1211,64 @@ bool proofps_dd::WeaponHandling::handleBulletUpdateFromServer(
         Player& player = playerIt->second;
 
         Weapon* const wpn = player.getWeaponManager().getWeaponById(msg.m_weaponId);
-        if (!wpn)
+        const WeaponDefinition* const pWpnDef = getWeaponDefinition(msg.m_weaponId);
+        if (!wpn || !pWpnDef)
         {
             getConsole().EOLn("WeaponHandling::%s(): getWeapon() failed!", __func__);
             assert(false);
             return false;
         }
 
-        if (isMyConnection(connHandleServerSide))
+        // Late create: bullet was fired earlier out of our view and just became relevant for us due to interest management,
+        // so it is not a firing event on our side: no firing sound at its current position and no reload sound interruption.
+        if (msg.m_bNewborn)
         {
-            // my bullet just fired so reload sounds must be killed asap
-            m_pge.getAudio().stopSoundInstance(m_sndWpnReloadStartHandle);
-            m_pge.getAudio().stopSoundInstance(m_sndWpnReloadEndHandle);
+            if (isMyConnection(connHandleServerSide))
+            {
+                // my bullet just fired so reload sounds must be killed asap
+                m_pge.getAudio().stopSoundInstance(m_sndWpnReloadStartHandle);
+                m_pge.getAudio().stopSoundInstance(m_sndWpnReloadEndHandle);
+            }
+            play3dSoundWithVoiceLimit(
+                SoundVoiceManager::SoundClass::WeaponFire,
+                wpn->getFiringSound(),
+                msg.m_pos.getX(),
+                msg.m_pos.getY(),
+                msg.m_pos.getZ(),
+                SndWpnFireDistMin,
+                SndWpnFireDistMax);
         }
-        const auto sndWpnFireHandle = m_pge.getAudio().play3dSound(wpn->getFiringSound(), msg.m_pos);
-        m_pge.getAudio().getAudioEngineCore().set3dSourceMinMaxDistance(sndWpnFireHandle, SndWpnFireDistMin, SndWpnFireDistMax);
-        m_pge.getAudio().getAudioEngineCore().set3dSourceAttenuation(sndWpnFireHandle, SoLoud::AudioSource::ATTENUATION_MODELS::LINEAR_DISTANCE, 1.f);
 
         // here create() invokes PooledBullet::init(), should invoke the client version!
-        if (!m_pge.getBullets().create(
+        PooledBullet* const pBullet = m_pge.getBullets().create(
             msg.m_bulletId,
             msg.m_weaponId,
             m_pge.getPure(),
             msg.m_pos.x, msg.m_pos.y, msg.m_pos.z,
             msg.m_angle.x, msg.m_angle.y, msg.m_angle.z,
-            wpn->getVars()["bullet_visible"].getAsBool(),
-            wpn->getVars()["bullet_size_x"].getAsFloat(),
-            wpn->getVars()["bullet_size_y"].getAsFloat(),
-            wpn->getVars()["bullet_size_z"].getAsFloat(),
-            wpn->getVars()["bullet_speed"].getAsFloat(),
-            wpn->getVars()["bullet_gravity"].getAsFloat(),
-            wpn->getVars()["bullet_drag"].getAsFloat(),
+            pWpnDef->m_bBulletVisible,
+            pWpnDef->m_fBulletSizeX,
+            pWpnDef->m_fBulletSizeY,
+            pWpnDef->m_fBulletSizeZ,
+            pWpnDef->m_fBulletSpeed,
+            pWpnDef->m_fBulletGravity,
+            pWpnDef->m_fBulletDrag,
             /* fragile is not used by client-side ctor */
-            wpn->getVars()["bullet_distance_max"].getAsFloat(),
-            wpn->getVars()["damage_rel_distance"].getAsBool(),
-            wpn->getVars()["bullet_bounces"].getAsBool(),
+            pWpnDef->m_fBulletDistanceMax,
+            pWpnDef->m_bDamageRelDistance,
+            pWpnDef->m_bBulletBounces,
             /* timer is not used by client-side ctor */
-            (wpn->getVars()["bullet_particle"].getAsString() == "smoke" ?
-                Bullet::ParticleType::Smoke :
-                Bullet::ParticleType::None),
+            pWpnDef->m_eBulletParticle,
             /* damageAP is not used by client-side ctor */
             msg.m_nDamageHp,
-            msg.m_fDamageAreaSize, msg.m_eDamageAreaEffect, msg.m_fDamageAreaPulse))
+            msg.m_fDamageAreaSize, msg.m_eDamageAreaEffect, msg.m_fDamageAreaPulse);
+        if (!pBullet)
         {
             getConsole().EOLn("WeaponHandling::%s():  pool did not create bullet!", __func__);
             assert(false); // crash in debug
             return true; // dont crash release
         }
+        m_bulletsActive.add(*pBullet);
     }
     else
     {
@@ -1208,6 +1282,7 @@ bool proofps_dd::WeaponHandling::handleBulletUpdateFromServer(
         }
 
         m_pge.getBullets().erase(it);
+        m_bulletsActive.compact();
     }
 
     return true;
@@ -1224,8 +1299,9 @@ bool proofps_dd::WeaponHandling::handleWpnUpdateFromServer(
         return false;
     }
 
+    const std::string& sWpnName = StringTable::getInstance().getString(msg.m_nWpnNameId);
     getConsole().OLn("WeaponHandling::%s(): received: %s, available: %s, state: %s, mag: %u, unmag: %u!",
-        __func__, msg.m_szWpnName, msg.m_bAvailable ? "yes" : "no", Weapon::stateToString(msg.m_state).c_str(), msg.m_nMagBulletCount, msg.m_nUnmagBulletCount);
+        __func__, sWpnName.c_str(), msg.m_bAvailable ? "yes" : "no", Weapon::stateToString(msg.m_state).c_str(), msg.m_nMagBulletCount, msg.m_nUnmagBulletCount);
 
     // this is private message, it always refers to me and one of my weapons (it is always my current weapon on server side, should be current here too).
 
@@ -1238,12 +1314,12 @@ bool proofps_dd::WeaponHandling::handleWpnUpdateFromServer(
     }
 
     Player& player = playerIt->second;
-    // TODO: since from v0.2.6 we also have msg.m_eMapItemType, we should get rid of msg.m_szWpnName,
+    // TODO: since from v0.2.6 we also have msg.m_eMapItemType, we should get rid of msg.m_nWpnNameId,
     // and use the getWeaponInstanceByMapItemType() as already used later in this function from v0.2.8!
-    Weapon* const wpn = player.getWeaponManager().getWeaponByFilename(msg.m_szWpnName);
+    Weapon* const wpn = player.getWeaponManager().getWeaponByFilename(sWpnName);
     if (!wpn)
     {
-        getConsole().EOLn("WeaponHandling::%s(): did not find wpn: %s!", __func__, msg.m_szWpnName);
+        getConsole().EOLn("WeaponHandling::%s(): did not find wpn: %s (id: %u)!", __func__, sWpnName.c_str(), msg.m_nWpnNameId);
         assert(false);
         return false;
     }
@@ -1251,7 +1327,7 @@ bool proofps_dd::WeaponHandling::handleWpnUpdateFromServer(
     assert(player.getWeaponManager().getCurrentWeapon());
 
     wpn->clientReceiveStateFromServer(msg.m_state);
-    if (player.getWeaponManager().getCurrentWeapon()->getFilename() == msg.m_szWpnName)
+    if (player.getWeaponManager().getCurrentWeapon()->getFilename() == sWpnName)
     {
         handleCurrentPlayersCurrentWeaponStateChangeShared(player, *wpn, wpn->getState().getOld(), msg.m_state, wpn->getMagBulletCount(), wpn->getUnmagBulletCount());
 
@@ -1310,7 +1386,8 @@ bool proofps_dd::WeaponHandling::handleWpnUpdateCurrentFromServer(pge_network::P
         return false;
     }
 
-    //getConsole().EOLn("WeaponHandling::%s(): received: %s for player %u, state: %d",  __func__, msg.m_szWpnCurrentName, connHandleServerSide, static_cast<int>(msg.m_state));
+    const std::string& sWpnCurrentName = StringTable::getInstance().getString(msg.m_nWpnCurrentNameId);
+    //getConsole().EOLn("WeaponHandling::%s(): received: %s for player %u, state: %d",  __func__, sWpnCurrentName.c_str(), connHandleServerSide, static_cast<int>(msg.m_state));
 
     // Due to https://github.com/proof88/PRooFPS-dd/issues/268, we need to apply WA here.
     // Explained in details in handlePlayerEventFromServer().
@@ -1326,10 +1403,10 @@ bool proofps_dd::WeaponHandling::handleWpnUpdateCurrentFromServer(pge_network::P
     }
 
     auto& player = it->second;
-    Weapon* const wpn = player.getWeaponManager().getWeaponByFilename(msg.m_szWpnCurrentName);
+    Weapon* const wpn = player.getWeaponManager().getWeaponByFilename(sWpnCurrentName);
     if (!wpn)
     {
-        getConsole().EOLn("WeaponHandling::%s(): did not find wpn: %s!", __func__, msg.m_szWpnCurrentName);
+        getConsole().EOLn("WeaponHandling::%s(): did not find wpn: %s (id: %u)!", __func__, sWpnCurrentName.c_str(), msg.m_nWpnCurrentNameId);
         assert(false);
         return false;
     }
@@ -1345,7 +1422,7 @@ bool proofps_dd::WeaponHandling::handleWpnUpdateCurrentFromServer(pge_network::P
     
     if (std::as_const(player).getHealth() > 0)
     {
-        if (isMyConnection(it->first) && (player.getWeaponManager().getCurrentWeapon()->getFilename() != msg.m_szWpnCurrentName))
+        if (isMyConnection(it->first) && (player.getWeaponManager().getCurrentWeapon()->getFilename() != sWpnCurrentName))
         {
             //getConsole().OLn("WeaponHandling::%s(): this current weapon update is changing my current weapon!", __func__);
             m_pge.getAudio().playSound(m_sounds.m_sndChangeWeapon);
@@ -1406,7 +1483,7 @@ void proofps_dd::WeaponHandling::handleCurrentPlayersCurrentWeaponStateChangeSha
         switch (newState)
         {
         case Weapon::State::WPN_READY:
-            if (wpnCurrent.getVars()["reload_per_mag"].getAsBool())
+            if (const WeaponDefinition* const pWpnDef = getWeaponDefinition(wpnCurrent); pWpnDef && pWpnDef->m_bReloadPerMag)
             {
                 // Reload sounds are only played for the specific player, and players cannot hear each other's reload.
                 // Reload end sound valid only for per-magazine reload weapons but we just dont check here, getReloadEndSound() is just not loaded.
@@ -1501,7 +1578,8 @@ void proofps_dd::WeaponHandling::handleCurrentPlayersCurrentWeaponStateChangeSha
         case Weapon::State::WPN_RELOADING:
             m_gui.getXHair()->startBlinking();
             {
-                if (wpnCurrent.getVars()["reload_per_mag"].getAsBool())
+                const WeaponDefinition* const pWpnDef = getWeaponDefinition(wpnCurrent);
+                if (pWpnDef && pWpnDef->m_bReloadPerMag)
                 {
                     // Reload sounds are only played for the specific player, and players cannot hear each other's reload.
                     m_sndWpnReloadStartHandle = m_pge.getAudio().play3dSound(wpnCurrent.getReloadStartSound(), player.getPos().getNew());
@@ -1587,9 +1665,51 @@ void proofps_dd::WeaponHandling::handleAutoSwitchUponWeaponPickupShared(const Pl
 // ############################### PRIVATE ###############################
 
 
-blIteratorAPI::blRawArrayWrapper<PooledBullet>::iterator proofps_dd::WeaponHandling::deleteBulletServer(
-    PgeObjectPool<PooledBullet>& bullets,
-    blIteratorAPI::blRawArrayWrapper<PooledBullet>::iterator itBullet,
+void proofps_dd::WeaponHandling::captureBulletBounds(const PooledBullet& bullet, BulletBounds& bulletBounds)
+{
+    const PureVector& vecPos = bullet.getObject3D().getPosVec();
+    const PureVector& vecScaledSize = bullet.getObject3D().getScaledSizeVec();
+    bulletBounds.m_fPosX = vecPos.getX();
+    bulletBounds.m_fPosY = vecPos.getY();
+    bulletBounds.m_fPosZ = vecPos.getZ();
+    bulletBounds.m_fSizeX = vecScaledSize.getX();
+    bulletBounds.m_fSizeY = vecScaledSize.getY();
+    bulletBounds.m_fSizeZ = vecScaledSize.getZ();
+}
+
+/**
+* Explosions query players from m_playerSpatialIndex, so it shall be rebuilt before any bullet might explode in the current tick.
+*/
+void proofps_dd::WeaponHandling::serverRebuildPlayerSpatialIndex()
+{
+    m_playerSpatialIndex.clear();
+    for (const auto& playerPair : m_mapPlayers)
+    {
+        const auto& player = playerPair.second;
+        if (!player.getObject3D())
+        {
+            continue;
+        }
+        m_playerSpatialIndex.add(
+            playerPair.first,
+            player.getPos().getNew().getX(),
+            player.getPos().getNew().getY(),
+            player.getObject3D()->getScaledSizeVec().getX(),
+            player.getObject3D()->getScaledSizeVec().getY());
+    }
+    m_playerSpatialIndex.build();
+}
+
+/**
+* Deletes the given bullet, and then all fragile bullets detonated by its explosion, and by their explosions, and so on.
+* Chain reaction is processed iteratively in m_vecChainDetonationQueue, in the order of detonation: a bullet is marked for deletion
+* before it is queued and marked bullets are never queued, so the queue cannot hold more bullets than the bullet pool.
+* 
+* The bullets are freed in the pool, but they stay in m_bulletsActive until the next compact(), so loops iterating over m_bulletsActive
+* are not disturbed, even if other bullets are deleted due to explosion.
+*/
+void proofps_dd::WeaponHandling::deleteBulletServer(
+    PooledBullet& bullet,
     const bool& bPlayerHit,
     const bool& bWallHit,
     XHair& xhair,
@@ -1597,14 +1717,38 @@ blIteratorAPI::blRawArrayWrapper<PooledBullet>::iterator proofps_dd::WeaponHandl
     proofps_dd::GameMode& gameMode,
     const bool& bEndGame)
 {
-    auto& bullet = *itBullet;
+    assert(m_vecChainDetonationQueue.empty());
+    deleteBulletServerSingle(bullet, bPlayerHit, bWallHit, xhair, vecCamShakeForce, gameMode, bEndGame);
 
+    // the queue might grow while we are iterating over it
+    for (size_t i = 0; i < m_vecChainDetonationQueue.size(); i++)
+    {
+        deleteBulletServerSingle(
+            *m_vecChainDetonationQueue[i], false /* bPlayerHit */, false /* bWallHit */, xhair, vecCamShakeForce, gameMode, gameMode.isGameWon());
+    }
+    m_vecChainDetonationQueue.clear();
+}
+
+/**
+* Deletes only the given bullet, fragile bullets detonated by its explosion are just queued into m_vecChainDetonationQueue.
+*/
+void proofps_dd::WeaponHandling::deleteBulletServerSingle(
+    PooledBullet& bullet,
+    const bool& bPlayerHit,
+    const bool& bWallHit,
+    XHair& xhair,
+    PureVector& vecCamShakeForce,
+    proofps_dd::GameMode& gameMode,
+    const bool& bEndGame)
+{
     assert(bullet.isMarkedForDeletion());
     if (!bullet.isMarkedForDeletion())
     {
         getConsole().EOLn("%s ERROR: bullet is NOT marked for deletion!", __func__);
     }
 
+    m_mapLagCompensatedBullets.erase(bullet.getId());
+
     bool bInvalidShooter = false;
     const auto itShooter = m_mapPlayers.find(bullet.getOwner());
     if ((itShooter == m_mapPlayers.end()) || !gameMode.isPlayerAllowedForGameplay(itShooter->second))
@@ -1620,16 +1764,15 @@ blIteratorAPI::blRawArrayWrapper<PooledBullet>::iterator proofps_dd::WeaponHandl
     {
         if (bullet.getAreaDamageSize() > 0.f)
         {
-            // let's use any WeaponManager to retrieve weapon, even tho it is not their bullet, it doesnt matter now, we need explosion data!
-            Weapon* const wpnForExplosionData = getWeaponByIdFromAnyPlayersWeaponManager(bullet.getWeaponId());
-            if (wpnForExplosionData->getVars()["bullet_subprojectiles"].getAsUInt() != 1)
+            const WeaponDefinition* const pWpnDef = getWeaponDefinition(bullet.getWeaponId());
+            if (pWpnDef && (pWpnDef->m_nBulletSubprojectiles != 1))
             {
                 // crash the game, to make sure we never allow explosive weapon firing multiple bullets within a single fire, until
                 // this bug is solved: https://github.com/proof88/PRooFPS-dd/issues/354 .
                 assert(false);
                 getConsole().EOLn("%s ERROR: explosive bullet launched with other bullet(s) by the same firing event, not allowed!", __func__);
             }
-            else if (wpnForExplosionData)
+            else if (pWpnDef)
             {
                 createExplosionServer(
                     bullet,
@@ -1638,7 +1781,7 @@ blIteratorAPI::blRawArrayWrapper<PooledBullet>::iterator proofps_dd::WeaponHandl
                     bullet.getAreaDamageSize(),
                     bullet.getAreaDamageEffect(),
                     bullet.getAreaDamagePulse(),
-                    wpnForExplosionData->getVars()["damage_area_gfx_obj"].getAsString(),
+                    pWpnDef->m_damageAreaGfxObjRefId,
                     bullet.getDamageAp(),
                     bullet.getDamageHp(),
                     xhair,
@@ -1666,7 +1809,8 @@ blIteratorAPI::blRawArrayWrapper<PooledBullet>::iterator proofps_dd::WeaponHandl
         bullet.getDamageHp(),
         bullet.getAreaDamageSize(),
         bullet.getAreaDamageEffect(),
-        bullet.getAreaDamagePulse()
+        bullet.getAreaDamagePulse(),
+        false /* newborn is irrelevant for delete */
     );
     
     // clients will also delete this bullet on their side because we set pkt's delete flag here
@@ -1688,10 +1832,9 @@ blIteratorAPI::blRawArrayWrapper<PooledBullet>::iterator proofps_dd::WeaponHandl
     {
         proofps_dd::MsgBulletUpdateFromServer::getDelete(pktBulletDelete) = proofps_dd::MsgBulletUpdateFromServer::BulletDelete::Yes;
     }
-    m_pge.getNetwork().getServer().sendToAllClientsExcept(pktBulletDelete);
+    serverSendBulletDeleteToRelevantClients(pktBulletDelete, bullet);
 
-    itBullet = bullets.erase(itBullet);
-    return itBullet;
+    bullet.remove(); // becomes free again in the pool
 }
 
 float proofps_dd::WeaponHandling::getDamageAndImpactForceAtDistance(
@@ -1770,14 +1913,20 @@ float proofps_dd::WeaponHandling::getDamageAndImpactForceAtDistance(
     );
 }
 
-proofps_dd::Explosion& proofps_dd::WeaponHandling::createExplosionServer(
+/**
+* Fragile bullets within the damage area are not deleted here but queued into m_vecChainDetonationQueue, see deleteBulletServer().
+* If the explosion pool is exhausted, the oldest explosion is evicted, so area damage is never lost due to lack of pool slot.
+*
+* @return The created explosion, or nullptr if the explosion pool has no capacity at all, in which case no damage is done either.
+*/
+proofps_dd::Explosion* proofps_dd::WeaponHandling::createExplosionServer(
     const PooledBullet& causedByBullet,
     const pge_network::PgeNetworkConnectionHandle& connHandle,
     const PureVector& pos,
     const TPureFloat& fDamageAreaSize,
     const Bullet::DamageAreaEffect& eDamageAreaEffect,
     const TPureFloat& fDamageAreaPulse,
-    const std::string& sExplosionGfxObjFilename,
+    const ExplosionObjRefId& explosionRefId,
     const int& nDamageAp,
     const int& nDamageHp,
     XHair& xhair,
@@ -1790,16 +1939,27 @@ proofps_dd::Explosion& proofps_dd::WeaponHandling::createExplosionServer(
         getConsole().EOLn("%s ERROR: causedByBullet is NOT marked for deletion!", __func__);
     }
 
-    const ExplosionObjRefId refId = PFL::calcHash(sExplosionGfxObjFilename);
-    m_explosions.push_back(
-        Explosion(
-            m_pge,
+    Explosion* pXpl = m_explosions.create(
+        connHandle,
+        explosionRefId,
+        pos,
+        fDamageAreaSize);
+    if (!pXpl && evictOldestExplosion())
+    {
+        pXpl = m_explosions.create(
             connHandle,
-            refId,
+            explosionRefId,
             pos,
-            fDamageAreaSize));
+            fDamageAreaSize);
+    }
+    if (!pXpl)
+    {
+        getConsole().EOLn("WeaponHandling::%s(): explosion pool has no free slot, capacity: %u!", __func__, static_cast<unsigned int>(m_explosions.capacity()));
+        return nullptr;
+    }
+    m_explosionsActive.add(*pXpl);
 
-    const Explosion& xpl = m_explosions.back();
+    const Explosion& xpl = *pXpl;
 
     bool bShotHitTargetStatUpdated = false; // make sure we increase it only once for the shooter, no matter how many players are hit!
     const auto itShooter = m_mapPlayers.find(xpl.getOwner());
@@ -1807,10 +1967,17 @@ proofps_dd::Explosion& proofps_dd::WeaponHandling::createExplosionServer(
 
     const float fAttackDamageMplier = m_config.getAttackDamageMultiplier();
     
-    // apply area damage to players
-    for (auto& playerPair : m_mapPlayers)
+    // apply area damage to players, only the players around the explosion need to be checked
+    m_playerSpatialIndex.queryRadius(pos.getX(), pos.getY(), fDamageAreaSize, m_vecExplosionCandidatePlayers);
+    for (const auto& connHandleCandidate : m_vecExplosionCandidatePlayers)
     {
-        auto& player = playerPair.second;
+        const auto itPlayer = m_mapPlayers.find(connHandleCandidate);
+        if (itPlayer == m_mapPlayers.end())
+        {
+            continue;
+        }
+
+        auto& player = itPlayer->second;
         const auto& playerConst = player;
 
         if (playerConst.getHealth() <= 0)
@@ -1928,31 +2095,24 @@ proofps_dd::Explosion& proofps_dd::WeaponHandling::createExplosionServer(
             pge_network::ServerConnHandle /* unused */,
             PlayerEventId::ExplosionMultiKill,
             nPlayersDiedByThisExplosion);
-        m_pge.getNetwork().getServer().sendToAllClientsExcept(pktPlayerEvent);
+        MsgTrafficStats::serverSendToAllClientsExcept(m_pge.getNetwork(), pktPlayerEvent);
 
         // server adds event to GUI here, clients do it when processing above message
         handleExplosionMultiKill(nPlayersDiedByThisExplosion);
     }
 
-    // check for other fragile bullets in range
-    PgeObjectPool<PooledBullet>& bullets = m_pge.getBullets();
-    size_t itiOuter = 0;
-    // we need iti because there is no way to explicitly iterate over the used elems on the object pool
-    auto itFragileBullet = bullets.begin();
-    while ((itiOuter < bullets.size()) && (itFragileBullet != bullets.end()))
+    // check for other fragile bullets in range;
+    // we are invoked by deleteBulletServer() while the caller is iterating over m_bulletsActive, so no sync() or compact() here!
+    if (m_vecChainDetonationQueue.capacity() < m_pge.getBullets().capacity())
     {
-        if (!itFragileBullet->used())
-        {
-            itFragileBullet++;
-            continue;
-        }
-        itiOuter++;
-
-        auto& fragileBullet = *itFragileBullet;
-
-        if ((&fragileBullet == &causedByBullet) || !fragileBullet.isFragile() || fragileBullet.isMarkedForDeletion())
+        // allocation only once, the queue cannot hold more bullets than the pool
+        m_vecChainDetonationQueue.reserve(m_pge.getBullets().capacity());
+    }
+    for (size_t iFragileBullet = 0; iFragileBullet < m_bulletsActive.size(); iFragileBullet++)
+    {
+        auto& fragileBullet = m_bulletsActive[iFragileBullet];
+        if (!fragileBullet.used() || (&fragileBullet == &causedByBullet) || !fragileBullet.isFragile() || fragileBullet.isMarkedForDeletion())
         {
-            itFragileBullet++;
             continue;
         }
 
@@ -1960,7 +2120,6 @@ proofps_dd::Explosion& proofps_dd::WeaponHandling::createExplosionServer(
         const auto itShooter2 = m_mapPlayers.find(xpl.getOwner());
         if (!canBulletHitPerFriendlyFireConfig(itShooter1, itShooter2))
         {
-            itFragileBullet++;
             continue;
         }
 
@@ -1975,24 +2134,17 @@ proofps_dd::Explosion& proofps_dd::WeaponHandling::createExplosionServer(
         );
         if (fRadiusDamage > 0.f)
         {
-            // itFragileBullet is within the radius of the explosion!
-            // marking it to be deleted, so recursive calls to deleteBulletServer()/createExplosionServer() won't touch it, iterator will stay valid for us!
+            // fragileBullet is within the radius of the explosion!
+            // marking it to be deleted, so further explosions won't queue it again!
             fragileBullet.markForDeletion();
-            itFragileBullet = deleteBulletServer(bullets, itFragileBullet, false /* bPlayerHit */, false /* bWallHit */, xhair, vecCamShakeForce, gameMode, gameMode.isGameWon());
-        }
-        else
-        {
-            // bullet didn't touch anything, go to next
-            itFragileBullet++;
+            m_vecChainDetonationQueue.push_back(&fragileBullet);
         }
+    } // end for iFragileBullet
 
-        // 'itFragileBullet' is referring to next bullet, don't use it from here!
-    } // end while itFragileBullet != bullets.end()
-
-    return m_explosions.back();
+    return pXpl;
 }
 
-proofps_dd::Explosion& proofps_dd::WeaponHandling::createExplosionClient(
+proofps_dd::Explosion* proofps_dd::WeaponHandling::createExplosionClient(
     const proofps_dd::Explosion::ExplosionId& id /* explosion id is not used on client-side */,
     const pge_network::PgeNetworkConnectionHandle& connHandle,
     const PureVector& pos,
@@ -2000,27 +2152,40 @@ proofps_dd::Explosion& proofps_dd::WeaponHandling::createExplosionClient(
     const TPureFloat& fDamageAreaSize,
     const Bullet::DamageAreaEffect& eDamageAreaEffect,
     const TPureFloat& fDamageAreaPulse,
-    const std::string& sExplosionGfxObjFilename,
+    const ExplosionObjRefId& explosionRefId,
     PureVector& vecCamShakeForce)
 {
-    const ExplosionObjRefId refId = PFL::calcHash(sExplosionGfxObjFilename);
-    m_explosions.push_back(
-        Explosion(
-            m_pge,
+    Explosion* pXpl = m_explosions.create(
+        id /* explosion id is not used on client-side */,
+        connHandle,
+        explosionRefId,
+        pos,
+        fDamageAreaSize);
+    if (!pXpl && evictOldestExplosion())
+    {
+        pXpl = m_explosions.create(
             id /* explosion id is not used on client-side */,
             connHandle,
-            refId,
+            explosionRefId,
             pos,
-            fDamageAreaSize));
+            fDamageAreaSize);
+    }
+    if (!pXpl)
+    {
+        // just a visual effect on client-side, no assert
+        getConsole().EOLn("WeaponHandling::%s(): explosion pool has no free slot, capacity: %u!", __func__, static_cast<unsigned int>(m_explosions.capacity()));
+        return nullptr;
+    }
+    m_explosionsActive.add(*pXpl);
 
-    Explosion& xpl = m_explosions.back();
+    const Explosion& xpl = *pXpl;
 
     const auto playerIt = m_mapPlayers.find(m_nServerSideConnectionHandle);
     if (playerIt == m_mapPlayers.end())
     {
         // must always find self player
         assert(false);
-        return xpl;
+        return pXpl;
     }
 
     const auto& playerConst = playerIt->second;
@@ -2041,7 +2206,30 @@ proofps_dd::Explosion& proofps_dd::WeaponHandling::createExplosionClient(
         }
     }
 
-    return xpl;
+    return pXpl;
+}
+
+/**
+* Frees the oldest explosion, so a new explosion can be created even if the explosion pool is exhausted.
+* The oldest one is the closest to finishing its animation anyway.
+* Must not be invoked while iterating over m_explosionsActive.
+*
+* @return False if there was no explosion to be freed, true otherwise.
+*/
+bool proofps_dd::WeaponHandling::evictOldestExplosion()
+{
+    // after sync() the list contains only used elements, in the order of adding them, unless it had to be rebuilt from the pool
+    m_explosionsActive.sync(m_explosions);
+    if (m_explosionsActive.empty())
+    {
+        return false;
+    }
+
+    getConsole().OLn("WeaponHandling::%s(): explosion pool exhausted, capacity: %u, evicting oldest explosion!",
+        __func__, static_cast<unsigned int>(m_explosions.capacity()));
+    m_explosionsActive[0].remove();
+    m_explosionsActive.compact();
+    return true;
 }
 
 bool proofps_dd::WeaponHandling::isBulletOutOfMapBounds(const Bullet& bullet) const
@@ -2059,14 +2247,224 @@ bool proofps_dd::WeaponHandling::isBulletOutOfMapBounds(const Bullet& bullet) co
     return !colliding3(vRelaxedMapMinBounds, vRelaxedMapMaxBounds, bullet.getObject3D().getPosVec(), bullet.getObject3D().getScaledSizeVec());
 }
 
-Weapon* proofps_dd::WeaponHandling::getWeaponByIdFromAnyPlayersWeaponManager(const WeaponId& wpnId)
+/**
+* Server-only.
+* Tells how many ticks the player hitboxes shall be rewound for hit-testing the given bullet in the current tick.
+* When a bullet is processed the first time, it takes the lag compensation ticks of its owner, as the owner fired it while seeing
+* the other players that many ticks behind. As the bullet travels, it catches up with the present: after living as many ticks as
+* it was rewound, it is hit-tested against the current hitboxes.
+*
+* @param bullet             The bullet to be hit-tested.
+* @param nCurrentServerTick The tick being simulated.
+*
+* @return Number of ticks to rewind, 0 means current player hitboxes shall be used.
+*/
+std::uint32_t proofps_dd::WeaponHandling::serverGetBulletRewindTicks(const PooledBullet& bullet, const std::uint32_t& nCurrentServerTick)
 {
-    if (m_mapPlayers.empty())
+    auto it = m_mapLagCompensatedBullets.find(bullet.getId());
+    if (it == m_mapLagCompensatedBullets.end())
     {
-        return nullptr;
+        if (bullet.isCreateSentToClients())
+        {
+            // not newly fired, or already caught up with the present
+            return 0;
+        }
+
+        const auto itShooter = m_mapPlayers.find(bullet.getOwner());
+        if ((itShooter == m_mapPlayers.end()) || (itShooter->second.getLagCompensationTicks() == 0))
+        {
+            return 0;
+        }
+
+        it = m_mapLagCompensatedBullets.insert({ bullet.getId(), LagCompensatedBullet{ nCurrentServerTick, itShooter->second.getLagCompensationTicks() } }).first;
+    }
+
+    const std::uint32_t nAgeTicks = nCurrentServerTick - it->second.m_nFiredAtServerTick;
+    if (nAgeTicks >= it->second.m_nRewindTicks)
+    {
+        m_mapLagCompensatedBullets.erase(it);
+        return 0;
+    }
+    return it->second.m_nRewindTicks - nAgeTicks;
+}
+
+/**
+* Updates the view positions of clients used by interest management.
+* Server cannot know what a dead or spectating client is looking at since spectated player selection is client-side logic,
+* so for these clients everything is treated relevant.
+*/
+void proofps_dd::WeaponHandling::serverUpdateInterestManagementClientViews()
+{
+    m_interestManagement.setEnabled(m_config.getInterestManagement());
+    if (!m_interestManagement.isEnabled())
+    {
+        return;
+    }
+
+    for (const auto& playerPair : m_mapPlayers)
+    {
+        if (playerPair.first == pge_network::ServerConnHandle)
+        {
+            // server never sends to itself
+            continue;
+        }
+
+        const Player& player = playerPair.second;
+        if ((player.getHealth() > 0) && !player.isInSpectatorMode() && !player.isForcedSpectating())
+        {
+            m_interestManagement.updateClientView(playerPair.first, player.getPos().getNew().getX());
+        }
+        else
+        {
+            m_interestManagement.setClientViewUnknown(playerPair.first);
+        }
+    }
+}
+
+/**
+* Calculates the horizontal range the given bullet might still cover during its remaining life, starting from the given position.
+* It is a conservative estimation: bouncing bullets might turn back so for them we extend the range in both directions, and
+* explosive bullets are extended by their area damage size since their explosion is also visible to those who are in that area.
+*/
+void proofps_dd::WeaponHandling::getBulletRemainingPathRangeX(
+    const PooledBullet& bullet,
+    const float& fPosX,
+    float& fMinX,
+    float& fMaxX) const
+{
+    if (bullet.getTravelDistanceMax() <= 0.f)
+    {
+        // unlimited travel distance, it might go through the whole map
+        fMinX = m_maps.getBlocksVertexPosMin().getX() - proofps_dd::Maps::fMapBlockSizeWidth * 4;
+        fMaxX = m_maps.getBlocksVertexPosMax().getX() + proofps_dd::Maps::fMapBlockSizeWidth * 4;
+        return;
     }
 
-    return m_mapPlayers.begin()->second.getWeaponManager().getWeaponById(wpnId);
+    const float fRemainingDistance = std::max(0.f, bullet.getTravelDistanceMax() - bullet.getTravelledDistance());
+    const bool bGoingLeft = (bullet.getObject3D().getAngleVec().getY() == 0.f); // otherwise it would be 180.f
+    fMinX = (bGoingLeft || bullet.canBounce()) ? (fPosX - fRemainingDistance) : fPosX;
+    fMaxX = (!bGoingLeft || bullet.canBounce()) ? (fPosX + fRemainingDistance) : fPosX;
+    fMinX -= bullet.getAreaDamageSize();
+    fMaxX += bullet.getAreaDamageSize();
+}
+
+/**
+* Sends bullet create message to clients to whom the bullet is relevant, and who have not yet been informed about it.
+* The owner of the bullet is always informed, since firing sound and reload sound handling on client-side depends on this message.
+* 
+* @param bullet   The bullet to be created on client-side.
+* @param fPosX    Horizontal position to be sent to clients.
+* @param fPosY    Vertical position to be sent to clients.
+* @param bNewborn True if the bullet was just fired, false if it is a late create for a client who just got close to the bullet.
+*                 For late create, clients start simulating the bullet from its current position, and for bouncing bullets the client-side
+*                 trajectory might slightly differ from server-side trajectory since client starts with initial gravity. This is only visual,
+*                 since server still tells when the bullet is deleted.
+*/
+void proofps_dd::WeaponHandling::serverSendBulletCreateToRelevantClients(
+    const PooledBullet& bullet,
+    const float& fPosX,
+    const float& fPosY,
+    const bool& bNewborn)
+{
+    float fMinX, fMaxX;
+    getBulletRemainingPathRangeX(bullet, fPosX, fMinX, fMaxX);
+
+    pge_network::PgePacket newPktBulletUpdate;
+    bool bPktInitialized = false;
+    for (const auto& playerPair : m_mapPlayers)
+    {
+        const pge_network::PgeNetworkConnectionHandle& connHandle = playerPair.first;
+        if (connHandle == pge_network::ServerConnHandle)
+        {
+            // server never sends to itself
+            continue;
+        }
+
+        if (m_interestManagement.isBulletKnownByClient(bullet.getId(), connHandle))
+        {
+            continue;
+        }
+
+        if (!(bNewborn && (connHandle == bullet.getOwner())) && !m_interestManagement.isRelevantForClient(connHandle, fMinX, fMaxX))
+        {
+            continue;
+        }
+
+        if (!bPktInitialized)
+        {
+            bPktInitialized = true;
+            proofps_dd::MsgBulletUpdateFromServer::initPkt(
+                newPktBulletUpdate,
+                bullet.getOwner(),
+                bullet.getId(),
+                bullet.getWeaponId(),
+                fPosX,
+                fPosY,
+                /* these should be also original values but they are NOT altered by bullet.update() so they actually stay original */
+                bullet.getObject3D().getPosVec().getZ(),
+                bullet.getObject3D().getAngleVec().getX(),
+                bullet.getObject3D().getAngleVec().getY(),
+                bullet.getObject3D().getAngleVec().getZ(),
+                bullet.getDamageHp(),
+                bullet.getAreaDamageSize(),
+                bullet.getAreaDamageEffect(),
+                bullet.getAreaDamagePulse(),
+                bNewborn);
+        }
+
+        MsgTrafficStats::serverSend(m_pge.getNetwork(), newPktBulletUpdate, connHandle);
+        m_interestManagement.setBulletKnownByClient(bullet.getId(), connHandle);
+    }
+}
+
+/**
+* Sends bullet delete message to clients who know about the bullet, and also to clients to whom the delete position is relevant.
+* The latter is needed because the delete message might also trigger explosion or melee hit sound on client-side, even if they have
+* never received the bullet create message (e.g. bullet hit a player immediately at birth).
+*/
+void proofps_dd::WeaponHandling::serverSendBulletDeleteToRelevantClients(
+    pge_network::PgePacket& pktBulletDelete,
+    const PooledBullet& bullet)
+{
+    const float fPosX = bullet.getObject3D().getPosVec().getX();
+    for (const auto& playerPair : m_mapPlayers)
+    {
+        const pge_network::PgeNetworkConnectionHandle& connHandle = playerPair.first;
+        if (connHandle == pge_network::ServerConnHandle)
+        {
+            // server never sends to itself
+            continue;
+        }
+
+        if (m_interestManagement.isBulletKnownByClient(bullet.getId(), connHandle) ||
+            m_interestManagement.isRelevantForClient(
+                connHandle, fPosX - bullet.getAreaDamageSize(), fPosX + bullet.getAreaDamageSize()))
+        {
+            MsgTrafficStats::serverSend(m_pge.getNetwork(), pktBulletDelete, connHandle);
+        }
+    }
+
+    m_interestManagement.forgetBullet(bullet.getId());
+}
+
+/**
+* Weapon properties needed for creating and handling bullets, parsed from the weapon files by initializeWeaponHandling().
+* 
+* @return Nullptr if the weapon id is unknown, or weapon ids are not yet bound by bindWeaponDefinitions().
+*/
+const proofps_dd::WeaponDefinition* proofps_dd::WeaponHandling::getWeaponDefinition(const WeaponId& wpnId) const
+{
+    return m_weaponDefinitions.find(wpnId);
+}
+
+/**
+* Same as getWeaponDefinition(wpnId) but for a player's own weapon, available even before weapon ids are bound.
+* 
+* @return Nullptr if the weapon was not loaded from any of the weapon files parsed by initializeWeaponHandling().
+*/
+const proofps_dd::WeaponDefinition* proofps_dd::WeaponHandling::getWeaponDefinition(const Weapon& wpn) const
+{
+    return m_weaponDefinitions.findByFilename(wpn.getFilename());
 }
 
 void proofps_dd::WeaponHandling::play3dMeleeWeaponHitSound(
@@ -2079,21 +2477,27 @@ void proofps_dd::WeaponHandling::play3dMeleeWeaponHitSound(
     assert(hitType != proofps_dd::MsgBulletUpdateFromServer::BulletDelete::No);
     assert(hitType != proofps_dd::MsgBulletUpdateFromServer::BulletDelete::Yes);
 
-    // just for playing sound, let's use any WeaponManager to retrieve weapon, even tho it is not their bullet, it doesnt matter now!
-    Weapon* const wpnForSound = getWeaponByIdFromAnyPlayersWeaponManager(wpnId);
-    if (!wpnForSound)
+    const WeaponDefinition* const pWpnDef = getWeaponDefinition(wpnId);
+    if (!pWpnDef || (pWpnDef->m_eType != Weapon::Type::Melee))
     {
         return;
     }
 
-    if (wpnForSound && (wpnForSound->getType() == Weapon::Type::Melee))
+    SoLoud::Wav* const pSnd =
+        (hitType == proofps_dd::MsgBulletUpdateFromServer::BulletDelete::YesHitPlayer) ?
+        pWpnDef->m_sndDamagePlayer.get() :
+        pWpnDef->m_sndDamageWall.get();
+    if (!pSnd)
     {
-        const auto handleSndHit = m_pge.getAudio().play3dSound(
-            ((hitType == proofps_dd::MsgBulletUpdateFromServer::BulletDelete::YesHitPlayer) ? wpnForSound->getPlayerHitSound() : wpnForSound->getWallHitSound()),
-            posX, posY, posZ);
-        m_pge.getAudio().getAudioEngineCore().set3dSourceMinMaxDistance(handleSndHit, SndMeleeWpnBulletHitDistMin, SndMeleeWpnBulletHitDistMax);
-        m_pge.getAudio().getAudioEngineCore().set3dSourceAttenuation(handleSndHit, SoLoud::AudioSource::ATTENUATION_MODELS::LINEAR_DISTANCE, 1.f);
+        return;
     }
+
+    play3dSoundWithVoiceLimit(
+        SoundVoiceManager::SoundClass::MeleeHit,
+        *pSnd,
+        posX, posY, posZ,
+        SndMeleeWpnBulletHitDistMin,
+        SndMeleeWpnBulletHitDistMax);
 }
 
 void proofps_dd::WeaponHandling::play3dMeleeWeaponHitSound(const WeaponId& wpnId, const PureVector& posVec, const proofps_dd::MsgBulletUpdateFromServer::BulletDelete& hitType)
@@ -2108,21 +2512,55 @@ void proofps_dd::WeaponHandling::play3dMeleeWeaponHitSound(const Bullet& bullet,
 
 void proofps_dd::WeaponHandling::play3dBulletBounceSound(const Bullet& bullet)
 {
-    // just for playing sound, let's use any WeaponManager to retrieve weapon, even tho it is not their bullet, it doesnt matter now!
-    Weapon* const wpnForSound = getWeaponByIdFromAnyPlayersWeaponManager(bullet.getWeaponId());
-    if (!wpnForSound)
+    const WeaponDefinition* const pWpnDef = getWeaponDefinition(bullet.getWeaponId());
+    if (!pWpnDef || !pWpnDef->m_sndBulletBounce || !bullet.canBounce())
     {
         return;
     }
 
-    if (wpnForSound && (bullet.canBounce()))
+    play3dSoundWithVoiceLimit(
+        SoundVoiceManager::SoundClass::BulletBounce,
+        *(pWpnDef->m_sndBulletBounce),
+        bullet.getPut().getPosVec().getX(),
+        bullet.getPut().getPosVec().getY(),
+        bullet.getPut().getPosVec().getZ(),
+        SndBulletBounceDistMin,
+        SndBulletBounceDistMax);
+}
+
+/**
+* Plays the given sound at the given position with linear distance attenuation, unless it would not be heard from the
+* listener's position, or too many closer sounds of the same class are already playing, see SoundVoiceManager.
+*
+* @return Handle of the started voice, 0 if no voice was started.
+*/
+SoLoud::handle proofps_dd::WeaponHandling::play3dSoundWithVoiceLimit(
+    const SoundVoiceManager::SoundClass& eSoundClass,
+    SoLoud::Wav& snd,
+    const float& posX,
+    const float& posY,
+    const float& posZ,
+    const float& fDistMin,
+    const float& fDistMax)
+{
+    // the 3D listener is always at the camera, see CameraHandling::cameraUpdatePosAndAngle()
+    const PureVector& vecListenerPos = m_pge.getPure().getCamera().getPosVec();
+    const float fDistanceToListener = std::sqrt(
+        (posX - vecListenerPos.getX()) * (posX - vecListenerPos.getX()) +
+        (posY - vecListenerPos.getY()) * (posY - vecListenerPos.getY()) +
+        (posZ - vecListenerPos.getZ()) * (posZ - vecListenerPos.getZ()));
+
+    auto& audioEngineCore = m_pge.getAudio().getAudioEngineCore();
+    if (!m_soundVoiceManager.reserveVoice(audioEngineCore, eSoundClass, fDistanceToListener, fDistMax))
     {
-        const auto handleSndBounce = m_pge.getAudio().play3dSound(
-            wpnForSound->getBulletBounceSound(),
-            bullet.getPut().getPosVec());
-        m_pge.getAudio().getAudioEngineCore().set3dSourceMinMaxDistance(handleSndBounce, SndBulletBounceDistMin, SndBulletBounceDistMax);
-        m_pge.getAudio().getAudioEngineCore().set3dSourceAttenuation(handleSndBounce, SoLoud::AudioSource::ATTENUATION_MODELS::LINEAR_DISTANCE, 1.f);
+        return 0;
     }
+
+    const auto handleSnd = m_pge.getAudio().play3dSound(snd, posX, posY, posZ);
+    audioEngineCore.set3dSourceMinMaxDistance(handleSnd, fDistMin, fDistMax);
+    audioEngineCore.set3dSourceAttenuation(handleSnd, SoLoud::AudioSource::ATTENUATION_MODELS::LINEAR_DISTANCE, 1.f);
+    m_soundVoiceManager.addVoice(eSoundClass, handleSnd, fDistanceToListener);
+    return handleSnd;
 }
 
 bool proofps_dd::WeaponHandling::canBulletHitPerFriendlyFireConfig(
@@ -2375,20 +2813,72 @@ void proofps_dd::WeaponHandling::emitParticles(PooledBullet& bullet)
     if ((bullet.getParticleType() == Bullet::ParticleType::Smoke) && (m_config.getSmokeConfigAmount() != Smoke::SmokeConfigAmount::None))
     {
         // generate smoke, note this should be in bullet.update() on the long run
-        bullet.getParticleEmitPerNthPhysicsIterationCntr()++;
         assert(static_cast<int>(m_config.getSmokeConfigAmount()) < static_cast<int>(Smoke::smokeEmitOperValues.size()));
-        if (bullet.getParticleEmitPerNthPhysicsIterationCntr() >= Smoke::smokeEmitOperValues[static_cast<int>(m_config.getSmokeConfigAmount())].m_nEmitInEveryNPhysicsIteration)
+        const PureVector& vecCamPos = m_pge.getPure().getCamera().getPosVec();
+        const int nEmitInEveryNPhysicsIteration = SmokeBudget::getEmitInterval(
+            Smoke::smokeEmitOperValues[static_cast<int>(m_config.getSmokeConfigAmount())].m_nEmitInEveryNPhysicsIteration,
+            bullet.getPut().getPosVec().getX(),
+            bullet.getPut().getPosVec().getY(),
+            vecCamPos.getX(),
+            vecCamPos.getY());
+        if (nEmitInEveryNPhysicsIteration == 0)
+        {
+            // too far from the camera, the trail would not be seen anyway
+            bullet.getParticleEmitPerNthPhysicsIterationCntr() = 0;
+            return;
+        }
+
+        bullet.getParticleEmitPerNthPhysicsIterationCntr()++;
+        if (bullet.getParticleEmitPerNthPhysicsIterationCntr() >= nEmitInEveryNPhysicsIteration)
         {
             bullet.getParticleEmitPerNthPhysicsIterationCntr() = 0;
-            m_smokes.create(
+            if (!makeRoomForSmoke())
+            {
+                return;
+            }
+
+            Smoke* const pSmoke = m_smokes.create(
                 bullet.getPut(),
                 (bullet.getObject3D().getAngleVec().getY() == 0.f) /* goingLeft, otherwise it would be 180.f */,
                 1.f, 1.f, 1.f /* rgb as floats */,
                 0.6f, 0.6f, 0.3f /* rgb as floats */);
+            if (pSmoke)
+            {
+                m_smokesActive.add(*pSmoke);
+            }
         }
     }
 }
 
+/**
+* Frees the oldest smokes if the number of live smokes reached the limit defined by SmokeBudget for the current smoke amount config,
+* so newly emitted smoke is never lost, old smoke disappears a bit earlier instead.
+*
+* @return True if a new smoke can be created, false otherwise.
+*/
+bool proofps_dd::WeaponHandling::makeRoomForSmoke()
+{
+    const size_t nLiveSmokesMax = std::min(SmokeBudget::getLiveSmokesMax(m_config.getSmokeConfigAmount()), m_smokes.capacity());
+    if (m_smokes.size() < nLiveSmokesMax)
+    {
+        return true;
+    }
+
+    // smokes emitted by players are not yet in the list, but they count in the budget, so they can be evicted too
+    m_smokesActive.sync(m_smokes);
+
+    // bullet smokes are added to the list in order of creation, so the first ones are the oldest ones, except right after a full sync
+    // when pool order is used, but that is still good enough for choosing smokes to be freed a bit earlier
+    size_t nSmokesToEvict = m_smokes.size() - nLiveSmokesMax + 1;
+    for (size_t i = 0; (i < m_smokesActive.size()) && (nSmokesToEvict > 0); i++, nSmokesToEvict--)
+    {
+        m_smokesActive[i].remove(); // becomes free again in the pool
+    }
+    m_smokesActive.compact();
+
+    return m_smokes.size() < m_smokes.capacity();
+}
+
 
 /**
 * Used before v0.5.
@@ -2464,3 +2954,165 @@ const PureObject3D* proofps_dd::WeaponHandling::sharedUpdateBullets_collisionWit
     
     return m_maps.getBVH().findOneColliderObject_startFromFirstNode(aabbBullet, nullptr);
 } // sharedUpdateBullets_collisionWithWalls_bvh()
+
+/**
+* Used by both server- and client-instances.
+* Finds the first wall (foreground block) hit by the bullet moving along a straight line from its old to its current position in this tick.
+* Unlike the collision functions above testing only the current position, this cannot miss a thin wall even if the bullet moved more than
+* the wall's size, so fast bullets are handled correctly even with lower physics rate.
+* Walls already touched at the old position are ignored: the bullet is moving along or away from them, that is handled by the per-axis logic
+* in sharedUpdateBouncingBullets() and sharedUpdateRicochetingBullets().
+*
+* @param fHitTime Set to the fraction of the movement in (0, 1] where the bullet first touches the returned wall.
+*
+* @return The first wall hit along the movement, nullptr if no wall was hit.
+*/
+const PureObject3D* proofps_dd::WeaponHandling::sharedUpdateBullets_sweptCollisionWithWalls(
+    const bool& bCollisionModeBvh,
+    const PurePosUpTarget& oldPut,
+    const BulletBounds& bulletBounds,
+    float& fHitTime)
+{
+    const PureObject3D* pFirstWallHit = nullptr;
+    fHitTime = 1.f;
+
+    if (bCollisionModeBvh)
+    {
+        // a single query with the box covering the whole path gives all walls we might hit
+        const float fOldPosX = oldPut.getPosVec().getX();
+        const float fOldPosY = oldPut.getPosVec().getY();
+        const PureAxisAlignedBoundingBox aabbPath(
+            PureVector((fOldPosX + bulletBounds.m_fPosX) / 2.f, (fOldPosY + bulletBounds.m_fPosY) / 2.f, bulletBounds.m_fPosZ),
+            PureVector(
+                std::abs(bulletBounds.m_fPosX - fOldPosX) + bulletBounds.m_fSizeX,
+                std::abs(bulletBounds.m_fPosY - fOldPosY) + bulletBounds.m_fSizeY,
+                bulletBounds.m_fSizeZ));
+        m_vecWallCandidatesSwept.clear();
+        m_maps.getBVH().findAllColliderObjects_startFromFirstNode(aabbPath, nullptr, m_vecWallCandidatesSwept);
+        for (const PureObject3D* const pWall : m_vecWallCandidatesSwept)
+        {
+            sharedUpdateBullets_sweptCollisionWithWall(*pWall, oldPut, bulletBounds, pFirstWallHit, fHitTime);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < m_maps.getForegroundBlockCount(); i++)
+        {
+            sharedUpdateBullets_sweptCollisionWithWall(*(m_maps.getForegroundBlocks()[i]), oldPut, bulletBounds, pFirstWallHit, fHitTime);
+        }
+    }
+
+    return pFirstWallHit;
+} // sharedUpdateBullets_sweptCollisionWithWalls()
+
+/**
+* Helper for sharedUpdateBullets_sweptCollisionWithWalls(), updates the first wall hit if the given wall is hit earlier.
+*/
+void proofps_dd::WeaponHandling::sharedUpdateBullets_sweptCollisionWithWall(
+    const PureObject3D& wall,
+    const PurePosUpTarget& oldPut,
+    const BulletBounds& bulletBounds,
+    const PureObject3D*& pFirstWallHit,
+    float& fFirstWallHitTime)
+{
+    const float fWallPosX = wall.getPosVec().getX();
+    const float fWallPosY = wall.getPosVec().getY();
+    const float fWallSizeX = wall.getSizeVec().getX();
+    const float fWallSizeY = wall.getSizeVec().getY();
+
+    float fHitTime = 1.f;
+    if (!colliding2_NoZ_swept(
+        oldPut.getPosVec().getX(), oldPut.getPosVec().getY(), bulletBounds.m_fPosX, bulletBounds.m_fPosY, bulletBounds.m_fSizeX, bulletBounds.m_fSizeY,
+        fWallPosX, fWallPosY, fWallSizeX, fWallSizeY,
+        fHitTime))
+    {
+        return;
+    }
+
+    if ((fHitTime == 0.f) &&
+        colliding2_NoZ(
+            oldPut.getPosVec().getX(), oldPut.getPosVec().getY(), bulletBounds.m_fSizeX, bulletBounds.m_fSizeY,
+            fWallPosX, fWallPosY, fWallSizeX, fWallSizeY))
+    {
+        // already touching at the old position
+        return;
+    }
+
+    if (!pFirstWallHit || (fHitTime < fFirstWallHitTime))
+    {
+        pFirstWallHit = &wall;
+        fFirstWallHitTime = fHitTime;
+    }
+}
+
+/**
+* Used by both server- and client-instances.
+* Moves the bullet back to the given fraction of its movement in this tick, keeping its direction.
+*
+* @param fTime        Fraction of the movement from the old position, in [0, 1].
+* @param bulletBounds Current bounds of the bullet, its position is also updated.
+*/
+void proofps_dd::WeaponHandling::sharedMoveBulletBackAlongPath(
+    PooledBullet& bullet,
+    const PurePosUpTarget& oldPut,
+    const float& fTime,
+    BulletBounds& bulletBounds)
+{
+    const float fNewPosX = oldPut.getPosVec().getX() + (bulletBounds.m_fPosX - oldPut.getPosVec().getX()) * fTime;
+    const float fNewPosY = oldPut.getPosVec().getY() + (bulletBounds.m_fPosY - oldPut.getPosVec().getY()) * fTime;
+    const float fDeltaX = fNewPosX - bulletBounds.m_fPosX;
+    const float fDeltaY = fNewPosY - bulletBounds.m_fPosY;
+
+    // target is moved together with position, otherwise the direction would change
+    PurePosUpTarget& put = bullet.getPut();
+    put.getPosVec().Set(put.getPosVec().getX() + fDeltaX, put.getPosVec().getY() + fDeltaY, put.getPosVec().getZ());
+    put.getTargetVec().Set(put.getTargetVec().getX() + fDeltaX, put.getTargetVec().getY() + fDeltaY, put.getTargetVec().getZ());
+    bullet.getObject3D().getPosVec().Set(fNewPosX, fNewPosY, bulletBounds.m_fPosZ);
+
+    bulletBounds.m_fPosX = fNewPosX;
+    bulletBounds.m_fPosY = fNewPosY;
+}
+
+/**
+* Used by both server- and client-instances.
+* Bouncing and ricocheting logic detects walls by overlapping at the bullet's current position. If the bullet passed through the given wall
+* in this tick without ending up in it, the bullet is moved back into the wall, halfway between where it entered and where it left the wall,
+* so that logic handles the hit as if the bullet simply ended up in the wall.
+*
+* @param fHitTime     As returned by sharedUpdateBullets_sweptCollisionWithWalls() for the given wall.
+* @param bulletBounds Current bounds of the bullet, its position is also updated.
+*/
+void proofps_dd::WeaponHandling::sharedMoveBulletIntoWallIfTunnelled(
+    PooledBullet& bullet,
+    const PurePosUpTarget& oldPut,
+    const PureObject3D& wall,
+    const float& fHitTime,
+    BulletBounds& bulletBounds)
+{
+    const float fWallPosX = wall.getPosVec().getX();
+    const float fWallPosY = wall.getPosVec().getY();
+    const float fWallSizeX = wall.getSizeVec().getX();
+    const float fWallSizeY = wall.getSizeVec().getY();
+
+    if (colliding2_NoZ(
+        bulletBounds.m_fPosX, bulletBounds.m_fPosY, bulletBounds.m_fSizeX, bulletBounds.m_fSizeY,
+        fWallPosX, fWallPosY, fWallSizeX, fWallSizeY))
+    {
+        // not tunnelled
+        return;
+    }
+
+    // sweeping backwards tells where the bullet left the wall
+    float fHitTimeBackwards = 0.f;
+    if (!colliding2_NoZ_swept(
+        bulletBounds.m_fPosX, bulletBounds.m_fPosY, oldPut.getPosVec().getX(), oldPut.getPosVec().getY(), bulletBounds.m_fSizeX, bulletBounds.m_fSizeY,
+        fWallPosX, fWallPosY, fWallSizeX, fWallSizeY,
+        fHitTimeBackwards))
+    {
+        // cannot happen since forward sweep found the wall
+        assert(false);
+        return;
+    }
+
+    sharedMoveBulletBackAlongPath(bullet, oldPut, (fHitTime + (1.f - fHitTimeBackwards)) / 2.f, bulletBounds);
+}
@@ -9,6 +9,10 @@
     ###################################################################################
 */
 
+#include <chrono>
+#include <map>
+#include <vector>
+
 #include "CConsole.h"
 
 #include "PGE.h"
@@ -19,12 +23,18 @@
 #include "Explosion.h"
 #include "GameMode.h"
 #include "GUI.h"
+#include "InterestManagement.h"
 #include "Maps.h"
 #include "Physics.h"
 #include "Player.h"
+#include "PlayerSpatialIndex.h"
+#include "PooledObjectActiveList.h"
 #include "PRooFPS-dd-packet.h"
 #include "Smoke.h"
+#include "SmokeBudget.h"
+#include "SoundVoiceManager.h"
 #include "Sounds.h"
+#include "WeaponDefinitions.h"
 
 namespace proofps_dd
 {
@@ -100,6 +110,7 @@ namespace proofps_dd
 
     protected:
 
+        bool bindWeaponDefinitions(WeaponManager& wpnMgr);
         void deleteWeaponHandlingAll(const bool& bDeallocBullets);
 
         void serverUpdateWeapons(proofps_dd::GameMode& gameMode);
@@ -124,6 +135,7 @@ namespace proofps_dd
             proofps_dd::GameMode& gameMode,
             const unsigned int& nPhysicsRate);
         void updateSmokes(proofps_dd::GameMode& gameMode, const unsigned int& nPhysicsRate);
+        void serverRemoveClientFromInterestManagement(const pge_network::PgeNetworkConnectionHandle& connHandleServerSide);
         
         bool handleBulletUpdateFromServer(
             pge_network::PgeNetworkConnectionHandle connHandleServerSide,
@@ -151,6 +163,32 @@ namespace proofps_dd
 
     private:
 
+        static constexpr unsigned int nWeaponMomentaryAccuracySetIntervalMillisecs = 66;  /**< Used by server only, same as every 4th frame at 60 FPS. */
+
+        /** Server-only: bullet fired by a lagging player, hit-tested against rewound player hitboxes in the first ticks of its life. */
+        struct LagCompensatedBullet
+        {
+            std::uint32_t m_nFiredAtServerTick;
+            std::uint32_t m_nRewindTicks;
+        };
+
+        /**
+        * Position and scaled size of a bullet's 3D object after its update in the current tick, passed to the swept collision functions.
+        * This is just a copy: the bullet's 3D object, moved by the engine, is still the source of truth, so functions moving the bullet
+        * shall update both.
+        */
+        struct BulletBounds
+        {
+            float m_fPosX;
+            float m_fPosY;
+            float m_fPosZ;
+            float m_fSizeX;  /**< Scaled size. */
+            float m_fSizeY;
+            float m_fSizeZ;
+        };
+
+        static void captureBulletBounds(const PooledBullet& bullet, BulletBounds& bulletBounds);
+
         static float getDamageAndImpactForceAtDistance(
             const float& fNearObjX,
             const float& fNearObjY,
@@ -175,8 +213,20 @@ namespace proofps_dd
         SoLoud::handle m_sndWpnReloadStartHandle;
         SoLoud::handle m_sndWpnReloadEndHandle;
 
-        std::list<Explosion> m_explosions;
+        PgeObjectPool<Explosion> m_explosions;
         PgeObjectPool<Smoke> m_smokes;
+        PooledObjectActiveList<PooledBullet> m_bulletsActive;  /**< Used elements of m_pge.getBullets(), so hot loops don't walk the whole pool. */
+        PooledObjectActiveList<Explosion> m_explosionsActive;  /**< Used elements of m_explosions. */
+        PooledObjectActiveList<Smoke> m_smokesActive;          /**< Used elements of m_smokes. */
+        WeaponDefinitions m_weaponDefinitions;                 /**< Loaded by initializeWeaponHandling(), bound to weapon ids by bindWeaponDefinitions(). */
+        PlayerSpatialIndex m_playerSpatialIndex;               /**< Used by server only, rebuilt by serverRebuildPlayerSpatialIndex() before bullets might explode. */
+        std::vector<pge_network::PgeNetworkConnectionHandle> m_vecExplosionCandidatePlayers;  /**< Used by server only, reused by createExplosionServer(). */
+        std::vector<PooledBullet*> m_vecChainDetonationQueue;  /**< Used by server only, fragile bullets caught by explosions, drained by deleteBulletServer(). */
+        InterestManagement m_interestManagement;  /**< Used by server only. */
+        SoundVoiceManager m_soundVoiceManager;    /**< Limits voices started by play3dSoundWithVoiceLimit(). */
+        std::map<Bullet::BulletId, LagCompensatedBullet> m_mapLagCompensatedBullets;  /**< Used by server only. */
+        std::vector<const PureObject3D*> m_vecWallCandidatesSwept;  /**< Reused by sharedUpdateBullets_sweptCollisionWithWalls() to avoid allocations. */
+        std::chrono::time_point<std::chrono::steady_clock> m_timeLastWeaponMomentaryAccuracySet{};  /**< Used by server only, see serverUpdateWeapons(). */
         bool m_bWpnAutoReloadRequest = false;
         bool m_bWpnAutoSwitchToBestLoadedRequest = false;
         bool m_bWpnAutoSwitchToBestWithAnyKindOfAmmoRequest = false;
@@ -191,9 +241,17 @@ namespace proofps_dd
         // has been already deleted! Result: undefined behavior, sooner or later crash.
         Weapon* m_pWpnAutoSwitchWhenPickedUp = nullptr;
 
-        blIteratorAPI::blRawArrayWrapper<PooledBullet>::iterator deleteBulletServer(
-            PgeObjectPool<PooledBullet>& bullets,
-            blIteratorAPI::blRawArrayWrapper<PooledBullet>::iterator itBullet,
+        void serverRebuildPlayerSpatialIndex();
+        void deleteBulletServer(
+            PooledBullet& bullet,
+            const bool& bPlayerHit,
+            const bool& bWallHit,
+            XHair& xhair,
+            PureVector& vecCamShakeForce,
+            proofps_dd::GameMode& gameMode,
+            const bool& bEndGame);
+        void deleteBulletServerSingle(
+            PooledBullet& bullet,
             const bool& bPlayerHit,
             const bool& bWallHit,
             XHair& xhair,
@@ -210,20 +268,20 @@ namespace proofps_dd
             const int& nDamageHp,
             PureVector& vecImpactForce);
         
-        Explosion& createExplosionServer(
+        Explosion* createExplosionServer(
             const PooledBullet& causedByBullet,
             const pge_network::PgeNetworkConnectionHandle& connHandle,
             const PureVector& pos,
             const TPureFloat& fDamageAreaSize,
             const Bullet::DamageAreaEffect& eDamageAreaEffect,
             const TPureFloat& fDamageAreaPulse,
-            const std::string& sExplosionGfxObjFilename,
+            const ExplosionObjRefId& explosionRefId,
             const int& nDamageAp,
             const int& nDamageHp,
             XHair& xhair,
             PureVector& vecCamShakeForce,
             proofps_dd::GameMode& gameMode);
-        Explosion& createExplosionClient(
+        Explosion* createExplosionClient(
             const proofps_dd::Explosion::ExplosionId& id,
             const pge_network::PgeNetworkConnectionHandle& connHandle,
             const PureVector& pos,
@@ -231,11 +289,28 @@ namespace proofps_dd
             const TPureFloat& fDamageAreaSize,
             const Bullet::DamageAreaEffect& eDamageAreaEffect,
             const TPureFloat& fDamageAreaPulse,
-            const std::string& sExplosionGfxObjFilename,
+            const ExplosionObjRefId& explosionRefId,
             PureVector& vecCamShakeForce);
+        bool evictOldestExplosion();
 
         bool isBulletOutOfMapBounds(const Bullet& bullet) const;
-        Weapon* getWeaponByIdFromAnyPlayersWeaponManager(const WeaponId& wpnId);
+        std::uint32_t serverGetBulletRewindTicks(const PooledBullet& bullet, const std::uint32_t& nCurrentServerTick);
+        void serverUpdateInterestManagementClientViews();
+        void getBulletRemainingPathRangeX(
+            const PooledBullet& bullet,
+            const float& fPosX,
+            float& fMinX,
+            float& fMaxX) const;
+        void serverSendBulletCreateToRelevantClients(
+            const PooledBullet& bullet,
+            const float& fPosX,
+            const float& fPosY,
+            const bool& bNewborn);
+        void serverSendBulletDeleteToRelevantClients(
+            pge_network::PgePacket& pktBulletDelete,
+            const PooledBullet& bullet);
+        const WeaponDefinition* getWeaponDefinition(const WeaponId& wpnId) const;
+        const WeaponDefinition* getWeaponDefinition(const Weapon& wpn) const;
         void play3dMeleeWeaponHitSound(
             const WeaponId& wpnId,
             const float& posX,
@@ -245,6 +320,14 @@ namespace proofps_dd
         void play3dMeleeWeaponHitSound(const WeaponId& wpnId, const PureVector& posVec, const proofps_dd::MsgBulletUpdateFromServer::BulletDelete& hitType);
         void play3dMeleeWeaponHitSound(const Bullet& bullet, const proofps_dd::MsgBulletUpdateFromServer::BulletDelete& hitType);
         void play3dBulletBounceSound(const Bullet& bullet);
+        SoLoud::handle play3dSoundWithVoiceLimit(
+            const SoundVoiceManager::SoundClass& eSoundClass,
+            SoLoud::Wav& snd,
+            const float& posX,
+            const float& posY,
+            const float& posZ,
+            const float& fDistMin,
+            const float& fDistMax);
         bool canBulletHitPerFriendlyFireConfig(
             const Player& playerHit,
             const std::map<pge_network::PgeNetworkConnectionHandle, proofps_dd::Player>::iterator& itShooter) const;
@@ -276,6 +359,7 @@ namespace proofps_dd
             const float& fFallGravityMin);
 
         void emitParticles(PooledBullet& bullet);
+        bool makeRoomForSmoke();
 
         const PureObject3D* sharedUpdateBullets_collisionWithWalls_legacy(
             const PooledBullet& bullet,
@@ -292,6 +376,32 @@ namespace proofps_dd
             const float& fBulletScaledSizeY,
             const float& fBulletScaledSizeZ);
 
+        const PureObject3D* sharedUpdateBullets_sweptCollisionWithWalls(
+            const bool& bCollisionModeBvh,
+            const PurePosUpTarget& oldPut,
+            const BulletBounds& bulletBounds,
+            float& fHitTime);
+
+        static void sharedUpdateBullets_sweptCollisionWithWall(
+            const PureObject3D& wall,
+            const PurePosUpTarget& oldPut,
+            const BulletBounds& bulletBounds,
+            const PureObject3D*& pFirstWallHit,
+            float& fFirstWallHitTime);
+
+        void sharedMoveBulletBackAlongPath(
+            PooledBullet& bullet,
+            const PurePosUpTarget& oldPut,
+            const float& fTime,
+            BulletBounds& bulletBounds);
+
+        void sharedMoveBulletIntoWallIfTunnelled(
+            PooledBullet& bullet,
+            const PurePosUpTarget& oldPut,
+            const PureObject3D& wall,
+            const float& fHitTime,
+            BulletBounds& bulletBounds);
+
     }; // class WeaponHandling
 
 } // namespace proofps_dd
\ No newline at end of file